@@ -31,19 +31,120 @@ UWorld* UDialogue::GetWorld() const
 	}
 }
 
-FDialogueNode UDialogue::GetNodeById(int32 id, int32 & index)
+void UDialogue::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileGraph();
+}
+
+void UDialogue::CompileGraph() const
+{
+	int32 MaxId = -1;
+	for (const FDialogueNode& Node : Data)
+	{
+		MaxId = FMath::Max(MaxId, Node.id);
+	}
+
+	NodeIndexById.Reset();
+	NodeIndexById.Init(INDEX_NONE, MaxId + 1);
+	for (int32 i = 0; i < Data.Num(); i++)
+	{
+		if (Data[i].id >= 0)
+		{
+			NodeIndexById[Data[i].id] = i;
+		}
+	}
+
+	LinkOffsets.Reset(Data.Num() + 1);
+	LinkedNodeIndices.Reset();
+	for (const FDialogueNode& Node : Data)
+	{
+		LinkOffsets.Add(LinkedNodeIndices.Num());
+		for (int32 LinkedId : Node.Links)
+		{
+			const int32 LinkedIndex = NodeIndexById.IsValidIndex(LinkedId) ? NodeIndexById[LinkedId] : INDEX_NONE;
+			if (LinkedIndex != INDEX_NONE)
+			{
+				LinkedNodeIndices.Add(LinkedIndex);
+			}
+		}
+	}
+	LinkOffsets.Add(LinkedNodeIndices.Num());
+
+	bGraphCompiled = true;
+}
+
+void UDialogue::EnsureGraphCompiled()
 {
-	index = -1;
+#if WITH_EDITOR
+	// the graph editor adds, removes and relinks nodes without property change events
+	CompileGraph();
+#else
+	if (!bGraphCompiled)
+	{
+		CompileGraph();
+	}
+#endif
+}
 
-	int i = 0;
-	for (FDialogueNode FoundNode : Data)
+int32 UDialogue::FindNodeIndex(int32 Id) const
+{
+	if (NodeIndexById.IsValidIndex(Id))
 	{
-		if (FoundNode.id == id)
+		const int32 Index = NodeIndexById[Id];
+		if (Data.IsValidIndex(Index) && Data[Index].id == Id)
 		{
-			index = i;
-			return FoundNode;
+			return Index;
 		}
-		i++;
+	}
+
+	// not compiled yet, or Data was edited after compiling
+	return Data.IndexOfByPredicate([Id](const FDialogueNode& Node) { return Node.id == Id; });
+}
+
+const FDialogueNode* UDialogue::FindNode(int32 Id) const
+{
+	const int32 Index = FindNodeIndex(Id);
+	return Index != INDEX_NONE ? &Data[Index] : nullptr;
+}
+
+const FDialogueNode* UDialogue::FindFirstNode() const
+{
+	const FDialogueNode* StartNode = FindNode(0);
+	if (!StartNode || StartNode->Links.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	return FindNode(StartNode->Links[0]);
+}
+
+TConstArrayView<int32> UDialogue::GetLinkedNodeIndices(int32 NodeIndex) const
+{
+	if (!Data.IsValidIndex(NodeIndex))
+	{
+		return TConstArrayView<int32>();
+	}
+
+	if (!bGraphCompiled || LinkOffsets.Num() != Data.Num() + 1)
+	{
+		// expected while the graph editor is open, anywhere else Data was changed without recompiling
+		UE_CLOG(!GIsEditor, LogTemp, Warning, TEXT("Dialogue %s: compiled links are out of date, recompiling"), *GetName());
+		CompileGraph();
+	}
+
+	const int32 Begin = LinkOffsets[NodeIndex];
+	return TConstArrayView<int32>(LinkedNodeIndices.GetData() + Begin, LinkOffsets[NodeIndex + 1] - Begin);
+}
+
+FDialogueNode UDialogue::GetNodeById(int32 id, int32 & index)
+{
+	index = FindNodeIndex(id);
+
+	if (index != INDEX_NONE)
+	{
+		return Data[index];
 	}
 
 	FDialogueNode Empty;
@@ -65,13 +166,12 @@ FDialogueNode UDialogue::GetNodeById(int32 id, bool& found)
 	return result;
 }
 
+// Blueprint wrappers, C++ should use FindFirstNode / GetLinkedNodeIndices which don't copy nodes
 FDialogueNode UDialogue::GetFirstNode()
 {
-	FDialogueNode StartNode = GetNodeById(0);
-
-	if (StartNode.Links.Num() > 0)
+	if (const FDialogueNode* FirstNode = FindFirstNode())
 	{
-		return GetNodeById(StartNode.Links[0]);
+		return *FirstNode;
 	}
 
 	FDialogueNode Empty;
@@ -81,6 +181,7 @@ FDialogueNode UDialogue::GetFirstNode()
 TArray<FDialogueNode> UDialogue::GetNextNodes(FDialogueNode Node)
 {
 	TArray<FDialogueNode> Output;
+	Output.Reserve(Node.Links.Num());
 
 	for (int32 foundindex : Node.Links)
 	{
@@ -170,5 +271,7 @@ void UDialogue::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyCha
 			Data[index].bDrawBubbleComment = false;
 		}
 	}
+
+	CompileGraph();
 }
 #endif
\ No newline at end of file
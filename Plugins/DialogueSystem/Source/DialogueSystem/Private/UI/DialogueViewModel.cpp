@@ -26,10 +26,11 @@ void UDialogueViewModel::StartDialogueExtended(UDialogue* Dialogue, AActor* Spea
 
 	OnDialogueOpened.Broadcast();
 
-	const FDialogueNode FirstNode = Dialogue->GetFirstNode();
-	if (FirstNode.id != -1)
+	Dialogue->EnsureGraphCompiled();
+
+	if (const FDialogueNode* FirstNode = Dialogue->FindFirstNode())
 	{
-		ProcessNode(FirstNode);
+		ProcessNode(*FirstNode);
 	}
 	else
 	{
@@ -60,14 +61,15 @@ void UDialogueViewModel::ProcessNode(const FDialogueNode& Node)
 {
 	CurrentNode = Node;
 
+	const TConstArrayView<int32> NextNodeIndices = CurrentDialogue->GetLinkedNodeIndices(CurrentDialogue->FindNodeIndex(Node.id));
+
 	if (Node.isPlayer)
 	{
 		AddToHistory(Node, true);
 
-		const TArray<FDialogueNode> NextNodes = CurrentDialogue->GetNextNodes(Node);
-		if (NextNodes.Num() > 0)
+		if (NextNodeIndices.Num() > 0)
 		{
-			ProcessNode(NextNodes[0]);
+			ProcessNode(CurrentDialogue->GetNodeByIndex(NextNodeIndices[0]));
 		}
 		else
 		{
@@ -81,10 +83,10 @@ void UDialogueViewModel::ProcessNode(const FDialogueNode& Node)
 	TryEmitCinematicCue(Node.id);
 
 	TArray<FDialogueRuntimeOption> RuntimeOptions;
-	BuildRuntimeOptions(CurrentDialogue->GetNextNodes(Node), RuntimeOptions);
-	CurrentRuntimeOptions = RuntimeOptions;
+	BuildRuntimeOptions(NextNodeIndices, RuntimeOptions);
+	CurrentRuntimeOptions = MoveTemp(RuntimeOptions);
 
-	CurrentPlayerOptions.Empty();
+	CurrentPlayerOptions.Reset(CurrentRuntimeOptions.Num());
 	for (const FDialogueRuntimeOption& Option : CurrentRuntimeOptions)
 	{
 		CurrentPlayerOptions.Add(Option.Node);
@@ -119,6 +121,18 @@ void UDialogueViewModel::ShowPlayerOptions(const TArray<FDialogueNode>& Options)
 
 void UDialogueViewModel::SelectOption(int32 NodeId)
 {
+	if (!CurrentDialogue)
+	{
+		return;
+	}
+
+	// ProcessNode rebuilds the option arrays, so pass the node stored in the dialogue rather than an option copy
+	const FDialogueNode* SelectedNode = CurrentDialogue->FindNode(NodeId);
+	if (!SelectedNode)
+	{
+		return;
+	}
+
 	for (const FDialogueRuntimeOption& Option : CurrentRuntimeOptions)
 	{
 		if (Option.Node.id == NodeId)
@@ -128,7 +142,7 @@ void UDialogueViewModel::SelectOption(int32 NodeId)
 				return;
 			}
 
-			ProcessNode(Option.Node);
+			ProcessNode(*SelectedNode);
 			return;
 		}
 	}
@@ -137,7 +151,7 @@ void UDialogueViewModel::SelectOption(int32 NodeId)
 	{
 		if (Option.id == NodeId)
 		{
-			ProcessNode(Option);
+			ProcessNode(*SelectedNode);
 			return;
 		}
 	}
@@ -162,11 +176,9 @@ void UDialogueViewModel::AdvanceToNode(int32 NodeId)
 		return;
 	}
 
-	bool bFound = false;
-	const FDialogueNode NextNode = CurrentDialogue->GetNodeById(NodeId, bFound);
-	if (bFound)
+	if (const FDialogueNode* NextNode = CurrentDialogue->FindNode(NodeId))
 	{
-		ProcessNode(NextNode);
+		ProcessNode(*NextNode);
 	}
 }
 
@@ -183,12 +195,15 @@ bool UDialogueViewModel::AreNodeConditionsMet(const FDialogueNode& Node, APlayer
 	return true;
 }
 
-void UDialogueViewModel::BuildRuntimeOptions(const TArray<FDialogueNode>& CandidateNodes,
+void UDialogueViewModel::BuildRuntimeOptions(TConstArrayView<int32> CandidateNodeIndices,
 	TArray<FDialogueRuntimeOption>& OutOptions) const
 {
+	OutOptions.Reserve(CandidateNodeIndices.Num());
+
 	int32 RunningIndex = 1;
-	for (const FDialogueNode& Node : CandidateNodes)
+	for (const int32 NodeIndex : CandidateNodeIndices)
 	{
+		const FDialogueNode& Node = CurrentDialogue->GetNodeByIndex(NodeIndex);
 		const bool bConditionsMet = AreNodeConditionsMet(Node, OwningPlayer.Get());
 
 		FDialogueOptionMeta Meta;
@@ -225,7 +240,7 @@ void UDialogueViewModel::BuildRuntimeOptions(const TArray<FDialogueNode>& Candid
 
 		if (Runtime.bVisible)
 		{
-			OutOptions.Add(Runtime);
+			OutOptions.Add(MoveTemp(Runtime));
 		}
 	}
 }
@@ -252,9 +267,10 @@ TArray<FDialogueNode> UDialogueViewModel::GetValidNextNodes(const FDialogueNode&
 		return ValidNodes;
 	}
 
-	const TArray<FDialogueNode> AllNextNodes = CurrentDialogue->GetNextNodes(FromNode);
-	for (const FDialogueNode& Node : AllNextNodes)
+	const TConstArrayView<int32> NextNodeIndices = CurrentDialogue->GetLinkedNodeIndices(CurrentDialogue->FindNodeIndex(FromNode.id));
+	for (const int32 NodeIndex : NextNodeIndices)
 	{
+		const FDialogueNode& Node = CurrentDialogue->GetNodeByIndex(NodeIndex);
 		if (AreNodeConditionsMet(Node, PC))
 		{
 			ValidNodes.Add(Node);
@@ -137,6 +137,8 @@ public:
 
 	UDialogue(const FObjectInitializer& ObjectInitializer);
 
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
@@ -148,6 +150,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Dialogue)
 	TArray<FDialogueNode> GetNextNodes(FDialogueNode Node);
 
+	/*
+	* Compiled runtime form of Data: a dense id -> index table and every node's links flattened into index spans.
+	* Built on load and after property edits. The graph editor changes Data directly, so editor builds rebuild it
+	* in EnsureGraphCompiled (called when a conversation starts) and lookups verify the index before trusting it.
+	* The compiled arrays are a cache of Data, so const lookups may rebuild them.
+	*/
+	void CompileGraph() const;
+	void EnsureGraphCompiled();
+
+	/* Index of the node in Data, or INDEX_NONE */
+	int32 FindNodeIndex(int32 Id) const;
+
+	/* Pointer into Data, valid until Data is modified. Nullptr if there is no such node */
+	const FDialogueNode* FindNode(int32 Id) const;
+
+	/* First user-created node (first link of the start node), or nullptr */
+	const FDialogueNode* FindFirstNode() const;
+
+	const FDialogueNode& GetNodeByIndex(int32 NodeIndex) const { return Data[NodeIndex]; }
+
+	/* Data indices of the nodes linked from Data[NodeIndex], in link order. Links to missing nodes are dropped.
+	* Recompiles first if nodes were added or removed since the last compile */
+	TConstArrayView<int32> GetLinkedNodeIndices(int32 NodeIndex) const;
+
 	UFUNCTION(BlueprintCallable, Category = Dialogue)
 	static void CallFunctionByName(UObject* Object, FString FunctionName);
 	
@@ -184,4 +210,14 @@ public:
 	FVector2D LinkingCoords;
 	int32 LinkingFromIndex;
 	//FSlateImageBrush* bgStyle;
+
+private:
+	// Node id -> index in Data, INDEX_NONE for unused ids. Ids are never reused, so this stays dense
+	mutable TArray<int32> NodeIndexById;
+
+	// Links of Data[i] are LinkedNodeIndices[LinkOffsets[i] .. LinkOffsets[i + 1]), LinkOffsets has Data.Num() + 1 entries
+	mutable TArray<int32> LinkOffsets;
+	mutable TArray<int32> LinkedNodeIndices;
+
+	mutable bool bGraphCompiled = false;
 };
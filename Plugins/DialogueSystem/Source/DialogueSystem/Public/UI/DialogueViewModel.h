@@ -110,7 +110,7 @@ private:
 	TObjectPtr<APlayerController> OwningPlayer = nullptr;
 
 	void ProcessNode(const FDialogueNode& Node);
-	void BuildRuntimeOptions(const TArray<FDialogueNode>& CandidateNodes, TArray<FDialogueRuntimeOption>& OutOptions) const;
+	void BuildRuntimeOptions(TConstArrayView<int32> CandidateNodeIndices, TArray<FDialogueRuntimeOption>& OutOptions) const;
 	bool AreNodeConditionsMet(const FDialogueNode& Node, APlayerController* PC) const;
 	void TryEmitCinematicCue(int32 NodeId) const;
 };
@@ -0,0 +1,264 @@
+#include "UI/DialogueTextTemplate.h"
+
+namespace DialogueTextTemplate
+{
+	// Lines are short and repeat every time a conversation is reopened, flush everything past this many
+	constexpr int32 MaxCachedTemplates = 1024;
+
+	static bool IsTagNameChar(TCHAR Char)
+	{
+		return (Char >= TEXT('a') && Char <= TEXT('z')) || (Char >= TEXT('A') && Char <= TEXT('Z'))
+			|| (Char >= TEXT('0') && Char <= TEXT('9')) || Char == TEXT(',');
+	}
+
+	// Length of the opening tag starting at Start ("<word>"), or 0
+	static int32 MatchOpenTag(const FString& Source, int32 Start)
+	{
+		int32 End = Start + 1;
+		while (End < Source.Len() && IsTagNameChar(Source[End]))
+		{
+			End++;
+		}
+		return (End > Start + 1 && End < Source.Len() && Source[End] == TEXT('>')) ? End - Start + 1 : 0;
+	}
+
+	static void AddLiteral(FDialogueTextTemplate& Template, const TCHAR* Chars, int32 Num)
+	{
+		if (Num <= 0)
+		{
+			return;
+		}
+
+		if (Template.Segments.Num() == 0 || Template.Segments.Last().Type != EDialogueTextSegmentType::Literal)
+		{
+			Template.Segments.AddDefaulted_GetRef().Type = EDialogueTextSegmentType::Literal;
+		}
+		Template.Segments.Last().Text.AppendChars(Chars, Num);
+		Template.NumVisibleChars += Num;
+	}
+}
+
+TSharedRef<const FDialogueTextTemplate> FDialogueTextTemplate::Compile(const FString& Source, EDialogueTextParseFlags Flags)
+{
+	using namespace DialogueTextTemplate;
+
+	TSharedRef<FDialogueTextTemplate> Template = MakeShared<FDialogueTextTemplate>();
+
+	// First pass: variable spans [first %, second %]. A space cancels an open variable, "%%" restarts it at the second sign
+	TArray<TPair<int32, int32>> VariableSpans;
+	if (EnumHasAnyFlags(Flags, EDialogueTextParseFlags::Variables))
+	{
+		int32 FirstPercent = INDEX_NONE;
+		for (int32 i = 0; i < Source.Len(); i++)
+		{
+			if (Source[i] == TEXT('%'))
+			{
+				if (FirstPercent == INDEX_NONE || FirstPercent + 1 == i)
+				{
+					FirstPercent = i;
+				}
+				else
+				{
+					VariableSpans.Emplace(FirstPercent, i);
+					FirstPercent = INDEX_NONE;
+				}
+			}
+			else if (Source[i] == TEXT(' '))
+			{
+				FirstPercent = INDEX_NONE;
+			}
+		}
+	}
+
+	// Second pass: segments
+	const bool bRichText = EnumHasAnyFlags(Flags, EDialogueTextParseFlags::RichText);
+	bool bTagOpen = false;
+	int32 NextSpan = 0;
+	int32 LiteralStart = 0;
+	int32 i = 0;
+
+	auto FlushLiteral = [&Template, &Source, &LiteralStart](int32 End)
+	{
+		AddLiteral(*Template, *Source + LiteralStart, End - LiteralStart);
+	};
+
+	while (i < Source.Len())
+	{
+		// skip spans that started inside a tag
+		while (VariableSpans.IsValidIndex(NextSpan) && VariableSpans[NextSpan].Key < i)
+		{
+			NextSpan++;
+		}
+
+		if (VariableSpans.IsValidIndex(NextSpan) && VariableSpans[NextSpan].Key == i)
+		{
+			FlushLiteral(i);
+
+			const int32 SpanEnd = VariableSpans[NextSpan].Value;
+			FDialogueTextSegment& Segment = Template->Segments.AddDefaulted_GetRef();
+			Segment.Type = EDialogueTextSegmentType::Variable;
+			Segment.Text = Source.Mid(i + 1, SpanEnd - i - 1);
+			Template->VariableNames.AddUnique(Segment.Text);
+
+			NextSpan++;
+			i = LiteralStart = SpanEnd + 1;
+			continue;
+		}
+
+		if (bRichText && Source[i] == TEXT('<'))
+		{
+			// Rich text doesn't support nested tags, so a closing tag only counts while one is open and vice versa
+			int32 TagLength = 0;
+			if (bTagOpen && FCString::Strncmp(*Source + i, TEXT("</>"), 3) == 0)
+			{
+				TagLength = 3;
+			}
+			else if (!bTagOpen)
+			{
+				TagLength = MatchOpenTag(Source, i);
+			}
+
+			if (TagLength > 0)
+			{
+				FlushLiteral(i);
+
+				FDialogueTextSegment& Segment = Template->Segments.AddDefaulted_GetRef();
+				Segment.Type = bTagOpen ? EDialogueTextSegmentType::TagClose : EDialogueTextSegmentType::TagOpen;
+				Segment.Text = Source.Mid(i, TagLength);
+				bTagOpen = !bTagOpen;
+
+				i = LiteralStart = i + TagLength;
+				continue;
+			}
+		}
+
+		i++;
+	}
+	FlushLiteral(Source.Len());
+
+	return Template;
+}
+
+TSharedRef<const FDialogueTextTemplate> FDialogueTextTemplate::FindOrCompile(const FString& Source, EDialogueTextParseFlags Flags)
+{
+	check(IsInGameThread());
+
+	using FCacheKey = TPair<FString, EDialogueTextParseFlags>;
+	static TMap<FCacheKey, TSharedRef<const FDialogueTextTemplate>> Cache;
+
+	const FCacheKey Key(Source, Flags);
+	if (const TSharedRef<const FDialogueTextTemplate>* Found = Cache.Find(Key))
+	{
+		return *Found;
+	}
+
+	if (Cache.Num() >= DialogueTextTemplate::MaxCachedTemplates)
+	{
+		Cache.Reset();
+	}
+
+	return Cache.Add(Key, Compile(Source, Flags));
+}
+
+FString FDialogueTextTemplate::Resolve(TFunctionRef<bool(const FString&, FString&)> Resolver) const
+{
+	FString Result;
+	Result.Reserve(NumVisibleChars);
+
+	FString Value;
+	for (const FDialogueTextSegment& Segment : Segments)
+	{
+		if (Segment.Type != EDialogueTextSegmentType::Variable)
+		{
+			Result += Segment.Text;
+		}
+		else if (Resolver(Segment.Text, Value))
+		{
+			Result += Value;
+		}
+		else
+		{
+			Result += TEXT('%');
+			Result += Segment.Text;
+			Result += TEXT('%');
+		}
+	}
+
+	return Result;
+}
+
+void FDialogueTypewriterCursor::Reset(TSharedPtr<const FDialogueTextTemplate> InTemplate)
+{
+	Template = MoveTemp(InTemplate);
+	Revealed.Reset();
+	SegmentIndex = 0;
+	CharInSegment = 0;
+	NumRevealed = 0;
+	bTagOpen = false;
+
+	if (Template.IsValid())
+	{
+		Revealed.Reserve(Template->NumVisibleChars);
+
+		// a line without visible characters is finished right away
+		Advance(0);
+	}
+}
+
+void FDialogueTypewriterCursor::Advance(int32 NumChars)
+{
+	if (!Template.IsValid())
+	{
+		return;
+	}
+
+	const TArray<FDialogueTextSegment>& Segments = Template->Segments;
+	while (NumChars > 0 && SegmentIndex < Segments.Num())
+	{
+		const FDialogueTextSegment& Segment = Segments[SegmentIndex];
+		if (Segment.Type == EDialogueTextSegmentType::TagOpen || Segment.Type == EDialogueTextSegmentType::TagClose)
+		{
+			Revealed += Segment.Text;
+			bTagOpen = Segment.Type == EDialogueTextSegmentType::TagOpen;
+			SegmentIndex++;
+			continue;
+		}
+
+		const int32 Take = FMath::Min(NumChars, Segment.Text.Len() - CharInSegment);
+		Revealed.AppendChars(*Segment.Text + CharInSegment, Take);
+		CharInSegment += Take;
+		NumRevealed += Take;
+		NumChars -= Take;
+
+		if (CharInSegment >= Segment.Text.Len())
+		{
+			SegmentIndex++;
+			CharInSegment = 0;
+		}
+	}
+
+	// once every character is shown, copy the trailing tags too so the result equals the source
+	if (NumRevealed >= Template->NumVisibleChars)
+	{
+		for (; SegmentIndex < Segments.Num(); SegmentIndex++)
+		{
+			Revealed += Segments[SegmentIndex].Text;
+			bTagOpen = Segments[SegmentIndex].Type == EDialogueTextSegmentType::TagOpen;
+		}
+	}
+}
+
+void FDialogueTypewriterCursor::AdvanceTo(int32 NumVisibleChars)
+{
+	Advance(NumVisibleChars - NumRevealed);
+}
+
+bool FDialogueTypewriterCursor::IsFinished() const
+{
+	return !Template.IsValid() || NumRevealed >= Template->NumVisibleChars;
+}
+
+FString FDialogueTypewriterCursor::GetText() const
+{
+	return bTagOpen ? Revealed + TEXT("</>") : Revealed;
+}
@@ -3,7 +3,7 @@
 #include "UI/DialogueUserWidget.h"
 #include "UObject/UnrealType.h"
 #include "UObject/Class.h"
-#include "Internationalization/Regex.h"
+#include "UObject/WeakObjectPtr.h"
 #include "Dialogue.h"
 
 bool UDialogueUserWidget::IsConditionsMetForNode_Implementation(FDialogueNode Node)
@@ -32,60 +32,110 @@ void UDialogueUserWidget::RunEventsForNode_Implementation(FDialogueNode Node)
 	}
 }
 
-/* If you supply this function with "charname", it'll run the function called Get_charname
- * It'll also make sure that your Get_charname function has no parameters and only returns a string
- * The resulting string will be returned in &resultString
-*/
-bool UDialogueUserWidget::RunStringReplacer(FString originalString, FString& resultString)
+namespace DialogueUserWidget
 {
-	const FString methodToCall = FString::Printf(TEXT("Get_%s"), *originalString);
-	UFunction* Func = GetClass()->FindFunctionByName(FName(*methodToCall), EIncludeSuperFlag::ExcludeSuper);
-
-	if (Func == nullptr) 
-	{ 
-		UE_LOG(LogTemp, Error, TEXT("Dialogue System: Function \"%s\" wasn't found on the dialogue widget."), *methodToCall);
-		return false;
-	}
-
-	int foundReturnStrings = 0;
-	for (TFieldIterator<FProperty> It(Func); It; ++It)
+	struct FStringReplacerBinding
 	{
-		FProperty* Prop = *It;
+		// null after resolving if Get_<Variable> is missing or has the wrong signature, so the error is only logged once per class
+		TWeakObjectPtr<UFunction> Function;
+		bool bResolved = false;
+	};
 
-		// print property flags
-		//uint64 flags = (uint64)Prop->GetPropertyFlags();
-		//UE_LOG(LogTemp, Log, TEXT("Property Flags: %llu"), flags); // convert to hex: https://www.rapidtables.com/convert/number/decimal-to-hex.html
+	// Widget class -> variable name -> binding. Blueprint recompiles create a new class, which gets its own entry
+	static TMap<TObjectKey<UClass>, TMap<FString, FStringReplacerBinding>> StringReplacerBindings;
 
-		// if it's a return type (in blueprints it's an out parameter), check that it's a string
-		if (Prop->HasAllPropertyFlags(CPF_Parm | CPF_OutParm))
+	/* Checks that the function has no parameters and only returns a string */
+	static bool ValidateStringReplacer(UFunction* Func, const FString& methodToCall)
+	{
+		int foundReturnStrings = 0;
+		for (TFieldIterator<FProperty> It(Func); It; ++It)
 		{
-			if (!Prop->GetCPPType().Equals(TEXT("FString")))
+			FProperty* Prop = *It;
+
+			// if it's a return type (in blueprints it's an out parameter), check that it's a string
+			if (Prop->HasAllPropertyFlags(CPF_Parm | CPF_OutParm))
 			{
-				// if we land here, it means our method returns something other than a string
-				UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" is returning something other than a string!"), *methodToCall);
-				return false;
+				if (!Prop->IsA<FStrProperty>())
+				{
+					// if we land here, it means our method returns something other than a string
+					UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" is returning something other than a string!"), *methodToCall);
+					return false;
+				}
+				foundReturnStrings++;
 			}
-			else
+			// if it's a normal parameter, return false
+			else if (Prop->HasAnyPropertyFlags(CPF_Parm))
 			{
-				foundReturnStrings++;
-			}			
+				// we have some parameters, but we shouldn't have them
+				UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" must have no parameters!"), *methodToCall);
+				return false;
+			}
 		}
-		// if it's a normal parameter, return false
-		else if (Prop->HasAnyPropertyFlags(CPF_Parm) && !Prop->HasAnyPropertyFlags(CPF_OutParm))
+		if (foundReturnStrings > 1)
 		{
-			// we have some parameters, but we shouldn't have them
-			UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" must have no parameters!"), *methodToCall);
+			UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" must return only one string!"), *methodToCall);
 			return false;
 		}
+		else if (foundReturnStrings == 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" doesn't return anything, but must return a string!"), *methodToCall);
+			return false;
+		}
+		return true;
 	}
-	if (foundReturnStrings > 1)
+}
+
+UFunction* UDialogueUserWidget::FindStringReplacerFunction(const FString& VarName) const
+{
+	using namespace DialogueUserWidget;
+
+	UClass* WidgetClass = GetClass();
+	FStringReplacerBinding& Binding = StringReplacerBindings.FindOrAdd(WidgetClass).FindOrAdd(VarName);
+
+	if (Binding.bResolved)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" must return only one string!"), *methodToCall);
-		return false;
+		if (UFunction* Func = Binding.Function.Get())
+		{
+			return Func;
+		}
+		if (Binding.Function.IsExplicitlyNull())
+		{
+			// missing or invalid, already logged
+			return nullptr;
+		}
+		// the function was garbage collected, resolve it again
 	}
-	else if (foundReturnStrings == 0)
+
+	Binding.bResolved = true;
+	Binding.Function = nullptr;
+
+	const FString methodToCall = FString::Printf(TEXT("Get_%s"), *VarName);
+	UFunction* Func = WidgetClass->FindFunctionByName(FName(*methodToCall), EIncludeSuperFlag::ExcludeSuper);
+
+	if (Func == nullptr) 
+	{ 
+		UE_LOG(LogTemp, Error, TEXT("Dialogue System: Function \"%s\" wasn't found on the dialogue widget."), *methodToCall);
+		return nullptr;
+	}
+
+	if (!ValidateStringReplacer(Func, methodToCall))
+	{
+		return nullptr;
+	}
+
+	Binding.Function = Func;
+	return Func;
+}
+
+/* If you supply this function with "charname", it'll run the function called Get_charname
+ * It'll also make sure that your Get_charname function has no parameters and only returns a string
+ * The resulting string will be returned in &resultString
+*/
+bool UDialogueUserWidget::RunStringReplacer(FString originalString, FString& resultString)
+{
+	UFunction* Func = FindStringReplacerFunction(originalString);
+	if (Func == nullptr)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Dialogue System: Your method \"%s\" doesn't return anything, but must return a string!"), *methodToCall);
 		return false;
 	}
 
@@ -101,37 +151,16 @@ bool UDialogueUserWidget::RunStringReplacer(FString originalString, FString& res
 */
 TArray<FString> UDialogueUserWidget::FindVarStrings(FText inText)
 {
-	TArray<FString> varStrings;
-
-	FString totalText = inText.ToString();
+	return FDialogueTextTemplate::FindOrCompile(inText.ToString(), EDialogueTextParseFlags::Variables)->VariableNames;
+}
 
-	int firstPercent = -1;
-	for (int i = 0; i < totalText.Len(); i++)
+FString UDialogueUserWidget::ResolveVarStrings(const FText& inText)
+{
+	const TSharedRef<const FDialogueTextTemplate> Template = FDialogueTextTemplate::FindOrCompile(inText.ToString(), EDialogueTextParseFlags::Variables);
+	return Template->Resolve([this](const FString& VarName, FString& OutValue)
 	{
-		if (totalText[i] == '%')
-		{
-			if (firstPercent == -1) // if we encounter the first % sign
-			{
-				firstPercent = i;
-			}
-			else if (firstPercent + 1 == i) //if we encounter "%%", disregard the first one
-			{
-				firstPercent = i;
-			}
-			else // if we encounter second % sign
-			{
-				FString foundVarString = totalText.Mid(firstPercent + 1, i - firstPercent - 1);
-				varStrings.AddUnique(foundVarString);
-				firstPercent = -1;
-			}
-		}
-		if (totalText[i] == ' ')
-		{
-			firstPercent = -1;
-		}
-	}
-
-	return varStrings;
+		return RunStringReplacer(VarName, OutValue);
+	});
 }
 
 // This function is only useful for the TypeWriter effect.
@@ -156,67 +185,29 @@ void UDialogueUserWidget::GetFirstChars(FString originalString, bool isRichText,
 	// If rich text is involved, we must display the text char by char, while correctly jumping over rich text tags, and closing any unclosed tags if we're only displaying half of a sentence.
 	// Note: using inexisting tags in UE turns off Rich Text entirely for the string, so we will assume that all tags are real!
 	// Therefore, don't use <AnySingleWord> in your text if it's not a valid tag!
-	
-	// This is a regex pattern for an opened tag, i.e. starts with '<', followed by a single word (only letters and numbers), ends with '>'
-	const FRegexPattern openedTagPattern(TEXT("^(\\<[a-z,A-Z,0-9]+\\>)"));
-	int openedTags = 0;
-	int skippedSymbols = 0;
-
-	/* Note to self: 
-	* If UE4 starts supporting nested tags in rich text, simply remove the checks "openedTags == 1" and "openedTags == 0" in the code below.
-	* Because nested tags aren't supported,t here's an edge-case where "<yellow><yellow>text</>" actually works in rich text, and the second "<yellow>" is displayed as text.
-	* Currently, we deal with this case correctly. But if nested tags get supported, we'll lose support for this. Oh well!
-	*/
-
-	for (int32 i = 0; i < originalString.Len() && i < chars+1+skippedSymbols; i++)
+	// The line is parsed once by StartTypewriter and the loop calling us with increasing steps only advances the cursor.
+	// The rich text path has always shown one character more than the step, but only reports finished once the step
+	// itself reaches the last character, so the caller keeps the full line up for one more step like it used to.
+	if (!TypewriterCursor.IsValid() || !bTypewriterRichText || chars + 1 < TypewriterCursor.GetNumRevealed() || !TypewriterSource.Equals(originalString, ESearchCase::CaseSensitive))
 	{
-		//UE_LOG(LogTemp, Error, TEXT("Evaluating symbol: %s"), *originalString.Mid(i, 1));
+		StartTypewriter(originalString, true);
+	}
 
-		// If it's not a symbol of either opening or closing rich text tag, just append it.
-		if (originalString[i] != TCHAR('<'))
-		{
-			outputString += originalString[i];
-		}
-		else // If we're possibly dealing with a tag.
-		{			
-			FString stringTail = originalString.Mid(i, originalString.Len() - i); // The rest of the string starting from i.
+	TypewriterCursor.AdvanceTo(chars + 1);
+	outputString = TypewriterCursor.GetText();
+	finished = chars >= TypewriterCursor.GetNumVisibleChars();
+}
 
-			// If we encountered a closing tag and one tag is currently open (UE4 doesn't support nested tags, hence the check).
-			if (stringTail.StartsWith("</>") && openedTags == 1)
-			{
-				//UE_LOG(LogTemp, Error, TEXT("Found closing tag"));
-				outputString += "</>";
-				skippedSymbols += 3;
-				i += 2;
-				openedTags--;
-			}
-			else 
-			{
-				// Check if we're dealing with one word, followed by a closing brace. If not, just treat it as a non-tag-related symbol (i.e. just append it).
-				FRegexMatcher tagMatcher(openedTagPattern, stringTail);
-				if (tagMatcher.FindNext() && openedTags == 0) // Also, since no nested tags are allowed, check that no tags are open right now.
-				{					
-					//UE_LOG(LogTemp, Error, TEXT("Found opening tag: %s (length: %d)"), *stringTail.Mid(0, myMatcher.GetMatchEnding()), myMatcher.GetMatchEnding());
-					int tagLength = tagMatcher.GetMatchEnding();
-					outputString += stringTail.Mid(0, tagLength);
-					skippedSymbols += tagLength;
-					i += tagLength - 1;
-					openedTags++;
-				}
-				// If the '<' symbol we encountered is not part of anything related to tags (or it's part of a nested tag, which we don't treat), just append it like any other symbol.
-				else 
-				{
-					outputString += originalString[i];
-				}
-			}
-		}
-	}	
-	for (int i = 0; i < openedTags; i++)
-	{
-		outputString += "</>";
-	}
-	if (chars + skippedSymbols == originalString.Len())
-	{
-		finished = true;
-	}
-}
\ No newline at end of file
+void UDialogueUserWidget::StartTypewriter(const FString& originalString, bool isRichText)
+{
+	TypewriterSource = originalString;
+	bTypewriterRichText = isRichText;
+	TypewriterCursor.Reset(FDialogueTextTemplate::FindOrCompile(originalString, isRichText ? EDialogueTextParseFlags::RichText : EDialogueTextParseFlags::None));
+}
+
+void UDialogueUserWidget::AdvanceTypewriter(int32 chars, FString& outputString, bool& finished)
+{
+	TypewriterCursor.Advance(chars);
+	outputString = TypewriterCursor.GetText();
+	finished = TypewriterCursor.IsFinished();
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+enum class EDialogueTextSegmentType : uint8
+{
+	Literal,
+	Variable,
+	TagOpen,
+	TagClose
+};
+
+enum class EDialogueTextParseFlags : uint8
+{
+	None = 0,
+	// %Variable% (a single word between two percent signs, same rules as UDialogueUserWidget::FindVarStrings)
+	Variables = 1 << 0,
+	// <tag>text</>, no nesting, same rules as the rich text typewriter
+	RichText = 1 << 1
+};
+ENUM_CLASS_FLAGS(EDialogueTextParseFlags);
+
+struct FDialogueTextSegment
+{
+	EDialogueTextSegmentType Type = EDialogueTextSegmentType::Literal;
+
+	// Literal text, variable name without the percent signs, or the whole tag ("<yellow>", "</>")
+	FString Text;
+};
+
+/**
+ * A dialogue line parsed once into literal, variable and rich text tag segments.
+ * Compiled templates are immutable and shared through FindOrCompile, so the same line is only parsed again if the cache was flushed.
+ */
+struct DIALOGUESYSTEMPRESENTATION_API FDialogueTextTemplate
+{
+	static TSharedRef<const FDialogueTextTemplate> Compile(const FString& Source, EDialogueTextParseFlags Flags);
+
+	// Game thread only
+	static TSharedRef<const FDialogueTextTemplate> FindOrCompile(const FString& Source, EDialogueTextParseFlags Flags);
+
+	/* Concatenates the segments, asking Resolver for each variable. Variables it can't resolve are kept as %Name% */
+	FString Resolve(TFunctionRef<bool(const FString& /*Name*/, FString& /*OutValue*/)> Resolver) const;
+
+	TArray<FDialogueTextSegment> Segments;
+
+	// Unique, in order of first appearance
+	TArray<FString> VariableNames;
+
+	// Characters in literal segments, i.e. what a typewriter reveals one by one
+	int32 NumVisibleChars = 0;
+};
+
+/**
+ * Reveals a compiled line character by character. Each revealed character costs O(1), tags are copied in front of the
+ * first character they apply to and an open tag is closed in GetText so the partial string is always valid rich text.
+ * Resolve variables first, the template should be compiled with EDialogueTextParseFlags::RichText only.
+ */
+struct DIALOGUESYSTEMPRESENTATION_API FDialogueTypewriterCursor
+{
+	void Reset(TSharedPtr<const FDialogueTextTemplate> InTemplate);
+
+	void Advance(int32 NumChars);
+	void AdvanceTo(int32 NumVisibleChars);
+
+	bool IsValid() const { return Template.IsValid(); }
+	bool IsFinished() const;
+	int32 GetNumRevealed() const { return NumRevealed; }
+	int32 GetNumVisibleChars() const { return Template.IsValid() ? Template->NumVisibleChars : 0; }
+
+	FString GetText() const;
+
+private:
+	TSharedPtr<const FDialogueTextTemplate> Template;
+
+	FString Revealed;
+	int32 SegmentIndex = 0;
+	int32 CharInSegment = 0;
+	int32 NumRevealed = 0;
+	bool bTagOpen = false;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Dialogue.h"
 #include "Blueprint/UserWidget.h"
+#include "UI/DialogueTextTemplate.h"
 #include "DialogueUserWidget.generated.h"
 
 class UDialogueViewModel;
@@ -49,14 +50,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dialogue UI")
 	TArray<FString> FindVarStrings(FText inText);
 
+	//VarStrings: replaces every %Variable% in the text with the result of Get_Variable, unknown variables are left as they are
+	UFUNCTION(BlueprintCallable, Category = "Dialogue UI")
+	FString ResolveVarStrings(const FText& inText);
+
 	/* This function is only useful for the TypeWriter effect.
 	Usage: call the function in a loop with delays, feeding it incrementing steps from 0 to inf, until it returns finished as true.
 	What it does: it goes through the string and returns the first N characters, but makes sure not to break any Rich Text tags */
 	UFUNCTION(BlueprintCallable, Category = "Dialogue UI")
 	void GetFirstChars(FString originalString, bool isRichText, int32 chars, FString& outputString, bool& finished);
+
+	/* Incremental TypeWriter: call StartTypewriter once per line, then AdvanceTypewriter with the number of characters to reveal since the last call.
+	The line is parsed once, each revealed character is O(1) and Rich Text tags are kept balanced */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue UI")
+	void StartTypewriter(const FString& originalString, bool isRichText);
+
+	UFUNCTION(BlueprintCallable, Category = "Dialogue UI")
+	void AdvanceTypewriter(int32 chars, FString& outputString, bool& finished);
 	
 	//The actor this dialogue belongs to
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = ( ExposeOnSpawn = true ), Category = "Dialogue UI")
 	AActor* NPCActor;
+
+private:
+	// Validated Get_<Variable> function of this widget's class, cached per class
+	UFunction* FindStringReplacerFunction(const FString& VarName) const;
+
+	FDialogueTypewriterCursor TypewriterCursor;
+	FString TypewriterSource;
+	bool bTypewriterRichText = false;
 };
 
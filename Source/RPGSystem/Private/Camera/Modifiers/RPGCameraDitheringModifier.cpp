@@ -6,6 +6,7 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "Materials/MaterialParameterCollection.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
+#include "Shared/RPGQueryStats.h"
 
 
 namespace DitherHelpers
@@ -164,8 +165,13 @@ bool URPGCameraDitheringModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo
 				}
 			}
 
+			// Only the overlap itself counts as query cost, not the dithering below
 			TArray<FOverlapResult> OutOverlaps;
-			GetWorld()->OverlapMultiByChannel(OutOverlaps, InOutPOV.Location, FQuat::Identity, DitheringSettings.DitherOverlapChannel, FCollisionShape::MakeSphere(DitheringSettings.SphereCollisionRadius), QueryParams);
+			{
+				RPG_QUERY_SCOPE(ERPGQuerySource::CameraDither, RPGQuery_CameraDither);
+				GetWorld()->OverlapMultiByChannel(OutOverlaps, InOutPOV.Location, FQuat::Identity, DitheringSettings.DitherOverlapChannel, FCollisionShape::MakeSphere(DitheringSettings.SphereCollisionRadius), QueryParams);
+			}
+			RPG_QUERY_RECORD(ERPGQuerySource::CameraDither, 1, OutOverlaps.Num());
 
 #if ENABLE_DRAW_DEBUG
 			if (GetWorld()->DebugDrawTraceTag == TEXT("CameraDithering"))
@@ -213,6 +219,10 @@ bool URPGCameraDitheringModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo
 						int32 Index = DitherHelpers::FindInactiveDitherState(DitheredActorStates);
 						DitheredActorStates[Index].StartDithering(Actor, EDitherType::OverlappingCamera);
 					}
+					else
+					{
+						RPG_QUERY_RECORD_DEDUP(ERPGQuerySource::CameraDither, 1);
+					}
 				}
 			}
 		}
@@ -236,7 +246,11 @@ bool URPGCameraDitheringModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo
 			FVector const BoxExtent = FVector(Delta.Size() * 0.495f, DitheringSettings.LOSProbeSize, DitheringSettings.LOSProbeSize);
 			FCollisionShape const Box = FCollisionShape::MakeBox(BoxExtent);
 
-			GetWorld()->OverlapMultiByChannel(OutOverlaps, BoxOrigin, Rotation, DitheringSettings.DitherLOSChannel, Box, QueryParams);
+			{
+				RPG_QUERY_SCOPE(ERPGQuerySource::CameraDither, RPGQuery_CameraDither);
+				GetWorld()->OverlapMultiByChannel(OutOverlaps, BoxOrigin, Rotation, DitheringSettings.DitherLOSChannel, Box, QueryParams);
+			}
+			RPG_QUERY_RECORD(ERPGQuerySource::CameraDither, 1, OutOverlaps.Num());
 
 #if ENABLE_DRAW_DEBUG
 			if (GetWorld()->DebugDrawTraceTag == TEXT("CameraDithering"))
@@ -276,6 +290,10 @@ bool URPGCameraDitheringModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo
 						int32 Index = DitherHelpers::FindInactiveDitherState(DitheredActorStates);
 						DitheredActorStates[Index].StartDithering(Actor, EDitherType::BlockingLOS);
 					}
+					else
+					{
+						RPG_QUERY_RECORD_DEDUP(ERPGQuerySource::CameraDither, 1);
+					}
 				}
 			}
 		}
@@ -3,3 +3,46 @@
 
 #include "Combat/Action/Actions/BowAttackAction.h"
 
+#include "Combat/Ranged/ArrowProjectile.h"
+#include "GameFramework/Character.h"
+#include "Shared/Subsystems/ObjectPoolSubsystem.h"
+
+AArrowProjectile* UBowAttackAction::FireArrow()
+{
+	if (!OwnerCharacter || !ArrowClass)
+	{
+		return nullptr;
+	}
+
+	UObjectPoolSubsystem* Pool = UObjectPoolSubsystem::Get(OwnerCharacter);
+	if (!Pool)
+	{
+		return nullptr;
+	}
+
+	// 컨트롤러가 있으면 조준 방향, 없으면 캐릭터 정면
+	const FRotator AimRotation = OwnerCharacter->GetController() ? OwnerCharacter->GetControlRotation() : OwnerCharacter->GetActorRotation();
+
+	FVector SpawnLocation = OwnerCharacter->GetActorLocation() + AimRotation.Vector() * ArrowSpawnForwardOffset;
+	USkeletalMeshComponent* Mesh = OwnerCharacter->GetMesh();
+	if (Mesh && ArrowSpawnSocket != NAME_None && Mesh->DoesSocketExist(ArrowSpawnSocket))
+	{
+		SpawnLocation = Mesh->GetSocketLocation(ArrowSpawnSocket);
+	}
+
+	AArrowProjectile* Arrow = Pool->AcquireActor<AArrowProjectile>(ArrowClass, FTransform(AimRotation, SpawnLocation), OwnerCharacter, OwnerCharacter);
+	if (!Arrow)
+	{
+		return nullptr;
+	}
+
+	ConsumeAttackResources();
+
+	FDamageInfo DamageInfo;
+	DamageInfo.BaseDamage = BaseDamage;
+	DamageInfo.DamageTags = DamageTags;
+	DamageInfo.SourceActor = OwnerCharacter;
+
+	Arrow->InitializeArrowProjectile(DamageInfo, ArrowSpeed, ArrowGravityScale);
+	return Arrow;
+}
@@ -0,0 +1,311 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+
+/**
+ * 전투 스트레스 자동화 테스트 (RPGSystem.Benchmark.Combat.Stress)
+ *
+ * 벤치마크 게임 월드에 플레이어를 빙의시키고 그 주위에 적 N명을 원형으로 스폰한 뒤 고정 프레임(1/60초)으로 월드를 틱하면서
+ * 스크립트 공격(히트박스 활성/비활성 반복)을 돌리고 프레임 시간과 서브시스템별 쿼리 비용(FRPGQueryStats)을 기록
+ *
+ * 적은 기본 AI 컨트롤러가 빙의, 공격은 적의 모든 UHitBoxComponent를 토글
+ * 플레이어 앞에는 상호작용 가능한 NPC를 두어 상호작용 탐색이, 카메라 매니저에는 디더링 모디파이어를 두어 카메라 디더링이 함께 돌도록 함
+ * 웜업 프레임(스폰 히치)은 측정에서 제외
+ *
+ * 단계 (기준 비교는 Shared/RPGBenchmark.h)
+ *	Frame / FrameP99: 월드 틱 평균 / p99 시간
+ *	<Source>Query: 쿼리 시간, 개수 열에는 쿼리 수 (쿼리 수가 기준보다 늘어도 회귀)
+ *
+ * 커맨드 라인
+ *	-CombatStressEnemies=50
+ *	-CombatStressEnemyClass=<클래스 경로> (기본 BP_EnemyCharacter, 히트박스가 없는 클래스면 테스트 실패)
+ *	-CombatStressPlayerClass=<클래스 경로> (기본 ARPGPlayerCharacter)
+ */
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Camera/Modifiers/RPGCameraDitheringModifier.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Hitbox/HitBoxComponent.h"
+#include "Interaction/InteractionComponent.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "NPC/NPCCharacter.h"
+#include "Player/RPGPlayerCharacter.h"
+#include "Player/RPGPlayerController.h"
+#include "Shared/RPGBenchmark.h"
+#include "Shared/RPGQueryStats.h"
+
+namespace CombatStressBenchmark
+{
+	// 무기 소켓과 히트박스가 설정된 적 블루프린트
+	static const TCHAR* DefaultEnemyClassPath = TEXT("/Game/Blueprint/Enemy/BP_EnemyCharacter.BP_EnemyCharacter_C");
+
+	// 플레이어 앞 상호작용 대상, UInteractionComponent 전방 탐색 거리(250) 안
+	constexpr int32 NumInteractables = 4;
+	constexpr float InteractableDistance = 180.f;
+
+	constexpr float FrameDeltaSeconds = 1.f / 60.f;
+	constexpr int32 WarmupFrames = 180;
+	constexpr int32 MeasuredFrames = 1800;
+
+	// 공격 주기와 히트박스 활성 시간, 시작 시점은 적마다 랜덤
+	constexpr float AttackInterval = 1.5f;
+	constexpr float AttackDuration = 0.4f;
+
+	// 무기가 서로 닿을 만큼 가깝게 배치
+	constexpr float SpawnRadius = 300.f;
+
+	constexpr int32 Seed = 1337;
+
+	struct FAttacker
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		TArray<TWeakObjectPtr<UHitBoxComponent>> HitBoxes;
+
+		float NextAttackTime = 0.f;
+
+		// 음수면 공격 중이 아님
+		float AttackEndTime = -1.f;
+	};
+
+	struct FState
+	{
+		FRPGBenchmarkWorld World;
+		FRPGBenchmarkReport Report = FRPGBenchmarkReport(TEXT("CombatStress"));
+		FRandomStream Random = FRandomStream(Seed);
+
+		TArray<FAttacker> Attackers;
+		TArray<double> FrameTimesMs;
+
+		float Elapsed = 0.f;
+		int32 Frame = 0;
+		int32 NumAttacks = 0;
+
+		void UpdateAttacks();
+	};
+
+	void FState::UpdateAttacks()
+	{
+		for (FAttacker& Attacker : Attackers)
+		{
+			if (!Attacker.Pawn.IsValid())
+			{
+				continue;
+			}
+
+			if (Attacker.AttackEndTime >= 0.f && Elapsed >= Attacker.AttackEndTime)
+			{
+				for (const TWeakObjectPtr<UHitBoxComponent>& HitBox : Attacker.HitBoxes)
+				{
+					if (HitBox.IsValid())
+					{
+						HitBox->DeactivateHitBox();
+					}
+				}
+				Attacker.AttackEndTime = -1.f;
+			}
+
+			if (Elapsed >= Attacker.NextAttackTime)
+			{
+				for (const TWeakObjectPtr<UHitBoxComponent>& HitBox : Attacker.HitBoxes)
+				{
+					if (HitBox.IsValid())
+					{
+						HitBox->ActivateHitBox();
+					}
+				}
+
+				Attacker.NextAttackTime += AttackInterval;
+				Attacker.AttackEndTime = Elapsed + AttackDuration;
+
+				if (Frame >= WarmupFrames)
+				{
+					++NumAttacks;
+				}
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRPGCombatStressBenchmark, "RPGSystem.Benchmark.Combat.Stress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FRPGCombatStressBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CombatStressBenchmark;
+
+	FString EnemyClassPath = DefaultEnemyClassPath;
+	FParse::Value(FCommandLine::Get(), TEXT("CombatStressEnemyClass="), EnemyClassPath);
+
+	UClass* EnemyClass = LoadClass<APawn>(nullptr, *EnemyClassPath);
+	if (!TestNotNull(*FString::Printf(TEXT("Enemy class %s"), *EnemyClassPath), EnemyClass))
+	{
+		return false;
+	}
+
+	UClass* PlayerClass = ARPGPlayerCharacter::StaticClass();
+
+	FString PlayerClassPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("CombatStressPlayerClass="), PlayerClassPath))
+	{
+		PlayerClass = LoadClass<APawn>(nullptr, *PlayerClassPath);
+		if (!TestNotNull(*FString::Printf(TEXT("Player class %s"), *PlayerClassPath), PlayerClass))
+		{
+			return false;
+		}
+	}
+
+	const TSharedRef<FState> State = MakeShared<FState>();
+	const int32 NumEnemies = State->Report.GetParameter(TEXT("CombatStressEnemies"), 50);
+	UWorld* World = State->World.GetWorld();
+
+	// 원점에서 +X를 바라보는 플레이어, 스폰 직후 BeginPlay에는 컨트롤러가 없으므로 상호작용은 빙의 후 다시 초기화
+	APlayerController* PlayerController = State->World.SpawnPlayer(PlayerClass, FTransform::Identity, ARPGPlayerController::StaticClass());
+	APawn* Player = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (!TestNotNull(TEXT("Possessed player pawn"), Player))
+	{
+		return false;
+	}
+
+	UInteractionComponent* InteractionComp = Player->FindComponentByClass<UInteractionComponent>();
+	if (!TestNotNull(TEXT("Player interaction component"), InteractionComp))
+	{
+		return false;
+	}
+	InteractionComp->InitializeInteraction(PlayerController);
+
+	// 카메라 매니저 블루프린트에 디더링이 설정되지 않은 경우에도 측정되도록 추가
+	APlayerCameraManager* CameraManager = PlayerController->PlayerCameraManager;
+	if (!TestNotNull(TEXT("Player camera manager"), CameraManager))
+	{
+		return false;
+	}
+
+	if (!CameraManager->FindCameraModifierByClass(URPGCameraDitheringModifier::StaticClass()))
+	{
+		CameraManager->AddNewCameraModifier(URPGCameraDitheringModifier::StaticClass());
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// 플레이어 전방 부채꼴에 NPC 배치
+	for (int32 Index = 0; Index < NumInteractables; ++Index)
+	{
+		const float Angle = FMath::DegreesToRadians(-30.f + 60.f * Index / FMath::Max(NumInteractables - 1, 1));
+		const FVector SpawnLocation = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * InteractableDistance;
+
+		if (!TestNotNull(TEXT("Spawned interactable NPC"), World->SpawnActor<ANPCCharacter>(SpawnLocation, (-SpawnLocation).Rotation(), SpawnParams)))
+		{
+			return false;
+		}
+	}
+
+	// 플레이어를 둘러싸도록 원형 배치, 거리는 랜덤
+	int32 NumHitBoxes = 0;
+	for (int32 EnemyIndex = 0; EnemyIndex < NumEnemies; ++EnemyIndex)
+	{
+		const float Angle = UE_TWO_PI * EnemyIndex / NumEnemies;
+		const float Distance = SpawnRadius * State->Random.FRandRange(0.5f, 1.f);
+		const FVector SpawnLocation = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Distance;
+		const FRotator SpawnRotation = (-SpawnLocation).Rotation();
+
+		APawn* Enemy = World->SpawnActor<APawn>(EnemyClass, SpawnLocation, SpawnRotation, SpawnParams);
+		if (!TestNotNull(TEXT("Spawned enemy"), Enemy))
+		{
+			return false;
+		}
+
+		// 스폰된 폰은 기본적으로 AI가 빙의하지 않을 수 있음
+		if (!Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+
+		FAttacker& Attacker = State->Attackers.AddDefaulted_GetRef();
+		Attacker.Pawn = Enemy;
+		Attacker.NextAttackTime = State->Random.FRandRange(0.f, AttackInterval);
+
+		TArray<UHitBoxComponent*> HitBoxes;
+		Enemy->GetComponents(HitBoxes);
+		Attacker.HitBoxes.Append(HitBoxes);
+		NumHitBoxes += HitBoxes.Num();
+	}
+
+	if (NumHitBoxes == 0)
+	{
+		AddError(FString::Printf(TEXT("Enemy class %s has no HitBoxComponents, hitbox queries would not be measured (see -CombatStressEnemyClass=)"), *EnemyClass->GetPathName()));
+		return false;
+	}
+
+	State->FrameTimesMs.Reserve(MeasuredFrames);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, NumHitBoxes]()
+	{
+		// 웜업이 끝나는 프레임부터 카운터를 새로 시작
+		if (State->Frame == WarmupFrames)
+		{
+			FRPGQueryStats::Reset();
+		}
+
+		if (State->Frame < WarmupFrames + MeasuredFrames)
+		{
+			// 공격 스크립트와 월드 틱만 측정, 나머지 엔진 프레임은 제외
+			const double Start = FPlatformTime::Seconds();
+			State->UpdateAttacks();
+			State->World.Tick(FrameDeltaSeconds);
+			const double FrameMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+			State->Report.SampleMemory();
+
+			if (State->Frame >= WarmupFrames)
+			{
+				State->FrameTimesMs.Add(FrameMs);
+			}
+
+			State->Elapsed += FrameDeltaSeconds;
+			++State->Frame;
+			return false;
+		}
+
+		TArray<double>& FrameTimesMs = State->FrameTimesMs;
+
+		double TotalMs = 0.0;
+		for (const double FrameMs : FrameTimesMs)
+		{
+			TotalMs += FrameMs;
+		}
+
+		FrameTimesMs.Sort();
+		const int32 P99Index = FMath::Clamp(FMath::CeilToInt(FrameTimesMs.Num() * 0.99) - 1, 0, FrameTimesMs.Num() - 1);
+
+		State->Report.AddStage(TEXT("Frame"), TotalMs / FMath::Max(FrameTimesMs.Num(), 1));
+		State->Report.AddStage(TEXT("FrameP99"), FrameTimesMs.IsEmpty() ? 0.0 : FrameTimesMs[P99Index]);
+
+		for (int32 SourceIndex = 0; SourceIndex < static_cast<int32>(ERPGQuerySource::Num); ++SourceIndex)
+		{
+			const ERPGQuerySource Source = static_cast<ERPGQuerySource>(SourceIndex);
+			const FRPGQueryCounters& Counters = FRPGQueryStats::Get(Source);
+
+			State->Report.AddStage(FString::Printf(TEXT("%sQuery"), FRPGQueryStats::GetSourceName(Source)), Counters.Seconds * 1000.0, Counters.Queries);
+			AddInfo(FString::Printf(TEXT("%-12s %8lld queries %8lld hits %6lld dedup"),
+				FRPGQueryStats::GetSourceName(Source), Counters.Queries, Counters.Hits, Counters.DedupRejections));
+		}
+
+		AddInfo(FString::Printf(TEXT("%d enemies, %d hitboxes, %d frames, %d attacks"),
+			State->Attackers.Num(), NumHitBoxes, FrameTimesMs.Num(), State->NumAttacks));
+
+		TestTrue(TEXT("Hitboxes ran queries"), FRPGQueryStats::Get(ERPGQuerySource::HitBox).Queries > 0);
+		TestTrue(TEXT("Player interaction ran queries"), FRPGQueryStats::Get(ERPGQuerySource::Interaction).Queries > 0);
+		TestTrue(TEXT("Camera dithering ran queries"), FRPGQueryStats::Get(ERPGQuerySource::CameraDither).Queries > 0);
+
+		State->Report.Submit(*this);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
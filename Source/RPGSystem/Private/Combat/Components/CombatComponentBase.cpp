@@ -295,12 +295,11 @@ void UCombatComponentBase::HandleDeath_Implementation(AActor* Killer)
 
 	if (UGlobalEventHandler* EventHandler = UGlobalEventHandler::Get(this))
 	{
-		TArray<FString> Metadata;
-		Metadata.Add(FString::Printf(TEXT("EventTag=%s"), *KillEventTag.ToString()));
-		Metadata.Add(TEXT("Amount=1"));
-		Metadata.Add(FString::Printf(TEXT("Killer=%s"), *QuestOwnerActor->GetPathName()));
+		FRPGKillEventPayload KillPayload;
+		KillPayload.Killer = QuestOwnerActor;
+		KillPayload.Amount = 1;
 
-		EventHandler->CallGlobalEventByGameplayTag(this, KillEventTag, GetOwner(), Metadata);
+		EventHandler->PublishEvent(this, KillEventTag, GetOwner(), KillPayload);
 	}
 }
 
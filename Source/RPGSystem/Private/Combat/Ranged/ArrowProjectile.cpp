@@ -5,8 +5,9 @@
 #include "Components/SphereComponent.h"
 #include "Engine/DamageEvents.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Shared/Subsystems/ObjectPoolSubsystem.h"
 
 AArrowProjectile::AArrowProjectile()
 {
@@ -21,6 +22,11 @@ AArrowProjectile::AArrowProjectile()
     MeshComponent->SetupAttachment(RootComponent);
     MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+    TracerComponent = CreateDefaultSubobject<UParticleSystemComponent>(TEXT("TracerComponent"));
+    TracerComponent->SetupAttachment(MeshComponent);
+    TracerComponent->bAutoActivate = false;
+    TracerComponent->bAutoDestroy = false;
+
     ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(TEXT("ProjectileMovement"));
     ProjectileMovement->InitialSpeed = 4000.0f;
     ProjectileMovement->MaxSpeed = 4000.0f;
@@ -34,11 +40,63 @@ void AArrowProjectile::BeginPlay()
     Super::BeginPlay();
 
     CollisionComponent->OnComponentHit.AddDynamic(this, &AArrowProjectile::OnArrowHit);
+
+    if (TracerTemplate)
+    {
+        TracerComponent->SetTemplate(TracerTemplate);
+    }
+
+    StartFlight();
+}
+
+void AArrowProjectile::StartFlight()
+{
     SetLifeSpan(LifeSeconds);
 
     if (TracerTemplate)
     {
-        UGameplayStatics::SpawnEmitterAttached(TracerTemplate, MeshComponent);
+        TracerComponent->Activate(true);
+    }
+}
+
+void AArrowProjectile::OnAcquiredFromPool_Implementation()
+{
+    // The movement component let go of the root when it was stopped
+    if (ProjectileMovement)
+    {
+        ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+        ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+        ProjectileMovement->Activate(true);
+    }
+
+    StartFlight();
+}
+
+void AArrowProjectile::OnReturnedToPool_Implementation()
+{
+    if (ProjectileMovement)
+    {
+        ProjectileMovement->StopMovementImmediately();
+        ProjectileMovement->Deactivate();
+    }
+
+    // Drop the live trail too, it would otherwise streak to the parking location
+    TracerComponent->DeactivateImmediate();
+
+    SetLifeSpan(0.0f);
+    DamageInfo = FDamageInfo();
+}
+
+void AArrowProjectile::LifeSpanExpired()
+{
+    ReleaseArrow();
+}
+
+void AArrowProjectile::ReleaseArrow()
+{
+    if (!UObjectPoolSubsystem::ReleaseToPool(this))
+    {
+        Destroy();
     }
 }
 
@@ -51,6 +109,9 @@ void AArrowProjectile::InitializeArrowProjectile(const FDamageInfo& InDamageInfo
         ProjectileMovement->InitialSpeed = InitialSpeed;
         ProjectileMovement->MaxSpeed = InitialSpeed;
         ProjectileMovement->ProjectileGravityScale = GravityScale;
+
+        // The component already launched at the old speed on spawn/checkout
+        ProjectileMovement->Velocity = GetActorForwardVector() * InitialSpeed;
     }
 }
 
@@ -87,6 +148,6 @@ void AArrowProjectile::OnArrowHit(
 
     if (bDestroyOnAnyHit)
     {
-        Destroy();
+        ReleaseArrow();
     }
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageFloat/DamageFloatLayerWidget.h"
+#include "DamageFloat/DamageFloatManagerComponent.h"
+#include "DamageFloat/SDamageFloatLayer.h"
+#include "GameFramework/PlayerController.h"
+#include "Styling/CoreStyle.h"
+
+#define LOCTEXT_NAMESPACE "DamageFloat"
+
+UDamageFloatLayerWidget::UDamageFloatLayerWidget()
+{
+	Font = FCoreStyle::GetDefaultFontStyle("Bold", 24);
+	Font.OutlineSettings.OutlineSize = 2;
+
+	SetVisibilityInternal(ESlateVisibility::HitTestInvisible);
+}
+
+void UDamageFloatLayerWidget::SetDamageFloatManager(UDamageFloatManagerComponent* InManager)
+{
+	Manager = InManager;
+	if (MyDamageFloatLayer.IsValid())
+	{
+		MyDamageFloatLayer->SetManager(ResolveManager());
+		MyDamageFloatLayer->SetOwningPlayer(GetOwningPlayer());
+	}
+}
+
+TSharedRef<SWidget> UDamageFloatLayerWidget::RebuildWidget()
+{
+	MyDamageFloatLayer = SNew(SDamageFloatLayer);
+	return MyDamageFloatLayer.ToSharedRef();
+}
+
+void UDamageFloatLayerWidget::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (MyDamageFloatLayer.IsValid())
+	{
+		MyDamageFloatLayer->SetFonts(Font, CriticalFontScale);
+		MyDamageFloatLayer->SetManager(ResolveManager());
+		MyDamageFloatLayer->SetOwningPlayer(GetOwningPlayer());
+	}
+}
+
+void UDamageFloatLayerWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyDamageFloatLayer.Reset();
+}
+
+UDamageFloatManagerComponent* UDamageFloatLayerWidget::ResolveManager() const
+{
+	if (UDamageFloatManagerComponent* ExplicitManager = Manager.Get())
+	{
+		return ExplicitManager;
+	}
+
+	const APlayerController* PC = GetOwningPlayer();
+	return PC ? PC->FindComponentByClass<UDamageFloatManagerComponent>() : nullptr;
+}
+
+#if WITH_EDITOR
+const FText UDamageFloatLayerWidget::GetPaletteCategory()
+{
+	return LOCTEXT("PaletteCategory", "RPG");
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -2,6 +2,9 @@
 
 
 #include "DamageFloat/DamageFloatManagerComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/HUD.h"
+#include "GameFramework/PlayerController.h"
 
 UDamageFloatManagerComponent::UDamageFloatManagerComponent()
 {
@@ -19,10 +22,12 @@ void UDamageFloatManagerComponent::BeginPlay()
 void UDamageFloatManagerComponent::PreallocatePool()
 {
     ActiveFloats.Reserve(MaxActiveDamageFloats);
+    RemainingLifetimes.Reserve(MaxActiveDamageFloats);
+    VerticalOffsets.Reserve(MaxActiveDamageFloats);
     UE_LOG(LogTemp, Log, TEXT("[DamageFloatManager] Pre-allocated pool for %d floats"), MaxActiveDamageFloats);
 }
 
-void UDamageFloatManagerComponent::SpawnDamageFloat(float DamageAmount, FVector WorldPosition, bool bIsCritical)
+void UDamageFloatManagerComponent::SpawnDamageFloat(float DamageAmount, FVector WorldPosition, bool bIsCritical, AActor* DamagedActor)
 {
     // Validation
     if (!ensure(DamageAmount >= 0.0f))
@@ -31,10 +36,28 @@ void UDamageFloatManagerComponent::SpawnDamageFloat(float DamageAmount, FVector
         return;
     }
 
-    // FIFO removal if max capacity reached
+    // Multi-hit: 같은 프레임, 같은 대상이면 숫자 하나로 합침 (가까이 붙어 있는 다른 적은 따로 표시)
+    if (bCoalesceSameFrameHits && DamagedActor)
+    {
+        const int32 ExistingIndex = FindCoalesceTarget(DamagedActor);
+        if (ExistingIndex != INDEX_NONE)
+        {
+            FDamageFloatData& Existing = ActiveFloats[ExistingIndex];
+            Existing.DamageAmount += DamageAmount;
+            Existing.DamageText = FString::FromInt(FMath::RoundToInt(Existing.DamageAmount));
+            if (bIsCritical && !Existing.bIsCritical)
+            {
+                Existing.bIsCritical = true;
+                Existing.TextColor = FLinearColor::Red;
+            }
+            return;
+        }
+    }
+
+    // 가득 차면 가장 오래된 것을 교체 (swap-remove라 순서가 없으므로 수명으로 찾음)
     if (ActiveFloats.Num() >= MaxActiveDamageFloats)
     {
-        ActiveFloats.RemoveAt(0);
+        RemoveFloatAtSwap(FindOldestFloat());
     }
 
     // Create new float with FIXED world position
@@ -42,7 +65,10 @@ void UDamageFloatManagerComponent::SpawnDamageFloat(float DamageAmount, FVector
     NewFloat.RemainingLifetime = DamageFloatLifetime;
     NewFloat.SpawnTime = CurrentWorldTime;
 
-    ActiveFloats.Add(NewFloat);
+    const int32 NewIndex = ActiveFloats.Add(MoveTemp(NewFloat));
+    RemainingLifetimes.Add(DamageFloatLifetime);
+    VerticalOffsets.Add(0.0f);
+    SpawnedThisFrame.Add({ NewIndex, DamagedActor });
 
 #if !UE_BUILD_SHIPPING
     // Debug visualization
@@ -73,7 +99,7 @@ void UDamageFloatManagerComponent::SpawnDamageFloatAtActor(AActor* TargetActor,
     // Get actor's CURRENT position (공격받은 순간의 위치!)
     FVector SpawnPosition = TargetActor->GetActorLocation() + FVector(0, 0, HeightOffset);
     
-    SpawnDamageFloat(DamageAmount, SpawnPosition, bIsCritical);
+    SpawnDamageFloat(DamageAmount, SpawnPosition, bIsCritical, TargetActor);
 }
 
 void UDamageFloatManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, 
@@ -81,74 +107,121 @@ void UDamageFloatManagerComponent::TickComponent(float DeltaTime, ELevelTick Tic
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    if (ActiveFloats.Num() == 0)
+    // 합치기는 같은 프레임 안에서만
+    SpawnedThisFrame.Reset();
+
+    const int32 NumFloats = ActiveFloats.Num();
+    if (NumFloats == 0)
     {
         return;
     }
 
     CurrentWorldTime += DeltaTime;
 
-    // Update all floats
-    TArray<int32> IndicesToRemove;
-    IndicesToRemove.Reserve(ActiveFloats.Num() / 4);
+    // 1. Update: 분기 없는 연속 float 배열이라 컴파일러가 벡터화
+    const float Rise = VerticalFloatSpeed * DeltaTime;
+    float* Lifetimes = RemainingLifetimes.GetData();
+    float* Offsets = VerticalOffsets.GetData();
+    for (int32 i = 0; i < NumFloats; ++i)
+    {
+        Lifetimes[i] -= DeltaTime;
+        Offsets[i] += Rise;
+    }
+
+    // 2. Remove expired / distant floats, 남는 것은 표시용 데이터에 기록
+    //    뒤에서부터 돌아서 swap으로 옮겨 온 요소는 이미 처리된 상태
+    FVector CameraLocation = FVector::ZeroVector;
+    const bool bCullByDistance = bCullOffScreenFloats && GetCameraLocation(CameraLocation);
+    const double MaxDistanceSquared = FMath::Square(static_cast<double>(MaxDistanceFromCamera));
+    const float InvLifetime = DamageFloatLifetime > 0.0f ? 1.0f / DamageFloatLifetime : 0.0f;
 
-    for (int32 i = 0; i < ActiveFloats.Num(); ++i)
+    for (int32 i = NumFloats - 1; i >= 0; --i)
     {
         FDamageFloatData& FloatData = ActiveFloats[i];
+        FloatData.RemainingLifetime = Lifetimes[i];
+        FloatData.VerticalOffset = Offsets[i];
 
-        // Update lifetime
-        FloatData.RemainingLifetime -= DeltaTime;
-
-        if (FloatData.RemainingLifetime <= 0.0f)
+        if (FloatData.RemainingLifetime <= 0.0f
+            || (bCullByDistance && FVector::DistSquared(FloatData.GetCurrentWorldPosition(), CameraLocation) > MaxDistanceSquared))
         {
-            IndicesToRemove.Add(i);
+            RemoveFloatAtSwap(i);
             continue;
         }
 
-        // Animate: Float upwards (독립적으로!)
-        FloatData.VerticalOffset += VerticalFloatSpeed * DeltaTime;
-
         // Fade out
-        float LifetimePercent = FloatData.RemainingLifetime / DamageFloatLifetime;
-        FloatData.TextColor.A = FMath::Clamp(LifetimePercent, 0.0f, 1.0f);
-    }
-
-    // Remove expired floats (reverse iteration)
-    for (int32 i = IndicesToRemove.Num() - 1; i >= 0; --i)
-    {
-        ActiveFloats.RemoveAt(IndicesToRemove[i]);
+        FloatData.TextColor.A = FMath::Clamp(FloatData.RemainingLifetime * InvLifetime, 0.0f, 1.0f);
     }
+}
 
-    // Optional: Cull off-screen floats
-    if (bCullOffScreenFloats)
+int32 UDamageFloatManagerComponent::FindCoalesceTarget(const AActor* DamagedActor) const
+{
+    const TObjectKey<AActor> DamagedActorKey(DamagedActor);
+    for (const FSpawnedFloat& Spawned : SpawnedThisFrame)
     {
-        CullDistantFloats();
+        if (Spawned.DamagedActor == DamagedActorKey)
+        {
+            return Spawned.Index;
+        }
     }
+    return INDEX_NONE;
+}
 
-    // Shrink if over-allocated
-    if (ActiveFloats.Max() > MaxActiveDamageFloats * 2 && ActiveFloats.Num() < MaxActiveDamageFloats / 2)
+int32 UDamageFloatManagerComponent::FindOldestFloat() const
+{
+    int32 OldestIndex = 0;
+    for (int32 i = 1; i < RemainingLifetimes.Num(); ++i)
     {
-        ActiveFloats.Shrink();
+        if (RemainingLifetimes[i] < RemainingLifetimes[OldestIndex])
+        {
+            OldestIndex = i;
+        }
     }
+    return OldestIndex;
 }
 
-void UDamageFloatManagerComponent::CullDistantFloats()
+void UDamageFloatManagerComponent::RemoveFloatAtSwap(int32 Index)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    const int32 LastIndex = ActiveFloats.Num() - 1;
 
-    APlayerController* PC = World->GetFirstPlayerController();
-    if (!IsValid(PC)) return;
+    ActiveFloats.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    RemainingLifetimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    VerticalOffsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 
-    APlayerCameraManager* CameraManager = PC->PlayerCameraManager;
-    if (!IsValid(CameraManager)) return;
+    // 이번 프레임 생성 목록의 인덱스도 같이 옮김
+    SpawnedThisFrame.RemoveAllSwap([Index](const FSpawnedFloat& Spawned) { return Spawned.Index == Index; }, EAllowShrinking::No);
+    if (Index != LastIndex)
+    {
+        for (FSpawnedFloat& Spawned : SpawnedThisFrame)
+        {
+            if (Spawned.Index == LastIndex)
+            {
+                Spawned.Index = Index;
+                break;
+            }
+        }
+    }
+}
 
-    FVector CameraLocation = CameraManager->GetCameraLocation();
+bool UDamageFloatManagerComponent::GetCameraLocation(FVector& OutLocation)
+{
+    // 보통 PlayerController나 HUD에 붙어 있으므로 매 프레임 GetFirstPlayerController를 부르지 않음
+    APlayerController* PC = CachedPlayerController.Get();
+    if (!PC)
+    {
+        const AHUD* HUD = Cast<AHUD>(GetOwner());
+        PC = HUD ? HUD->PlayerOwner.Get() : Cast<APlayerController>(GetOwner());
+        if (!PC && GetWorld())
+        {
+            PC = GetWorld()->GetFirstPlayerController();
+        }
+        CachedPlayerController = PC;
+    }
 
-    // Remove floats too far from camera
-    ActiveFloats.RemoveAll([&](const FDamageFloatData& FloatData)
+    if (!IsValid(PC) || !IsValid(PC->PlayerCameraManager))
     {
-        float Distance = FVector::Dist(FloatData.GetCurrentWorldPosition(), CameraLocation);
-        return Distance > MaxDistanceFromCamera;
-    });
-}
\ No newline at end of file
+        return false;
+    }
+
+    OutLocation = PC->PlayerCameraManager->GetCameraLocation();
+    return true;
+}
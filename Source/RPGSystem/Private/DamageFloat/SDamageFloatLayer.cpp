@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageFloat/SDamageFloatLayer.h"
+#include "DamageFloat/DamageFloatManagerComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/HUD.h"
+#include "GameFramework/PlayerController.h"
+#include "Rendering/DrawElements.h"
+#include "SceneView.h"
+
+namespace DamageFloatLayer
+{
+	// 문자열 폭 측정 대신 쓰는 숫자 한 글자의 대략적인 폭 (폰트 크기 대비)
+	constexpr float DigitWidthRatio = 0.6f;
+}
+
+void SDamageFloatLayer::Construct(const FArguments& InArgs)
+{
+	// 매 프레임 숫자가 움직이므로 캐싱하지 않음
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+void SDamageFloatLayer::SetManager(UDamageFloatManagerComponent* InManager)
+{
+	Manager = InManager;
+}
+
+void SDamageFloatLayer::SetOwningPlayer(APlayerController* InOwningPlayer)
+{
+	OwningPlayer = InOwningPlayer;
+}
+
+void SDamageFloatLayer::SetFonts(const FSlateFontInfo& InFont, float CriticalFontScale)
+{
+	Font = InFont;
+	CriticalFont = InFont;
+	CriticalFont.Size = FMath::RoundToFloat(InFont.Size * CriticalFontScale);
+}
+
+int32 SDamageFloatLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UDamageFloatManagerComponent* DamageFloatManager = Manager.Get();
+	if (!DamageFloatManager || DamageFloatManager->GetActiveDamageFloatCount() == 0)
+	{
+		return LayerId;
+	}
+
+	const APlayerController* PC = OwningPlayer.Get();
+	if (!PC)
+	{
+		const AActor* ManagerOwner = DamageFloatManager->GetOwner();
+		const AHUD* HUD = Cast<AHUD>(ManagerOwner);
+		PC = HUD ? HUD->PlayerOwner.Get() : Cast<APlayerController>(ManagerOwner);
+	}
+
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+	{
+		return LayerId;
+	}
+
+	// 투영 행렬은 프레임당 한 번
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return LayerId;
+	}
+	const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+
+	FVector2D ViewportSize;
+	LocalPlayer->ViewportClient->GetViewportSize(ViewportSize);
+	if (ViewportSize.X <= 0.0 || ViewportSize.Y <= 0.0)
+	{
+		return LayerId;
+	}
+
+	// 뷰포트 픽셀 -> 이 위젯의 로컬 좌표 (레이어가 뷰포트 전체를 덮는다고 가정)
+	const FVector2D PixelToLocal = AllottedGeometry.GetLocalSize() / ViewportSize;
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+
+	for (const FDamageFloatData& FloatData : DamageFloatManager->GetActiveDamageFloats())
+	{
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(FloatData.GetCurrentWorldPosition(), ViewRect, ViewProjectionMatrix, ScreenPosition))
+		{
+			continue;
+		}
+
+		const FSlateFontInfo& FloatFont = FloatData.bIsCritical ? CriticalFont : Font;
+
+		// 숫자 중앙이 투영 위치에 오도록
+		const FVector2D CenterOffset(-0.5f * FloatData.DamageText.Len() * FloatFont.Size * DamageFloatLayer::DigitWidthRatio, -0.5f * FloatFont.Size);
+		const FVector2D LocalPosition = ScreenPosition * PixelToLocal + CenterOffset;
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FSlateLayoutTransform(FVector2f(LocalPosition))),
+			FloatData.DamageText,
+			FloatFont,
+			ESlateDrawEffect::None,
+			FloatData.TextColor * Tint);
+	}
+
+	return LayerId;
+}
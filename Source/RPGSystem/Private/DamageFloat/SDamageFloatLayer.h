@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Fonts/SlateFontInfo.h"
+
+class APlayerController;
+class UDamageFloatManagerComponent;
+
+/**
+ * UDamageFloatLayerWidget의 Slate 구현
+ * 뷰-프로젝션 행렬을 한 번 구해서 모든 숫자를 투영하고 텍스트 요소로 그림
+ */
+class SDamageFloatLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDamageFloatLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetManager(UDamageFloatManagerComponent* InManager);
+
+	// 투영에 쓸 플레이어, 없으면 매니저가 붙은 PlayerController 또는 HUD의 PlayerOwner
+	void SetOwningPlayer(APlayerController* InOwningPlayer);
+	void SetFonts(const FSlateFontInfo& InFont, float CriticalFontScale);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	TWeakObjectPtr<UDamageFloatManagerComponent> Manager;
+	TWeakObjectPtr<APlayerController> OwningPlayer;
+
+	FSlateFontInfo Font;
+	FSlateFontInfo CriticalFont;
+};
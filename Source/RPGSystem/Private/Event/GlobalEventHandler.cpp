@@ -3,7 +3,10 @@
 
 #include "Event/GlobalEventHandler.h"
 #include "GameplayTagContainer.h"
+#include "GameplayTagsManager.h"
 #include "Event/RPGEventBase.h"
+#include "Engine/GameInstance.h"
+#include "TimerManager.h"
 
 
 void UGlobalEventHandler::CallGlobalEventByClass(UObject* Publisher, TSubclassOf<URPGEventBase> EventClass,
@@ -33,6 +36,15 @@ void UGlobalEventHandler::CallGlobalEventByGameplayTag(UObject* Publisher, FGame
 	{
 		return;
 	}
+
+	//Native subscribers receive the Metadata as is
+	FRPGNativeEvent Event;
+	Event.EventTag = EventGameplayTag;
+	Event.Publisher = Publisher;
+	Event.Target = Payload;
+	Event.Metadata = &Metadata;
+	DispatchNative(Event);
+
 	CallGlobalEvent(Publisher, Payload, Metadata, ListenerEventsByGameplayTag, EventGameplayTag);
 }
 
@@ -240,3 +252,344 @@ UGlobalEventHandler* UGlobalEventHandler::Get(const UObject* WorldContextObject)
 	}
 	return nullptr;
 }
+
+/**
+Native Events
+**/
+
+FDelegateHandle UGlobalEventHandler::SubscribeNative(const FGameplayTag& EventGameplayTag, FRPGNativeEventDelegate&& Delegate, const bool bMatchChildTags)
+{
+	if (!EventGameplayTag.IsValid() || !Delegate.IsBound())
+	{
+		return FDelegateHandle();
+	}
+
+	FNativeSubscriber Subscriber;
+	Subscriber.Handle = Delegate.GetHandle();
+	Subscriber.Delegate = MoveTemp(Delegate);
+	Subscriber.bMatchChildTags = bMatchChildTags;
+
+	const FDelegateHandle Handle = Subscriber.Handle;
+
+	//Don't touch the arrays that are being iterated
+	if (DispatchDepth > 0)
+	{
+		PendingSubscribers.Emplace(EventGameplayTag, MoveTemp(Subscriber));
+	}
+	else
+	{
+		AddNativeSubscriber(EventGameplayTag, MoveTemp(Subscriber));
+	}
+
+	return Handle;
+}
+
+void UGlobalEventHandler::UnsubscribeNative(const FGameplayTag& EventGameplayTag, const FDelegateHandle& Handle)
+{
+	PendingSubscribers.RemoveAll([&Handle](const TPair<FGameplayTag, FNativeSubscriber>& Pending)
+	{
+		return Pending.Value.Handle == Handle;
+	});
+
+	if (TArray<FNativeSubscriber>* Subscribers = NativeSubscribers.Find(EventGameplayTag))
+	{
+		for (FNativeSubscriber& Subscriber : *Subscribers)
+		{
+			if (Subscriber.Handle == Handle)
+			{
+				Subscriber.bRemoved = true;
+				bHasRemovedSubscribers = true;
+			}
+		}
+	}
+
+	if (DispatchDepth == 0)
+	{
+		CompactNativeSubscribers();
+	}
+}
+
+void UGlobalEventHandler::UnsubscribeAllNative(const void* UserObject)
+{
+	if (!UserObject)
+	{
+		return;
+	}
+
+	PendingSubscribers.RemoveAll([UserObject](const TPair<FGameplayTag, FNativeSubscriber>& Pending)
+	{
+		return Pending.Value.Delegate.IsBoundToObject(UserObject);
+	});
+
+	for (TPair<FGameplayTag, TArray<FNativeSubscriber>>& Pair : NativeSubscribers)
+	{
+		for (FNativeSubscriber& Subscriber : Pair.Value)
+		{
+			if (Subscriber.Delegate.IsBoundToObject(UserObject))
+			{
+				Subscriber.bRemoved = true;
+				bHasRemovedSubscribers = true;
+			}
+		}
+	}
+
+	if (DispatchDepth == 0)
+	{
+		CompactNativeSubscribers();
+	}
+}
+
+void UGlobalEventHandler::FlushDeferredEvents()
+{
+	if (bIsFlushing || DeferredEvents.Events.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UGlobalEventHandler::FlushDeferredEvents"));
+
+	//Events published while flushing go to the other buffer and are drained on the next tick
+	bIsFlushing = true;
+	Swap(DeferredEvents, FlushingEvents);
+
+	for (const FDeferredEvent& Deferred : FlushingEvents.Events)
+	{
+		FRPGNativeEvent Event;
+		Event.EventTag = Deferred.EventTag;
+		Event.Publisher = Deferred.Publisher.Get();
+		Event.Target = Deferred.Target.Get();
+		Event.PayloadType = Deferred.PayloadType;
+		Event.Payload = FlushingEvents.GetPayload(Deferred);
+
+		if (Event.Publisher)
+		{
+			DispatchEvent(Event, Deferred.AppendMetadata);
+		}
+	}
+
+	FlushingEvents.Reset();
+	bIsFlushing = false;
+
+	if (DeferredEvents.Events.Num() > 0)
+	{
+		if (const UGameInstance* GameInstance = GetGameInstance())
+		{
+			GameInstance->GetTimerManager().SetTimerForNextTick(this, &UGlobalEventHandler::FlushDeferredEvents);
+		}
+	}
+}
+
+void UGlobalEventHandler::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	UGlobalEventHandler* This = CastChecked<UGlobalEventHandler>(InThis);
+
+	//Keeps e.g. the killer of a queued kill event alive until the queue is flushed
+	This->DeferredEvents.AddReferencedObjects(Collector);
+	This->FlushingEvents.AddReferencedObjects(Collector);
+}
+
+void UGlobalEventHandler::Deinitialize()
+{
+	//Payloads may own memory, e.g. strings
+	DeferredEvents.Reset();
+	FlushingEvents.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UGlobalEventHandler::HasBlueprintListeners(const FGameplayTag& EventGameplayTag) const
+{
+	const FRPGOnEventCalledMulticast* Multicast = ListenerEventsByGameplayTag.Find(EventGameplayTag);
+	return Multicast && Multicast->IsBound();
+}
+
+void UGlobalEventHandler::DispatchEvent(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata)
+{
+	if (!Event.Publisher || !Event.EventTag.IsValid())
+	{
+		return;
+	}
+
+	DispatchNative(Event);
+
+	//Blueprint listeners get the payload as strings, only built if anyone listens
+	if (const FRPGOnEventCalledMulticast* Multicast = ListenerEventsByGameplayTag.Find(Event.EventTag))
+	{
+		if (Multicast->IsBound())
+		{
+			TArray<FString> Metadata;
+			Metadata.Add(FString::Printf(TEXT("EventTag=%s"), *Event.EventTag.ToString()));
+			AppendMetadata(Event.Payload, Metadata);
+
+			Multicast->Broadcast(Event.Publisher, Event.Target, Metadata);
+		}
+	}
+}
+
+void UGlobalEventHandler::DispatchNative(const FRPGNativeEvent& Event)
+{
+	if (NativeSubscribers.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FGameplayTag, TInlineAllocator<8>> Route;
+	GetNativeRoute(Event.EventTag, Route);
+
+	++DispatchDepth;
+
+	for (const FGameplayTag& SubscribedTag : Route)
+	{
+		const TArray<FNativeSubscriber>* Subscribers = NativeSubscribers.Find(SubscribedTag);
+		if (!Subscribers)
+		{
+			continue;
+		}
+
+		const bool bExactMatch = SubscribedTag == Event.EventTag;
+
+		//Subscribers are only flagged while dispatching, never added or removed
+		for (const FNativeSubscriber& Subscriber : *Subscribers)
+		{
+			if (!Subscriber.bRemoved && (bExactMatch || Subscriber.bMatchChildTags))
+			{
+				Subscriber.Delegate.ExecuteIfBound(Event);
+			}
+		}
+	}
+
+	--DispatchDepth;
+
+	if (DispatchDepth == 0)
+	{
+		for (TPair<FGameplayTag, FNativeSubscriber>& Pending : PendingSubscribers)
+		{
+			AddNativeSubscriber(Pending.Key, MoveTemp(Pending.Value));
+		}
+		PendingSubscribers.Reset();
+
+		CompactNativeSubscribers();
+	}
+}
+
+void UGlobalEventHandler::EnqueueEvent(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata)
+{
+	if (!Event.Publisher || !Event.EventTag.IsValid())
+	{
+		return;
+	}
+
+	DeferredEvents.Add(Event, AppendMetadata);
+
+	//Drained once per frame
+	if (DeferredEvents.Events.Num() == 1 && !bIsFlushing)
+	{
+		if (const UGameInstance* GameInstance = GetGameInstance())
+		{
+			GameInstance->GetTimerManager().SetTimerForNextTick(this, &UGlobalEventHandler::FlushDeferredEvents);
+		}
+	}
+}
+
+void UGlobalEventHandler::FDeferredEventQueue::Add(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata)
+{
+	const UScriptStruct* PayloadType = Event.PayloadType;
+	checkf(uint32(PayloadType->GetMinAlignment()) <= DeferredPayloadAlignment, TEXT("Deferred event payload %s is over-aligned"), *PayloadType->GetName());
+
+	const int32 Offset = Align(PayloadMemory.Num(), PayloadType->GetMinAlignment());
+	PayloadMemory.SetNumUninitialized(Offset + PayloadType->GetStructureSize());
+
+	FDeferredEvent& Deferred = Events.AddDefaulted_GetRef();
+	Deferred.EventTag = Event.EventTag;
+	Deferred.Publisher = Event.Publisher;
+	Deferred.Target = Event.Target;
+	Deferred.PayloadType = PayloadType;
+	Deferred.PayloadOffset = Offset;
+	Deferred.AppendMetadata = AppendMetadata;
+
+	//Copied through the struct ops, so payloads with object references or non-trivial members are safe to queue
+	uint8* Payload = GetPayload(Deferred);
+	PayloadType->InitializeStruct(Payload);
+	PayloadType->CopyScriptStruct(Payload, Event.Payload);
+}
+
+void UGlobalEventHandler::FDeferredEventQueue::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (const FDeferredEvent& Deferred : Events)
+	{
+		Collector.AddPropertyReferencesWithStructARO(Deferred.PayloadType, GetPayload(Deferred));
+	}
+}
+
+void UGlobalEventHandler::FDeferredEventQueue::Reset()
+{
+	for (const FDeferredEvent& Deferred : Events)
+	{
+		Deferred.PayloadType->DestroyStruct(GetPayload(Deferred));
+	}
+
+	Events.Reset();
+	PayloadMemory.Reset();
+}
+
+void UGlobalEventHandler::AddNativeSubscriber(const FGameplayTag& EventGameplayTag, FNativeSubscriber&& Subscriber)
+{
+	TArray<FNativeSubscriber>* Subscribers = NativeSubscribers.Find(EventGameplayTag);
+	if (!Subscribers)
+	{
+		//A new subscribed tag can change the route of any published tag below it
+		Subscribers = &NativeSubscribers.Add(EventGameplayTag);
+		NativeRoutes.Reset();
+	}
+
+	Subscribers->Add(MoveTemp(Subscriber));
+}
+
+void UGlobalEventHandler::CompactNativeSubscribers()
+{
+	if (!bHasRemovedSubscribers)
+	{
+		return;
+	}
+
+	bHasRemovedSubscribers = false;
+
+	for (auto It = NativeSubscribers.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAll([](const FNativeSubscriber& Subscriber)
+		{
+			return Subscriber.bRemoved;
+		});
+
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+			NativeRoutes.Reset();
+		}
+	}
+}
+
+void UGlobalEventHandler::GetNativeRoute(const FGameplayTag& EventGameplayTag, TArray<FGameplayTag, TInlineAllocator<8>>& OutRoute)
+{
+	if (const TArray<FGameplayTag, TInlineAllocator<8>>* CachedRoute = NativeRoutes.Find(EventGameplayTag))
+	{
+		OutRoute = *CachedRoute;
+		return;
+	}
+
+	//Contains the tag itself and all of its parents
+	const FGameplayTagContainer TagAndParents = UGameplayTagsManager::Get().RequestGameplayTagParents(EventGameplayTag);
+
+	TArray<FGameplayTag, TInlineAllocator<8>>& NewRoute = NativeRoutes.Add(EventGameplayTag);
+	for (const FGameplayTag& Tag : TagAndParents)
+	{
+		if (NativeSubscribers.Contains(Tag))
+		{
+			NewRoute.Add(Tag);
+		}
+	}
+
+	OutRoute = NewRoute;
+}
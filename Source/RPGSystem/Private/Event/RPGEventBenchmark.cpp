@@ -0,0 +1,179 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Event/RPGEventBenchmark.h"
+
+void URPGEventBenchmarkListener::OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata)
+{
+	for (const FString& Entry : Metadata)
+	{
+		if (Entry.StartsWith(TEXT("Amount=")))
+		{
+			TotalAmount += FCString::Atoi(*Entry.RightChop(7));
+			break;
+		}
+	}
+}
+
+void URPGEventBenchmarkListener::OnNativeEvent(const FRPGNativeEvent& Event)
+{
+	if (const FRPGKillEventPayload* KillPayload = Event.GetPayload<FRPGKillEventPayload>())
+	{
+		TotalAmount += KillPayload->Amount;
+	}
+	else if (const FRPGLocationEventPayload* LocationPayload = Event.GetPayload<FRPGLocationEventPayload>())
+	{
+		LastTrigger = LocationPayload->Trigger;
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Event/GlobalEventHandler.h"
+#include "RPGSystemGameplayTags.h"
+#include "Shared/RPGBenchmark.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace EventBenchmark
+{
+	constexpr int32 NumEvents = 100000;
+	constexpr int32 NumListeners = 8;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRPGEventDispatchBenchmark, "RPGSystem.Benchmark.Event.Dispatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FRPGEventDispatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace EventBenchmark;
+
+	const FGameplayTag KillTag = RPGGameplayTags::Event_Combat_Kill.GetTag();
+	if (!TestTrue(TEXT("Kill event tag is registered"), KillTag.IsValid()))
+	{
+		return false;
+	}
+
+	//Standalone handler, so the benchmark does not reach listeners of the running game
+	const TStrongObjectPtr<UGlobalEventHandler> Handler(NewObject<UGlobalEventHandler>(GetTransientPackage()));
+	const TStrongObjectPtr<URPGEventBenchmarkListener> Publisher(NewObject<URPGEventBenchmarkListener>(GetTransientPackage()));
+
+	TArray<TStrongObjectPtr<URPGEventBenchmarkListener>> Listeners;
+	for (int32 Index = 0; Index < NumListeners; ++Index)
+	{
+		Listeners.Emplace(NewObject<URPGEventBenchmarkListener>(GetTransientPackage()));
+	}
+
+	const auto CheckReceived = [this, &Listeners](const TCHAR* PathName)
+	{
+		int32 NumIncomplete = 0;
+		for (const TStrongObjectPtr<URPGEventBenchmarkListener>& Listener : Listeners)
+		{
+			NumIncomplete += Listener->TotalAmount != NumEvents;
+			Listener->TotalAmount = 0;
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: listeners that missed events"), PathName), NumIncomplete, 0);
+	};
+
+	FRPGBenchmarkReport Report(TEXT("EventDispatch"));
+
+	FRPGKillEventPayload KillPayload;
+	KillPayload.Amount = 1;
+
+	//Blueprint path, with Metadata built per publish like the publishers used to
+	for (const TStrongObjectPtr<URPGEventBenchmarkListener>& Listener : Listeners)
+	{
+		FRPGOnEventCalledSingle Delegate;
+		Delegate.BindUFunction(Listener.Get(), GET_FUNCTION_NAME_CHECKED(URPGEventBenchmarkListener, OnGlobalEvent));
+		Handler->BindGlobalEventByGameplayTag(KillTag, Delegate);
+	}
+
+	Report.Measure(TEXT("BlueprintPublish"), [&]()
+	{
+		for (int32 Index = 0; Index < NumEvents; ++Index)
+		{
+			TArray<FString> Metadata;
+			Metadata.Add(FString::Printf(TEXT("EventTag=%s"), *KillTag.ToString()));
+			Metadata.Add(TEXT("Amount=1"));
+			Metadata.Add(FString::Printf(TEXT("Killer=%s"), *Publisher->GetPathName()));
+
+			Handler->CallGlobalEventByGameplayTag(Publisher.Get(), KillTag, Publisher.Get(), Metadata);
+		}
+		return int64(0);
+	});
+	CheckReceived(TEXT("Blueprint"));
+
+	Handler->ClearGlobalEventByGameplayTag(KillTag, true);
+
+	//Native path
+	for (const TStrongObjectPtr<URPGEventBenchmarkListener>& Listener : Listeners)
+	{
+		Handler->SubscribeNative(KillTag, FRPGNativeEventDelegate::CreateUObject(Listener.Get(), &URPGEventBenchmarkListener::OnNativeEvent));
+	}
+
+	Report.Measure(TEXT("NativePublish"), [&]()
+	{
+		for (int32 Index = 0; Index < NumEvents; ++Index)
+		{
+			Handler->PublishEvent(Publisher.Get(), KillTag, Publisher.Get(), KillPayload);
+		}
+		return int64(0);
+	});
+	CheckReceived(TEXT("Native"));
+
+	//Deferred native path, including the drain
+	Report.Measure(TEXT("DeferredPublish"), [&]()
+	{
+		for (int32 Index = 0; Index < NumEvents; ++Index)
+		{
+			Handler->PublishEventDeferred(Publisher.Get(), KillTag, Publisher.Get(), KillPayload);
+		}
+		Handler->FlushDeferredEvents();
+		return int64(0);
+	});
+	CheckReceived(TEXT("Deferred"));
+
+	for (const TStrongObjectPtr<URPGEventBenchmarkListener>& Listener : Listeners)
+	{
+		Handler->UnsubscribeAllNative(Listener.Get());
+	}
+
+	return Report.Submit(*this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRPGEventDeferredPayloadReferencesTest, "RPGSystem.Event.DeferredPayloadReferences",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FRPGEventDeferredPayloadReferencesTest::RunTest(const FString& Parameters)
+{
+	const FGameplayTag LocationTag = RPGGameplayTags::Event_World_LocationEntered.GetTag();
+	if (!TestTrue(TEXT("Location event tag is registered"), LocationTag.IsValid()))
+	{
+		return false;
+	}
+
+	const TStrongObjectPtr<UGlobalEventHandler> Handler(NewObject<UGlobalEventHandler>(GetTransientPackage()));
+	const TStrongObjectPtr<URPGEventBenchmarkListener> Listener(NewObject<URPGEventBenchmarkListener>(GetTransientPackage()));
+	Handler->SubscribeNative(LocationTag, FRPGNativeEventDelegate::CreateUObject(Listener.Get(), &URPGEventBenchmarkListener::OnNativeEvent));
+
+	//Only the queued payload references the trigger
+	FRPGLocationEventPayload Payload;
+	Payload.LocationTag = LocationTag;
+	Payload.Trigger = NewObject<URPGEventBenchmarkListener>(GetTransientPackage());
+	const TWeakObjectPtr<UObject> WeakTrigger = Payload.Trigger;
+
+	Handler->PublishEventDeferred(Listener.Get(), LocationTag, nullptr, Payload);
+	Payload.Trigger = nullptr;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	TestTrue(TEXT("Trigger survives GC while queued"), WeakTrigger.IsValid());
+
+	Handler->FlushDeferredEvents();
+	TestTrue(TEXT("Flushed payload still points to the trigger"), Listener->LastTrigger.IsValid() && Listener->LastTrigger == WeakTrigger);
+
+	Handler->UnsubscribeAllNative(Listener.Get());
+	return true;
+}
+
+#endif
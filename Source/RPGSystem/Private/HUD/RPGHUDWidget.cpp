@@ -5,6 +5,8 @@
 
 #include "Inventory/DragDrop/InventoryDragDropOperation.h"
 #include "Status/StatsViewModel.h"
+#include "UI/Navigation/NavigationMarkerLayerWidget.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
 
 
 void URPGHUDWidget::NativeConstruct()
@@ -28,6 +30,94 @@ void URPGHUDWidget::SetViewModel(UStatsViewModel* InViewModel)
 	StatsViewModel = InViewModel;
 }
 
+void URPGHUDWidget::AddOrUpdateWorldMarker(UObject* MarkerObject, const FWorldMarkerInfo& MarkerInfo)
+{
+	UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this);
+	if (Layer_WorldMarkers && MarkerSubsystem)
+	{
+		// 미니맵/나침반이 같은 대상을 등록했으면 그 뷰는 유지, 대상 검증은 서브시스템이 함
+		ENavigationMarkerFlags Flags = MarkerSubsystem->GetMarkerViews(MarkerObject) | ENavigationMarkerFlags::WorldMarker;
+		if (MarkerInfo.ScreenPersistance)
+		{
+			Flags |= ENavigationMarkerFlags::ClampToEdge;
+		}
+		MarkerSubsystem->AddOrUpdateMarker(MarkerObject, MarkerInfo.MarkerIcon, MarkerInfo.MarkerIconColor, MarkerInfo.MarkerScale, static_cast<int32>(Flags));
+		if (MarkerSubsystem->HasMarker(MarkerObject))
+		{
+			LayerWorldMarkers.Add(MarkerObject);
+		}
+		return;
+	}
+
+	// 배치 레이어가 없는 블루프린트는 마커마다 위젯을 화면에 추가
+	if (!MarkerObject || !WorldMarkerClass)
+	{
+		return;
+	}
+
+	UWorldMarkerWidget* MarkerWidget = WorldMarkerMap.FindRef(MarkerObject);
+	if (!MarkerWidget)
+	{
+		MarkerWidget = CreateWidget<UWorldMarkerWidget>(GetOwningPlayer(), WorldMarkerClass);
+		if (!MarkerWidget)
+		{
+			return;
+		}
+		MarkerWidget->MarkerObject = MarkerObject;
+		MarkerWidget->AddToPlayerScreen();
+		WorldMarkerMap.Add(MarkerObject, MarkerWidget);
+	}
+
+	MarkerWidget->MarkerInfo = MarkerInfo;
+	MarkerWidget->MarkerScale = MarkerInfo.MarkerScale;
+	MarkerWidget->bUseMarkerArrow = MarkerInfo.UseMarkerArrow;
+	MarkerWidget->bPingMarker = MarkerInfo.PingMarker;
+	MarkerWidget->bScreenPersistance = MarkerInfo.ScreenPersistance;
+}
+
+void URPGHUDWidget::RemoveWorldMarker(UObject* MarkerObject)
+{
+	if (LayerWorldMarkers.Remove(MarkerObject) > 0)
+	{
+		if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+		{
+			MarkerSubsystem->RemoveMarkerViews(MarkerObject, ENavigationMarkerFlags::WorldMarker);
+		}
+	}
+
+	TObjectPtr<UWorldMarkerWidget> MarkerWidget;
+	if (WorldMarkerMap.RemoveAndCopyValue(MarkerObject, MarkerWidget) && MarkerWidget)
+	{
+		MarkerWidget->RemoveFromParent();
+	}
+}
+
+void URPGHUDWidget::RemoveAllWorldMarkers()
+{
+	// 이 HUD가 등록한 레이어 마커의 월드 마커 뷰만 제거 (다른 뷰의 마커는 유지)
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+	{
+		for (const TWeakObjectPtr<UObject>& Marker : LayerWorldMarkers)
+		{
+			// 파괴된 대상의 마커는 서브시스템이 이미 제거함
+			if (UObject* MarkerObject = Marker.Get())
+			{
+				MarkerSubsystem->RemoveMarkerViews(MarkerObject, ENavigationMarkerFlags::WorldMarker);
+			}
+		}
+	}
+	LayerWorldMarkers.Empty();
+
+	for (const TPair<TObjectPtr<UObject>, TObjectPtr<UWorldMarkerWidget>>& Pair : WorldMarkerMap)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->RemoveFromParent();
+		}
+	}
+	WorldMarkerMap.Empty();
+}
+
 bool URPGHUDWidget::NativeOnDrop(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent,
                                  UDragDropOperation* InOperation)
 {
@@ -3,3 +3,111 @@
 
 #include "HitBox/AnimNotifies/AnimNotify_SpawnHitboxProjectile.h"
 
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Shared/Subsystems/ObjectPoolSubsystem.h"
+
+void UAnimNotify_SpawnHitboxProjectile::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	if (!MeshComp || !ProjectileClass)
+	{
+		return;
+	}
+
+	// Only game worlds have a shared pool, animation editor previews spawn nothing
+	UObjectPoolSubsystem* Pool = UObjectPoolSubsystem::Get(MeshComp);
+	if (!Pool)
+	{
+		return;
+	}
+
+	const FTransform SocketTransform = ParentSocket != NAME_None ? MeshComp->GetSocketTransform(ParentSocket) : MeshComp->GetComponentTransform();
+	const FTransform OffsetTransform(ProjectileBulkSpawnSettings.RotationOffset, ProjectileBulkSpawnSettings.LocationOffset);
+
+	// Mesh scale should not scale the spawn pattern
+	const FTransform BaseTransform = OffsetTransform * FTransform(SocketTransform.GetRotation(), SocketTransform.GetLocation());
+
+	TArray<FTransform> SpawnTransforms;
+	GetProjectileSpawnTransforms(BaseTransform, SpawnTransforms);
+
+	AActor* OwnerActor = MeshComp->GetOwner();
+	APawn* InstigatorPawn = OwnerActor ? OwnerActor->GetInstigator() : nullptr;
+
+	for (const FTransform& SpawnTransform : SpawnTransforms)
+	{
+		AActor* Projectile = Pool->AcquireActor(ProjectileClass, SpawnTransform, OwnerActor, InstigatorPawn);
+		if (!Projectile)
+		{
+			continue;
+		}
+
+		if (UProjectileMovementComponent* Movement = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+		{
+			// A stopped movement component lets go of its updated component
+			if (!Movement->UpdatedComponent)
+			{
+				Movement->SetUpdatedComponent(Projectile->GetRootComponent());
+			}
+			Movement->Velocity = SpawnTransform.GetRotation().GetForwardVector() * ProjectileBulkSpawnSettings.ProjectileSpeed;
+			Movement->Activate();
+		}
+	}
+}
+
+void UAnimNotify_SpawnHitboxProjectile::GetProjectileSpawnTransforms(const FTransform& BaseTransform, TArray<FTransform>& OutTransforms) const
+{
+	const int32 Amount = FMath::Max<int32>(ProjectileBulkSpawnSettings.AmountToSpawnAtOnce, 1);
+	OutTransforms.Reset(Amount);
+
+	const FHitboxSpawnTypeSettings& Settings = ProjectileSpawnSettings;
+	const float MinRandomDirection = ProjectileBulkSpawnSettings.MinXYRandomVelocityDirection;
+	const float MaxRandomDirection = ProjectileBulkSpawnSettings.MaxXYRandomVelocityDirection;
+
+	// A full circle must not place the first and last projectile on the same spot
+	float CircleAngleStep = 0.f;
+	if (Settings.MaxCircleAngle >= 360.f)
+	{
+		CircleAngleStep = 360.f / Amount;
+	}
+	else if (Amount > 1)
+	{
+		CircleAngleStep = Settings.MaxCircleAngle / (Amount - 1);
+	}
+
+	for (int32 Index = 0; Index < Amount; ++Index)
+	{
+		FVector LocalOffset = FVector::ZeroVector;
+		FVector LocalDirection = FVector::ForwardVector;
+
+		switch (Settings.SpawnType)
+		{
+		case ERHSSpawnType::RandomBoundingBox:
+			LocalOffset = FMath::RandPointInBox(FBox(-Settings.SpawnLocationVariance, Settings.SpawnLocationVariance));
+			break;
+
+		case ERHSSpawnType::EvenlyAlongVector:
+			// Centered on the socket
+			LocalOffset = Settings.SpawnLocationVariance * (Index - (Amount - 1) * 0.5f);
+			break;
+
+		case ERHSSpawnType::EvenlyInCircle:
+		{
+			const float Angle = -Settings.MaxCircleAngle * 0.5f + CircleAngleStep * Index;
+			LocalDirection = FVector::ForwardVector.RotateAngleAxis(Angle, Settings.CircleRotationAxis.GetSafeNormal());
+			LocalOffset = LocalDirection * Settings.CircleRadius;
+			break;
+		}
+		}
+
+		if (MinRandomDirection != 0.f || MaxRandomDirection != 0.f)
+		{
+			LocalDirection.X += FMath::FRandRange(MinRandomDirection, MaxRandomDirection);
+			LocalDirection.Y += FMath::FRandRange(MinRandomDirection, MaxRandomDirection);
+			LocalDirection.Normalize();
+		}
+
+		OutTransforms.Emplace(BaseTransform.TransformRotation(LocalDirection.ToOrientationQuat()), BaseTransform.TransformPosition(LocalOffset));
+	}
+}
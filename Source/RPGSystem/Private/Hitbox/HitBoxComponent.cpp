@@ -8,6 +8,7 @@
 #include "Combat/Combatable.h"
 #include "Combat/Components/CombatComponentBase.h"
 #include "GameFramework/Character.h"
+#include "Shared/RPGQueryStats.h"
 
 
 UHitBoxComponent::UHitBoxComponent()
@@ -63,7 +64,21 @@ void UHitBoxComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// 활성 상태일 때만 트레이스 수행
-	if (CurrentState == EHitBoxState::Active)
+	if (CurrentState != EHitBoxState::Active)
+	{
+		return;
+	}
+
+	if (bUseSubSteppedTrace)
+	{
+		// 지난 프레임에 요청한 스윕 결과 처리 후 이번 프레임 스윕 요청
+		ConsumeAsyncTraceResults();
+		if (CurrentState == EHitBoxState::Active)
+		{
+			PerformSubSteppedTrace();
+		}
+	}
+	else
 	{
 		PerformTrace();
 	}
@@ -104,6 +119,15 @@ void UHitBoxComponent::DeactivateHitBox()
 		return;
 	}
 
+	// 결과를 아직 받지 못한 스윕 처리 (마지막 프레임의 스윙 구간이 빠지지 않도록)
+	FlushPendingSweeps();
+
+	// 그 히트로 최대 히트 수에 도달해 이미 비활성화된 경우
+	if (CurrentState == EHitBoxState::Inactive)
+	{
+		return;
+	}
+
 	SetHitBoxState(EHitBoxState::Inactive);
 
 	// 틱 비활성화
@@ -122,6 +146,9 @@ void UHitBoxComponent::DeactivateHitBox()
 void UHitBoxComponent::ResetCombo()
 {
 	CurrentComboCount = 0;
+
+	// 진행 중인 스윙을 취소하므로 결과를 기다리는 스윕도 버림
+	PendingSweeps.Reset();
 	ClearHitActors();
 	CurrentHitCount = 0;
 	SetHitBoxState(EHitBoxState::Inactive);
@@ -152,51 +179,271 @@ void UHitBoxComponent::PerformTrace()
 	TArray<FHitResult> HitResults;
 	bool bHitDetected = false;
 
-	// 소켓별로 트레이스 수행
-	for (int32 i = 0; i < HitBoxSettings.TraceSocketNames.Num() - 1; ++i)
+	// 소켓별로 트레이스 수행 (쿼리 계측은 트레이스까지만, 히트 처리는 제외)
 	{
-		FName StartSocket = HitBoxSettings.TraceSocketNames[i];
-		FName EndSocket = HitBoxSettings.TraceSocketNames[i + 1];
+		RPG_QUERY_SCOPE(ERPGQuerySource::HitBox, RPGQuery_HitBox);
+		for (int32 i = 0; i < HitBoxSettings.TraceSocketNames.Num() - 1; ++i)
+		{
+			FName StartSocket = HitBoxSettings.TraceSocketNames[i];
+			FName EndSocket = HitBoxSettings.TraceSocketNames[i + 1];
 
-		if (!OwnerMesh->DoesSocketExist(StartSocket) || !OwnerMesh->DoesSocketExist(EndSocket))
+			if (!OwnerMesh->DoesSocketExist(StartSocket) || !OwnerMesh->DoesSocketExist(EndSocket))
+			{
+				continue;
+			}
+
+			FVector StartLocation = OwnerMesh->GetSocketLocation(StartSocket);
+			FVector EndLocation = OwnerMesh->GetSocketLocation(EndSocket);
+
+			TArray<FHitResult> CurrentHits;
+			bool bCurrentHit = false;
+
+			// 트레이스 타입에 따른 처리
+			switch (HitBoxSettings.TraceType)
+			{
+			case ETraceType::LineTrace:
+				bCurrentHit = PerformLineTrace(StartLocation, EndLocation, CurrentHits);
+				break;
+			case ETraceType::SphereTrace:
+				bCurrentHit = PerformSphereTrace(StartLocation, EndLocation, CurrentHits);
+				break;
+			case ETraceType::BoxTrace:
+				bCurrentHit = PerformBoxTrace(StartLocation, EndLocation, CurrentHits);
+				break;
+			case ETraceType::CapsuleTrace:
+				bCurrentHit = PerformCapsuleTrace(StartLocation, EndLocation, CurrentHits);
+				break;
+			}
+
+			RPG_QUERY_RECORD(ERPGQuerySource::HitBox, 1, CurrentHits.Num());
+
+			if (bCurrentHit)
+			{
+				bHitDetected = true;
+				HitResults.Append(CurrentHits);
+			}
+		}
+	}
+
+	// 히트 결과 처리
+	for (const FHitResult& Hit : HitResults)
+	{
+		ProcessHit(Hit);
+	}
+}
+
+void UHitBoxComponent::PerformSubSteppedTrace()
+{
+	if (!OwnerMesh || !GetWorld())
+	{
+		return;
+	}
+
+	RPG_QUERY_SCOPE(ERPGQuerySource::HitBox, RPGQuery_HitBox);
+
+	GatherSocketPositions(CurrentTracePositions, CurrentSocketValid);
+
+	const int32 NumSockets = CurrentTracePositions.Num();
+	if (NumSockets < 2)
+	{
+		PreviousTracePositions = CurrentTracePositions;
+		PreviousSocketValid = CurrentSocketValid;
+		return;
+	}
+
+	// 소켓 구성이 바뀌면 (SetTraceSettings, 메시 교체) 보간할 이전 포즈가 없으므로 현재 포즈만 스윕
+	if (PreviousTracePositions.Num() != NumSockets || PreviousSocketValid != CurrentSocketValid)
+	{
+		PreviousTracePositions = CurrentTracePositions;
+		PreviousSocketValid = CurrentSocketValid;
+		bPreviousPoseTraced = false;
+	}
+
+	const FCollisionShape Shape = MakeTraceShape();
+	const int32 NumSubSteps = CalculateSubStepCount();
+
+	// 이전 포즈(Alpha 0)는 지난 프레임의 마지막 서브스텝으로 이미 스윕됨
+	for (int32 Step = bPreviousPoseTraced ? 1 : 0; Step <= NumSubSteps; ++Step)
+	{
+		const float Alpha = static_cast<float>(Step) / NumSubSteps;
+
+		// PerformTrace와 같은 짝 (소켓 i-1 -> i), 없는 소켓이 낀 구간은 건너뜀
+		for (int32 i = 1; i < NumSockets; ++i)
 		{
-			continue;
+			if (!IsSegmentValid(i))
+			{
+				continue;
+			}
+
+			const FVector SegmentStart = FMath::Lerp(PreviousTracePositions[i - 1], CurrentTracePositions[i - 1], Alpha);
+			const FVector SegmentEnd = FMath::Lerp(PreviousTracePositions[i], CurrentTracePositions[i], Alpha);
+			RequestAsyncSweep(SegmentStart, SegmentEnd, Shape);
 		}
+	}
 
-		FVector StartLocation = OwnerMesh->GetSocketLocation(StartSocket);
-		FVector EndLocation = OwnerMesh->GetSocketLocation(EndSocket);
+	Swap(PreviousTracePositions, CurrentTracePositions);
+	Swap(PreviousSocketValid, CurrentSocketValid);
+	bPreviousPoseTraced = true;
+}
 
-		TArray<FHitResult> CurrentHits;
-		bool bCurrentHit = false;
+void UHitBoxComponent::ConsumeAsyncTraceResults()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingSweeps.Num() == 0)
+	{
+		return;
+	}
+
+	// ProcessHit에서 비활성화될 수 있으므로 복사본으로 처리
+	TArray<FPendingSweep> Sweeps = MoveTemp(PendingSweeps);
+	PendingSweeps.Reset();
+
+	// 핸들은 서브스텝 순서로 요청되므로 결과도 같은 순서
+	TArray<TArray<FHitResult>> SweepHits;
+	CollectSweepHits(Sweeps, SweepHits);
+
+	ProcessSweepResults(SweepHits);
+}
 
-		// 트레이스 타입에 따른 처리
-		switch (HitBoxSettings.TraceType)
+void UHitBoxComponent::FlushPendingSweeps()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingSweeps.Num() == 0)
+	{
+		PendingSweeps.Reset();
+		return;
+	}
+
+	TArray<FPendingSweep> Sweeps = MoveTemp(PendingSweeps);
+	PendingSweeps.Reset();
+
+	// 이미 끝난 비동기 결과는 그대로 쓰고, 아직 물리에서 처리 중인 구간만 동기로 다시 스윕
+	TArray<TArray<FHitResult>> SweepHits;
+	CollectSweepHits(Sweeps, SweepHits);
+
+	ProcessSweepResults(SweepHits);
+}
+
+void UHitBoxComponent::CollectSweepHits(const TArray<FPendingSweep>& Sweeps, TArray<TArray<FHitResult>>& OutSweepHits)
+{
+	UWorld* World = GetWorld();
+	check(World);
+
+	// 결과 수집만 쿼리 비용으로 계측, 히트 처리는 제외
+	RPG_QUERY_SCOPE(ERPGQuerySource::HitBox, RPGQuery_HitBox);
+
+	const FCollisionShape Shape = MakeTraceShape();
+	FTraceDatum TraceData;
+
+	OutSweepHits.Reserve(OutSweepHits.Num() + Sweeps.Num());
+	for (const FPendingSweep& Sweep : Sweeps)
+	{
+		TArray<FHitResult>& Hits = OutSweepHits.AddDefaulted_GetRef();
+		if (World->QueryTraceData(Sweep.Handle, TraceData))
 		{
-		case ETraceType::LineTrace:
-			bCurrentHit = PerformLineTrace(StartLocation, EndLocation, CurrentHits);
-			break;
-		case ETraceType::SphereTrace:
-			bCurrentHit = PerformSphereTrace(StartLocation, EndLocation, CurrentHits);
-			break;
-		case ETraceType::BoxTrace:
-			bCurrentHit = PerformBoxTrace(StartLocation, EndLocation, CurrentHits);
-			break;
-		case ETraceType::CapsuleTrace:
-			bCurrentHit = PerformCapsuleTrace(StartLocation, EndLocation, CurrentHits);
-			break;
+			RPG_QUERY_RECORD(ERPGQuerySource::HitBox, 0, TraceData.OutHits.Num());
+			Hits = MoveTemp(TraceData.OutHits);
+			continue;
 		}
 
-		if (bCurrentHit)
+		// 구간을 버리면 그 사이를 지나간 적을 놓치므로 동기로 다시 스윕
+		if (Shape.IsLine())
+		{
+			PerformLineTrace(Sweep.Start, Sweep.End, Hits);
+		}
+		else
 		{
-			bHitDetected = true;
-			HitResults.Append(CurrentHits);
+			World->SweepMultiByChannel(Hits, Sweep.Start, Sweep.End, FQuat::Identity, HitBoxSettings.TraceChannel, Shape, CachedQueryParams);
 		}
+		RPG_QUERY_RECORD(ERPGQuerySource::HitBox, 1, Hits.Num());
+	}
+}
+
+void UHitBoxComponent::ProcessSweepResults(const TArray<TArray<FHitResult>>& SweepHits)
+{
+	// 서브스텝끼리 같은 액터를 중복으로 맞추지 않도록 이미 맞은 액터부터 등록
+	// 가장 이른 서브스텝의 히트가 처리됨
+	TArray<AActor*> ProcessedActors;
+	if (!bAllowMultiHit)
+	{
+		ProcessedActors = GetHitActors();
 	}
 
-	// 히트 결과 처리
-	for (const FHitResult& Hit : HitResults)
+	for (const TArray<FHitResult>& Hits : SweepHits)
 	{
-		ProcessHit(Hit);
+		for (const FHitResult& Hit : Hits)
+		{
+			AActor* HitActor = Hit.GetActor();
+			if (!HitActor)
+			{
+				continue;
+			}
+
+			if (ProcessedActors.Contains(HitActor))
+			{
+				RPG_QUERY_RECORD_DEDUP(ERPGQuerySource::HitBox, 1);
+				continue;
+			}
+
+			ProcessedActors.Add(HitActor);
+			ProcessHit(Hit);
+
+			// 최대 히트 수에 도달해 비활성화됨
+			if (CurrentState != EHitBoxState::Active)
+			{
+				return;
+			}
+		}
+	}
+}
+
+void UHitBoxComponent::RequestAsyncSweep(const FVector& Start, const FVector& End, const FCollisionShape& Shape)
+{
+	FTraceHandle TraceHandle;
+
+	if (Shape.IsLine())
+	{
+		TraceHandle = GetWorld()->AsyncLineTraceByChannel(
+			EAsyncTraceType::Multi,
+			Start,
+			End,
+			HitBoxSettings.TraceChannel,
+			CachedQueryParams
+		);
+	}
+	else
+	{
+		TraceHandle = GetWorld()->AsyncSweepByChannel(
+			EAsyncTraceType::Multi,
+			Start,
+			End,
+			FQuat::Identity,
+			HitBoxSettings.TraceChannel,
+			Shape,
+			CachedQueryParams
+		);
+	}
+
+	FPendingSweep& PendingSweep = PendingSweeps.AddDefaulted_GetRef();
+	PendingSweep.Handle = TraceHandle;
+	PendingSweep.Start = Start;
+	PendingSweep.End = End;
+	RPG_QUERY_RECORD(ERPGQuerySource::HitBox, 1, 0);
+}
+
+FCollisionShape UHitBoxComponent::MakeTraceShape() const
+{
+	switch (HitBoxSettings.TraceType)
+	{
+	case ETraceType::SphereTrace:
+		return FCollisionShape::MakeSphere(HitBoxSettings.TraceRadius);
+	case ETraceType::BoxTrace:
+		return FCollisionShape::MakeBox(HitBoxSettings.BoxExtent);
+	case ETraceType::CapsuleTrace:
+		return FCollisionShape::MakeCapsule(HitBoxSettings.CapsuleRadius, HitBoxSettings.CapsuleHalfHeight);
+	case ETraceType::LineTrace:
+	default:
+		return FCollisionShape();
 	}
 }
 
@@ -266,6 +513,8 @@ FHitResult UHitBoxComponent::MainTrace(const TArray<FName>& SocketsName,ETraceTy
 		return OutHit;
 	}
 
+	RPG_QUERY_SCOPE(ERPGQuerySource::HitBox, RPGQuery_HitBox);
+
 	FVector StartLocation = OwnerMesh->GetSocketLocation(SocketNames[0]);
 	FVector EndLocation = OwnerMesh->GetSocketLocation(SocketNames[1]);
 
@@ -288,6 +537,8 @@ FHitResult UHitBoxComponent::MainTrace(const TArray<FName>& SocketsName,ETraceTy
 		break;
 	}
 
+	RPG_QUERY_RECORD(ERPGQuerySource::HitBox, 1, HitResults.Num());
+
 	if (bHit && HitResults.Num() > 0)
 	{
 		OutHit = HitResults[0];
@@ -311,6 +562,7 @@ void UHitBoxComponent::ProcessHit(const FHitResult& Hit)
 	// 다단히트 체크
 	if (!bAllowMultiHit && HitActors.Contains(HitActor))
 	{
+		RPG_QUERY_RECORD_DEDUP(ERPGQuerySource::HitBox, 1);
 		return;
 	}
 
@@ -320,6 +572,7 @@ void UHitBoxComponent::ProcessHit(const FHitResult& Hit)
 		const float* LastHitTime = LastHitTimes.Find(HitActor);
 		if (LastHitTime && GetWorld()->GetTimeSeconds() - *LastHitTime < MultiHitDelay)
 		{
+			RPG_QUERY_RECORD_DEDUP(ERPGQuerySource::HitBox, 1);
 			return;
 		}
 	}
@@ -685,20 +938,52 @@ void UHitBoxComponent::UpdateQueryParams()
 
 void UHitBoxComponent::CacheTracePositions()
 {
-	PreviousTracePositions.Empty();
+	GatherSocketPositions(PreviousTracePositions, PreviousSocketValid);
+	bPreviousPoseTraced = false;
+}
+
+void UHitBoxComponent::GatherSocketPositions(TArray<FVector>& OutPositions, TBitArray<>& OutValid) const
+{
+	OutPositions.Reset();
+	OutValid.Reset();
 	
 	if (!OwnerMesh)
 	{
 		return;
 	}
 
+	// 없는 소켓도 자리를 유지해야 뒤 소켓들의 짝이 밀리지 않음
 	for (const FName& SocketName : HitBoxSettings.TraceSocketNames)
 	{
-		if (OwnerMesh->DoesSocketExist(SocketName))
+		const bool bExists = OwnerMesh->DoesSocketExist(SocketName);
+		OutPositions.Add(bExists ? OwnerMesh->GetSocketLocation(SocketName) : FVector::ZeroVector);
+		OutValid.Add(bExists);
+	}
+}
+
+bool UHitBoxComponent::IsSegmentValid(int32 EndSocketIndex) const
+{
+	const int32 StartSocketIndex = EndSocketIndex - 1;
+	return StartSocketIndex >= 0
+		&& CurrentSocketValid.IsValidIndex(EndSocketIndex) && PreviousSocketValid.IsValidIndex(EndSocketIndex)
+		&& CurrentSocketValid[StartSocketIndex] && CurrentSocketValid[EndSocketIndex]
+		&& PreviousSocketValid[StartSocketIndex] && PreviousSocketValid[EndSocketIndex];
+}
+
+int32 UHitBoxComponent::CalculateSubStepCount() const
+{
+	// 가장 많이 움직인 소켓 기준 (보통 무기 끝)
+	float MaxTravelSquared = 0.0f;
+	for (int32 i = 0; i < CurrentTracePositions.Num(); ++i)
+	{
+		if (CurrentSocketValid[i] && PreviousSocketValid[i])
 		{
-			PreviousTracePositions.Add(OwnerMesh->GetSocketLocation(SocketName));
+			MaxTravelSquared = FMath::Max(MaxTravelSquared, FVector::DistSquared(PreviousTracePositions[i], CurrentTracePositions[i]));
 		}
 	}
+
+	const int32 NumSubSteps = FMath::CeilToInt(FMath::Sqrt(MaxTravelSquared) / FMath::Max(SubStepDistance, 1.0f));
+	return FMath::Clamp(NumSubSteps, 1, FMath::Max(MaxSubSteps, 1));
 }
 
 void UHitBoxComponent::OnMultiHitTimerComplete()
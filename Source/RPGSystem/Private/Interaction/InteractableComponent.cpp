@@ -11,6 +11,7 @@
 #include "RPGSystemCollisionChannels.h"
 #include "RPGSystemGameplayTags.h"
 #include "Components/WidgetComponent.h"
+#include "Interaction/InteractableRegistrySubsystem.h"
 #include "Interaction/Interface/InteractableInterface.h"
 #include "Interaction/Interface/InteractorInterface.h"
 #include "Interaction/UI/InteractionPromptWidget.h"
@@ -83,11 +84,8 @@ namespace
 // Sets default values for this component's properties
 UInteractableComponent::UInteractableComponent(const FObjectInitializer& ObjectInitializer)
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-	// ...
+	// 매 프레임 할 일이 없음, 탐색은 UInteractableRegistrySubsystem 그리드로 처리
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UInteractableComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -108,6 +106,21 @@ void UInteractableComponent::BeginPlay()
 	{
 		InteractableOwner->Initialize();
 	}
+
+	if (UInteractableRegistrySubsystem* Registry = UInteractableRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+	}
+}
+
+void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractableRegistrySubsystem* Registry = UInteractableRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UInteractableComponent::AssociatedActorInteraction(AActor* Interactor)
@@ -192,16 +205,10 @@ void UInteractableComponent::OnInteraction(AActor* Interactor)
 	{
 		if (UGlobalEventHandler* EventHandler = UGlobalEventHandler::Get(this))
 		{
-			TArray<FString> Metadata;
-			Metadata.Add(FString::Printf(TEXT("EventTag=%s"), *InteractionSuccessTag.ToString()));
-
-			const FGameplayTag InteractTag = ResolveInteractionTag(OwnerActor, QuestInteractionTag);
-			if (InteractTag.IsValid())
-			{
-				Metadata.Add(FString::Printf(TEXT("InteractTag=%s"), *InteractTag.ToString()));
-			}
+			FRPGInteractEventPayload InteractPayload;
+			InteractPayload.InteractTag = ResolveInteractionTag(OwnerActor, QuestInteractionTag);
 
-			EventHandler->CallGlobalEventByGameplayTag(this, InteractionSuccessTag, OwnerActor, Metadata);
+			EventHandler->PublishEvent(this, InteractionSuccessTag, OwnerActor, InteractPayload);
 		}
 	}
 	
@@ -289,6 +296,12 @@ void UInteractableComponent::SetupInteractableReferences(UShapeComponent* Area,
 	if (Area) 
 	{
 		InteractableArea = Area;
+
+		// BeginPlay 등록 이후에 지정되면 레지스트리 위치를 영역 중심으로 옮김
+		if (UInteractableRegistrySubsystem* Registry = UInteractableRegistrySubsystem::Get(this))
+		{
+			Registry->UpdateInteractableLocation(this);
+		}
 	}
 	
 	if (Widget)
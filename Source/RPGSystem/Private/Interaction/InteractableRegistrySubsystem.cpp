@@ -0,0 +1,319 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Interaction/InteractableRegistrySubsystem.h"
+
+#include "Components/ShapeComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Interaction/InteractableComponent.h"
+
+static TAutoConsoleVariable<float> CVarInteractionGridCellSize(
+	TEXT("RPGInteraction.GridCellSize"),
+	1000.0f,
+	TEXT("Cell size (cm) of the interactable registry grid. Roughly the largest interaction query radius works best. Applied to worlds created afterwards."));
+
+namespace InteractableRegistry
+{
+	// 정면 정렬 대비 거리의 가중치 (점수 = cos(각도) - DistanceWeight * 거리 / 반경)
+	constexpr float DistanceWeight = 0.25f;
+}
+
+void UInteractableRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(100.0f, CVarInteractionGridCellSize.GetValueOnGameThread());
+}
+
+void UInteractableRegistrySubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<UInteractableComponent>, FRegisteredInteractable>& Pair : Registered)
+	{
+		UntrackLocationComponent(Pair.Value);
+	}
+
+	Registered.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UInteractableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UInteractableRegistrySubsystem* UInteractableRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr;
+}
+
+FVector UInteractableRegistrySubsystem::GetInteractableLocation(const UInteractableComponent* Component)
+{
+	if (!Component)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// UInteractionComponent::HasLineOfSight의 트레이스 목표와 같은 지점
+	const UShapeComponent* Area = Component->InteractableArea;
+	if (IsValid(Area))
+	{
+		return Area->Bounds.Origin;
+	}
+
+	const AActor* OwnerActor = Component->GetOwner();
+	return OwnerActor ? OwnerActor->GetActorLocation() : FVector::ZeroVector;
+}
+
+USceneComponent* UInteractableRegistrySubsystem::GetLocationComponent(const UInteractableComponent* Component)
+{
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	UShapeComponent* Area = Component->InteractableArea;
+	if (IsValid(Area))
+	{
+		return Area;
+	}
+
+	const AActor* OwnerActor = Component->GetOwner();
+	return OwnerActor ? OwnerActor->GetRootComponent() : nullptr;
+}
+
+FIntPoint UInteractableRegistrySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// --- 등록 ---
+
+void UInteractableRegistrySubsystem::RegisterInteractable(UInteractableComponent* Component)
+{
+	if (!Component || !Component->GetOwner() || Registered.Contains(Component))
+	{
+		return;
+	}
+
+	const FVector Location = GetInteractableLocation(Component);
+
+	FRegisteredInteractable& Info = Registered.Add(Component);
+	Info.Cell = GetCell(Location);
+	Cells.FindOrAdd(Info.Cell).Add({ Component, Location });
+
+	TrackLocationComponent(Component, Info);
+}
+
+void UInteractableRegistrySubsystem::UnregisterInteractable(UInteractableComponent* Component)
+{
+	FRegisteredInteractable Info;
+	if (!Registered.RemoveAndCopyValue(Component, Info))
+	{
+		return;
+	}
+
+	UntrackLocationComponent(Info);
+	RemoveFromCell(Info.Cell, Component);
+}
+
+void UInteractableRegistrySubsystem::UpdateInteractableLocation(UInteractableComponent* Component)
+{
+	FRegisteredInteractable* Info = Registered.Find(Component);
+	if (!Info)
+	{
+		return;
+	}
+
+	// 상호작용 영역이 등록 이후에 지정/교체된 경우 추적 대상도 바꿈
+	if (Info->TrackedComponent.Get() != GetLocationComponent(Component))
+	{
+		UntrackLocationComponent(*Info);
+		TrackLocationComponent(Component, *Info);
+	}
+
+	MoveEntry(Component, *Info, GetInteractableLocation(Component));
+}
+
+void UInteractableRegistrySubsystem::TrackLocationComponent(UInteractableComponent* Component, FRegisteredInteractable& Info)
+{
+	// 고정 오브젝트는 위치가 바뀌지 않으므로 추적하지 않음
+	// 영역이 오너 루트에 붙어 있으면 루트가 움직일 때 영역의 TransformUpdated도 호출됨
+	USceneComponent* LocationComponent = GetLocationComponent(Component);
+	if (LocationComponent && LocationComponent->Mobility != EComponentMobility::Static)
+	{
+		Info.TrackedComponent = LocationComponent;
+		Info.TransformUpdatedHandle = LocationComponent->TransformUpdated.AddUObject(
+			this, &UInteractableRegistrySubsystem::HandleTrackedTransformUpdated, TWeakObjectPtr<UInteractableComponent>(Component));
+	}
+}
+
+void UInteractableRegistrySubsystem::UntrackLocationComponent(FRegisteredInteractable& Info)
+{
+	if (USceneComponent* TrackedComponent = Info.TrackedComponent.Get())
+	{
+		TrackedComponent->TransformUpdated.Remove(Info.TransformUpdatedHandle);
+	}
+
+	Info.TrackedComponent.Reset();
+	Info.TransformUpdatedHandle.Reset();
+}
+
+void UInteractableRegistrySubsystem::HandleTrackedTransformUpdated(USceneComponent* UpdatedComponent,
+	EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TWeakObjectPtr<UInteractableComponent> WeakComponent)
+{
+	UInteractableComponent* Component = WeakComponent.Get();
+	FRegisteredInteractable* Info = Component ? Registered.Find(Component) : nullptr;
+	if (Info)
+	{
+		// 바운드는 TransformUpdated 이전에 갱신됨
+		MoveEntry(Component, *Info, GetInteractableLocation(Component));
+	}
+}
+
+void UInteractableRegistrySubsystem::MoveEntry(UInteractableComponent* Component, FRegisteredInteractable& Info, const FVector& NewLocation)
+{
+	const FIntPoint NewCell = GetCell(NewLocation);
+
+	// 같은 셀 안에서의 이동은 위치만 갱신
+	if (NewCell == Info.Cell)
+	{
+		if (TArray<FInteractableGridEntry>* Entries = Cells.Find(Info.Cell))
+		{
+			for (FInteractableGridEntry& Entry : *Entries)
+			{
+				if (Entry.Component.Get() == Component)
+				{
+					Entry.Location = NewLocation;
+					return;
+				}
+			}
+		}
+	}
+
+	RemoveFromCell(Info.Cell, Component);
+	Info.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add({ Component, NewLocation });
+}
+
+void UInteractableRegistrySubsystem::RemoveFromCell(const FIntPoint& Cell, const UInteractableComponent* Component)
+{
+	TArray<FInteractableGridEntry>* Entries = Cells.Find(Cell);
+	if (!Entries)
+	{
+		return;
+	}
+
+	// 파괴된 컴포넌트의 엔트리도 같이 정리
+	for (int32 Index = Entries->Num() - 1; Index >= 0; --Index)
+	{
+		const FInteractableGridEntry& Entry = (*Entries)[Index];
+		if (!Entry.Component.IsValid() || Entry.Component.Get() == Component)
+		{
+			Entries->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	if (Entries->Num() == 0)
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+// --- 조회 ---
+
+void UInteractableRegistrySubsystem::ForEachEntryInRadius(const FVector& Origin, float Radius,
+	TFunctionRef<bool(const FInteractableGridEntry&, float)> Visitor) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+	const FIntPoint MinCell = GetCell(Origin - FVector(Radius));
+	const FIntPoint MaxCell = GetCell(Origin + FVector(Radius));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<FInteractableGridEntry>* Entries = Cells.Find(FIntPoint(CellX, CellY));
+			if (!Entries)
+			{
+				continue;
+			}
+
+			for (const FInteractableGridEntry& Entry : *Entries)
+			{
+				const float DistanceSquared = FVector::DistSquared(Entry.Location, Origin);
+				if (DistanceSquared <= RadiusSquared && !Visitor(Entry, DistanceSquared))
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+UInteractableComponent* UInteractableRegistrySubsystem::FindBestInteractable(const FVector& Origin, const FVector& Direction,
+	float Radius, float ConeHalfAngleDegrees, TFunctionRef<bool(UInteractableComponent*)> Filter) const
+{
+	if (Radius <= 0.0f)
+	{
+		return nullptr;
+	}
+
+	const FVector ConeDirection = Direction.GetSafeNormal();
+	const float MinCos = ConeHalfAngleDegrees >= 180.0f || ConeDirection.IsZero()
+		? -1.0f
+		: FMath::Cos(FMath::DegreesToRadians(ConeHalfAngleDegrees));
+
+	UInteractableComponent* BestComponent = nullptr;
+	float BestScore = -MAX_flt;
+
+	ForEachEntryInRadius(Origin, Radius, [&](const FInteractableGridEntry& Entry, float DistanceSquared)
+	{
+		const float Distance = FMath::Sqrt(DistanceSquared);
+
+		// 원점과 겹치면 정면으로 취급
+		const float Cos = Distance > UE_KINDA_SMALL_NUMBER
+			? FVector::DotProduct(Entry.Location - Origin, ConeDirection) / Distance
+			: 1.0f;
+		if (Cos < MinCos)
+		{
+			return true;
+		}
+
+		const float Score = Cos - InteractableRegistry::DistanceWeight * Distance / Radius;
+		if (Score <= BestScore)
+		{
+			return true;
+		}
+
+		UInteractableComponent* Component = Entry.Component.Get();
+		if (Component && Filter(Component))
+		{
+			BestComponent = Component;
+			BestScore = Score;
+		}
+		return true;
+	});
+
+	return BestComponent;
+}
+
+int32 UInteractableRegistrySubsystem::QueryInteractablesInRadius(const FVector& Origin, float Radius, TArray<UInteractableComponent*>& OutComponents) const
+{
+	const int32 NumBefore = OutComponents.Num();
+
+	ForEachEntryInRadius(Origin, Radius, [&OutComponents](const FInteractableGridEntry& Entry, float DistanceSquared)
+	{
+		if (UInteractableComponent* Component = Entry.Component.Get())
+		{
+			OutComponents.Add(Component);
+		}
+		return true;
+	});
+
+	return OutComponents.Num() - NumBefore;
+}
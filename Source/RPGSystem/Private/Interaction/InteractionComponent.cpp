@@ -7,8 +7,10 @@
 #include "Camera/CameraComponent.h"
 #include "Components/ShapeComponent.h"
 #include "Interaction/InteractableComponent.h"
+#include "Interaction/InteractableRegistrySubsystem.h"
 #include "Interaction/Interface/InteractableInterface.h"
 #include "Interaction/Interface/InteractorInterface.h"
+#include "Shared/RPGQueryStats.h"
 
 UInteractionComponent::UInteractionComponent(const FObjectInitializer& ObjectInitializer)
 {
@@ -32,41 +34,40 @@ void UInteractionComponent::UpdateInteraction()
 	}
 	ControlledPawnRef = ControllerPawn;
 
-	// 두 가지 방식으로 상호작용 대상 탐색
-	UInteractableComponent* CameraTraceResult = FindInteractableViaTrace();
-	UInteractableComponent* ForwardTraceResult = FindInteractableViaForwardTrace();
-	UInteractableComponent* PreferredTraceResult = CameraTraceResult ? CameraTraceResult : ForwardTraceResult;
+	// 두 가지 방식으로 상호작용 대상 탐색 (그리드 조회)
+	UInteractableComponent* CameraResult = FindInteractableInView();
+	UInteractableComponent* ForwardResult = FindInteractableInFront();
 
-	// 현재 상호작용 중인 객체가 없는 경우
-	if (!CurrentInteractable)
+	// 둘 중 하나라도 현재 대상을 감지하면 유지, 아니면 카메라 결과 우선
+	UInteractableComponent* Candidate = nullptr;
+	if (CurrentInteractable && (CameraResult == CurrentInteractable || ForwardResult == CurrentInteractable))
 	{
-		// 두 트레이스가 모두 같은 대상을 감지한 경우에만 상호작용 시작
-		if (PreferredTraceResult)
-		{
-			AssignInteractionToLocal(PreferredTraceResult);
-		}
+		Candidate = CurrentInteractable;
+	}
+	else
+	{
+		Candidate = CameraResult ? CameraResult : ForwardResult;
+	}
+
+	// 최종 후보 하나만 가림 여부 확인
+	if (Candidate && !HasLineOfSight(Candidate))
+	{
+		Candidate = nullptr;
+	}
+
+	if (Candidate == CurrentInteractable)
+	{
+		return;
+	}
+
+	if (Candidate)
+	{
+		// 기존 상호작용 제거 후 새 상호작용 시작
+		AssignInteractionToLocal(Candidate);
 	}
-	// 현재 상호작용 중인 객체가 있는 경우
 	else
 	{
-		// 상호작용 유지 조건 체크
-		bool bCameraDetectsCurrent = (CameraTraceResult == CurrentInteractable);
-		bool bForwardDetectsCurrent = (ForwardTraceResult == CurrentInteractable);
-		
-		// 둘 중 하나라도 현재 객체를 감지하면 유지
-		if (bCameraDetectsCurrent || bForwardDetectsCurrent)
-		{
-			return;
-		}
-		
-		// 둘 다 현재 객체를 감지하지 못하는 경우 상호작용 제거
 		RemoveInteractionFromCurrent();
-		
-		// 새로운 동일한 객체를 감지했다면 즉시 새 상호작용 시작
-		if (PreferredTraceResult)
-		{
-			AssignInteractionToLocal(PreferredTraceResult);
-		}
 	}
 }
 
@@ -144,114 +145,88 @@ void UInteractionComponent::AssignInteractionToLocal(UInteractableComponent* Int
 	OnNewInteractableAssigned.Broadcast(CurrentInteractable);
 }
 
-bool UInteractionComponent::PerformInteractionTrace(TArray<FHitResult>& OutHits, const FVector& StartLocation,
-                                                    const FVector& EndLocation, const TArray<AActor*>& IgnoredActors, float CapsuleRadius, float CapsuleHalfHeight)
-{
-	// 상호작용 가능한 오브젝트 타입 설정
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypesToQuery;
-	ObjectTypesToQuery.Add(UEngineTypes::ConvertToObjectType(ECO_Interactable));
-	
-	bool bIsHit = UKismetSystemLibrary::CapsuleTraceMultiForObjects(
-		GetWorld(),
-		StartLocation,
-		EndLocation,
-		CapsuleRadius,
-		CapsuleHalfHeight,
-		ObjectTypesToQuery,
-		false,
-		IgnoredActors,
-		DebugTrace,
-		OutHits,
-		true,
-		TraceColor,
-		TraceHitColor,
-		DebugDrawTime
-	);
-    
-	return bIsHit;
-}
-
-UInteractableComponent* UInteractionComponent::FindInteractableViaForwardTrace()
+UInteractableComponent* UInteractionComponent::FindInteractableInCone(const FVector& Origin, const FVector& Direction,
+	float Radius, float ConeHalfAngle) const
 {
-	if (!ControlledPawnRef || !GetWorld())
+	const UInteractableRegistrySubsystem* Registry = UInteractableRegistrySubsystem::Get(this);
+	if (!Registry)
 	{
 		return nullptr;
 	}
 
-	// 폰의 전방 벡터 기반 트레이스
-	FVector PawnLocation = ControlledPawnRef->GetActorLocation();
-	FVector PawnForward = ControlledPawnRef->GetActorForwardVector();
-	FVector StartLocation = PawnLocation;
-	FVector EndLocation = PawnLocation + PawnForward * OwnerTraceLength;
+	return Registry->FindBestInteractable(Origin, Direction, Radius, ConeHalfAngle,
+		[this](UInteractableComponent* Component)
+		{
+			return Component->GetOwner() != ControlledPawnRef && IsValidInteractable(Component);
+		});
+}
 
-	TArray<AActor*> IgnoredActors{ ControlledPawnRef };
-	TArray<FHitResult> OutHits;
-	
-	if (!PerformInteractionTrace(OutHits, StartLocation, EndLocation, IgnoredActors))
+UInteractableComponent* UInteractionComponent::FindInteractableInFront() const
+{
+	if (!ControlledPawnRef)
 	{
 		return nullptr;
 	}
 
-	// 히트한 액터들 중 유효한 상호작용 컴포넌트 찾기
-	for (const FHitResult& HitResult : OutHits)
-	{
-		AActor* HitActor = HitResult.GetActor();
-		if (!HitActor)
-		{
-			continue;
-		}
-
-		UInteractableComponent* FoundInteractableComp = HitActor->FindComponentByClass<UInteractableComponent>();
-		if (FoundInteractableComp && IsValidInteractable(FoundInteractableComp))
-		{
-			return FoundInteractableComp;
-		}
-	}
-
-	return nullptr;
+	// 폰의 전방 벡터 기반 탐색
+	return FindInteractableInCone(
+		ControlledPawnRef->GetActorLocation(),
+		ControlledPawnRef->GetActorForwardVector(),
+		OwnerTraceLength,
+		OwnerConeHalfAngle);
 }
 
-UInteractableComponent* UInteractionComponent::FindInteractableViaTrace()
+UInteractableComponent* UInteractionComponent::FindInteractableInView() const
 {
 	// 카메라 컴포넌트 가져오기
-	UCameraComponent* PlayerCamera = ControlledPawnRef->FindComponentByClass<UCameraComponent>();
+	UCameraComponent* PlayerCamera = ControlledPawnRef ? ControlledPawnRef->FindComponentByClass<UCameraComponent>() : nullptr;
 	if (!PlayerCamera)
 	{
 		return nullptr;
 	}
 
-	// 카메라 시선 방향 기반 트레이스
-	const FVector PawnLocation = ControlledPawnRef->GetActorLocation();
-	const FVector CameraForward = PlayerCamera->GetForwardVector();
-	const FVector StartLocation = PawnLocation + FVector(0.f, 0.f, InteractionDistance);
-	const FVector EndLocation = StartLocation + CameraForward * CameraTraceLength;
+	// 카메라 시선 방향 기반 탐색, 원점은 기존 카메라 트레이스 시작점과 동일
+	const FVector Origin = ControlledPawnRef->GetActorLocation() + FVector(0.f, 0.f, InteractionDistance);
+	return FindInteractableInCone(Origin, PlayerCamera->GetForwardVector(), CameraTraceLength, CameraConeHalfAngle);
+}
 
-	TArray<FHitResult> OutHits;
-	const TArray<AActor*> IgnoredActors{ ControlledPawnRef };
-	
-	// 카메라 트레이스는 좁은 캡슐 사용 (정확한 조준)
-	if (!PerformInteractionTrace(OutHits, StartLocation, EndLocation, IgnoredActors, 35.f, 0.f))
+bool UInteractionComponent::HasLineOfSight(UInteractableComponent* Component)
+{
+	RPG_QUERY_SCOPE(ERPGQuerySource::Interaction, RPGQuery_Interaction);
+
+	AActor* TargetActor = Component ? Component->GetOwner() : nullptr;
+	if (!ControlledPawnRef || !TargetActor || !GetWorld())
 	{
-		return nullptr;
+		return false;
 	}
 
-	// 히트한 액터들 중 유효한 상호작용 컴포넌트 찾기
-	for (const FHitResult& Hit : OutHits)
-	{
-		AActor* HitActor = Hit.GetActor();
-		if (!IsValid(HitActor))
-		{
-			continue;
-		}
+	// 상호작용 영역이 있으면 영역 중심, 없으면 액터 위치
+	const UShapeComponent* Area = Component->InteractableArea;
+	const FVector TargetLocation = IsValid(Area) ? Area->Bounds.Origin : TargetActor->GetActorLocation();
 
-		UInteractableComponent* FoundComponent = HitActor->FindComponentByClass<UInteractableComponent>();
-		if (FoundComponent && IsValidInteractable(FoundComponent))
-		{
-			return FoundComponent;
-		}
-	}
+	// 폰과 폰에 붙은 무기 등, 대상 자신은 무시
+	TArray<AActor*> IgnoredActors{ ControlledPawnRef, TargetActor };
+	ControlledPawnRef->GetAttachedActors(IgnoredActors, false);
+
+	FHitResult Hit;
+	const bool bBlocked = UKismetSystemLibrary::LineTraceSingle(
+		GetWorld(),
+		ControlledPawnRef->GetPawnViewLocation(),
+		TargetLocation,
+		UEngineTypes::ConvertToTraceType(LineOfSightChannel),
+		false,
+		IgnoredActors,
+		DebugTrace,
+		Hit,
+		true,
+		TraceColor,
+		TraceHitColor,
+		DebugDrawTime
+	);
+
+	RPG_QUERY_RECORD(ERPGQuerySource::Interaction, 1, bBlocked ? 1 : 0);
 
-	return nullptr;
+	return !bBlocked;
 }
 
 bool UInteractionComponent::IsValidInteractable(UInteractableComponent* Component) const
@@ -0,0 +1,335 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+
+/**
+ * 상호작용 탐색 자동화 테스트 (RPGSystem.Benchmark.Interaction.Query)
+ *
+ * 벤치마크 게임 월드의 정사각형 영역에 상호작용 대상 N개를 스폰하고
+ * 매 프레임 같은 무작위 탐색 지점/방향으로 두 방식을 번갈아 측정
+ *	Registry: UInteractableRegistrySubsystem 원뿔 조회 + 찾은 후보의 가림 확인 라인 트레이스 (UInteractionComponent와 동일)
+ *	CapsuleTrace: 기존 방식, ECO_Interactable 캡슐 트레이스 + UInteractableComponent 후처리 필터
+ *
+ * 대상은 Interactable 오브젝트 채널의 구 콜리전을 가진 Static 액터, 웜업 프레임 이후부터 측정
+ *
+ * 단계 (기준 비교는 Shared/RPGBenchmark.h)
+ *	Registry / CapsuleTrace: 방식별 전체 탐색 시간, Registry 개수 열에는 가림 확인 트레이스 수
+ *	RegistryFrameP99 / CapsuleTraceFrameP99: 프레임당 탐색 시간 p99
+ */
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+#include "Interaction/InteractableComponent.h"
+#include "Interaction/InteractableRegistrySubsystem.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Math/RandomStream.h"
+#include "RPGSystemCollisionChannels.h"
+#include "Shared/RPGBenchmark.h"
+
+namespace InteractionQueryBenchmark
+{
+	constexpr int32 NumInteractables = 5000;
+
+	// 스폰 영역의 한 변 길이 (월드 원점 중심)
+	constexpr float Extent = 20000.f;
+
+	constexpr int32 WarmupFrames = 30;
+	constexpr int32 MeasuredFrames = 600;
+
+	// 프레임당 방식별 탐색 수
+	constexpr int32 QueriesPerFrame = 64;
+
+	// UInteractionComponent 카메라 탐색 기본값과 동일
+	constexpr float QueryRadius = 500.f;
+	constexpr float ConeHalfAngle = 15.f;
+	constexpr float CapsuleRadius = 35.f;
+	constexpr ECollisionChannel LineOfSightChannel = ECC_Visibility;
+
+	constexpr int32 Seed = 1337;
+
+	// 탐색 지점 (플레이어 폰 원점/방향 대용)
+	struct FProbe
+	{
+		FVector Origin;
+		FVector Direction;
+	};
+
+	struct FMethodResult
+	{
+		double TotalMs = 0.0;
+		TArray<double> FrameMs;
+
+		// 대상을 찾은 탐색 수
+		int64 Found = 0;
+
+		// Registry만 사용, 가림 확인 트레이스 수
+		int64 LineTraces = 0;
+
+		double GetP99FrameMs()
+		{
+			if (FrameMs.IsEmpty())
+			{
+				return 0.0;
+			}
+
+			FrameMs.Sort();
+			return FrameMs[FMath::Clamp(FMath::CeilToInt(FrameMs.Num() * 0.99) - 1, 0, FrameMs.Num() - 1)];
+		}
+	};
+
+	struct FState
+	{
+		FRPGBenchmarkWorld World;
+		FRPGBenchmarkReport Report = FRPGBenchmarkReport(TEXT("InteractionQuery"));
+		FRandomStream Random = FRandomStream(Seed);
+
+		TArray<FProbe> Probes;
+		FMethodResult Registry;
+		FMethodResult CapsuleTrace;
+
+		int32 NumSpawned = 0;
+		int32 Frame = 0;
+
+		bool SpawnInteractable(const FVector& Location);
+		void MakeProbes();
+
+		// 방식별 한 프레임 분량 실행, 걸린 시간(ms) 반환
+		double RunRegistryQueries();
+		double RunCapsuleTraceQueries();
+	};
+
+	bool FState::SpawnInteractable(const FVector& Location)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AActor* Actor = World.GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+		if (!Actor)
+		{
+			return false;
+		}
+
+		// 기존 캡슐 트레이스와 가림 확인 트레이스가 모두 찾을 수 있도록 Interactable 채널과 Visibility 채널을 막음
+		USphereComponent* Sphere = NewObject<USphereComponent>(Actor, TEXT("InteractionArea"));
+		Sphere->SetMobility(EComponentMobility::Static);
+		Sphere->InitSphereRadius(50.f);
+		Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Sphere->SetCollisionObjectType(ECO_Interactable);
+		Sphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+		Sphere->SetCollisionResponseToChannel(ECO_Interactable, ECR_Block);
+		Sphere->SetCollisionResponseToChannel(LineOfSightChannel, ECR_Block);
+		Sphere->SetWorldLocation(Location);
+		Actor->SetRootComponent(Sphere);
+		Sphere->RegisterComponent();
+
+		// 이미 BeginPlay가 끝난 액터라 등록 시점에 BeginPlay가 호출되어 영역 중심으로 레지스트리에 들어감
+		UInteractableComponent* Interactable = NewObject<UInteractableComponent>(Actor, TEXT("Interactable"));
+		Interactable->InteractableArea = Sphere;
+		Interactable->RegisterComponent();
+
+		return true;
+	}
+
+	void FState::MakeProbes()
+	{
+		Probes.Reset(QueriesPerFrame);
+
+		const float HalfExtent = Extent * 0.5f;
+		for (int32 Index = 0; Index < QueriesPerFrame; ++Index)
+		{
+			FProbe& Probe = Probes.AddDefaulted_GetRef();
+			Probe.Origin = FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 100.f);
+
+			const float Yaw = Random.FRandRange(0.f, UE_TWO_PI);
+			Probe.Direction = FVector(FMath::Cos(Yaw), FMath::Sin(Yaw), Random.FRandRange(-0.3f, 0.1f)).GetSafeNormal();
+		}
+	}
+
+	double FState::RunRegistryQueries()
+	{
+		UWorld* QueryWorld = World.GetWorld();
+		const UInteractableRegistrySubsystem* RegistrySubsystem = UInteractableRegistrySubsystem::Get(QueryWorld);
+		const ETraceTypeQuery TraceType = UEngineTypes::ConvertToTraceType(LineOfSightChannel);
+		FHitResult Hit;
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (const FProbe& Probe : Probes)
+		{
+			// UInteractionComponent와 같은 필터 비용을 흉내 (유효성/영역 확인)
+			UInteractableComponent* Found = RegistrySubsystem->FindBestInteractable(Probe.Origin, Probe.Direction, QueryRadius, ConeHalfAngle,
+				[](UInteractableComponent* Component)
+				{
+					return Component->bIsInteractable && IsValid(Component->InteractableArea);
+				});
+
+			if (!Found)
+			{
+				continue;
+			}
+
+			// UInteractionComponent::HasLineOfSight와 같은 최종 후보 가림 확인 (폰 대신 탐색 지점에서)
+			const TArray<AActor*> IgnoredActors{ Found->GetOwner() };
+			const bool bBlocked = UKismetSystemLibrary::LineTraceSingle(
+				QueryWorld,
+				Probe.Origin,
+				Found->InteractableArea->Bounds.Origin,
+				TraceType,
+				false,
+				IgnoredActors,
+				EDrawDebugTrace::None,
+				Hit,
+				true);
+
+			++Registry.LineTraces;
+			if (!bBlocked)
+			{
+				++Registry.Found;
+			}
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+	double FState::RunCapsuleTraceQueries()
+	{
+		UWorld* QueryWorld = World.GetWorld();
+		const TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes{ UEngineTypes::ConvertToObjectType(ECO_Interactable) };
+		const TArray<AActor*> IgnoredActors;
+		TArray<FHitResult> Hits;
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (const FProbe& Probe : Probes)
+		{
+			// 기존 카메라 트레이스와 같은 캡슐 (반높이 0)
+			UKismetSystemLibrary::CapsuleTraceMultiForObjects(
+				QueryWorld,
+				Probe.Origin,
+				Probe.Origin + Probe.Direction * QueryRadius,
+				CapsuleRadius,
+				0.f,
+				ObjectTypes,
+				false,
+				IgnoredActors,
+				EDrawDebugTrace::None,
+				Hits,
+				true);
+
+			for (const FHitResult& Hit : Hits)
+			{
+				const AActor* HitActor = Hit.GetActor();
+				const UInteractableComponent* Component = HitActor ? HitActor->FindComponentByClass<UInteractableComponent>() : nullptr;
+				if (Component && Component->bIsInteractable && IsValid(Component->InteractableArea))
+				{
+					++CapsuleTrace.Found;
+					break;
+				}
+			}
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRPGInteractionQueryBenchmark, "RPGSystem.Benchmark.Interaction.Query",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FRPGInteractionQueryBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionQueryBenchmark;
+
+	const TSharedRef<FState> State = MakeShared<FState>();
+	if (!TestNotNull(TEXT("Interactable registry"), UInteractableRegistrySubsystem::Get(State->World.GetWorld())))
+	{
+		return false;
+	}
+
+	// 격자에 지터를 준 배치 (레벨에 흩어진 오브젝트와 비슷한 밀도)
+	const int32 NumPerRow = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumInteractables)));
+	const float Spacing = Extent / NumPerRow;
+	const FVector Corner(-Extent * 0.5f, -Extent * 0.5f, 0.f);
+
+	for (int32 Index = 0; Index < NumInteractables; ++Index)
+	{
+		const FVector Location = Corner + FVector(
+			(Index % NumPerRow + State->Random.FRandRange(0.1f, 0.9f)) * Spacing,
+			(Index / NumPerRow + State->Random.FRandRange(0.1f, 0.9f)) * Spacing,
+			State->Random.FRandRange(0.f, 150.f));
+
+		if (State->SpawnInteractable(Location))
+		{
+			++State->NumSpawned;
+		}
+	}
+
+	TestEqual(TEXT("Registered interactables"), UInteractableRegistrySubsystem::Get(State->World.GetWorld())->GetNumInteractables(), State->NumSpawned);
+
+	State->Registry.FrameMs.Reserve(MeasuredFrames);
+	State->CapsuleTrace.FrameMs.Reserve(MeasuredFrames);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		// 웜업 동안 스폰 히치와 물리 씬 반영을 흘려보냄
+		if (State->Frame < WarmupFrames)
+		{
+			State->World.Tick();
+			++State->Frame;
+			return false;
+		}
+
+		if (State->Frame < WarmupFrames + MeasuredFrames)
+		{
+			State->MakeProbes();
+
+			// 캐시 영향을 줄이기 위해 프레임마다 순서를 바꿈
+			double RegistryMs = 0.0;
+			double CapsuleTraceMs = 0.0;
+			if (State->Frame % 2 == 0)
+			{
+				RegistryMs = State->RunRegistryQueries();
+				CapsuleTraceMs = State->RunCapsuleTraceQueries();
+			}
+			else
+			{
+				CapsuleTraceMs = State->RunCapsuleTraceQueries();
+				RegistryMs = State->RunRegistryQueries();
+			}
+
+			State->Registry.TotalMs += RegistryMs;
+			State->Registry.FrameMs.Add(RegistryMs);
+			State->CapsuleTrace.TotalMs += CapsuleTraceMs;
+			State->CapsuleTrace.FrameMs.Add(CapsuleTraceMs);
+
+			State->World.Tick();
+			++State->Frame;
+			return false;
+		}
+
+		FMethodResult& Registry = State->Registry;
+		FMethodResult& CapsuleTrace = State->CapsuleTrace;
+		const int64 NumQueries = static_cast<int64>(MeasuredFrames) * QueriesPerFrame;
+
+		State->Report.AddStage(TEXT("Registry"), Registry.TotalMs, Registry.LineTraces);
+		State->Report.AddStage(TEXT("RegistryFrameP99"), Registry.GetP99FrameMs());
+		State->Report.AddStage(TEXT("CapsuleTrace"), CapsuleTrace.TotalMs);
+		State->Report.AddStage(TEXT("CapsuleTraceFrameP99"), CapsuleTrace.GetP99FrameMs());
+
+		AddInfo(FString::Printf(TEXT("%d interactables, %d frames, %d queries per frame"), State->NumSpawned, MeasuredFrames, QueriesPerFrame));
+		AddInfo(FString::Printf(TEXT("Registry     %8lld found %8lld line traces %8.3f us/query"),
+			Registry.Found, Registry.LineTraces, Registry.TotalMs * 1000.0 / NumQueries));
+		AddInfo(FString::Printf(TEXT("CapsuleTrace %8lld found %8.3f us/query"),
+			CapsuleTrace.Found, CapsuleTrace.TotalMs * 1000.0 / NumQueries));
+
+		TestTrue(TEXT("Registry found interactables"), Registry.Found > 0);
+
+		State->Report.Submit(*this);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
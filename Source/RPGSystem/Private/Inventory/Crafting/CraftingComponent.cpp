@@ -92,11 +92,20 @@ void UCraftingComponent::CraftItem(const UCraftingRecipe* Recipe, int32 Amount)
 		return;
 	}
 
+	// 재료 소모와 결과물 지급을 하나의 트랜잭션으로 처리 (알림/복제는 한 번, 실패 시 재료 복구)
+	FInventoryTransactionScope Transaction(GetInventoryCore());
+
 	// 1. 재료 소모
 	ConsumeIngredients(Recipe, Amount);
 
 	// 2. 결과물 지급
-	GrantResults(Recipe, Amount);
+	if (!GrantResults(Recipe, Amount))
+	{
+		Transaction.Rollback();
+		OnCraftingFailed.Broadcast(FText::FromString(TEXT("인벤토리 공간이 부족합니다.")));
+		return;
+	}
+	Transaction.Commit();
 
 	// 3. 성공 알림
 	OnCraftingSuccess.Broadcast(Recipe);
@@ -119,7 +128,7 @@ void UCraftingComponent::ConsumeIngredients(const UCraftingRecipe* Recipe, int32
 	}
 }
 
-void UCraftingComponent::GrantResults(const UCraftingRecipe* Recipe, int32 Amount)
+bool UCraftingComponent::GrantResults(const UCraftingRecipe* Recipe, int32 Amount)
 {
 	UInventoryCoreComponent* Inventory = GetInventoryCore();
 
@@ -135,10 +144,12 @@ void UCraftingComponent::GrantResults(const UCraftingRecipe* Recipe, int32 Amoun
 
 		if (Remaining > 0)
 		{
-			// 인벤토리에 다 못 넣은 경우 (바닥에 드랍하는 로직 추가 가능)
-			UE_LOG(LogTemp, Warning, TEXT("인벤토리 공간 부족으로 %d개의 아이템을 잃어버렸습니다."), Remaining);
+			// 인벤토리에 다 못 넣은 경우 (CraftItem에서 트랜잭션 롤백)
+			UE_LOG(LogTemp, Warning, TEXT("인벤토리 공간 부족으로 %d개의 아이템을 넣지 못했습니다."), Remaining);
+			return false;
 		}
 	}
+	return true;
 }
 
 void UCraftingComponent::SetCurrentStation(AActor* StationActor)
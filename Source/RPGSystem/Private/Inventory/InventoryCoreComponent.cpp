@@ -9,12 +9,19 @@
 #include "Engine/ActorChannel.h"
 #include "Inventory/InventoryInitializer.h"
 
+namespace
+{
+    // 한 RPC로 받을 수 있는 최대 이동 수
+    constexpr int32 MaxMovesPerBatch = 256;
+}
+
 UInventoryCoreComponent::UInventoryCoreComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
     PrimaryComponentTick.bCanEverTick = false;
     SetIsReplicatedByDefault(true);
     InventoryList.OwnerComponent = this;
+    InventorySlots.OwnerComponent = this;
     InventoryInitializer = CreateDefaultSubobject<UInventoryInitializer>(TEXT("InventoryInitializer"));
 }
 
@@ -22,6 +29,7 @@ void UInventoryCoreComponent::BeginPlay()
 {
     Super::BeginPlay();
     InventoryList.OwnerComponent = this;
+    InventorySlots.OwnerComponent = this;
     InitializeInventory();
 }
 
@@ -29,6 +37,7 @@ void UInventoryCoreComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(UInventoryCoreComponent, InventoryList);
+    DOREPLIFETIME(UInventoryCoreComponent, InventorySlots);
 }
 
 bool UInventoryCoreComponent::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
@@ -91,7 +100,9 @@ FGuid UInventoryCoreComponent::CreateInventory(const FInventoryCreateConfig& Con
     NewMetaData.MaxWeight = Config.MaxWeight;
     NewMetaData.CurrentWeight = 0.0f;
     NewMetaData.AllowedTypes = Config.AllowedTypes;
-    
+
+    // 트랜잭션 중이면 롤백 시 제거되도록 "없던 인벤토리"로 기록
+    RecordTransactionSnapshot(NewGuid);
     InventoryList.AddInventory(NewGuid, NewMetaData, NewSlots);
     
     UE_LOG(LogTemp, Log, TEXT("Created inventory '%s' with GUID: %s"),*Config.InventoryName.ToString(), *NewGuid.ToString());
@@ -108,9 +119,12 @@ bool UInventoryCoreComponent::DestroyInventory(FGuid InventoryGuid)
     {
         InventoryName = Entry->MetaData.InventoryName;
     }
+
+    RecordTransactionSnapshot(InventoryGuid);
     
     if (InventoryList.RemoveInventory(InventoryGuid))
     {
+        InventorySlots.RemoveInventory(InventoryGuid);
         OnInventoryCleared.Broadcast(InventoryGuid, InventoryName);
         return true;
     }
@@ -170,26 +184,14 @@ bool UInventoryCoreComponent::HasInventory(FGuid InventoryGuid) const
 
 bool UInventoryCoreComponent::IsInventoryFull(FGuid InventoryGuid) const
 {
-    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    if (!Inventory) return true;
-    
-    for (const FInventorySlot& Slot : *Inventory)
-    {
-        if (Slot.IsEmpty()) return false;
-    }
-    return true;
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    return !Entry || Entry->LookupIndex.GetNumEmptySlots() == 0;
 }
 
 int32 UInventoryCoreComponent::GetEmptySlotIndex(FGuid InventoryGuid) const
 {
-    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    if (!Inventory) return -1;
-    
-    for (int32 i = 0; i < Inventory->Num(); ++i)
-    {
-        if ((*Inventory)[i].IsEmpty()) return i;
-    }
-    return -1;
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    return Entry ? Entry->LookupIndex.FindFirstEmptySlot() : -1;
 }
 
 FGuid UInventoryCoreComponent::FindInventoryGuid(FName InventoryName) const
@@ -318,6 +320,8 @@ bool UInventoryCoreComponent::AddItemToSlot(FGuid InventoryGuid, int32 SlotIndex
         if (Meta->CurrentWeight + AddWeight > Meta->MaxWeight) return false;
     }
 
+    RecordTransactionSnapshot(InventoryGuid);
+
     // 소유권 이전
     InInstance->Rename(nullptr, this);
     Slot->ItemInstance = InInstance;
@@ -343,6 +347,7 @@ bool UInventoryCoreComponent::RemoveItem(FGuid InventoryGuid, int32 SlotIndex, i
     if (!Slot || Slot->IsEmpty()) return false;
     
     const UItemDefinition* ItemDef = Slot->GetItemDefinition();
+    RecordTransactionSnapshot(InventoryGuid);
     
     if (Slot->Quantity <= Quantity)
     {
@@ -363,31 +368,34 @@ bool UInventoryCoreComponent::RemoveItemByDef(FGuid InventoryGuid, const UItemDe
 {
     if (!ItemDef || Quantity <= 0 || !HasInventory(InventoryGuid)) return false;
     
-    TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    if (!Inventory) return false;
-    
+    FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    if (!Entry) return false;
+
+    const TArray<int32>* DefSlots = Entry->LookupIndex.FindSlotsByDef(ItemDef);
+    if (!DefSlots) return false;
+
+    // 제거 중 인덱스가 바뀌므로 복사본 순회
+    const TArray<int32> SlotIndices = *DefSlots;
+    RecordTransactionSnapshot(InventoryGuid);
     int32 RemainingToRemove = Quantity;
     
-    for (int32 i = 0; i < Inventory->Num() && RemainingToRemove > 0; ++i)
+    for (int32 Pos = 0; Pos < SlotIndices.Num() && RemainingToRemove > 0; ++Pos)
     {
-        FInventorySlot& Slot = (*Inventory)[i];
+        const int32 i = SlotIndices[Pos];
+        FInventorySlot& Slot = Entry->Slots[i];
+        const int32 AmountToRemove = FMath::Min(Slot.Quantity, RemainingToRemove);
         
-        if (Slot.GetItemDefinition() == ItemDef)
+        if (Slot.Quantity <= AmountToRemove)
         {
-            const int32 AmountToRemove = FMath::Min(Slot.Quantity, RemainingToRemove);
-            
-            if (Slot.Quantity <= AmountToRemove)
-            {
-                RemainingToRemove -= Slot.Quantity;
-                Slot.Clear();
-                HandleInventoryChanged(InventoryGuid, i, EInventoryRefreshType::SingleSlot, ItemDef, false);
-            }
-            else
-            {
-                Slot.Quantity -= AmountToRemove;
-                RemainingToRemove -= AmountToRemove;
-                HandleInventoryChanged(InventoryGuid, i, EInventoryRefreshType::SingleSlot, nullptr, false);
-            }
+            RemainingToRemove -= Slot.Quantity;
+            Slot.Clear();
+            HandleInventoryChanged(InventoryGuid, i, EInventoryRefreshType::SingleSlot, ItemDef, false);
+        }
+        else
+        {
+            Slot.Quantity -= AmountToRemove;
+            RemainingToRemove -= AmountToRemove;
+            HandleInventoryChanged(InventoryGuid, i, EInventoryRefreshType::SingleSlot, nullptr, false);
         }
     }
     
@@ -402,15 +410,18 @@ bool UInventoryCoreComponent::RemoveItemFromSpecificInventory(FGuid InventoryGui
         return false;
     }
 
-    const TArray<FInventorySlot>* Slots = GetInventory(InventoryGuid);
-    if (!Slots) return false;
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    if (!Entry) return false;
+
+    // 2. 같은 아이템 정의가 있는 슬롯에서만 인스턴스 찾기
+    const TArray<int32>* DefSlots = Entry->LookupIndex.FindSlotsByDef(ItemInstance->GetItemDef());
+    if (!DefSlots) return false;
 
-    // 2. 슬롯 순회하며 인스턴스 찾기
-    for (int32 i = 0; i < Slots->Num(); ++i)
+    for (const int32 i : *DefSlots)
     {
-        if ((*Slots)[i].ItemInstance == ItemInstance)
+        if (Entry->Slots[i].ItemInstance == ItemInstance)
         {
-            int32 QuantityToRemove = (*Slots)[i].Quantity;
+            int32 QuantityToRemove = Entry->Slots[i].Quantity;
             return RemoveItem(InventoryGuid, i, QuantityToRemove);
         }
     }
@@ -449,7 +460,11 @@ bool UInventoryCoreComponent::MoveItem(FGuid FromInventoryGuid, int32 FromSlot,
 
     if (!TargetSlot->IsEmpty()) return false;
 
-    *TargetSlot = *SourceSlot;
+    RecordTransactionSnapshot(FromInventoryGuid);
+    RecordTransactionSnapshot(ToInventoryGuid);
+
+    // 내용만 옮김 (SlotIndex는 각 슬롯의 배열 위치로 유지)
+    TargetSlot->SwapContents(*SourceSlot);
     SourceSlot->Clear();
 
     HandleInventoryChanged(FromInventoryGuid, FromSlot, EInventoryRefreshType::SingleSlot, nullptr, false);
@@ -471,9 +486,10 @@ bool UInventoryCoreComponent::SwapItems(FGuid InventoryAGuid, int32 SlotA, FGuid
 
     // 무게 체크 생략 (복잡도 감소, 필요시 추가)
 
-    FInventorySlot Temp = *SlotPtrA;
-    *SlotPtrA = *SlotPtrB;
-    *SlotPtrB = Temp;
+    RecordTransactionSnapshot(InventoryAGuid);
+    RecordTransactionSnapshot(InventoryBGuid);
+
+    SlotPtrA->SwapContents(*SlotPtrB);
 
     HandleInventoryChanged(InventoryAGuid, SlotA, EInventoryRefreshType::SingleSlot, nullptr, true);
     HandleInventoryChanged(InventoryBGuid, SlotB, EInventoryRefreshType::SingleSlot, nullptr, true);
@@ -495,6 +511,8 @@ bool UInventoryCoreComponent::AddSlots(FGuid InventoryGuid, int32 Count)
         return false;
     }
     
+    RecordTransactionSnapshot(InventoryGuid);
+
     const int32 CurrentSize = Inventory->Num();
     Inventory->SetNum(CurrentSize + Count);
     
@@ -502,6 +520,14 @@ bool UInventoryCoreComponent::AddSlots(FGuid InventoryGuid, int32 Count)
     {
         (*Inventory)[i].SlotIndex = i;
     }
+
+    // 새 슬롯은 비어있으므로 슬롯 수만 복제
+    if (FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid))
+    {
+        Entry->LookupIndex.Rebuild(Entry->Slots);
+        Entry->NumSlots = Inventory->Num();
+        InventoryList.MarkItemDirty(*Entry);
+    }
     
     return true;
 }
@@ -510,6 +536,8 @@ void UInventoryCoreComponent::CompactInventory(FGuid InventoryGuid)
 {
     TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
     if (!Inventory) return;
+
+    RecordTransactionSnapshot(InventoryGuid);
     
     TArray<FInventorySlot> CompactedSlots;
     for (const FInventorySlot& Slot : *Inventory)
@@ -533,6 +561,8 @@ void UInventoryCoreComponent::ClearInventory(FGuid InventoryGuid)
 {
     TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
     if (!Inventory) return;
+
+    RecordTransactionSnapshot(InventoryGuid);
     
     for (FInventorySlot& Slot : *Inventory)
     {
@@ -547,15 +577,10 @@ void UInventoryCoreComponent::ClearInventory(FGuid InventoryGuid)
 
 int32 UInventoryCoreComponent::CountItemByDef(FGuid InventoryGuid, const UItemDefinition* ItemDef) const
 {
-    if (!ItemDef || !HasInventory(InventoryGuid)) return 0;
-    
-    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    int32 TotalCount = 0;
-    for (const FInventorySlot& Slot : *Inventory)
-    {
-        if (Slot.GetItemDefinition() == ItemDef) TotalCount += Slot.Quantity;
-    }
-    return TotalCount;
+    if (!ItemDef) return 0;
+
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    return Entry ? Entry->LookupIndex.GetItemCount(ItemDef) : 0;
 }
 
 bool UInventoryCoreComponent::CanAddItemType(FGuid InventoryGuid, const UItemDefinition* ItemDef) const
@@ -565,18 +590,19 @@ bool UInventoryCoreComponent::CanAddItemType(FGuid InventoryGuid, const UItemDef
 
 float UInventoryCoreComponent::CalculateCurrentWeight(FGuid InventoryGuid) const
 {
-    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    if (!Inventory) return 0.0f;
-    
-    float TotalWeight = 0.0f;
-    for (const FInventorySlot& Slot : *Inventory)
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    return Entry ? Entry->LookupIndex.GetTotalWeight() : 0.0f;
+}
+
+bool UInventoryCoreComponent::VerifyLookupIndex(FGuid InventoryGuid, FString* OutMismatch) const
+{
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    if (!Entry)
     {
-        if (!Slot.IsEmpty())
-        {
-            TotalWeight += GetItemWeight(Slot.GetItemDefinition(), Slot.Quantity);
-        }
+        if (OutMismatch) *OutMismatch = TEXT("Inventory not found");
+        return false;
     }
-    return TotalWeight;
+    return Entry->LookupIndex.Matches(Entry->Slots, OutMismatch);
 }
 
 int32 UInventoryCoreComponent::GetInventoryCount() const
@@ -617,6 +643,8 @@ int32 UInventoryCoreComponent::InsertItem_Internal(FGuid InventoryGuid, const UI
         if (Meta->CurrentWeight + AddWeight > Meta->MaxWeight) return 0;
     }
 
+    RecordTransactionSnapshot(InventoryGuid);
+
     TArray<FInventorySlot>* Slots = GetInventory(InventoryGuid);
     int32 AmountRemaining = Quantity;
     int32 AmountAdded = 0;
@@ -682,11 +710,26 @@ int32 UInventoryCoreComponent::InsertItem_Internal(FGuid InventoryGuid, const UI
 void UInventoryCoreComponent::HandleInventoryChanged(FGuid InventoryGuid, int32 SlotIndex,
     EInventoryRefreshType RefreshType, const UItemDefinition* ItemDefAddedOrRemoved, bool bWasAdded)
 {
-    if (FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid))
+    UpdateLookupIndex(InventoryGuid, SlotIndex);
+
+    // 트랜잭션 중에는 인덱스만 갱신하고 복제/알림은 커밋 때 한 번에 처리
+    if (IsInTransaction())
     {
-        InventoryList.MarkItemDirty(*Entry);
+        const int32 PendingIndex = (RefreshType == EInventoryRefreshType::FullRefresh) ? -1 : SlotIndex;
+        PendingChangedSlots.FindOrAdd(InventoryGuid).Add(PendingIndex);
+
+        // 무게 제한 검사가 최신 값을 보도록 값은 즉시 갱신 (OnWeightChanged는 커밋 시)
+        UpdateWeight(InventoryGuid);
+
+        if (ItemDefAddedOrRemoved)
+        {
+            PendingItemEvents.AddUnique({ InventoryGuid, SlotIndex, ItemDefAddedOrRemoved, bWasAdded });
+        }
+        return;
     }
 
+    SyncReplicatedSlots(InventoryGuid, SlotIndex);
+
     UpdateWeight(InventoryGuid);
 
     switch (RefreshType)
@@ -708,19 +751,75 @@ void UInventoryCoreComponent::HandleInventoryChanged(FGuid InventoryGuid, int32
     }
 }
 
+void UInventoryCoreComponent::UpdateLookupIndex(FGuid InventoryGuid, int32 SlotIndex)
+{
+    FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    if (!Entry) return;
+
+    if (Entry->Slots.IsValidIndex(SlotIndex))
+    {
+        Entry->LookupIndex.UpdateSlot(SlotIndex, Entry->Slots[SlotIndex]);
+        return;
+    }
+
+    for (int32 i = 0; i < Entry->Slots.Num(); ++i)
+    {
+        Entry->Slots[i].SlotIndex = i;
+    }
+    Entry->LookupIndex.Rebuild(Entry->Slots);
+}
+
+void UInventoryCoreComponent::SyncReplicatedSlots(FGuid InventoryGuid, int32 SlotIndex)
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
+    if (!Inventory) return;
+
+    if (Inventory->IsValidIndex(SlotIndex))
+    {
+        InventorySlots.SyncSlot(InventoryGuid, SlotIndex, (*Inventory)[SlotIndex]);
+        return;
+    }
+
+    // 전체 갱신 (Compact, Clear 등)
+    for (int32 i = 0; i < Inventory->Num(); ++i)
+    {
+        InventorySlots.SyncSlot(InventoryGuid, i, (*Inventory)[i]);
+    }
+}
+
+void UInventoryCoreComponent::RefreshReplicatedEntry(FInventoryEntry& Entry)
+{
+    const int32 OldNum = Entry.Slots.Num();
+    Entry.Slots.SetNum(Entry.NumSlots);
+
+    for (int32 i = OldNum; i < Entry.Slots.Num(); ++i)
+    {
+        Entry.Slots[i].SlotIndex = i;
+    }
+
+    InventorySlots.ApplyToEntry(Entry);
+    Entry.LookupIndex.Rebuild(Entry.Slots);
+    UpdateWeight(Entry.InventoryGuid);
+}
+
 int32 UInventoryCoreComponent::FindPartialStack(FGuid InventoryGuid, const UItemDefinition* ItemDef) const
 {
     if (!ItemDef || !IsItemStackable(ItemDef)) return -1;
     
-    const TArray<FInventorySlot>* Inventory = GetInventory(InventoryGuid);
-    if (!Inventory) return -1;
+    const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+    if (!Entry) return -1;
+
+    const TArray<int32>* DefSlots = Entry->LookupIndex.FindSlotsByDef(ItemDef);
+    if (!DefSlots) return -1;
     
     const int32 MaxStack = GetMaxStackSize(ItemDef);
     
-    for (int32 i = 0; i < Inventory->Num(); ++i)
+    // 같은 아이템이 있는 슬롯만 확인 (O(스택 수))
+    for (const int32 i : *DefSlots)
     {
-        const FInventorySlot& Slot = (*Inventory)[i];
-        if (Slot.GetItemDefinition() == ItemDef && Slot.Quantity < MaxStack) return i;
+        if (Entry->Slots[i].Quantity < MaxStack) return i;
     }
     return -1;
 }
@@ -758,7 +857,11 @@ void UInventoryCoreComponent::UpdateWeight(FGuid InventoryGuid)
     
     const float NewWeight = CalculateCurrentWeight(InventoryGuid);
     MetaData->CurrentWeight = NewWeight;
-    OnWeightChanged.Broadcast(InventoryGuid, NewWeight);
+
+    if (!IsInTransaction())
+    {
+        OnWeightChanged.Broadcast(InventoryGuid, NewWeight);
+    }
 }
 
 bool UInventoryCoreComponent::PassesFilter(FGuid InventoryGuid, const UItemDefinition* ItemDef) const
@@ -817,6 +920,7 @@ void UInventoryCoreComponent::AddToStack(FGuid InventoryGuid, int32 SlotIndex, i
     if (Slot && !Slot->IsEmpty())
     {
         const UItemDefinition* ItemDef = Slot->GetItemDefinition();
+        RecordTransactionSnapshot(InventoryGuid);
         Slot->Quantity += Quantity;
         HandleInventoryChanged(InventoryGuid, SlotIndex, EInventoryRefreshType::SingleSlot, ItemDef, true);
     }
@@ -832,10 +936,42 @@ void UInventoryCoreComponent::ServerMoveItemToSlot_Implementation(FGuid SourceGu
 {
     if (SourceGuid == DestGuid && SourceIdx == DestIdx) return;
 
+    MoveOrSwapSlot(SourceGuid, SourceIdx, DestGuid, DestIdx);
+}
+
+void UInventoryCoreComponent::ServerMoveItemsBatch_Implementation(const TArray<FInventoryMoveRequest>& Moves)
+{
+    if (Moves.Num() > MaxMovesPerBatch)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ServerMoveItemsBatch: rejected %d moves (max %d)"), Moves.Num(), MaxMovesPerBatch);
+        return;
+    }
+
+    // 전체가 하나의 트랜잭션: 슬롯 복제와 알림은 바뀐 슬롯당 한 번
+    FInventoryTransactionScope Transaction(this);
+
+    for (const FInventoryMoveRequest& Move : Moves)
+    {
+        if (Move.SourceGuid == Move.DestGuid && Move.SourceIndex == Move.DestIndex) continue;
+
+        if (!MoveOrSwapSlot(Move.SourceGuid, Move.SourceIndex, Move.DestGuid, Move.DestIndex))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ServerMoveItemsBatch: move %s[%d] -> %s[%d] failed, rolling back %d moves"),
+                *Move.SourceGuid.ToString(), Move.SourceIndex, *Move.DestGuid.ToString(), Move.DestIndex, Moves.Num());
+            Transaction.Rollback();
+            return;
+        }
+    }
+}
+
+bool UInventoryCoreComponent::MoveOrSwapSlot(FGuid SourceGuid, int32 SourceIdx, FGuid DestGuid, int32 DestIdx)
+{
+    if (SourceGuid == DestGuid && SourceIdx == DestIdx) return false;
+
     FInventorySlot* SourceSlot = GetSlot(SourceGuid, SourceIdx);
     FInventorySlot* DestSlot = GetSlot(DestGuid, DestIdx);
 
-    if (!SourceSlot || !DestSlot || SourceSlot->IsEmpty()) return;
+    if (!SourceSlot || !DestSlot || SourceSlot->IsEmpty()) return false;
 
     // 3. 아이템 정의 및 타입 확인
     const UItemDefinition* SourceDef = SourceSlot->GetItemDefinition();
@@ -843,16 +979,23 @@ void UInventoryCoreComponent::ServerMoveItemToSlot_Implementation(FGuid SourceGu
 
     // 4. 도착지 필터 검사 (예: 장비 슬롯에 잘못된 아이템을 넣으려는지)
     // (이 부분은 GetSlot이나 별도 검증 함수에서 처리 가능)
-    if (!PassesFilter(DestGuid, SourceDef)) return;
+    if (!PassesFilter(DestGuid, SourceDef)) return false;
+
+    // [CASE 3] 교환 시 도착지 아이템이 출발지에 들어갈 수 있는지(필터) 먼저 확인
+    const bool bCanStack = SourceDef == DestDef && SourceDef->IsStackable();
+    if (!DestSlot->IsEmpty() && !bCanStack && !PassesFilter(SourceGuid, DestDef)) return false;
+
+    RecordTransactionSnapshot(SourceGuid);
+    RecordTransactionSnapshot(DestGuid);
 
     // 5. 로직 분기
     if (DestSlot->IsEmpty())
     {
         // [CASE 1] 빈 슬롯으로 이동 (Move)
-        *DestSlot = *SourceSlot;
+        DestSlot->SwapContents(*SourceSlot);
         SourceSlot->Clear();
     }
-    else if (SourceDef == DestDef && SourceDef->IsStackable())
+    else if (bCanStack)
     {
         // [CASE 2] 같은 아이템 & 스택 가능 -> 합치기 (Stack)
         int32 MaxStack = SourceDef->GetMaxStackSize();
@@ -873,41 +1016,168 @@ void UInventoryCoreComponent::ServerMoveItemToSlot_Implementation(FGuid SourceGu
         else
         {
             // 꽉 찼으면 교환(Swap)
-            FInventorySlot Temp = *SourceSlot;
-            *SourceSlot = *DestSlot;
-            *DestSlot = Temp;
+            SourceSlot->SwapContents(*DestSlot);
         }
     }
     else
     {
         // [CASE 3] 다른 아이템이거나 스택 불가 -> 교환 (Swap)
-        // 도착지 아이템이 출발지에 들어갈 수 있는지(필터) 확인 필요
-        if (PassesFilter(SourceGuid, DestDef))
+        SourceSlot->SwapContents(*DestSlot);
+    }
+
+    // 6. 변경 사항 알림 (바뀐 두 슬롯만 복제됨)
+    HandleInventoryChanged(SourceGuid, SourceIdx, EInventoryRefreshType::SingleSlot, nullptr, false);
+    HandleInventoryChanged(DestGuid, DestIdx, EInventoryRefreshType::SingleSlot, nullptr, true);
+    return true;
+}
+
+// ========================================
+// 트랜잭션
+// ========================================
+
+void UInventoryCoreComponent::BeginTransaction()
+{
+    if (TransactionDepth++ == 0)
+    {
+        bTransactionRollbackRequested = false;
+    }
+}
+
+void UInventoryCoreComponent::CommitTransaction()
+{
+    if (!ensureMsgf(TransactionDepth > 0, TEXT("CommitTransaction without BeginTransaction"))) return;
+
+    if (--TransactionDepth > 0) return;
+
+    if (bTransactionRollbackRequested)
+    {
+        RestoreTransactionSnapshots();
+    }
+    else
+    {
+        FlushTransaction();
+    }
+}
+
+void UInventoryCoreComponent::RollbackTransaction()
+{
+    if (!ensureMsgf(TransactionDepth > 0, TEXT("RollbackTransaction without BeginTransaction"))) return;
+
+    // 안쪽에서 롤백해도 가장 바깥 트랜잭션이 끝날 때 전체를 되돌림
+    bTransactionRollbackRequested = true;
+
+    if (--TransactionDepth == 0)
+    {
+        RestoreTransactionSnapshots();
+    }
+}
+
+void UInventoryCoreComponent::RecordTransactionSnapshot(FGuid InventoryGuid)
+{
+    if (!IsInTransaction() || TransactionSnapshots.Contains(InventoryGuid)) return;
+
+    FTransactionSnapshot& Snapshot = TransactionSnapshots.Add(InventoryGuid);
+    if (const FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid))
+    {
+        Snapshot.bExisted = true;
+        Snapshot.MetaData = Entry->MetaData;
+        Snapshot.Slots = Entry->Slots;
+    }
+}
+
+void UInventoryCoreComponent::FlushTransaction()
+{
+    // 리스너가 새 트랜잭션을 시작할 수 있으므로 먼저 비움
+    TMap<FGuid, TSet<int32>> ChangedSlots = MoveTemp(PendingChangedSlots);
+    TArray<FPendingItemEvent> ItemEvents = MoveTemp(PendingItemEvents);
+    PendingChangedSlots.Reset();
+    PendingItemEvents.Reset();
+    TransactionSnapshots.Reset();
+
+    for (const TPair<FGuid, TSet<int32>>& Pair : ChangedSlots)
+    {
+        const FGuid& InventoryGuid = Pair.Key;
+        if (!HasInventory(InventoryGuid)) continue;
+
+        TArray<int32> SlotIndices = Pair.Value.Array();
+        if (SlotIndices.Contains(-1))
+        {
+            SlotIndices = { -1 };
+            SyncReplicatedSlots(InventoryGuid, -1);
+        }
+        else
+        {
+            SlotIndices.Sort();
+            for (const int32 SlotIndex : SlotIndices)
+            {
+                SyncReplicatedSlots(InventoryGuid, SlotIndex);
+            }
+        }
+
+        UpdateWeight(InventoryGuid);
+
+        for (const int32 SlotIndex : SlotIndices)
         {
-            FInventorySlot Temp = *SourceSlot;
-            *SourceSlot = *DestSlot;
-            *DestSlot = Temp;
+            OnInventoryChanged.Broadcast(InventoryGuid, SlotIndex);
         }
+        OnInventoryBatchChanged.Broadcast(InventoryGuid, SlotIndices);
     }
 
-    // 6. 변경 사항 알림 (Fast Array를 쓰면 MarkItemDirty 호출)
-    if (FInventoryEntry* SourceEntry = InventoryList.FindInventoryByGuid(SourceGuid))
+    for (const FPendingItemEvent& Event : ItemEvents)
     {
-        InventoryList.MarkItemDirty(*SourceEntry);
+        if (Event.bWasAdded) OnItemAdded.Broadcast(Event.InventoryGuid, Event.SlotIndex, Event.ItemDef);
+        else OnItemRemoved.Broadcast(Event.InventoryGuid, Event.SlotIndex, Event.ItemDef);
     }
+}
 
-    // 2. Dest 쪽 Entry 찾기 (Source와 다를 경우)
-    if (SourceGuid != DestGuid)
+void UInventoryCoreComponent::RestoreTransactionSnapshots()
+{
+    TMap<FGuid, FTransactionSnapshot> Snapshots = MoveTemp(TransactionSnapshots);
+    TransactionSnapshots.Reset();
+    PendingChangedSlots.Reset();
+    PendingItemEvents.Reset();
+    bTransactionRollbackRequested = false;
+
+    for (TPair<FGuid, FTransactionSnapshot>& Pair : Snapshots)
     {
-        if (FInventoryEntry* DestEntry = InventoryList.FindInventoryByGuid(DestGuid))
+        const FGuid& InventoryGuid = Pair.Key;
+        FTransactionSnapshot& Snapshot = Pair.Value;
+
+        // 트랜잭션 중 생성된 인벤토리 제거
+        if (!Snapshot.bExisted)
         {
-            InventoryList.MarkItemDirty(*DestEntry);
+            if (InventoryList.RemoveInventory(InventoryGuid))
+            {
+                InventorySlots.RemoveInventory(InventoryGuid);
+            }
+            continue;
         }
+
+        FInventoryEntry* Entry = InventoryList.FindInventoryByGuid(InventoryGuid);
+        if (!Entry)
+        {
+            // 트랜잭션 중 삭제된 인벤토리는 같은 GUID로 복구
+            InventoryList.AddInventory(InventoryGuid, Snapshot.MetaData, Snapshot.Slots);
+            SyncReplicatedSlots(InventoryGuid, -1);
+            OnInventoryChanged.Broadcast(InventoryGuid, -1);
+            continue;
+        }
+
+        const bool bResized = Entry->Slots.Num() != Snapshot.Slots.Num();
+        Entry->Slots = MoveTemp(Snapshot.Slots);
+        Entry->MetaData = Snapshot.MetaData;
+        Entry->LookupIndex.Rebuild(Entry->Slots);
+
+        if (bResized)
+        {
+            // 늘어난 슬롯의 복제 항목까지 지우고 다시 동기화
+            Entry->NumSlots = Entry->Slots.Num();
+            InventoryList.MarkItemDirty(*Entry);
+            InventorySlots.RemoveInventory(InventoryGuid);
+        }
+
+        // 복구된 슬롯은 커밋 전 복제 상태와 같으므로 실제로 바뀐 항목만 dirty
+        SyncReplicatedSlots(InventoryGuid, -1);
     }
-    
-    // UI 강제 갱신이 필요하다면 Delegate 호출
-    HandleInventoryChanged(SourceGuid, SourceIdx, EInventoryRefreshType::SingleSlot, nullptr, false);
-    HandleInventoryChanged(DestGuid, DestIdx, EInventoryRefreshType::SingleSlot, nullptr, true);
 }
 
-
@@ -5,6 +5,7 @@
 
 #include "Inventory/InventoryCoreComponent.h"
 #include "Item/Data/ItemDataStructure.h"
+#include "UObject/Package.h"
 
 void UInventoryDebugLibrary::LogAllInventories(const UObject* WorldContextObject, UInventoryCoreComponent* InventoryComp)
 {
@@ -125,6 +126,25 @@ void UInventoryDebugLibrary::LogInventoryByName(UInventoryCoreComponent* Invento
 #endif
 }
 
+bool UInventoryDebugLibrary::ValidateLookupIndex(UInventoryCoreComponent* InventoryComp)
+{
+	if (!InventoryComp) return false;
+
+	bool bAllValid = true;
+	for (const FGuid& Guid : InventoryComp->GetAllInventoryGuids())
+	{
+		FString Mismatch;
+		if (!InventoryComp->VerifyLookupIndex(Guid, &Mismatch))
+		{
+			const FInventoryMetaData* MetaData = InventoryComp->GetMetaData(Guid);
+			UE_LOG(LogTemp, Error, TEXT("[Inventory Debug] Lookup index of '%s' is out of sync: %s"),
+				MetaData ? *MetaData->InventoryName.ToString() : *Guid.ToString(), *Mismatch);
+			bAllValid = false;
+		}
+	}
+	return bAllValid;
+}
+
 void UInventoryDebugLibrary::DrawDebugInventoryOnScreen(UInventoryCoreComponent* InventoryComp, float Duration)
 {
 #if !UE_BUILD_SHIPPING
@@ -166,4 +186,123 @@ void UInventoryDebugLibrary::DrawDebugInventoryOnScreen(UInventoryCoreComponent*
 	// 화면에 Cyan 색상으로 출력 (Key: -1로 설정하여 기존 메시지를 덮어쓰지 않고 추가)
 	GEngine->AddOnScreenDebugMessage(-1, Duration, FColor::Cyan, DebugMessage);
 #endif
-}
\ No newline at end of file
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Shared/RPGTestItems.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * 랜덤 조작 후 매번 조회 인덱스를 전체 스캔 결과와 비교
+ * 시드 변경: Automation RunTests RPGSystem.Inventory.LookupIndexFuzz 실행 시 -InventoryFuzzSeed=<N>
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventoryLookupIndexFuzzTest, "RPGSystem.Inventory.LookupIndexFuzz",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FInventoryLookupIndexFuzzTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumOps = 5000;
+
+	int32 Seed = 1;
+	FParse::Value(FCommandLine::Get(), TEXT("InventoryFuzzSeed="), Seed);
+
+	// 월드와 무관한 임시 컴포넌트와 아이템 정의
+	const TStrongObjectPtr<UInventoryCoreComponent> InventoryCompPtr(NewObject<UInventoryCoreComponent>(GetTransientPackage()));
+	UInventoryCoreComponent* InventoryComp = InventoryCompPtr.Get();
+
+	const TArray<TStrongObjectPtr<UItemDefinition>> ItemDefs = RPGTestItems::CreateItemDefinitions();
+
+	const auto CreateInventory = [InventoryComp](int32 Index)
+	{
+		FInventoryCreateConfig Config;
+		Config.InventoryName = *FString::Printf(TEXT("Fuzz_%d"), Index);
+		Config.SlotCount = 24;
+		Config.MaxSlots = 64;
+		return InventoryComp->CreateInventory(Config);
+	};
+
+	TArray<FGuid> Guids;
+	int32 CreatedCount = 0;
+	for (; CreatedCount < 3; ++CreatedCount)
+	{
+		Guids.Add(CreateInventory(CreatedCount));
+	}
+
+	FRandomStream Random(Seed);
+	int32 Failures = 0;
+
+	for (int32 Op = 0; Op < NumOps && Failures == 0; ++Op)
+	{
+		const FGuid Guid = Guids[Random.RandHelper(Guids.Num())];
+		const FGuid OtherGuid = Guids[Random.RandHelper(Guids.Num())];
+		const TArray<FInventorySlot>* Slots = InventoryComp->GetInventory(Guid);
+		const int32 NumSlots = Slots ? Slots->Num() : 1;
+		UItemDefinition* ItemDef = ItemDefs[Random.RandHelper(ItemDefs.Num())].Get();
+
+		switch (Random.RandHelper(10))
+		{
+		case 0:
+		case 1:
+		case 2:
+			InventoryComp->AddItemToInventory(Guid, ItemDef, Random.RandRange(1, 40));
+			break;
+		case 3:
+			InventoryComp->RemoveItem(Guid, Random.RandHelper(NumSlots), Random.RandRange(1, 10));
+			break;
+		case 4:
+			InventoryComp->RemoveItemByDef(Guid, ItemDef, Random.RandRange(1, 30));
+			break;
+		case 5:
+			InventoryComp->MoveItem(Guid, Random.RandHelper(NumSlots), OtherGuid, Random.RandHelper(NumSlots));
+			break;
+		case 6:
+			InventoryComp->SwapItems(Guid, Random.RandHelper(NumSlots), OtherGuid, Random.RandHelper(NumSlots));
+			break;
+		case 7:
+			InventoryComp->CompactInventory(Guid);
+			break;
+		case 8:
+			InventoryComp->AddSlots(Guid, Random.RandRange(1, 4));
+			break;
+		default:
+			// 인벤토리 교체로 GUID 인덱스 검증
+			if (Random.FRand() < 0.2f && InventoryComp->DestroyInventory(Guid))
+			{
+				Guids.Remove(Guid);
+				Guids.Add(CreateInventory(CreatedCount++));
+			}
+			else
+			{
+				InventoryComp->ClearInventory(Guid);
+			}
+			break;
+		}
+
+		for (const FGuid& CheckGuid : Guids)
+		{
+			FString Mismatch;
+			const TArray<FInventorySlot>* CheckSlots = InventoryComp->GetInventory(CheckGuid);
+			if (!CheckSlots)
+			{
+				Mismatch = TEXT("GUID lookup failed");
+			}
+			else
+			{
+				InventoryComp->VerifyLookupIndex(CheckGuid, &Mismatch);
+			}
+
+			if (!Mismatch.IsEmpty())
+			{
+				AddError(FString::Printf(TEXT("Fuzz op %d (seed %d): %s"), Op, Seed, *Mismatch));
+				++Failures;
+			}
+		}
+	}
+
+	return Failures == 0;
+}
+
+#endif
@@ -18,7 +18,8 @@ void UInventoryInitializer::Initialize(UInventoryCoreComponent* InOwner)
 	CreateInventoriesFromConfigTable();
 	CreateInventoriesFromAutoList();
 
-	// 2. 아이템 지급 단계
+	// 2. 아이템 지급 단계 (슬롯 복제/알림은 끝날 때 한 번에)
+	FInventoryTransactionScope Transaction(Owner);
 	LoadItemsFromDataTables();
 	AddSingleInitialItems();
 	GenerateRandomLoot();
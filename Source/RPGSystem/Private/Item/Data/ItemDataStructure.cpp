@@ -2,6 +2,7 @@
 
 #include "Item/Data/ItemDataStructure.h"
 #include "Inventory/InventoryCoreComponent.h"
+#include "Algo/BinarySearch.h"
 
 // ========================================
 // FInventoryList 구현
@@ -9,6 +10,8 @@
 
 void FInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
 {
+    bGuidIndexDirty = true;
+
     // 클라이언트에서 인벤토리가 추가되었을 때
     if (!OwnerComponent)
     {
@@ -23,6 +26,9 @@ void FInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int
             
             UE_LOG(LogTemp, Log, TEXT("[Client] Inventory added: %s"), 
                 *Entry.MetaData.InventoryName.ToString());
+
+            // 슬롯 내용은 FInventorySlotList로 따로 오므로, 먼저 도착한 슬롯을 적용
+            OwnerComponent->RefreshReplicatedEntry(Entries[Index]);
             
             // 전체 인벤토리 갱신 델리게이트 (-1은 전체 갱신)
             OwnerComponent->OnInventoryChanged.Broadcast(Entry.InventoryGuid, -1);
@@ -43,6 +49,9 @@ void FInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices
         if (Entries.IsValidIndex(Index))
         {
             const FInventoryEntry& Entry = Entries[Index];
+
+            // 슬롯 수나 메타데이터가 바뀐 경우만 옴 (슬롯 내용 변경은 FInventorySlotList)
+            OwnerComponent->RefreshReplicatedEntry(Entries[Index]);
             
             // 전체 인벤토리 갱신
             OwnerComponent->OnInventoryChanged.Broadcast(Entry.InventoryGuid, -1);
@@ -52,6 +61,9 @@ void FInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices
 
 void FInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
 {
+    // 콜백 이후 배열에서 제거되므로 다음 조회 때 재구성
+    bGuidIndexDirty = true;
+
     // 클라이언트에서 인벤토리가 제거되기 전
     if (!OwnerComponent)
     {
@@ -76,26 +88,47 @@ void FInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices,
 
 FInventoryEntry* FInventoryList::FindInventoryByGuid(const FGuid& InGuid)
 {
-    for (FInventoryEntry& Entry : Entries)
+    const int32 Index = FindIndexByGuid(InGuid);
+    return Index != INDEX_NONE ? &Entries[Index] : nullptr;
+}
+
+const FInventoryEntry* FInventoryList::FindInventoryByGuid(const FGuid& InGuid) const
+{
+    const int32 Index = FindIndexByGuid(InGuid);
+    return Index != INDEX_NONE ? &Entries[Index] : nullptr;
+}
+
+int32 FInventoryList::FindIndexByGuid(const FGuid& InGuid) const
+{
+    if (bGuidIndexDirty)
     {
-        if (Entry.InventoryGuid == InGuid)
-        {
-            return &Entry;
-        }
+        RebuildGuidIndex();
     }
-    return nullptr;
+
+    const int32* Found = GuidToIndex.Find(InGuid);
+    if (Found && Entries.IsValidIndex(*Found) && Entries[*Found].InventoryGuid == InGuid)
+    {
+        return *Found;
+    }
+
+    // 알 수 없는 경로로 배열이 바뀐 경우 한 번만 재구성
+    if (Found || GuidToIndex.Num() != Entries.Num())
+    {
+        RebuildGuidIndex();
+        Found = GuidToIndex.Find(InGuid);
+        return Found ? *Found : INDEX_NONE;
+    }
+    return INDEX_NONE;
 }
 
-const FInventoryEntry* FInventoryList::FindInventoryByGuid(const FGuid& InGuid) const
+void FInventoryList::RebuildGuidIndex() const
 {
-    for (const FInventoryEntry& Entry : Entries)
+    GuidToIndex.Reset();
+    for (int32 i = 0; i < Entries.Num(); ++i)
     {
-        if (Entry.InventoryGuid == InGuid)
-        {
-            return &Entry;
-        }
+        GuidToIndex.Add(Entries[i].InventoryGuid, i);
     }
-    return nullptr;
+    bGuidIndexDirty = false;
 }
 
 FInventoryEntry* FInventoryList::FindInventoryByName(FName InName)
@@ -127,7 +160,14 @@ FInventoryEntry& FInventoryList::AddInventory(const FGuid& InGuid, const FInvent
     FInventoryEntry& NewEntry = Entries.AddDefaulted_GetRef();
     NewEntry.InventoryGuid = InGuid;
     NewEntry.MetaData = InMetaData;
+    NewEntry.NumSlots = InSlots.Num();
     NewEntry.Slots = InSlots;
+    NewEntry.LookupIndex.Rebuild(NewEntry.Slots);
+
+    if (!bGuidIndexDirty)
+    {
+        GuidToIndex.Add(InGuid, Entries.Num() - 1);
+    }
     
     // Fast Array에 변경 마킹
     MarkItemDirty(NewEntry);
@@ -142,6 +182,7 @@ bool FInventoryList::RemoveInventory(const FGuid& InGuid)
         if (Entries[i].InventoryGuid == InGuid)
         {
             Entries.RemoveAt(i);
+            bGuidIndexDirty = true;
             MarkArrayDirty();
             return true;
         }
@@ -184,3 +225,307 @@ bool FInventoryList::IsEmpty() const
 {
     return Entries.Num() == 0;
 }
+
+// ========================================
+// FInventoryLookupIndex 구현
+// ========================================
+
+void FInventoryLookupIndex::Rebuild(const TArray<FInventorySlot>& Slots)
+{
+    CachedSlots.Reset(Slots.Num());
+    CachedSlots.SetNum(Slots.Num());
+    SlotsByDef.Reset();
+    CountByDef.Reset();
+    EmptySlots.Init(true, Slots.Num());
+    NumEmptySlots = Slots.Num();
+
+    for (int32 i = 0; i < Slots.Num(); ++i)
+    {
+        UpdateSlot(i, Slots[i]);
+    }
+}
+
+void FInventoryLookupIndex::UpdateSlot(int32 SlotIndex, const FInventorySlot& Slot)
+{
+    if (SlotIndex < 0)
+    {
+        return;
+    }
+
+    // AddSlots 등으로 늘어난 슬롯은 빈 슬롯으로 추가
+    if (SlotIndex >= CachedSlots.Num())
+    {
+        const int32 NumAdded = SlotIndex + 1 - CachedSlots.Num();
+        CachedSlots.SetNum(SlotIndex + 1);
+        EmptySlots.Add(true, NumAdded);
+        NumEmptySlots += NumAdded;
+    }
+
+    FCachedSlot& Cached = CachedSlots[SlotIndex];
+    const bool bOccupied = !Slot.IsEmpty();
+    const UItemDefinition* NewDef = bOccupied ? Slot.GetItemDefinition() : nullptr;
+    const int32 NewQuantity = bOccupied ? Slot.Quantity : 0;
+
+    if (Cached.bOccupied == bOccupied && Cached.ItemDef == NewDef && Cached.Quantity == NewQuantity)
+    {
+        return;
+    }
+
+    // 이전 상태 제거
+    if (Cached.ItemDef)
+    {
+        int32& Count = CountByDef.FindChecked(Cached.ItemDef);
+        Count -= Cached.Quantity;
+        if (Count == 0)
+        {
+            CountByDef.Remove(Cached.ItemDef);
+        }
+
+        if (Cached.ItemDef != NewDef)
+        {
+            TArray<int32>& DefSlots = SlotsByDef.FindChecked(Cached.ItemDef);
+            DefSlots.RemoveSingle(SlotIndex);
+            if (DefSlots.IsEmpty())
+            {
+                SlotsByDef.Remove(Cached.ItemDef);
+            }
+        }
+    }
+
+    // 새 상태 추가
+    if (NewDef)
+    {
+        CountByDef.FindOrAdd(NewDef) += NewQuantity;
+
+        if (Cached.ItemDef != NewDef)
+        {
+            TArray<int32>& DefSlots = SlotsByDef.FindOrAdd(NewDef);
+            const int32 InsertAt = Algo::LowerBound(DefSlots, SlotIndex);
+            DefSlots.Insert(SlotIndex, InsertAt);
+        }
+    }
+
+    if (Cached.bOccupied != bOccupied)
+    {
+        EmptySlots[SlotIndex] = !bOccupied;
+        NumEmptySlots += bOccupied ? -1 : 1;
+    }
+
+    Cached.ItemDef = NewDef;
+    Cached.Quantity = NewQuantity;
+    Cached.bOccupied = bOccupied;
+}
+
+float FInventoryLookupIndex::GetTotalWeight() const
+{
+    float TotalWeight = 0.0f;
+    for (const TPair<const UItemDefinition*, int32>& Pair : CountByDef)
+    {
+        TotalWeight += Pair.Key->GetWeight() * Pair.Value;
+    }
+    return TotalWeight;
+}
+
+bool FInventoryLookupIndex::Matches(const TArray<FInventorySlot>& Slots, FString* OutMismatch) const
+{
+    const auto Fail = [OutMismatch](const FString& Reason)
+    {
+        if (OutMismatch)
+        {
+            *OutMismatch = Reason;
+        }
+        return false;
+    };
+
+    if (CachedSlots.Num() != Slots.Num())
+    {
+        return Fail(FString::Printf(TEXT("Slot count %d, expected %d"), CachedSlots.Num(), Slots.Num()));
+    }
+
+    TMap<const UItemDefinition*, int32> ExpectedCounts;
+    TMap<const UItemDefinition*, TArray<int32>> ExpectedSlots;
+    int32 ExpectedEmpty = 0;
+    int32 ExpectedFirstEmpty = INDEX_NONE;
+    float ExpectedWeight = 0.0f;
+
+    for (int32 i = 0; i < Slots.Num(); ++i)
+    {
+        const FInventorySlot& Slot = Slots[i];
+        if (Slot.IsEmpty())
+        {
+            ++ExpectedEmpty;
+            if (ExpectedFirstEmpty == INDEX_NONE)
+            {
+                ExpectedFirstEmpty = i;
+            }
+            continue;
+        }
+
+        if (const UItemDefinition* ItemDef = Slot.GetItemDefinition())
+        {
+            ExpectedCounts.FindOrAdd(ItemDef) += Slot.Quantity;
+            ExpectedSlots.FindOrAdd(ItemDef).Add(i);
+            ExpectedWeight += ItemDef->GetWeight() * Slot.Quantity;
+        }
+    }
+
+    if (NumEmptySlots != ExpectedEmpty || FindFirstEmptySlot() != ExpectedFirstEmpty)
+    {
+        return Fail(FString::Printf(TEXT("Empty slots %d (first %d), expected %d (first %d)"), NumEmptySlots, FindFirstEmptySlot(), ExpectedEmpty, ExpectedFirstEmpty));
+    }
+
+    if (!CountByDef.OrderIndependentCompareEqual(ExpectedCounts))
+    {
+        return Fail(TEXT("Item counts differ"));
+    }
+
+    if (SlotsByDef.Num() != ExpectedSlots.Num())
+    {
+        return Fail(TEXT("Item slot lists differ"));
+    }
+
+    for (const TPair<const UItemDefinition*, TArray<int32>>& Pair : ExpectedSlots)
+    {
+        const TArray<int32>* DefSlots = SlotsByDef.Find(Pair.Key);
+        if (!DefSlots || *DefSlots != Pair.Value)
+        {
+            return Fail(FString::Printf(TEXT("Slots of %s differ"), *GetNameSafe(Pair.Key)));
+        }
+    }
+
+    if (!FMath::IsNearlyEqual(GetTotalWeight(), ExpectedWeight, KINDA_SMALL_NUMBER * FMath::Max(1.0f, ExpectedWeight)))
+    {
+        return Fail(FString::Printf(TEXT("Weight %f, expected %f"), GetTotalWeight(), ExpectedWeight));
+    }
+
+    return true;
+}
+
+// ========================================
+// FInventorySlotList 구현
+// ========================================
+
+void FInventorySlotList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+    ApplyReplicatedSlots(AddedIndices, false);
+}
+
+void FInventorySlotList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+    ApplyReplicatedSlots(ChangedIndices, false);
+}
+
+void FInventorySlotList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+    // 인벤토리가 제거될 때 같이 제거됨, 엔트리가 남아있으면 슬롯을 비움
+    ApplyReplicatedSlots(RemovedIndices, true);
+}
+
+void FInventorySlotList::ApplyReplicatedSlots(const TArrayView<int32> Indices, bool bRemoved)
+{
+    if (!OwnerComponent)
+    {
+        return;
+    }
+
+    TArray<FGuid, TInlineAllocator<4>> TouchedInventories;
+
+    for (int32 Index : Indices)
+    {
+        if (!Items.IsValidIndex(Index))
+        {
+            continue;
+        }
+
+        const FInventorySlotEntry& Item = Items[Index];
+        FInventoryEntry* Entry = OwnerComponent->InventoryList.FindInventoryByGuid(Item.InventoryGuid);
+
+        // 엔트리가 아직 없으면 도착할 때 ApplyToEntry로 적용됨
+        if (!Entry || !Entry->Slots.IsValidIndex(Item.Slot.SlotIndex))
+        {
+            continue;
+        }
+
+        FInventorySlot& Slot = Entry->Slots[Item.Slot.SlotIndex];
+        if (bRemoved)
+        {
+            Slot.Clear();
+        }
+        else
+        {
+            Slot = Item.Slot;
+        }
+        Entry->LookupIndex.UpdateSlot(Item.Slot.SlotIndex, Slot);
+
+        TouchedInventories.AddUnique(Item.InventoryGuid);
+        OwnerComponent->OnInventoryChanged.Broadcast(Item.InventoryGuid, Item.Slot.SlotIndex);
+    }
+
+    for (const FGuid& InventoryGuid : TouchedInventories)
+    {
+        OwnerComponent->UpdateWeight(InventoryGuid);
+    }
+}
+
+void FInventorySlotList::SyncSlot(const FGuid& InGuid, int32 SlotIndex, const FInventorySlot& InSlot)
+{
+    // 슬롯에 저장된 SlotIndex가 아니라 배열 위치로 식별 (클라이언트도 이 위치에 적용)
+    FInventorySlot Slot = InSlot;
+    Slot.SlotIndex = SlotIndex;
+
+    const TPair<FGuid, int32> Key(InGuid, SlotIndex);
+
+    if (const int32* ItemIndex = ItemIndexMap.Find(Key))
+    {
+        FInventorySlotEntry& Item = Items[*ItemIndex];
+        if (Item.Slot != Slot)
+        {
+            Item.Slot = Slot;
+            MarkItemDirty(Item);
+        }
+        return;
+    }
+
+    // 클라이언트의 기본값이 빈 슬롯이므로 항목을 만들 필요 없음
+    if (Slot.IsEmpty())
+    {
+        return;
+    }
+
+    FInventorySlotEntry& NewItem = Items.AddDefaulted_GetRef();
+    NewItem.InventoryGuid = InGuid;
+    NewItem.Slot = Slot;
+    ItemIndexMap.Add(Key, Items.Num() - 1);
+    MarkItemDirty(NewItem);
+}
+
+void FInventorySlotList::RemoveInventory(const FGuid& InGuid)
+{
+    const int32 NumRemoved = Items.RemoveAll([&InGuid](const FInventorySlotEntry& Item)
+    {
+        return Item.InventoryGuid == InGuid;
+    });
+
+    if (NumRemoved == 0)
+    {
+        return;
+    }
+
+    ItemIndexMap.Reset();
+    for (int32 i = 0; i < Items.Num(); ++i)
+    {
+        ItemIndexMap.Add(TPair<FGuid, int32>(Items[i].InventoryGuid, Items[i].Slot.SlotIndex), i);
+    }
+    MarkArrayDirty();
+}
+
+void FInventorySlotList::ApplyToEntry(FInventoryEntry& Entry) const
+{
+    for (const FInventorySlotEntry& Item : Items)
+    {
+        if (Item.InventoryGuid == Entry.InventoryGuid && Entry.Slots.IsValidIndex(Item.Slot.SlotIndex))
+        {
+            Entry.Slots[Item.Slot.SlotIndex] = Item.Slot;
+        }
+    }
+}
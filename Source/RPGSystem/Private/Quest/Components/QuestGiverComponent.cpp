@@ -95,9 +95,27 @@ void UQuestGiverComponent::LateBeginPlay()
 	/* Get the quest manager */
 	QuestManagerComponent = localPlayer->FindComponentByClass<UQuestManagerComponent>();
 
+	if (!QuestManagerComponent)
+		return;
+
 	if (QuestMarkerClass)
 		CreateQuestMarkerWidget();
 
+	/* 스트리밍 셀과 함께 로드된 NPC의 퀘스트만 비동기 로드 */
+	TArray<int32> GiverQuestIDs;
+	QuestManagerComponent->GetQuestIDsForGiver(QuestGiverID, GiverQuestIDs);
+	for (const int32 QuestID : GiverQuestIDs)
+	{
+		QuestList.FindOrAdd(QuestID);
+	}
+
+	TArray<int32> QuestIDs;
+	QuestList.GenerateKeyArray(QuestIDs);
+	QuestManagerComponent->RequestQuestsAsync(QuestIDs, FOnQuestsLoadedNative::CreateUObject(this, &UQuestGiverComponent::OnQuestsLoaded));
+}
+
+void UQuestGiverComponent::OnQuestsLoaded()
+{
 	BindFunctionsToQuestDelegates();
 }
 
@@ -136,7 +154,7 @@ void UQuestGiverComponent::BindFunctionsToQuestDelegates()
 		int32 QuestID = Elem.Key;
        
 		// 현재 활성화된(Active) 퀘스트 인스턴스가 있는지 확인
-		URPGQuest* ActiveQuest = QuestManagerComponent->QueryQuest(QuestID);
+		URPGQuest* ActiveQuest = QuestManagerComponent->FindLoadedQuest(QuestID);
 
 		if (ActiveQuest)
 		{
@@ -200,8 +218,8 @@ void UQuestGiverComponent::UpdateQuestMarker()
        int32 QuestID = Elem.Key;
        FQuestGiverEntry& Config = Elem.Value;
 
-       // 1. 이미 받은 퀘스트인지 확인 (인스턴스 조회)
-       URPGQuest* ActiveQuest = QuestManagerComponent->QueryQuest(QuestID);
+       // 1. 이미 받은 퀘스트인지 확인 (인스턴스 조회, 로드 중이면 로드 완료 후 다시 갱신됨)
+       URPGQuest* ActiveQuest = QuestManagerComponent->FindLoadedQuest(QuestID);
 
        // [Case 1: 완료 보고 가능?] (Valid)
        if (ActiveQuest && Config.bIsQuestReceiver)
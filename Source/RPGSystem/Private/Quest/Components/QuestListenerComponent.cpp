@@ -30,9 +30,17 @@ void UQuestListenerComponent::ListenToQuests()
 {
 	if (!QuestManagerComponent) return;
 
+	// 추적할 퀘스트를 비동기로 로드한 뒤 바인딩
+	QuestManagerComponent->RequestQuestsAsync(QuestToFollow, FOnQuestsLoadedNative::CreateUObject(this, &UQuestListenerComponent::OnQuestsLoaded));
+}
+
+void UQuestListenerComponent::OnQuestsLoaded()
+{
+	if (!QuestManagerComponent) return;
+
 	for (auto QuestID : QuestToFollow)
 	{
-		URPGQuest* questToFollow = QuestManagerComponent->QueryQuest(QuestID);
+		URPGQuest* questToFollow = QuestManagerComponent->FindLoadedQuest(QuestID);
 		if (!questToFollow) continue;
 		
 		// [수정 1] Delegate 이름 변경 (QuestStateChangedDelegate -> OnQuestStateChanged)
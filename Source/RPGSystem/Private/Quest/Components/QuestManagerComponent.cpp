@@ -4,6 +4,8 @@
 #include "Quest/Components/QuestManagerComponent.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Event/GlobalEventHandler.h"
 #include "Event/RPGEventBase.h"
 #include "GameFramework/Pawn.h"
@@ -14,7 +16,47 @@
 #include "Quest/Data/QuestSpecialEventData.h"
 #include "Quest/Data/Objectives/QuestObjectiveBase.h"
 #include "Quest/Data/Requirements/QuestRequirementBase.h"
-#include "Quest/Data/Requirements/QuestRequirement_SpecialEvent.h"
+
+namespace QuestManager
+{
+	// 레지스트리 태그에서 퀘스트 정보를 읽음, QuestID 태그가 없으면 false
+	bool ReadQuestAssetInfo(const FAssetData& Asset, int32& OutQuestID, FQuestAssetInfo& OutInfo)
+	{
+		if (!Asset.GetTagValue(GET_MEMBER_NAME_CHECKED(URPGQuestData, QuestID), OutQuestID))
+		{
+			return false;
+		}
+
+		OutInfo.AssetPath = Asset.GetSoftObjectPath();
+		Asset.GetTagValue(GET_MEMBER_NAME_CHECKED(URPGQuestData, QuestGiverID), OutInfo.QuestGiverID);
+
+		TArray<FString> Entries;
+		FString TagValue;
+		if (Asset.GetTagValue(URPGQuestData::PrerequisiteQuestsTag, TagValue))
+		{
+			TagValue.ParseIntoArray(Entries, TEXT(","));
+			for (const FString& Entry : Entries)
+			{
+				OutInfo.PrerequisiteQuests.Add(FCString::Atoi(*Entry));
+			}
+		}
+
+		if (Asset.GetTagValue(URPGQuestData::SpecialEventTagsTag, TagValue))
+		{
+			TagValue.ParseIntoArray(Entries, TEXT(","));
+			for (const FString& Entry : Entries)
+			{
+				const FGameplayTag EventTag = FGameplayTag::RequestGameplayTag(FName(*Entry), false);
+				if (EventTag.IsValid())
+				{
+					OutInfo.SpecialEventTags.Add(EventTag);
+				}
+			}
+		}
+
+		return true;
+	}
+}
 
 // Sets default values for this component's properties
 UQuestManagerComponent::UQuestManagerComponent()
@@ -49,6 +91,15 @@ void UQuestManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	}
 	TrackedSpecialEventTags.Reset();
 
+	for (const TSharedPtr<FStreamableHandle>& Handle : PendingLoadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	PendingLoadHandles.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -61,6 +112,12 @@ void UQuestManagerComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
 
+	// 퀘스트 데이터는 로드하지 않고 인덱스만 구성, 인스턴스는 필요할 때 생성
+	BuildQuestAssetIndex();
+}
+
+void UQuestManagerComponent::BuildQuestAssetIndex()
+{
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
@@ -69,30 +126,161 @@ void UQuestManagerComponent::InitializeComponent()
 	const FTopLevelAssetPath AssetPath = FTopLevelAssetPath(TEXT("/Script/RPGSystem"), TEXT("RPGQuestData"));
 	AssetRegistry.GetAssetsByClass(AssetPath, QuestDataAssets, true);
 
+	QuestAssetIndex.Reset();
+	QuestsByGiver.Reset();
+
 	for (const FAssetData& Asset : QuestDataAssets)
 	{
-		URPGQuestData* DataAsset = Cast<URPGQuestData>(Asset.GetAsset());
-		if (!DataAsset)
+		int32 QuestID = 0;
+		FQuestAssetInfo Info;
+		if (!QuestManager::ReadQuestAssetInfo(Asset, QuestID, Info))
 		{
-			continue;
+			// 태그가 추가되기 전에 저장된 에셋, 다시 저장하면 로드 없이 인덱싱됨
+			URPGQuestData* DataAsset = Cast<URPGQuestData>(Asset.GetAsset());
+			if (!DataAsset || !QuestManager::ReadQuestAssetInfo(FAssetData(DataAsset), QuestID, Info))
+			{
+				continue;
+			}
+
+			UE_LOG(LogTemp, Warning, TEXT("QuestManager: %s has no registry tags and was loaded at startup, resave the asset"), *Asset.GetObjectPathString());
+			CreateQuestInstance(QuestID, DataAsset);
 		}
 
-		URPGQuest* NewQuestInstance = NewObject<URPGQuest>(this, URPGQuest::StaticClass());
-		NewQuestInstance->InitializeFromData(DataAsset);
+		if (Info.QuestGiverID != NAME_None)
+		{
+			QuestsByGiver.Add(Info.QuestGiverID, QuestID);
+		}
+		QuestAssetIndex.Add(QuestID, MoveTemp(Info));
+	}
+}
 
-		const int32 QuestID = DataAsset->QuestID;
-		QuestDataCenter.Add(QuestID, NewQuestInstance);
+URPGQuest* UQuestManagerComponent::CreateQuestInstance(int32 QuestID, URPGQuestData* Data)
+{
+	if (!Data)
+	{
+		return nullptr;
+	}
+
+	if (URPGQuest* ExistingQuest = QuestDataCenter.FindRef(QuestID))
+	{
+		return ExistingQuest;
 	}
+
+	URPGQuest* NewQuestInstance = NewObject<URPGQuest>(this, URPGQuest::StaticClass());
+	NewQuestInstance->InitializeFromData(Data);
+
+	QuestDataCenter.Add(QuestID, NewQuestInstance);
+	OnQuestLoaded.Broadcast(NewQuestInstance);
+	return NewQuestInstance;
 }
 
 URPGQuest* UQuestManagerComponent::QueryQuest(int QuestID)
 {
-	if (QuestDataCenter.Find(QuestID))
+	if (URPGQuest* Quest = QuestDataCenter.FindRef(QuestID))
 	{
-		return QuestDataCenter[QuestID];
+		return Quest;
 	}
 
-	return nullptr;
+	const FQuestAssetInfo* Info = QuestAssetIndex.Find(QuestID);
+	if (!Info)
+	{
+		return nullptr;
+	}
+
+	// 비동기 로드가 끝나기 전에 필요해진 경우, 동기 로드로 즉시 생성
+	URPGQuestData* DataAsset = Cast<URPGQuestData>(UAssetManager::GetStreamableManager().LoadSynchronous(Info->AssetPath));
+	return CreateQuestInstance(QuestID, DataAsset);
+}
+
+URPGQuest* UQuestManagerComponent::FindLoadedQuest(int32 QuestID) const
+{
+	return QuestDataCenter.FindRef(QuestID);
+}
+
+bool UQuestManagerComponent::IsQuestLoaded(int32 QuestID) const
+{
+	return QuestDataCenter.Contains(QuestID);
+}
+
+void UQuestManagerComponent::RequestQuestsAsync(const TArray<int32>& QuestIDs, FOnQuestsLoadedNative OnLoaded)
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	for (const int32 QuestID : QuestIDs)
+	{
+		if (QuestDataCenter.Contains(QuestID))
+		{
+			continue;
+		}
+
+		if (const FQuestAssetInfo* Info = QuestAssetIndex.Find(QuestID))
+		{
+			AssetPaths.AddUnique(Info->AssetPath);
+		}
+	}
+
+	if (AssetPaths.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound();
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPaths,
+		FStreamableDelegate::CreateUObject(this, &UQuestManagerComponent::HandleQuestsLoaded, QuestIDs, OnLoaded));
+
+	if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		PendingLoadHandles.Add(Handle);
+	}
+}
+
+void UQuestManagerComponent::HandleQuestsLoaded(TArray<int32> QuestIDs, FOnQuestsLoadedNative OnLoaded)
+{
+	for (const int32 QuestID : QuestIDs)
+	{
+		if (const FQuestAssetInfo* Info = QuestAssetIndex.Find(QuestID))
+		{
+			CreateQuestInstance(QuestID, Cast<URPGQuestData>(Info->AssetPath.ResolveObject()));
+		}
+	}
+
+	// 인스턴스가 데이터를 참조하므로 완료된 핸들은 해제
+	PendingLoadHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+	{
+		return !Handle.IsValid() || !Handle->IsLoadingInProgress();
+	});
+
+	OnLoaded.ExecuteIfBound();
+}
+
+void UQuestManagerComponent::PreloadQuests(const TArray<int32>& QuestIDs)
+{
+	RequestQuestsAsync(QuestIDs);
+}
+
+void UQuestManagerComponent::PreloadQuestsForGiver(FName QuestGiverID)
+{
+	TArray<int32> QuestIDs;
+	GetQuestIDsForGiver(QuestGiverID, QuestIDs);
+	RequestQuestsAsync(QuestIDs);
+}
+
+void UQuestManagerComponent::GetQuestIDsForGiver(FName QuestGiverID, TArray<int32>& OutQuestIDs) const
+{
+	OutQuestIDs.Reset();
+	if (QuestGiverID != NAME_None)
+	{
+		QuestsByGiver.MultiFind(QuestGiverID, OutQuestIDs);
+	}
+}
+
+void UQuestManagerComponent::GetQuestPrerequisites(int32 QuestID, TArray<int32>& OutQuestIDs) const
+{
+	OutQuestIDs.Reset();
+	if (const FQuestAssetInfo* Info = QuestAssetIndex.Find(QuestID))
+	{
+		OutQuestIDs = Info->PrerequisiteQuests;
+	}
 }
 
 bool UQuestManagerComponent::IsQuestCompleted(int32 QuestID) const
@@ -284,33 +472,11 @@ void UQuestManagerComponent::InitializeSpecialEventTracking()
 		return;
 	}
 
+	// 레지스트리 태그 기준이라 퀘스트가 로드되지 않아도 추적 가능
 	TrackedSpecialEventTags.Reset();
-	for (const TPair<int, URPGQuest*>& Pair : QuestDataCenter)
+	for (const TPair<int32, FQuestAssetInfo>& Pair : QuestAssetIndex)
 	{
-		const URPGQuest* Quest = Pair.Value;
-		if (!Quest || !Quest->QuestData)
-		{
-			continue;
-		}
-
-		for (const UQuestRequirementBase* Requirement : Quest->QuestData->Requirements)
-		{
-			const UQuestRequirement_SpecialEvent* SpecialRequirement = Cast<UQuestRequirement_SpecialEvent>(Requirement);
-			if (!SpecialRequirement)
-			{
-				continue;
-			}
-
-			if (SpecialRequirement->TargetEventTag.IsValid())
-			{
-				TrackedSpecialEventTags.Add(SpecialRequirement->TargetEventTag);
-			}
-
-			if (SpecialRequirement->TargetEventAsset && SpecialRequirement->TargetEventAsset->EventTag.IsValid())
-			{
-				TrackedSpecialEventTags.Add(SpecialRequirement->TargetEventAsset->EventTag);
-			}
-		}
+		TrackedSpecialEventTags.Append(Pair.Value.SpecialEventTags);
 	}
 
 	for (const FGameplayTag& TrackedTag : TrackedSpecialEventTags)
@@ -59,20 +59,14 @@ TArray<FGameplayTag> UQuestObjective_Interact::GetListenedEventTags() const
 	return Tags;
 }
 
-void UQuestObjective_Interact::OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata)
+FGameplayTag UQuestObjective_Interact::GetListenedTargetTag(const FGameplayTag& EventTag) const
 {
-	Super::OnGlobalEvent(Publisher, Payload, Metadata);
-
-	FGameplayTag InteractTag;
-	for (const FString& Entry : Metadata)
-	{
-		if (Entry.StartsWith(TEXT("InteractTag=")))
-		{
-			const FString TagString = Entry.RightChop(12);
-			InteractTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
-			break;
-		}
-	}
+	return TargetInteractableTag;
+}
 
-	OnInteracted(InteractTag);
+bool UQuestObjective_Interact::OnQuestEvent(const FQuestEventPayload& Payload)
+{
+	// 상호작용 태그는 대상 태그로 전달됨
+	OnInteracted(Payload.TargetTags.First());
+	return bIsCompleted;
 }
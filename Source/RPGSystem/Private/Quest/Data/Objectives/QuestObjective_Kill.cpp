@@ -2,49 +2,9 @@
 
 #include "Quest/Data/Objectives/QuestObjective_Kill.h"
 
-#include "GameplayTagAssetInterface.h"
+#include "GameFramework/Actor.h"
 #include "RPGSystemGameplayTags.h"
 
-namespace
-{
-	int32 ExtractAmountFromMetadata(const TArray<FString>& Metadata)
-	{
-		for (const FString& Entry : Metadata)
-		{
-			if (Entry.StartsWith(TEXT("Amount=")))
-			{
-				return FMath::Max(1, FCString::Atoi(*Entry.RightChop(7)));
-			}
-		}
-		return 1;
-	}
-
-	bool MatchesTargetTag(const AActor* Actor, const FGameplayTag& TargetTag)
-	{
-		if (!Actor)
-		{
-			return false;
-		}
-
-		if (!TargetTag.IsValid())
-		{
-			return true;
-		}
-
-		if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor))
-		{
-			FGameplayTagContainer OwnedTags;
-			TagInterface->GetOwnedGameplayTags(OwnedTags);
-			if (OwnedTags.HasTag(TargetTag))
-			{
-				return true;
-			}
-		}
-
-		return Actor->ActorHasTag(TargetTag.GetTagName());
-	}
-}
-
 void UQuestObjective_Kill::ActivateObjective(URPGQuest* OwnerQuest)
 {
 	Super::ActivateObjective(OwnerQuest);
@@ -72,23 +32,19 @@ TArray<FGameplayTag> UQuestObjective_Kill::GetListenedEventTags() const
 	return Tags;
 }
 
-void UQuestObjective_Kill::OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata)
+FGameplayTag UQuestObjective_Kill::GetListenedTargetTag(const FGameplayTag& EventTag) const
 {
-	Super::OnGlobalEvent(Publisher, Payload, Metadata);
-
-	if (bIsCompleted)
-	{
-		return;
-	}
+	return TargetEnemyTag;
+}
 
-	AActor* DeadActor = Cast<AActor>(Payload);
-	if (!DeadActor || !MatchesTargetTag(DeadActor, TargetEnemyTag))
+bool UQuestObjective_Kill::OnQuestEvent(const FQuestEventPayload& Payload)
+{
+	if (bIsCompleted || !Payload.GetTargetAs<AActor>())
 	{
-		return;
+		return bIsCompleted;
 	}
 
-	CurrentAmount += ExtractAmountFromMetadata(Metadata);
-	CurrentAmount = FMath::Min(CurrentAmount, TargetAmount);
+	CurrentAmount = FMath::Min(CurrentAmount + Payload.Amount, TargetAmount);
 	if (OnProgressChanged.IsBound())
 	{
 		OnProgressChanged.Broadcast(this);
@@ -98,4 +54,6 @@ void UQuestObjective_Kill::OnGlobalEvent(UObject* Publisher, UObject* Payload, c
 	{
 		FinishObjective();
 	}
+
+	return bIsCompleted;
 }
@@ -39,20 +39,14 @@ TArray<FGameplayTag> UQuestObjective_Location::GetListenedEventTags() const
 	return Tags;
 }
 
-void UQuestObjective_Location::OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata)
+FGameplayTag UQuestObjective_Location::GetListenedTargetTag(const FGameplayTag& EventTag) const
 {
-	Super::OnGlobalEvent(Publisher, Payload, Metadata);
-
-	FGameplayTag LocationTag;
-	for (const FString& Entry : Metadata)
-	{
-		if (Entry.StartsWith(TEXT("LocationTag=")))
-		{
-			const FString TagString = Entry.RightChop(12);
-			LocationTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
-			break;
-		}
-	}
+	return TargetLocationTag;
+}
 
-	OnLocationEntered(LocationTag);
+bool UQuestObjective_Location::OnQuestEvent(const FQuestEventPayload& Payload)
+{
+	// 위치 태그는 대상 태그로 전달됨
+	OnLocationEntered(Payload.TargetTags.First());
+	return bIsCompleted;
 }
@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Quest/Data/RPGQuestData.h"
+#include "Quest/Data/QuestSpecialEventData.h"
+#include "Quest/Data/Requirements/QuestRequirement_QuestState.h"
+#include "Quest/Data/Requirements/QuestRequirement_SpecialEvent.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+const FName URPGQuestData::PrerequisiteQuestsTag = TEXT("PrerequisiteQuests");
+const FName URPGQuestData::SpecialEventTagsTag = TEXT("SpecialEventTags");
+
+void URPGQuestData::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	TArray<FString> Prerequisites;
+	TArray<FString> SpecialEventTags;
+
+	for (const UQuestRequirementBase* Requirement : Requirements)
+	{
+		if (const UQuestRequirement_QuestState* StateRequirement = Cast<UQuestRequirement_QuestState>(Requirement))
+		{
+			Prerequisites.AddUnique(FString::FromInt(StateRequirement->TargetQuestID));
+		}
+		else if (const UQuestRequirement_SpecialEvent* SpecialRequirement = Cast<UQuestRequirement_SpecialEvent>(Requirement))
+		{
+			if (SpecialRequirement->TargetEventTag.IsValid())
+			{
+				SpecialEventTags.AddUnique(SpecialRequirement->TargetEventTag.ToString());
+			}
+
+			if (SpecialRequirement->TargetEventAsset && SpecialRequirement->TargetEventAsset->EventTag.IsValid())
+			{
+				SpecialEventTags.AddUnique(SpecialRequirement->TargetEventAsset->EventTag.ToString());
+			}
+		}
+	}
+
+	// 콤마로 구분된 목록 ("3,7")
+	Context.AddTag(FAssetRegistryTag(PrerequisiteQuestsTag, FString::Join(Prerequisites, TEXT(",")), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(SpecialEventTagsTag, FString::Join(SpecialEventTags, TEXT(",")), FAssetRegistryTag::TT_Hidden));
+}
@@ -4,7 +4,8 @@
 #include "Quest/QuestEventMediator.h"
 
 #include "Event/GlobalEventHandler.h"
-#include "Event/RPGEventBase.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagAssetInterface.h"
 #include "Quest/QuestEventListener.h"
 #include "Quest/RPGQuest.h"
 #include "Quest/Data/RPGQuestData.h"
@@ -20,6 +21,16 @@ void UQuestEventMediator::Initialize(UGlobalEventHandler* InGlobalEventHandler)
 	GlobalEventHandler = InGlobalEventHandler;
 }
 
+void UQuestEventMediator::BeginDestroy()
+{
+	if (GlobalEventHandler.IsValid())
+	{
+		GlobalEventHandler->UnsubscribeAllNative(this);
+	}
+
+	Super::BeginDestroy();
+}
+
 void UQuestEventMediator::RegisterListener(UObject* ListenerObject)
 {
 	if (!IsValid(ListenerObject) || !ListenerObject->Implements<UQuestEventListener>())
@@ -33,11 +44,17 @@ void UQuestEventMediator::RegisterListener(UObject* ListenerObject)
 	}
 
 	IQuestEventListener* Listener = Cast<IQuestEventListener>(ListenerObject);
-	if (!Listener)
+	if (!Listener || ListenerKeys.Contains(ListenerObject))
 	{
 		return;
 	}
 
+	FListenerEntry Entry;
+	Entry.Object = ListenerObject;
+	Entry.Listener = Listener;
+
+	TArray<FRouteKey> Keys;
+
 	const TArray<FGameplayTag> ListenedTags = Listener->GetListenedEventTags();
 	for (const FGameplayTag& Tag : ListenedTags)
 	{
@@ -46,45 +63,45 @@ void UQuestEventMediator::RegisterListener(UObject* ListenerObject)
 			continue;
 		}
 
-		TArray<TWeakObjectPtr<UObject>>& Listeners = ListenersByTag.FindOrAdd(Tag);
-		const bool bAlreadyRegistered = Listeners.ContainsByPredicate([ListenerObject](const TWeakObjectPtr<UObject>& Entry)
+		const FRouteKey Key(Tag, Listener->GetListenedTargetTag(Tag));
+		if (Keys.Contains(Key))
 		{
-			return Entry.Get() == ListenerObject;
-		});
+			continue;
+		}
 
-		if (!bAlreadyRegistered)
+		Keys.Add(Key);
+
+		// 디스패치 중에는 인덱스를 건드리지 않음
+		if (DispatchDepth > 0)
+		{
+			PendingEntries.Emplace(Key, Entry);
+		}
+		else
 		{
-			Listeners.Add(ListenerObject);
+			AddToRoute(Key, Entry);
 		}
 
 		BindTagIfNeeded(Tag);
 	}
+
+	if (Keys.Num() > 0)
+	{
+		ListenerKeys.Add(ListenerObject, MoveTemp(Keys));
+	}
 }
 
 void UQuestEventMediator::UnregisterListener(UObject* ListenerObject)
 {
-	if (!IsValid(ListenerObject))
+	if (!ListenerObject)
 	{
 		return;
 	}
 
-	for (auto It = ListenersByTag.CreateIterator(); It; ++It)
-	{
-		TArray<TWeakObjectPtr<UObject>>& Listeners = It.Value();
-		Listeners.RemoveAll([ListenerObject](const TWeakObjectPtr<UObject>& Entry)
-		{
-			return !Entry.IsValid() || Entry.Get() == ListenerObject;
-		});
+	RemoveFromRoutes(ListenerObject);
 
-		if (Listeners.Num() == 0)
-		{
-			if (GlobalEventHandler.IsValid())
-			{
-				GlobalEventHandler->UnbindAllGlobalEventsByGameplayTag(this, It.Key());
-			}
-			BoundTags.Remove(It.Key());
-			It.RemoveCurrent();
-		}
+	if (DispatchDepth == 0)
+	{
+		CompactRoutes();
 	}
 }
 
@@ -101,65 +118,135 @@ void UQuestEventMediator::UnregisterAllListenersForQuest(URPGQuest* Quest)
 	}
 }
 
-void UQuestEventMediator::HandleGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata)
+void UQuestEventMediator::HandleGlobalEvent(const FRPGNativeEvent& Event)
 {
-	if (ListenersByTag.Num() == 0)
+	FEventRoute* Route = Routes.Find(Event.EventTag);
+	if (!Route)
 	{
 		return;
 	}
 
-	FGameplayTag EventTag;
-	if (const URPGEventBase* EventBase = Cast<URPGEventBase>(Publisher))
+	FQuestEventPayload QuestPayload;
+	BuildQuestPayload(Event, QuestPayload);
+
+	++DispatchDepth;
+
+	const auto NotifyListeners = [this, &QuestPayload](const TArray<FListenerEntry>& Entries)
 	{
-		EventTag = EventBase->EventTag;
-	}
+		for (const FListenerEntry& Entry : Entries)
+		{
+			if (!Entry.Listener || !Entry.Object.IsValid())
+			{
+				continue;
+			}
 
-	if (!EventTag.IsValid())
+			// 완료된 목표는 더 이상 이벤트를 받지 않음
+			if (Entry.Listener->OnQuestEvent(QuestPayload))
+			{
+				RemoveFromRoutes(Entry.Object.Get());
+			}
+		}
+	};
+
+	NotifyListeners(Route->AnyTarget);
+
+	// 대상 태그와 그 부모 태그로 직접 조회. 계층 매칭: Enemy.Goblin.Chief 처치는 Enemy.Goblin 리스너에게 전달됨
+	if (QuestPayload.TargetTags.Num() > 0 && Route->ByTargetTag.Num() > 0)
 	{
-		for (const FString& Entry : Metadata)
+		TArray<FGameplayTag, TInlineAllocator<16>> VisitedTags;
+
+		for (const FGameplayTag& TargetTag : QuestPayload.TargetTags)
 		{
-			if (Entry.StartsWith(TEXT("EventTag=")))
+			for (FGameplayTag Tag = TargetTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
 			{
-				const FString TagString = Entry.RightChop(9);
-				EventTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
-				break;
+				// 이미 확인한 태그면 그 부모도 확인했으므로 중단 (공통 부모의 리스너가 두 번 받지 않도록)
+				if (VisitedTags.Contains(Tag))
+				{
+					break;
+				}
+				VisitedTags.Add(Tag);
+
+				if (const TArray<FListenerEntry>* Entries = Route->ByTargetTag.Find(Tag))
+				{
+					NotifyListeners(*Entries);
+				}
 			}
 		}
 	}
 
-	if (!EventTag.IsValid() && Metadata.Num() > 0)
+	--DispatchDepth;
+
+	if (DispatchDepth == 0)
 	{
-		EventTag = FGameplayTag::RequestGameplayTag(FName(*Metadata[0]), false);
+		for (const TPair<FRouteKey, FListenerEntry>& Pending : PendingEntries)
+		{
+			AddToRoute(Pending.Key, Pending.Value);
+		}
+		PendingEntries.Reset();
+
+		CompactRoutes();
 	}
+}
 
-	if (!EventTag.IsValid())
+void UQuestEventMediator::BuildQuestPayload(const FRPGNativeEvent& Event, FQuestEventPayload& OutPayload)
+{
+	OutPayload.Target = Event.Target;
+	OutPayload.EventTag = Event.EventTag;
+
+	if (const FRPGKillEventPayload* KillPayload = Event.GetPayload<FRPGKillEventPayload>())
+	{
+		OutPayload.Amount = FMath::Max(1, KillPayload->Amount);
+	}
+	else if (const FRPGInteractEventPayload* InteractPayload = Event.GetPayload<FRPGInteractEventPayload>())
 	{
+		OutPayload.TargetTags.AddTag(InteractPayload->InteractTag);
 		return;
 	}
-
-	TArray<TWeakObjectPtr<UObject>>* ListenersPtr = ListenersByTag.Find(EventTag);
-	if (!ListenersPtr)
+	else if (const FRPGLocationEventPayload* LocationPayload = Event.GetPayload<FRPGLocationEventPayload>())
 	{
+		OutPayload.TargetTags.AddTag(LocationPayload->LocationTag);
 		return;
 	}
+	else if (Event.Metadata)
+	{
+		// 블루프린트 API로 발행된 이벤트만 문자열을 파싱
+		OutPayload.Metadata = *Event.Metadata;
 
-	FQuestEventPayload QuestPayload;
-	QuestPayload.Target = Payload;
-	QuestPayload.EventTag = EventTag;
-	QuestPayload.Metadata = Metadata;
+		bool bHasExplicitTarget = false;
+		for (const FString& Entry : OutPayload.Metadata)
+		{
+			if (Entry.StartsWith(TEXT("Amount=")))
+			{
+				OutPayload.Amount = FMath::Max(1, FCString::Atoi(*Entry.RightChop(7)));
+			}
+			else if (Entry.StartsWith(TEXT("InteractTag=")) || Entry.StartsWith(TEXT("LocationTag=")))
+			{
+				OutPayload.TargetTags.AddTag(FGameplayTag::RequestGameplayTag(FName(*Entry.RightChop(12)), false));
+				bHasExplicitTarget = true;
+			}
+		}
 
-	const TArray<TWeakObjectPtr<UObject>> ListenersCopy = *ListenersPtr;
-	for (const TWeakObjectPtr<UObject>& WeakListener : ListenersCopy)
+		if (bHasExplicitTarget)
+		{
+			return;
+		}
+	}
+
+	// 그 외에는 대상 액터의 태그
+	if (const AActor* TargetActor = Cast<AActor>(Event.Target))
 	{
-		UObject* ListenerObject = WeakListener.Get();
-		if (!IsValid(ListenerObject) || !ListenerObject->Implements<UQuestEventListener>())
+		if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(TargetActor))
 		{
-			continue;
+			TagInterface->GetOwnedGameplayTags(OutPayload.TargetTags);
 		}
 
-		if (IQuestEventListener* Listener = Cast<IQuestEventListener>(ListenerObject))
+		for (const FName& ActorTag : TargetActor->Tags)
 		{
-			Listener->OnQuestEvent(QuestPayload);
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(ActorTag, false);
+			if (Tag.IsValid())
+			{
+				OutPayload.TargetTags.AddTag(Tag);
+			}
 		}
 	}
 }
@@ -176,8 +263,104 @@ void UQuestEventMediator::BindTagIfNeeded(const FGameplayTag& Tag)
 		return;
 	}
 
-	FRPGOnEventCalledSingle Delegate;
-	Delegate.BindUFunction(this, FName("HandleGlobalEvent"));
-	GlobalEventHandler->BindGlobalEventByGameplayTag(Tag, Delegate);
-	BoundTags.Add(Tag);
-}
\ No newline at end of file
+	const FDelegateHandle Handle = GlobalEventHandler->SubscribeNative(Tag, FRPGNativeEventDelegate::CreateUObject(this, &UQuestEventMediator::HandleGlobalEvent));
+	BoundTags.Add(Tag, Handle);
+}
+
+void UQuestEventMediator::UnbindTag(const FGameplayTag& Tag)
+{
+	FDelegateHandle Handle;
+	if (BoundTags.RemoveAndCopyValue(Tag, Handle) && GlobalEventHandler.IsValid())
+	{
+		GlobalEventHandler->UnsubscribeNative(Tag, Handle);
+	}
+}
+
+void UQuestEventMediator::AddToRoute(const FRouteKey& Key, const FListenerEntry& Entry)
+{
+	FEventRoute& Route = Routes.FindOrAdd(Key.Key);
+
+	if (Key.Value.IsValid())
+	{
+		Route.ByTargetTag.FindOrAdd(Key.Value).Add(Entry);
+	}
+	else
+	{
+		Route.AnyTarget.Add(Entry);
+	}
+}
+
+void UQuestEventMediator::RemoveFromRoutes(const UObject* ListenerObject)
+{
+	TArray<FRouteKey> Keys;
+	if (!ListenerKeys.RemoveAndCopyValue(ListenerObject, Keys))
+	{
+		return;
+	}
+
+	PendingEntries.RemoveAll([ListenerObject](const TPair<FRouteKey, FListenerEntry>& Pending)
+	{
+		return Pending.Value.Object == ListenerObject;
+	});
+
+	// 배열은 디스패치 중일 수 있으므로 엔트리만 비우고 나중에 정리
+	for (const FRouteKey& Key : Keys)
+	{
+		FEventRoute* Route = Routes.Find(Key.Key);
+		if (!Route)
+		{
+			continue;
+		}
+
+		TArray<FListenerEntry>* Entries = Key.Value.IsValid() ? Route->ByTargetTag.Find(Key.Value) : &Route->AnyTarget;
+		if (!Entries)
+		{
+			continue;
+		}
+
+		for (FListenerEntry& Entry : *Entries)
+		{
+			if (Entry.Object == ListenerObject)
+			{
+				Entry.Listener = nullptr;
+				bHasRemovedEntries = true;
+			}
+		}
+	}
+}
+
+void UQuestEventMediator::CompactRoutes()
+{
+	if (!bHasRemovedEntries)
+	{
+		return;
+	}
+
+	bHasRemovedEntries = false;
+
+	const auto IsRemoved = [](const FListenerEntry& Entry)
+	{
+		return !Entry.Listener || !Entry.Object.IsValid();
+	};
+
+	for (auto It = Routes.CreateIterator(); It; ++It)
+	{
+		FEventRoute& Route = It.Value();
+		Route.AnyTarget.RemoveAll(IsRemoved);
+
+		for (auto TargetIt = Route.ByTargetTag.CreateIterator(); TargetIt; ++TargetIt)
+		{
+			TargetIt.Value().RemoveAll(IsRemoved);
+			if (TargetIt.Value().Num() == 0)
+			{
+				TargetIt.RemoveCurrent();
+			}
+		}
+
+		if (Route.IsEmpty())
+		{
+			UnbindTag(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -104,12 +104,11 @@ void AQuestLocationTrigger::HandleOverlap(
 		return;
 	}
 
-	TArray<FString> Metadata;
-	Metadata.Add(FString::Printf(TEXT("EventTag=%s"), *LocationEventTag.ToString()));
-	Metadata.Add(FString::Printf(TEXT("LocationTag=%s"), *LocationTag.ToString()));
-	Metadata.Add(FString::Printf(TEXT("Trigger=%s"), *GetPathName()));
+	FRPGLocationEventPayload LocationPayload;
+	LocationPayload.LocationTag = LocationTag;
+	LocationPayload.Trigger = this;
 
-	EventHandler->CallGlobalEventByGameplayTag(this, LocationEventTag, OtherActor, Metadata);
+	EventHandler->PublishEvent(this, LocationEventTag, OtherActor, LocationPayload);
 	TriggeredActors.Add(OtherActor);
 
 	if (bDisableAfterFirstValidTrigger && TriggerVolume)
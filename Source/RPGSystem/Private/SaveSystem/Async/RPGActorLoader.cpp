@@ -9,6 +9,9 @@
 Init
 **/
 
+TMap<FName, double> FRPGSaveLevelLoader::ClassLoadCost;
+double FRPGSaveLevelLoader::AverageLoadCost = 0.0;
+
 //Always create via FRPGSaveLevelLoader::Create to ensure shared ownership.
 FRPGSaveLevelLoader::FRPGSaveLevelLoader(URPGSaveSubsystem* URPGSaveSubSystem, const FLoaderInitData& InitData)
 {
@@ -19,6 +22,7 @@ FRPGSaveLevelLoader::FRPGSaveLevelLoader(URPGSaveSubsystem* URPGSaveSubSystem, c
 	bIsWorldPartitionLoader = InitData.bIsWorldPartition;
 
 	BatchSize = FMath::Max(1, int32(FSettingHelpers::GetLoadBatchSize()));
+	FrameBudget = FSettingHelpers::GetLoadFrameBudget();
 	CurrentIndex = 0;
 
 	TotalProcessedCount = 0;
@@ -32,9 +36,32 @@ FRPGSaveLevelLoader::~FRPGSaveLevelLoader()
 		UE_LOG(LogRPGSave, Warning, TEXT("Loader was destroyed before being finished!"));
 	}
 
+	//Take the records that were never handled out of the shared progress
+	const int32 NumRemaining = NumWork - NumHandled;
+	if (NumRemaining > 0 && RPGSaveSubsystem)
+	{
+		const TWeakObjectPtr<URPGSaveSubsystem> WeakSubsystem = RPGSaveSubsystem.Get();
+		const uint32 Generation = LoadGeneration;
+
+		if (IsInGameThread())
+		{
+			RPGSaveSubsystem->RemoveLevelLoadWork(NumRemaining, Generation);
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, NumRemaining, Generation]()
+			{
+				if (URPGSaveSubsystem* Subsystem = WeakSubsystem.Get())
+				{
+					Subsystem->RemoveLevelLoadWork(NumRemaining, Generation);
+				}
+			});
+		}
+	}
+
 	SavedActors.Empty();
 	ActorMap.Empty();
-	Batches.Empty();
+	LoadQueue.Empty();
 }
 
 TSharedRef<FRPGSaveLevelLoader> FRPGSaveLevelLoader::Create(URPGSaveSubsystem* URPGSaveSubSystem, const FLoaderInitData& InitData)
@@ -55,6 +82,9 @@ void FRPGSaveLevelLoader::Start()
 	//Distance based sorting
 	FActorHelpers::SortLevelActors(SavedActors, RPGSaveSubsystem->GetPlayerController());
 
+	NumWork = SavedActors.Num();
+	LoadGeneration = RPGSaveSubsystem->AddLevelLoadWork(NumWork);
+
 	SetLoaderTimer([bMulti, bDeferred](TSharedPtr<FRPGSaveLevelLoader> Loader)
 	{
 		if (Loader.IsValid())
@@ -117,8 +147,8 @@ void FRPGSaveLevelLoader::GatherValidBatches()
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("RPGSaveSubsystemActorLoader::GatherValidBatches"));
 	SCOPE_CYCLE_COUNTER(STAT_RPGSaveLoader_Gather);
 
-	TArray<TArray<FActorProcessData>> LocalBatches;
-	TArray<FActorProcessData> CurrentBatch;
+	TArray<FActorProcessData> LocalQueue;
+	LocalQueue.Reserve(SavedActors.Num());
 
 	int32 IterationCount = 0;
 
@@ -138,24 +168,14 @@ void FRPGSaveLevelLoader::GatherValidBatches()
 		TWeakObjectPtr<AActor> ActorPtr;
 		if (ShouldEvaluateData(Data, ActorPtr))
 		{
-			CurrentBatch.Add({Data, ActorPtr});
-
-			if (CurrentBatch.Num() >= BatchSize)
-			{
-				LocalBatches.Add(MoveTemp(CurrentBatch));
-				CurrentBatch.Empty();
-			}
+			LocalQueue.Add({Data, ActorPtr});
 		}
 	}
 
-	if (CurrentBatch.Num() > 0)
-	{
-		LocalBatches.Add(MoveTemp(CurrentBatch));
-	}
-
 	FScopeLock Lock(&LoadActorScope);
 
-	Batches = MoveTemp(LocalBatches);
+	LoadQueue = MoveTemp(LocalQueue);
+	QueueHead = 0;
 }
 
 void FRPGSaveLevelLoader::ScheduleMainThreadBatchStart()
@@ -170,6 +190,8 @@ void FRPGSaveLevelLoader::ScheduleMainThreadBatchStart()
 	{
 		if (TSharedPtr<FRPGSaveLevelLoader> Loader = WeakPtr.Pin())
 		{
+			//Records that need no loading are done right away
+			Loader->ReportProgress(Loader->SavedActors.Num() - Loader->LoadQueue.Num());
 			Loader->StartBatchTick();
 		}
 	});
@@ -179,7 +201,7 @@ void FRPGSaveLevelLoader::StartBatchTick()
 {
 	FScopeLock Lock(&LoadActorScope);
 
-	if (!CheckCancel() && RPGSaveSubsystem && Batches.Num() > 0)
+	if (!CheckCancel() && RPGSaveSubsystem && QueueHead < LoadQueue.Num())
 	{
 		SetLoaderTimer([](TSharedPtr<FRPGSaveLevelLoader> Loader)
 		{
@@ -204,24 +226,33 @@ void FRPGSaveLevelLoader::ProcessNextBatch()
 
 	FScopeLock Lock(&LoadActorScope);
 
-	if (bCompleted || Batches.Num() <= 0)
+	if (bCompleted || QueueHead >= LoadQueue.Num())
 	{
 		FinishLoading();
 		return;
 	}
 
-	ProcessActorBatch(Batches[0]);
-	Batches.RemoveAt(0);
+	BeginFrameBudget();
 
-	StartBatchTick();
-}
+	const int32 StartHead = QueueHead;
 
-void FRPGSaveLevelLoader::ProcessActorBatch(const TArray<FActorProcessData>& Batch)
-{
-	for (const FActorProcessData& Item : Batch)
+	while (QueueHead < LoadQueue.Num())
 	{
-		ProcessActor(Item);
+		const FActorProcessData& Item = LoadQueue[QueueHead];
+		const FName CostKey = GetCostKey(Item);
+
+		if (!HasFrameBudget(CostKey))
+		{
+			break;
+		}
+
+		ProcessActorTimed(Item, CostKey);
+		++QueueHead;
 	}
+
+	ReportProgress(QueueHead - StartHead);
+
+	StartBatchTick();
 }
 
 /**
@@ -275,9 +306,12 @@ bool FRPGSaveLevelLoader::ShouldContinueTicking()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("RPGSaveSubsystemActorLoader::ShouldContinueTicking"));
 
+	BeginFrameBudget();
+
+	const int32 StartIndex = CurrentIndex;
 	int32 IterationCount = 0;
 
-	while (IterationCount < BatchSize && CurrentIndex < SavedActors.Num())
+	while (CurrentIndex < SavedActors.Num())
 	{
 		//Early exit
 		if (CheckCancel()) 
@@ -285,20 +319,123 @@ bool FRPGSaveLevelLoader::ShouldContinueTicking()
 			return false; 
 		}
 
-		if(CheckActorLimits(IterationCount))
+		TWeakObjectPtr<AActor> ActorPtr;
+		if (ShouldEvaluateData(SavedActors[CurrentIndex], ActorPtr))
 		{
-			return false;
-		}
+			const FActorProcessData Item(SavedActors[CurrentIndex], ActorPtr);
+			const FName CostKey = GetCostKey(Item);
 
-		const FActorSaveData Data = SavedActors[CurrentIndex];
-		EvaluateAndProcess(Data);
+			//Evaluated again next frame
+			if (!HasFrameBudget(CostKey))
+			{
+				break;
+			}
+
+			if (CheckActorLimits(IterationCount))
+			{
+				return false;
+			}
+
+			ProcessActorTimed(Item, CostKey);
+		}
 
 		++CurrentIndex;
 	}
 
+	ReportProgress(CurrentIndex - StartIndex);
+
 	return true;
 }
 
+/**
+Frame Budget
+**/
+
+void FRPGSaveLevelLoader::BeginFrameBudget()
+{
+	FrameStartTime = FPlatformTime::Seconds();
+	FrameProcessedCount = 0;
+}
+
+bool FRPGSaveLevelLoader::HasFrameBudget(const FName& CostKey) const
+{
+	//Always make progress, even if a single Actor is above the budget
+	if (FrameProcessedCount == 0)
+	{
+		return true;
+	}
+
+	if (FrameBudget <= 0.0)
+	{
+		return FrameProcessedCount < BatchSize;
+	}
+
+	//Stop before an Actor that is expected to overrun the frame, not after
+	const double Elapsed = FPlatformTime::Seconds() - FrameStartTime;
+	return Elapsed + GetEstimatedCost(CostKey) <= FrameBudget;
+}
+
+void FRPGSaveLevelLoader::ProcessActorTimed(const FActorProcessData& ProcessData, const FName& CostKey)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	ProcessActor(ProcessData);
+
+	UpdateEstimatedCost(CostKey, FPlatformTime::Seconds() - StartTime);
+	++FrameProcessedCount;
+}
+
+FName FRPGSaveLevelLoader::GetCostKey(const FActorProcessData& ProcessData)
+{
+	if (const AActor* Actor = ProcessData.ActorPtr.Get())
+	{
+		return Actor->GetClass()->GetFName();
+	}
+
+	//Runtime Actors are spawned from their saved class path
+	return FName(FSaveHelpers::StringFromBytes(ProcessData.Data.Class));
+}
+
+double FRPGSaveLevelLoader::GetEstimatedCost(const FName& CostKey)
+{
+	if (const double* Cost = ClassLoadCost.Find(CostKey))
+	{
+		return *Cost;
+	}
+
+	//Unknown classes are assumed to be average
+	return AverageLoadCost;
+}
+
+void FRPGSaveLevelLoader::UpdateEstimatedCost(const FName& CostKey, const double Seconds)
+{
+	//Smoothed, so a single hitch does not push the class into later frames for the rest of the load
+	constexpr double Smoothing = 0.25;
+
+	double& Cost = ClassLoadCost.FindOrAdd(CostKey, Seconds);
+	Cost += (Seconds - Cost) * Smoothing;
+
+	AverageLoadCost += (Seconds - AverageLoadCost) * Smoothing;
+}
+
+/**
+Progress
+**/
+
+float FRPGSaveLevelLoader::GetProgress() const
+{
+	return SavedActors.Num() > 0 ? float(NumHandled) / SavedActors.Num() : 1.f;
+}
+
+void FRPGSaveLevelLoader::ReportProgress(const int32 NumRecords)
+{
+	if (NumRecords > 0 && RPGSaveSubsystem)
+	{
+		NumHandled += NumRecords;
+		RPGSaveSubsystem->AddLevelLoadProgress(NumRecords, LoadGeneration);
+	}
+}
+
 /**
 Modular helpers
 **/
@@ -318,7 +455,7 @@ void FRPGSaveLevelLoader::ProcessActor(const FActorProcessData& ProcessData)
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("RPGSaveSubsystemActorLoader::ProcessActor")); 
 
 	AActor* Actor = ProcessData.ActorPtr.Get();
-	const FActorSaveData ActorData = ProcessData.Data;
+	const FActorSaveData& ActorData = ProcessData.Data;
 	const EActorType ActorType = EActorType(ActorData.Type);
 
 	//Check for runtime Actors, make sure we never attempt to spawn any other type
@@ -464,6 +601,7 @@ void FRPGSaveLevelLoader::FinishLoading()
 		{
 			if (TSharedPtr<FRPGSaveLevelLoader> Pinned = WeakPtr.Pin())
 			{
+				Pinned->ReportProgress(Pinned->SavedActors.Num() - Pinned->NumHandled);
 				Pinned->OnComplete.ExecuteIfBound();
 			}
 		});
@@ -472,6 +610,8 @@ void FRPGSaveLevelLoader::FinishLoading()
 	{
 		if (TSharedPtr<FRPGSaveLevelLoader> Pinned = WeakPtr.Pin())
 		{
+			//Skipped or canceled records still count as handled, so the progress always completes
+			Pinned->ReportProgress(Pinned->SavedActors.Num() - Pinned->NumHandled);
 			Pinned->OnComplete.ExecuteIfBound();
 		}
 	}
@@ -185,6 +185,13 @@ void URPGAsyncLoadGame::PrepareLevel()
 
 	if (Data & ENUM_TO_FLAG(ELoadTypeFlags::LF_Level))
 	{
+		//A staged save may still be writing the files we are about to read
+		if (RPGSaveSubsystem->IsLevelSavePending())
+		{
+			RPGSaveSubsystem->GetTimerManager().SetTimerForNextTick(this, &URPGAsyncLoadGame::PrepareLevel);
+			return;
+		}
+
 		if (RPGSaveSubsystem->TryLoadLevelFile())
 		{
 			SetLoadNotFailed();
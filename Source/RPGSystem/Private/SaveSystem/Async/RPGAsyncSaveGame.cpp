@@ -146,7 +146,19 @@ void URPGAsyncSaveGame::SaveLevel()
 
 	if (RPGSaveSubsystem)
 	{
-		if (FSettingHelpers::IsMultiThreadSaving())
+		//The files of a previous staged save are still being written
+		if (!bMemoryOnly && RPGSaveSubsystem->IsLevelSavePending())
+		{
+			RPGSaveSubsystem->GetTimerManager().SetTimerForNextTick(this, &URPGAsyncSaveGame::SaveLevel);
+			return;
+		}
+
+		if (FSettingHelpers::IsStagedLevelSaving())
+		{
+			//Only the snapshot runs on the Game Thread, the rest completes through the callback
+			InternalSaveLevelStaged();
+		}
+		else if (FSettingHelpers::IsMultiThreadSaving())
 		{
 			AsyncTask(ENamedThreads::AnyNormalThreadNormalTask, [this]()
 			{
@@ -181,6 +193,23 @@ void URPGAsyncSaveGame::InternalSaveLevel()
 	bFinishedStep = true;
 }
 
+void URPGAsyncSaveGame::InternalSaveLevelStaged()
+{
+	if (!(Data & ENUM_TO_FLAG(ESaveTypeFlags::SF_Level)))
+	{
+		bFinishedStep = true;
+		return;
+	}
+
+	const bool bPrevHasFailed = bHasFailed;
+
+	RPGSaveSubsystem->SaveLevelActorsStaged(bMemoryOnly, FRPGOnLevelSaveFinished::CreateWeakLambda(this, [this, bPrevHasFailed](const bool bSuccess)
+	{
+		bHasFailed = bSuccess ? false : bPrevHasFailed;
+		bFinishedStep = true;
+	}));
+}
+
 /**
 Finish
 **/
@@ -96,8 +96,9 @@ bool URPGAsyncStream::SetupLevelActors()
 		return false;
 	}
 
-	//Prune saved Actor data to prevent looking up huge arrays
-	TArray<FActorSaveData> PrunedActors = RPGSaveSubsystem->GetMultiLevelStreamData().ActorArray;
+	//Only the records of this level are fetched through the level index, independent of the total save size
+	TArray<FActorSaveData> PrunedActors;
+	RPGSaveSubsystem->GetStreamingLevelActors(StreamingLevel, PrunedActors);
 	FActorHelpers::PruneSavedActors(StreamActorsMap, PrunedActors);
 	PrunedData.CopyActors(PrunedActors);
 
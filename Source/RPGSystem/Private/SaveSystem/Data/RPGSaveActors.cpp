@@ -69,6 +69,23 @@ FString FActorHelpers::GetActorLevelName(const AActor* Actor)
 	return ActorLevelName;
 }
 
+FName FActorHelpers::GetRecordLevelName(const ULevel* Level)
+{
+	//Persistent level records are relevant for every streaming level
+	if (!Level || Level->IsPersistentLevel() || !Level->GetOuter())
+	{
+		return NAME_None;
+	}
+
+	const FString LevelName = FLevelHelpers::StripPIEPrefix(Level->GetWorld(), Level->GetOuter()->GetName());
+	return FName(LevelName);
+}
+
+FName FActorHelpers::GetRecordLevelName(const AActor* Actor)
+{
+	return Actor ? GetRecordLevelName(Actor->GetLevel()) : NAME_None;
+}
+
 FString FActorHelpers::GetFullActorName(const AActor* Actor)
 {
 	const FString ActorName = Actor->GetName();
@@ -153,6 +170,17 @@ bool FActorHelpers::CanProcessActorTransform(const AActor* Actor)
 	return bCanBeMoved && !IsSkipTransform(Actor) && Actor->GetAttachParentActor() == nullptr;
 }
 
+FTransform FActorHelpers::GetRecordTransform(const AActor* Actor, const EActorType Type)
+{
+	//No transform for persistent Actors or if skipped
+	if (!IsPersistent(Type) && CanProcessActorTransform(Actor))
+	{
+		return Actor->GetActorTransform();
+	}
+
+	return FTransform::Identity;
+}
+
 bool FActorHelpers::IsPlacedActor(const AActor* Actor)
 {
 	return Actor && (Actor->IsNetStartupActor() || Actor->HasAnyFlags(RF_WasLoaded));
@@ -223,11 +251,13 @@ void FActorHelpers::SortLevelActors(TArray<FActorSaveData>& ToSort, const APlaye
 		return;
 	}
 
-	if (PC)
+	if (PC && PC->PlayerCameraManager)
 	{
-		ToSort.Sort([PC](const FActorSaveData& A, const FActorSaveData& B)
+		//Nearest first. The camera location is fetched once instead of per comparison.
+		const FVector CameraLoc = PC->PlayerCameraManager->GetCameraLocation();
+		ToSort.Sort([&CameraLoc](const FActorSaveData& A, const FActorSaveData& B)
 		{
-			return FActorHelpers::CompareDistance(A.Transform.GetLocation(), B.Transform.GetLocation(), PC);
+			return FVector::DistSquared(A.Transform.GetLocation(), CameraLoc) < FVector::DistSquared(B.Transform.GetLocation(), CameraLoc);
 		});
 	}
 }
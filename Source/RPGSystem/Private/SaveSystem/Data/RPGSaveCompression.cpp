@@ -0,0 +1,222 @@
+#include "SaveSystem/Data/RPGSaveCompression.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+/**
+Compression
+**/
+
+bool FSaveCompression::CompressChunked(const TArray<uint8>& InData, TArray<uint8>& OutCompressed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FSaveCompression::CompressChunked"));
+
+	const int32 BlockSize = RPGSave::ChunkedBlockSize;
+	const int32 NumBlocks = FMath::DivideAndRoundUp(InData.Num(), BlockSize);
+
+	TArray<TArray<uint8>> CompressedBlocks;
+	CompressedBlocks.SetNum(NumBlocks);
+
+	std::atomic<bool> bFailed(false);
+
+	ParallelFor(NumBlocks, [&InData, &CompressedBlocks, &bFailed, BlockSize](const int32 Index)
+	{
+		const int64 Start = int64(Index) * BlockSize;
+		const int32 Size = int32(FMath::Min<int64>(BlockSize, InData.Num() - Start));
+		const uint8* Src = InData.GetData() + Start;
+
+		TArray<uint8>& Block = CompressedBlocks[Index];
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Size);
+		Block.SetNumUninitialized(CompressedSize);
+
+		if (!FCompression::CompressMemory(NAME_Oodle, Block.GetData(), CompressedSize, Src, Size))
+		{
+			bFailed = true;
+			return;
+		}
+
+		//Not worth it, store the raw bytes
+		if (CompressedSize >= Size)
+		{
+			Block.SetNumUninitialized(Size);
+			FMemory::Memcpy(Block.GetData(), Src, Size);
+		}
+		else
+		{
+			Block.SetNum(CompressedSize, EAllowShrinking::No);
+		}
+	});
+
+	if (bFailed)
+	{
+		UE_LOG(LogRPGSave, Error, TEXT("Chunked compression failed"));
+		return false;
+	}
+
+	FChunkedArchiveHeader Header;
+	Header.BlockSize = BlockSize;
+	Header.UncompressedSize = InData.Num();
+	Header.Blocks.Reserve(NumBlocks);
+
+	int64 Offset = 0;
+	for (int32 Index = 0; Index < NumBlocks; ++Index)
+	{
+		FChunkedArchiveBlock& Block = Header.Blocks.AddDefaulted_GetRef();
+		Block.Offset = Offset;
+		Block.CompressedSize = CompressedBlocks[Index].Num();
+		Block.UncompressedSize = int32(FMath::Min<int64>(BlockSize, InData.Num() - int64(Index) * BlockSize));
+
+		Offset += Block.CompressedSize;
+	}
+
+	OutCompressed.Reset();
+
+	FMemoryWriter Writer(OutCompressed);
+	Writer << Header;
+
+	OutCompressed.Reserve(OutCompressed.Num() + Offset);
+	for (const TArray<uint8>& Block : CompressedBlocks)
+	{
+		OutCompressed.Append(Block);
+	}
+
+	return !Writer.IsError();
+}
+
+/**
+Decompression
+**/
+
+bool FSaveCompression::ReadChunkedHeader(const TArray<uint8>& InCompressed, FChunkedArchiveHeader& OutHeader, int64& OutDataStart)
+{
+	FMemoryReader Reader(InCompressed);
+
+	//Read field by field, so a corrupt block count can not allocate more than the file could hold
+	int32 NumBlocks = 0;
+	Reader << OutHeader.Tag;
+	Reader << OutHeader.Version;
+	Reader << OutHeader.BlockSize;
+	Reader << OutHeader.UncompressedSize;
+	Reader << NumBlocks;
+
+	if (Reader.IsError() || OutHeader.Tag != RPGSave::CHUNKED_ARCHIVE_TAG)
+	{
+		return false;
+	}
+
+	if (OutHeader.Version > RPGSave::CHUNKED_ARCHIVE_VERSION)
+	{
+		UE_LOG(LogRPGSave, Error, TEXT("Chunked archive version %u is newer than supported version %u"), OutHeader.Version, RPGSave::CHUNKED_ARCHIVE_VERSION);
+		return false;
+	}
+
+	//Decompressed data goes into a single TArray, which is indexed with int32
+	if (OutHeader.BlockSize <= 0 || OutHeader.UncompressedSize < 0 || OutHeader.UncompressedSize > MAX_int32)
+	{
+		return false;
+	}
+
+	const int64 BlockEntrySize = sizeof(int64) + sizeof(int32) + sizeof(int32);
+	if (NumBlocks < 0 || int64(NumBlocks) * BlockEntrySize > InCompressed.Num() - Reader.Tell())
+	{
+		return false;
+	}
+
+	OutHeader.Blocks.SetNum(NumBlocks);
+	for (FChunkedArchiveBlock& Block : OutHeader.Blocks)
+	{
+		Reader << Block;
+	}
+
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	OutDataStart = Reader.Tell();
+
+	//Validate the block index against the actual file size before touching any block
+	const int64 MaxDataSize = InCompressed.Num() - OutDataStart;
+	int64 ExpectedSize = 0;
+	for (const FChunkedArchiveBlock& Block : OutHeader.Blocks)
+	{
+		if (Block.Offset != ExpectedSize || Block.CompressedSize < 0 || Block.UncompressedSize < 0 || Block.UncompressedSize > OutHeader.BlockSize)
+		{
+			return false;
+		}
+
+		ExpectedSize += Block.CompressedSize;
+
+		if (ExpectedSize > MaxDataSize)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FSaveCompression::DecompressChunked(const TArray<uint8>& InCompressed, TArray<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FSaveCompression::DecompressChunked"));
+	SCOPE_CYCLE_COUNTER(STAT_RPGSave_ArchiveDecompress);
+
+	FChunkedArchiveHeader Header;
+	int64 DataStart = 0;
+
+	if (!ReadChunkedHeader(InCompressed, Header, DataStart))
+	{
+		UE_LOG(LogRPGSave, Error, TEXT("Chunked archive header is corrupt"));
+		return false;
+	}
+
+	//Destination offsets, so every block writes straight into its final position
+	TArray<int64> DestOffsets;
+	DestOffsets.SetNumUninitialized(Header.Blocks.Num());
+
+	int64 DestOffset = 0;
+	for (int32 Index = 0; Index < Header.Blocks.Num(); ++Index)
+	{
+		DestOffsets[Index] = DestOffset;
+		DestOffset += Header.Blocks[Index].UncompressedSize;
+	}
+
+	if (DestOffset != Header.UncompressedSize)
+	{
+		UE_LOG(LogRPGSave, Error, TEXT("Chunked archive block sizes do not match the header"));
+		OutData.Empty();
+		return false;
+	}
+
+	//Bounded to int32 by ReadChunkedHeader
+	OutData.SetNumUninitialized(int32(Header.UncompressedSize));
+
+	std::atomic<bool> bFailed(false);
+
+	ParallelFor(Header.Blocks.Num(), [&InCompressed, &OutData, &Header, &DestOffsets, &bFailed, DataStart](const int32 Index)
+	{
+		const FChunkedArchiveBlock& Block = Header.Blocks[Index];
+		const uint8* Src = InCompressed.GetData() + DataStart + Block.Offset;
+		uint8* Dest = OutData.GetData() + DestOffsets[Index];
+
+		if (Block.IsStoredRaw())
+		{
+			FMemory::Memcpy(Dest, Src, Block.UncompressedSize);
+		}
+		else if (!FCompression::UncompressMemory(NAME_Oodle, Dest, Block.UncompressedSize, Src, Block.CompressedSize))
+		{
+			bFailed = true;
+		}
+	});
+
+	if (bFailed)
+	{
+		UE_LOG(LogRPGSave, Error, TEXT("Chunked archive failed to decompress"));
+		OutData.Empty();
+		return false;
+	}
+
+	return true;
+}
@@ -6,14 +6,201 @@
 
 #include "SaveSystem/Data/RPGSaveData.h"
 #include "SaveSystem/Data/RPGSaveActors.h"
-// #include "SaveSystem/Data/RPGSaveVersion.h"
+#include "SaveSystem/Data/RPGSaveVersion.h"
 #include "../ProjectSettings/RPGSaveProjectSetting.h"
 #include "Engine/World.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
 
 DEFINE_LOG_CATEGORY(LogRPGSave);
 
+/**
+FArchiveHelpers
+**/
+
+void FArchiveHelpers::SerializeActorArray(FArchive& Ar, TArray<FActorSaveData>& Actors)
+{
+	const bool bParallel = Ar.IsSaving() 
+		&& Actors.Num() >= RPGSave::ParallelSerializeMinActors 
+		&& FPlatformProcess::SupportsMultithreading();
+
+	if (!bParallel)
+	{
+		Ar << Actors;
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FArchiveHelpers::SerializeActorArray"));
+
+	//Each record is written to its own buffer with the versions of the outer archive.
+	//Records only hold bytes and plain values at this point, no UObject is touched here.
+	TArray<TArray<uint8>> Records;
+	Records.SetNum(Actors.Num());
+
+	//Fetched once, the container is lazily built and must not be touched from the workers
+	const FCustomVersionContainer& CustomVersions = Ar.GetCustomVersions();
+	std::atomic<bool> bRecordError(false);
+
+	ParallelFor(Actors.Num(), [&Ar, &Actors, &Records, &CustomVersions, &bRecordError](const int32 Index)
+	{
+		FMemoryWriter RecordWriter(Records[Index]);
+		RecordWriter.SetUEVer(Ar.UEVer());
+		RecordWriter.SetLicenseeUEVer(Ar.LicenseeUEVer());
+		RecordWriter.SetEngineVer(Ar.EngineVer());
+		RecordWriter.SetCustomVersions(CustomVersions);
+		RecordWriter.SetByteSwapping(Ar.IsByteSwapping());
+
+		RecordWriter << Actors[Index];
+
+		if (RecordWriter.IsError())
+		{
+			bRecordError = true;
+		}
+	});
+
+	//Reported through the outer archive, so HasSaveArchiveError catches it
+	if (bRecordError)
+	{
+		Ar.SetError();
+	}
+
+	//Same layout as TArray serialization: element count followed by the elements
+	int32 Num = Actors.Num();
+	Ar << Num;
+
+	for (TArray<uint8>& Record : Records)
+	{
+		Ar.Serialize(Record.GetData(), Record.Num());
+	}
+}
+
+void FArchiveHelpers::SerializeLevelIndex(FArchive& Ar, TArray<FActorSaveData>& Actors)
+{
+	Ar.UsingCustomVersion(FSaveArchiveVersion::GUID);
+
+	if (Ar.IsSaving())
+	{
+		//One range per contiguous run of records from the same level
+		TArray<FActorRecordRange> Ranges;
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
+		{
+			if (Ranges.Num() > 0 && Ranges.Last().Level == Actors[Index].Level)
+			{
+				++Ranges.Last().Num;
+			}
+			else
+			{
+				Ranges.Add({ Actors[Index].Level, Index, 1 });
+			}
+		}
+
+		Ar << Ranges;
+	}
+	else if (Ar.IsLoading())
+	{
+		//Old archives have no index, so any level may own the records
+		if (Ar.CustomVer(FSaveArchiveVersion::GUID) < FSaveArchiveVersion::LevelRecordIndex)
+		{
+			for (FActorSaveData& ActorData : Actors)
+			{
+				ActorData.Level = RPGSave::UnindexedLevel;
+			}
+			return;
+		}
+
+		TArray<FActorRecordRange> Ranges;
+		Ar << Ranges;
+
+		for (const FActorRecordRange& Range : Ranges)
+		{
+			if (Range.Start < 0 || Range.Num < 0 || Range.Start + Range.Num > Actors.Num())
+			{
+				UE_LOG(LogRPGSave, Warning, TEXT("Level index out of range, ignoring remaining entries"));
+				return;
+			}
+
+			for (int32 Index = Range.Start; Index < Range.Start + Range.Num; ++Index)
+			{
+				Actors[Index].Level = Range.Level;
+			}
+		}
+	}
+}
+
+void FArchiveHelpers::SerializePayload(FArchive& Ar, TArray<uint8>& Data, FSaveBufferView& View)
+{
+	if (Ar.IsSaving() && View.IsSet())
+	{
+		TArrayView<const uint8> Bytes = View.Get();
+
+		int32 Num = Bytes.Num();
+		Ar << Num;
+		Ar.Serialize(const_cast<uint8*>(Bytes.GetData()), Num);
+		return;
+	}
+
+	const FSaveLoadBufferScope* BufferScope = FSaveLoadBufferScope::Get();
+	if (Ar.IsLoading() && BufferScope && BufferScope->IsReading(Ar))
+	{
+		int32 Num = 0;
+		Ar << Num;
+
+		const int64 Offset = Ar.Tell();
+		if (Num < 0 || Offset + Num > BufferScope->GetBuffer()->Num())
+		{
+			Ar.SetError();
+			return;
+		}
+
+		Data.Empty();
+		View.Buffer = BufferScope->GetBuffer();
+		View.Offset = int32(Offset);
+		View.Num = Num;
+
+		Ar.Seek(Offset + Num);
+		return;
+	}
+
+	View = FSaveBufferView();
+	Ar << Data;
+}
+
+void FArchiveHelpers::GroupActorsByLevel(TArray<FActorSaveData>& Actors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FArchiveHelpers::GroupActorsByLevel"));
+
+	//Order of records is irrelevant for loading, only same levels need to be adjacent
+	Algo::StableSortBy(Actors, &FActorSaveData::Level, [](const FName& A, const FName& B)
+	{
+		return A.FastLess(B);
+	});
+}
+
+/**
+FSaveLoadBufferScope
+**/
+
+static thread_local const FSaveLoadBufferScope* GActiveLoadBufferScope = nullptr;
+
+FSaveLoadBufferScope::FSaveLoadBufferScope(const TSharedRef<const TArray<uint8>>& InBuffer, const FArchive& InReader)
+	: Buffer(InBuffer), Reader(&InReader), Previous(GActiveLoadBufferScope)
+{
+	GActiveLoadBufferScope = this;
+}
+
+FSaveLoadBufferScope::~FSaveLoadBufferScope()
+{
+	GActiveLoadBufferScope = Previous;
+}
+
+const FSaveLoadBufferScope* FSaveLoadBufferScope::Get()
+{
+	return GActiveLoadBufferScope;
+}
+
 /**
 FSaveHelpers
 **/
@@ -249,17 +436,45 @@ void FMultiLevelStreamingData::ReplaceOrAddToArray(const TSaveData& Data, TSaveD
 	}
 }
 
+void FMultiLevelStreamingData::ReplaceOrAddActor(const FActorSaveData& ActorData)
+{
+	const FName ActorKey(FSaveHelpers::StringFromBytes(ActorData.Name));
+
+	if (const int32* ExistingIndex = ActorIndexMap.Find(ActorKey))
+	{
+		FActorSaveData& Existing = ActorArray[*ExistingIndex];
+
+		//Level can only change for records that were loaded without an index
+		if (Existing.Level != ActorData.Level)
+		{
+			if (TArray<int32>* OldLevelIndices = LevelIndexMap.Find(Existing.Level))
+			{
+				OldLevelIndices->RemoveSingleSwap(*ExistingIndex, EAllowShrinking::No);
+			}
+
+			LevelIndexMap.FindOrAdd(ActorData.Level).Add(*ExistingIndex);
+		}
+
+		Existing = ActorData;
+		return;
+	}
+
+	const int32 NewIndex = ActorArray.Add(ActorData);
+	ActorIndexMap.Add(ActorKey, NewIndex);
+	LevelIndexMap.FindOrAdd(ActorData.Level).Add(NewIndex);
+}
+
 void FMultiLevelStreamingData::CopyActors(const TArray<FActorSaveData>& InData)
 {
+	ActorArray.Reserve(ActorArray.Num() + InData.Num());
+
 	for (const FActorSaveData& ActorData : InData)
 	{
 		//We only add stream relevant actors. All Actor types are stored in the SavedActors array.
 		const EActorType Type = EActorType(ActorData.Type);
 		if (FActorHelpers::IsMultiLevelStreamRelevant(Type))
 		{
-			const FName ActorKey(FSaveHelpers::StringFromBytes(ActorData.Name));
-			ActorMap.Add(ActorKey, ActorData);
-			ReplaceOrAddToArray(ActorData, ActorArray);
+			ReplaceOrAddActor(ActorData);
 		}
 	}
 }
@@ -279,9 +494,26 @@ void FMultiLevelStreamingData::CopyFrom(FLevelArchive& A)
 	const uint32 NumActors = A.SavedActors.Num() + ActorArray.Num();
 	A.SavedActors.Reserve(NumActors);
 
+	//Name lookup for the archive, instead of a linear search per streamed Actor
+	TMap<FName, int32> ArchiveIndexMap;
+	ArchiveIndexMap.Reserve(NumActors);
+
+	for (int32 Index = 0; Index < A.SavedActors.Num(); ++Index)
+	{
+		ArchiveIndexMap.Add(FActorHelpers::GetActorDataName(A.SavedActors[Index]), Index);
+	}
+
 	for (const FActorSaveData& ActorData : ActorArray)
 	{
-		ReplaceOrAddToArray(ActorData, A.SavedActors);
+		const FName ActorKey = FActorHelpers::GetActorDataName(ActorData);
+		if (const int32* ExistingIndex = ArchiveIndexMap.Find(ActorKey))
+		{
+			A.SavedActors[*ExistingIndex] = ActorData;
+		}
+		else
+		{
+			ArchiveIndexMap.Add(ActorKey, A.SavedActors.Add(ActorData));
+		}
 	}
 
 	const uint32 NumScripts = A.SavedScripts.Num() + ScriptArray.Num();
@@ -293,6 +525,253 @@ void FMultiLevelStreamingData::CopyFrom(FLevelArchive& A)
 	}
 }
 
+void FMultiLevelStreamingData::GetLevelActors(const FName& InLevel, TArray<FActorSaveData>& OutActors) const
+{
+	//Persistent level and runtime records are in the NAME_None bucket and only loaded with the persistent level
+	const TArray<int32>* LevelIndices = LevelIndexMap.Find(InLevel);
+
+	//Records from archives saved before the index existed could belong to any level
+	const TArray<int32>* UnindexedIndices = LevelIndexMap.Find(RPGSave::UnindexedLevel);
+
+	OutActors.Reserve(OutActors.Num() + (LevelIndices ? LevelIndices->Num() : 0) + (UnindexedIndices ? UnindexedIndices->Num() : 0));
+
+	for (const TArray<int32>* Indices : { LevelIndices, UnindexedIndices })
+	{
+		if (Indices)
+		{
+			for (const int32 Index : *Indices)
+			{
+				OutActors.Add(ActorArray[Index]);
+			}
+		}
+	}
+}
+
+/**
+Level Delta Archives
+**/
+
+void FLevelSaveSnapshot::CountChangedActors(const uint32 BaseRevision, int32& OutChanged, int32& OutTotal) const
+{
+	OutChanged = 0;
+	OutTotal = 0;
+
+	const auto CountArchive = [BaseRevision, &OutChanged, &OutTotal](const FLevelArchive& A)
+	{
+		OutTotal += A.SavedActors.Num();
+
+		for (const FActorSaveData& ActorData : A.SavedActors)
+		{
+			if (ActorData.Revision > BaseRevision)
+			{
+				++OutChanged;
+			}
+		}
+	};
+
+	if (bUseStack)
+	{
+		for (const FLevelArchive& StackedArchive : LevelStack.Archives)
+		{
+			CountArchive(StackedArchive);
+		}
+	}
+	else
+	{
+		CountArchive(LevelArchive);
+	}
+}
+
+void FLevelSaveSnapshot::CollectRecordNames(FLevelBaseNames& OutNames) const
+{
+	const auto CollectArchive = [&OutNames](const FLevelArchive& A)
+	{
+		TSet<FName>& Names = OutNames.FindOrAdd(A.Level);
+		Names.Reserve(Names.Num() + A.SavedActors.Num());
+
+		for (const FActorSaveData& ActorData : A.SavedActors)
+		{
+			Names.Add(FActorHelpers::GetActorDataName(ActorData));
+		}
+	};
+
+	if (bUseStack)
+	{
+		for (const FLevelArchive& StackedArchive : LevelStack.Archives)
+		{
+			CollectArchive(StackedArchive);
+		}
+	}
+	else
+	{
+		CollectArchive(LevelArchive);
+	}
+}
+
+void FLevelDeltaArchive::CaptureFrom(const FLevelArchive& A, const uint32 BaseRevision, const TSet<FName>* BaseNames)
+{
+	Level = A.Level;
+
+	TSet<FName> SavedNames;
+	SavedNames.Reserve(BaseNames ? A.SavedActors.Num() : 0);
+
+	for (const FActorSaveData& ActorData : A.SavedActors)
+	{
+		if (BaseNames)
+		{
+			SavedNames.Add(FActorHelpers::GetActorDataName(ActorData));
+		}
+
+		if (ActorData.Revision > BaseRevision)
+		{
+			ChangedActors.Add(ActorData);
+		}
+	}
+
+	if (BaseNames)
+	{
+		for (const FName& BaseName : *BaseNames)
+		{
+			if (!SavedNames.Contains(BaseName))
+			{
+				RemovedActors.Add(BaseName);
+			}
+		}
+	}
+
+	SavedScripts = A.SavedScripts;
+	SavedGameMode = A.SavedGameMode;
+	SavedGameState = A.SavedGameState;
+}
+
+void FLevelDeltaArchive::ApplyTo(FLevelArchive& A) const
+{
+	TMap<FName, int32> BaseIndexMap;
+	BaseIndexMap.Reserve(A.SavedActors.Num());
+
+	for (int32 Index = 0; Index < A.SavedActors.Num(); ++Index)
+	{
+		BaseIndexMap.Add(FActorHelpers::GetActorDataName(A.SavedActors[Index]), Index);
+	}
+
+	TBitArray<> RemovedIndices(false, A.SavedActors.Num());
+	int32 NumMissing = 0;
+
+	for (const FName& RemovedName : RemovedActors)
+	{
+		if (const int32* BaseIndex = BaseIndexMap.Find(RemovedName))
+		{
+			RemovedIndices[*BaseIndex] = true;
+		}
+		else
+		{
+			++NumMissing;
+		}
+	}
+
+	//Changed records replace their base record in place, new ones are appended
+	TArray<FActorSaveData> AddedActors;
+
+	for (const FActorSaveData& ActorData : ChangedActors)
+	{
+		if (const int32* BaseIndex = BaseIndexMap.Find(FActorHelpers::GetActorDataName(ActorData)))
+		{
+			A.SavedActors[*BaseIndex] = ActorData;
+			RemovedIndices[*BaseIndex] = false;
+		}
+		else
+		{
+			AddedActors.Add(ActorData);
+		}
+	}
+
+	if (NumMissing > 0)
+	{
+		UE_LOG(LogRPGSave, Warning, TEXT("Level delta does not match its base file, %d removed Actors not found for: %s"), NumMissing, *Level.ToString());
+	}
+
+	TArray<FActorSaveData> MergedActors;
+	MergedActors.Reserve(A.SavedActors.Num() - RemovedActors.Num() + NumMissing + AddedActors.Num());
+
+	for (int32 Index = 0; Index < A.SavedActors.Num(); ++Index)
+	{
+		if (!RemovedIndices[Index])
+		{
+			MergedActors.Add(MoveTemp(A.SavedActors[Index]));
+		}
+	}
+
+	MergedActors.Append(MoveTemp(AddedActors));
+
+	A.SavedActors = MoveTemp(MergedActors);
+	A.SavedScripts = SavedScripts;
+	A.SavedGameMode = SavedGameMode;
+	A.SavedGameState = SavedGameState;
+	A.Level = Level;
+}
+
+void FLevelDeltaSnapshot::CaptureFrom(const FLevelSaveSnapshot& Snapshot)
+{
+	bUseStack = Snapshot.bUseStack;
+
+	if (bUseStack)
+	{
+		Archives.SetNum(Snapshot.LevelStack.Archives.Num());
+
+		for (int32 Index = 0; Index < Archives.Num(); ++Index)
+		{
+			const FLevelArchive& StackedArchive = Snapshot.LevelStack.Archives[Index];
+			const TSet<FName>* BaseNames = Snapshot.BaseNames.IsValid() ? Snapshot.BaseNames->Find(StackedArchive.Level) : nullptr;
+			Archives[Index].CaptureFrom(StackedArchive, Snapshot.DeltaBaseRevision, BaseNames);
+		}
+
+		SavedGameMode = Snapshot.LevelStack.SavedGameMode;
+		SavedGameState = Snapshot.LevelStack.SavedGameState;
+	}
+	else
+	{
+		const TSet<FName>* BaseNames = Snapshot.BaseNames.IsValid() ? Snapshot.BaseNames->Find(Snapshot.LevelArchive.Level) : nullptr;
+		Archives.AddDefaulted_GetRef().CaptureFrom(Snapshot.LevelArchive, Snapshot.DeltaBaseRevision, BaseNames);
+	}
+}
+
+void FLevelDeltaSnapshot::ApplyTo(FLevelArchive& A) const
+{
+	for (const FLevelDeltaArchive& DeltaArchive : Archives)
+	{
+		if (DeltaArchive.Level == A.Level)
+		{
+			DeltaArchive.ApplyTo(A);
+			return;
+		}
+	}
+}
+
+void FLevelDeltaSnapshot::ApplyTo(FLevelStackArchive& Stack) const
+{
+	for (const FLevelDeltaArchive& DeltaArchive : Archives)
+	{
+		FLevelArchive* StackedArchive = Stack.Archives.FindByPredicate([&DeltaArchive](const FLevelArchive& A)
+		{
+			return A.Level == DeltaArchive.Level;
+		});
+
+		//Levels first saved after the base only consist of changed records
+		if (!StackedArchive)
+		{
+			StackedArchive = &Stack.Archives.AddDefaulted_GetRef();
+		}
+
+		DeltaArchive.ApplyTo(*StackedArchive);
+	}
+
+	if (bUseStack)
+	{
+		Stack.SavedGameMode = SavedGameMode;
+		Stack.SavedGameState = SavedGameState;
+	}
+}
+
 /**
 FSaveGameArchive
 **/
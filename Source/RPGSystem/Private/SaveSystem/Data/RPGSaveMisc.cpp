@@ -61,6 +61,16 @@ bool FSettingHelpers::IsMultiThreadSaving()
 	return URPGSaveProjectSetting::Get()->bMultiThreadSaving && FPlatformProcess::SupportsMultithreading();
 }
 
+bool FSettingHelpers::IsStagedLevelSaving()
+{
+	return URPGSaveProjectSetting::Get()->bStagedLevelSaving && FPlatformProcess::SupportsMultithreading();
+}
+
+bool FSettingHelpers::IsDeltaLevelSaving()
+{
+	return URPGSaveProjectSetting::Get()->bDeltaLevelSaving;
+}
+
 bool FSettingHelpers::IsMultiThreadLoading()
 {
 	return URPGSaveProjectSetting::Get()->LoadMethod == ELoadMethod::LM_Thread && FPlatformProcess::SupportsMultithreading();
@@ -71,11 +81,27 @@ bool FSettingHelpers::IsDeferredLoading()
 	return URPGSaveProjectSetting::Get()->LoadMethod == ELoadMethod::LM_Deferred;
 }
 
+bool FSettingHelpers::IsZeroCopyLoading()
+{
+	return URPGSaveProjectSetting::Get()->bZeroCopyLoading;
+}
+
 uint32 FSettingHelpers::GetLoadBatchSize()
 {
 	return FMath::Max(1, URPGSaveProjectSetting::Get()->DeferredLoadStackSize);
 }
 
+double FSettingHelpers::GetLoadFrameBudget()
+{
+	//In seconds
+	return FMath::Max(0.f, URPGSaveProjectSetting::Get()->LoadFrameBudget) / 1000.0;
+}
+
+int32 FSettingHelpers::GetMaxDeltaSaves()
+{
+	return FMath::Max(1, URPGSaveProjectSetting::Get()->MaxDeltaSaves);
+}
+
 /**
 Async Node Helpers
 **/
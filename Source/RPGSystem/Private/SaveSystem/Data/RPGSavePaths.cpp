@@ -21,11 +21,13 @@ TArray<FString> FSavePaths::GetDefaultSaveFiles(const FString& SaveGameName)
 	{
 		const FString PlayerFile = SaveGameName + UnderscoreFile + PlayerSuffix;
 		const FString LevelFile = SaveGameName + UnderscoreFile + ActorSuffix;
+		const FString LevelDeltaFile = SaveGameName + UnderscoreFile + ActorDeltaSuffix;
 		const FString SlotFile = SaveGameName + UnderscoreFile + SlotSuffix;
 		const FString ThumbFile = SaveGameName + UnderscoreFile + ThumbSuffix;
 
 		AllFiles.Add(PlayerFile);
 		AllFiles.Add(LevelFile);
+		AllFiles.Add(LevelDeltaFile);
 		AllFiles.Add(SlotFile);
 		AllFiles.Add(ThumbFile);
 	}
@@ -9,6 +9,10 @@
 #include "Misc/Paths.h"
 #include "SaveGameSystem.h"
 #include "PlatformFeatures.h"
+#include "Serialization/CustomVersion.h"
+
+const FGuid FSaveArchiveVersion::GUID(0x5B2E7D41, 0x9C3A4F18, 0xA6D05E27, 0x31F48BC9);
+static FCustomVersionRegistration GRegisterSaveArchiveVersion(FSaveArchiveVersion::GUID, FSaveArchiveVersion::LatestVersion, TEXT("RPGSaveArchiveVer"));
 
 FString FSaveVersion::GetGameVersion()
 {
@@ -51,31 +55,31 @@ FPackageFileVersion FSaveVersion::GetStaticOldPackageVersion()
 	return FPackageFileVersion(StaticPackageVersion, EUnrealEngineObjectUE5Version(StaticPackageVersion));
 }
 
-bool FSaveVersion::RequiresPerObjectPackageTag(const UObject* Object)
+bool FSaveVersion::UsesPerObjectPackageTags()
 {
 	if (!URPGSaveProjectSetting::Get()->bMigratedSaveActorVersionCheck)
 	{
 		return false;
 	}
 
-	if (FSettingHelpers::IsStackBasedMultiLevelSave() || FSettingHelpers::IsStreamMultiLevelSave())
+	return FSettingHelpers::IsStackBasedMultiLevelSave() || FSettingHelpers::IsStreamMultiLevelSave();
+}
+
+bool FSaveVersion::IsPerObjectPackageTagged(const UObject* Object)
+{
+	if (const AActor* Actor = Cast<AActor>(Object))
 	{
-		if (const AActor* Actor = Cast<AActor>(Object))
-		{
-			const EActorType Type = FActorHelpers::GetActorType(Actor);
-			if (FActorHelpers::IsLevelActor(Type, true))
-			{
-				return true;
-			}
-		}
-		else
-		{
-			//This is for components. 
-			return true;
-		}
+		const EActorType Type = FActorHelpers::GetActorType(Actor);
+		return FActorHelpers::IsLevelActor(Type, true);
 	}
 
-	return false;
+	//This is for components. 
+	return true;
+}
+
+bool FSaveVersion::RequiresPerObjectPackageTag(const UObject* Object)
+{
+	return UsesPerObjectPackageTags() && IsPerObjectPackageTagged(Object);
 }
 
 void FSaveVersion::WriteObjectPackageTag(TArray<uint8>& Data)
@@ -84,7 +88,7 @@ void FSaveVersion::WriteObjectPackageTag(TArray<uint8>& Data)
 	Data.Append(DataTag, RPG_PKG_TAG_SIZE);
 }
 
-bool FSaveVersion::CheckObjectPackageTag(const TArray<uint8>& Data)
+bool FSaveVersion::CheckObjectPackageTag(TArrayView<const uint8> Data)
 {
 	const uint8* DataTag = RPGSave::UE_OBJECT_PACKAGE_TAG;
 	const uint8 Len = RPG_PKG_TAG_SIZE;
@@ -145,6 +149,26 @@ uint8 FSaveVersion::UpdateArchiveVersion(FArchive& Ar)
 	return Version;
 }
 
+void FSaveVersion::SetArchiveVersion(FArchive& Ar, const int32 Version)
+{
+	//Read back through Ar.CustomVer, also by nested archive structs
+	Ar.SetCustomVersion(FSaveArchiveVersion::GUID, Version, TEXT("RPGSaveArchiveVer"));
+}
+
+bool FSaveVersion::IsChunkedArchive(const TArray<uint8>& Data)
+{
+	//Legacy compressed files start with the package file tag of the compressed proxy
+	if (Data.Num() < int32(sizeof(uint32)))
+	{
+		return false;
+	}
+
+	uint32 Tag = 0;
+	FMemory::Memcpy(&Tag, Data.GetData(), sizeof(uint32));
+
+	return Tag == RPGSave::CHUNKED_ARCHIVE_TAG;
+}
+
 EFileValidity FSaveVersion::IsSaveFileValid(const FString& InSavePath, const bool bLog)
 {
 	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
@@ -209,6 +209,14 @@ void URPGSaveFunctionLibrary::SetActorSaveProperties(UObject* WorldContextObject
 	}
 }
 
+void URPGSaveFunctionLibrary::MarkActorSaveDirty(UObject* WorldContextObject)
+{
+	if (URPGSaveSubsystem* SaveSubsystem = URPGSaveSubsystem::Get(WorldContextObject))
+	{
+		SaveSubsystem->MarkActorSaveDirty(Cast<AActor>(WorldContextObject));
+	}
+}
+
 bool URPGSaveFunctionLibrary::IsSavingOrLoading(UObject* WorldContextObject)
 {
 	if (URPGSaveSubsystem* SaveSubsystem = URPGSaveSubsystem::Get(WorldContextObject))
@@ -224,6 +232,16 @@ bool URPGSaveFunctionLibrary::IsSavingOrLoading(UObject* WorldContextObject)
 	return false;
 }
 
+float URPGSaveFunctionLibrary::GetLevelLoadProgress(UObject* WorldContextObject)
+{
+	if (const URPGSaveSubsystem* SaveSubsystem = URPGSaveSubsystem::Get(WorldContextObject))
+	{
+		return SaveSubsystem->GetLevelLoadProgress();
+	}
+
+	return 1.f;
+}
+
 /**
 Custom Objects
 **/
@@ -32,6 +32,12 @@ URPGSaveSubsystem::URPGSaveSubsystem() : URPGSaveSubsystemBase()
 	bLoadPartition = false;
 	bSavePartition = false;
 	WorldPartitionInitTimer = 0.f;
+	LevelRecordRevision = 1;
+	LevelBaseRevision = 0;
+	LevelDeltaCount = 0;
+	LevelLoadTotal = 0;
+	LevelLoadHandled = 0;
+	LevelLoadGeneration = 0;
 }
 
 void URPGSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -44,6 +50,9 @@ void URPGSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void URPGSaveSubsystem::Deinitialize()
 {
+	//Never leave a level file half written
+	WaitForPendingLevelSave();
+
 	Super::Deinitialize();
 
 	RemoveWorldPartitionStreamDelegates();
@@ -88,7 +97,15 @@ bool URPGSaveSubsystem::TryLoadLevelFile()
 		return true;
 	}
 
+	//A staged save may still be writing the files we are about to read
+	WaitForPendingLevelSave();
+
+	//The delta segment is read first and merged while the base file is unpacked
+	LoadedLevelDelta.Reset();
+	LoadBinaryArchive(EDataLoadType::DATA_LevelDelta, ActorDeltaSaveFile());
+
 	const bool bDiskLoadSuccess = LoadBinaryArchive(EDataLoadType::DATA_Level, ActorSaveFile());
+	LoadedLevelDelta.Reset();
 
 	//We don't have data yet, but want to allow auto-saving
 	if (!bDiskLoadSuccess && AutoSaveLoadWorldPartition())
@@ -120,8 +137,25 @@ bool URPGSaveSubsystem::UnpackBinaryArchive(const EDataLoadType LoadType, FMemor
 		ClearSavedLevelActors();
 		ClearStreamingData();
 
+		//Memory data now comes from disk, so the next save writes a new base
+		ClearLevelDeltaBase();
+
 		return UnpackLevelArchive(FromBinary);
 	}
+	else if (LoadType == EDataLoadType::DATA_LevelDelta)
+	{
+		FLevelDeltaSnapshot LevelDelta;
+		FromBinary << LevelDelta;
+
+		if (FromBinary.IsError())
+		{
+			UE_LOG(LogRPGSave, Warning, TEXT("Level delta could not be read and is ignored"));
+			return false;
+		}
+
+		LoadedLevelDelta = MoveTemp(LevelDelta);
+		return true;
+	}
 	else if (LoadType == EDataLoadType::DATA_Player)
 	{
 		return UnpackPlayerArchive(FromBinary);
@@ -156,6 +190,11 @@ bool URPGSaveSubsystem::UnpackLevelArchive(FMemoryReader& FromBinary)
 		FLevelStackArchive LevelStack;
 		FromBinary << LevelStack;
 
+		if (LoadedLevelDelta.IsSet())
+		{
+			LoadedLevelDelta->ApplyTo(LevelStack);
+		}
+
 		//Copy from disk to memory.
 		if (RPGSave::ArrayEmpty(LevelArchiveList))
 		{
@@ -191,6 +230,11 @@ bool URPGSaveSubsystem::UnpackLevelArchive(FMemoryReader& FromBinary)
 		FLevelArchive LevelArchive;
 		FromBinary << LevelArchive;
 
+		if (LoadedLevelDelta.IsSet())
+		{
+			LoadedLevelDelta->ApplyTo(LevelArchive);
+		}
+
 		//Update stream data for current level only
 		if (IsStreamMultiLevelSave() && LevelArchive.Level == GetLevelName())
 		{
@@ -425,6 +469,159 @@ Saving Level Actors
 
 bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 {
+	//Writes of a previous staged save must not interleave with this one
+	WaitForPendingLevelSave();
+
+	FLevelSaveSnapshot Snapshot;
+	SnapshotLevelActors(Snapshot);
+
+	//Memory only automatic saving for World Partition cells. Much faster as it skips compression etc. 
+	if (bMemoryOnly)
+	{
+		FBufferArchive LevelData;
+		if (!SerializeLevelSnapshot(Snapshot, LevelData))
+		{
+			UE_LOG(LogRPGSave, Warning, TEXT("Failed to save Level Actors"));
+			return false;
+		}
+
+		bLoadFromMemory = true;
+		UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors stored in memory"));
+		return true;
+	}
+
+	PrepareLevelDelta(Snapshot);
+
+	FBufferArchive LevelData;
+	if (SerializeLevelSnapshot(Snapshot, LevelData) && SaveLevelArchive(LevelData, Snapshot.IsDelta(), ActorSaveFile(), ActorDeltaSaveFile()))
+	{
+		UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors have been saved"));
+		return true;
+	}
+
+	ClearLevelDeltaBase();
+	UE_LOG(LogRPGSave, Warning, TEXT("Failed to save Level Actors"));
+
+	return false;
+}
+
+void URPGSaveSubsystem::SaveLevelActorsStaged(const bool bMemoryOnly, const FRPGOnLevelSaveFinished& OnFinished)
+{
+	check(IsInGameThread());
+
+	//Writes of a previous staged save must not interleave with this one
+	WaitForPendingLevelSave();
+
+	//Stage 1: Everything that touches UObjects or the memory data of the subsystem
+	const double SnapshotStart = FPlatformTime::Seconds();
+
+	TSharedRef<FLevelSaveSnapshot> Snapshot = MakeShared<FLevelSaveSnapshot>();
+	SnapshotLevelActors(*Snapshot);
+
+	const double SnapshotTime = FPlatformTime::Seconds() - SnapshotStart;
+
+	if (bMemoryOnly)
+	{
+		FBufferArchive LevelData;
+		if (!SerializeLevelSnapshot(*Snapshot, LevelData))
+		{
+			UE_LOG(LogRPGSave, Warning, TEXT("Failed to save Level Actors"));
+			OnFinished.ExecuteIfBound(false);
+			return;
+		}
+
+		bLoadFromMemory = true;
+		UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors stored in memory | Snapshot: %.2f ms"), SnapshotTime * 1000.0);
+		OnFinished.ExecuteIfBound(true);
+		return;
+	}
+
+	PrepareLevelDelta(*Snapshot);
+
+	//Stage 2 and 3: Serialize, compress and write in the background
+	const FString SaveFile = ActorSaveFile();
+	const FString DeltaFile = ActorDeltaSaveFile();
+	TWeakObjectPtr<URPGSaveSubsystem> WeakThis = this;
+
+	//Deinitialize waits for this task, so the subsystem outlives it. The weak pointer is only resolved on the Game Thread.
+	const URPGSaveSubsystem* Subsystem = this;
+
+	PendingLevelSave = Async(EAsyncExecution::ThreadPool, [Subsystem, WeakThis, Snapshot, SaveFile, DeltaFile, SnapshotTime, OnFinished]()
+	{
+		const double SerializeStart = FPlatformTime::Seconds();
+
+		FBufferArchive LevelData;
+		bool bSuccess = Subsystem->SerializeLevelSnapshot(*Snapshot, LevelData);
+
+		const double WriteStart = FPlatformTime::Seconds();
+
+		if (bSuccess)
+		{
+			bSuccess = Subsystem->SaveLevelArchive(LevelData, Snapshot->IsDelta(), SaveFile, DeltaFile);
+		}
+
+		const double WriteEnd = FPlatformTime::Seconds();
+
+		if (bSuccess)
+		{
+			UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors have been saved (%s) | Snapshot: %.2f ms | Serialize: %.2f ms | Compress and Write: %.2f ms"),
+				Snapshot->IsDelta() ? TEXT("Delta") : TEXT("Full"), SnapshotTime * 1000.0, (WriteStart - SerializeStart) * 1000.0, (WriteEnd - WriteStart) * 1000.0);
+		}
+		else
+		{
+			UE_LOG(LogRPGSave, Warning, TEXT("Failed to save Level Actors"));
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnFinished, bSuccess]()
+		{
+			if (WeakThis.IsValid())
+			{
+				//Following deltas must not build on a base that never made it to disk
+				if (!bSuccess)
+				{
+					WeakThis->ClearLevelDeltaBase();
+				}
+
+				OnFinished.ExecuteIfBound(bSuccess);
+			}
+		});
+
+		return bSuccess;
+	});
+}
+
+bool URPGSaveSubsystem::IsLevelSavePending() const
+{
+	return PendingLevelSave.IsValid() && !PendingLevelSave.IsReady();
+}
+
+void URPGSaveSubsystem::WaitForPendingLevelSave()
+{
+	if (PendingLevelSave.IsValid())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("URPGSaveSubsystem::WaitForPendingLevelSave"));
+
+		//Async save and load tasks wait for IsLevelSavePending without blocking, so this only stalls for direct calls
+		if (!PendingLevelSave.IsReady() && IsInGameThread())
+		{
+			UE_LOG(LogRPGSave, Warning, TEXT("Waiting for a staged level save on the Game Thread"));
+		}
+
+		//The Game Thread callback may not have run yet, a following delta must not build on a failed base
+		if (!PendingLevelSave.Get())
+		{
+			ClearLevelDeltaBase();
+		}
+
+		PendingLevelSave.Reset();
+	}
+}
+
+void URPGSaveSubsystem::SnapshotLevelActors(FLevelSaveSnapshot& OutSnapshot)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("URPGSaveSubsystem::SnapshotLevelActors"));
+	SCOPE_CYCLE_COUNTER(STAT_RPGSave_LevelSnapshot);
+
 	TArray<FActorSaveData> InActors;
 	TArray<FActorSaveData> InPersistentActors;
 	TArray<FLevelScriptSaveData> InScripts;
@@ -432,6 +629,9 @@ bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 	FGameObjectSaveData InGameState;
 
 	FScopeLock Lock(&SaveActorsScope);
+	FScopeLock CacheLock(&RecordCacheScope);
+
+	InActors.Reserve(ActorList.Num());
 
 	for (const TWeakObjectPtr<AActor>& ActorWeakPtr : ActorList)
 	{
@@ -453,22 +653,19 @@ bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 		case EActorType::AT_Runtime:
 		case EActorType::AT_Placed:
 			{
-				const FActorSaveData ActorArray = ParseLevelActorForSaving(Actor, Type);
-				InActors.Add(ActorArray);
+				InActors.Add(ParseLevelActorCached(Actor, Type));
 			}
 			break;
 
 		case EActorType::AT_Persistent:
 			{
-				const FActorSaveData ActorArray = ParseLevelActorForSaving(Actor, Type);
-				InPersistentActors.Add(ActorArray);
+				InPersistentActors.Add(ParseLevelActorCached(Actor, Type));
 			}
 			break;
 
 		case EActorType::AT_LevelScript:
 			{
-				const FLevelScriptSaveData ScriptArray = ParseLevelScriptForSaving(Actor);
-				InScripts.Add(ScriptArray);
+				InScripts.Add(ParseLevelScriptForSaving(Actor));
 			}
 			break;
 
@@ -498,23 +695,20 @@ bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 		InGameState = ParseGameModeObjectForSaving(World->GetGameState());
 	}
 
-	FBufferArchive LevelData;
-	WritePackageInfo(LevelData);
-
 	FLevelArchive LevelArchive;
 	{
 		//Stack based only has one set of data for mode and state, so skip
 		if (!IsStackBasedMultiLevelSave())
 		{
-			LevelArchive.SavedGameMode = InGameMode;
-			LevelArchive.SavedGameState = InGameState;
+			LevelArchive.SavedGameMode = MoveTemp(InGameMode);
+			LevelArchive.SavedGameState = MoveTemp(InGameState);
 
 			//Also make sure we add persistent Actors
 			InActors.Append(InPersistentActors);
 		}
 
-		LevelArchive.SavedActors = InActors;
-		LevelArchive.SavedScripts = InScripts;
+		LevelArchive.SavedActors = MoveTemp(InActors);
+		LevelArchive.SavedScripts = MoveTemp(InScripts);
 
 		LevelArchive.Level = GetLevelName();
 	}
@@ -524,7 +718,7 @@ bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 	{
 		if (IsStackBasedMultiLevelSave())
 		{
-			PersistentArchive.SavedActors = InPersistentActors;
+			PersistentArchive.SavedActors = MoveTemp(InPersistentActors);
 			PersistentArchive.Level = RPGSave::PersistentActors;
 		}
 	}
@@ -532,54 +726,106 @@ bool URPGSaveSubsystem::SaveLevelActors(const bool bMemoryOnly)
 	//Check for multi level saving.
 	if (IsNormalMultiLevelSave())
 	{
-		FLevelStackArchive LevelStack = AddMultiLevelStackData(LevelArchive, PersistentArchive, InGameMode, InGameState);
-		LevelData << LevelStack;
+		OutSnapshot.LevelStack = AddMultiLevelStackData(LevelArchive, PersistentArchive, InGameMode, InGameState);
+		OutSnapshot.bUseStack = true;
 	}
 	else if (IsStreamMultiLevelSave())
 	{
-		FLevelArchive StreamArchive = AddMultiLevelStreamData(LevelArchive);
-		LevelData << StreamArchive;
+		OutSnapshot.LevelArchive = AddMultiLevelStreamData(LevelArchive);
 	}
 	else if (IsFullMultiLevelSave())
 	{
 		const FLevelArchive StreamArchive = AddMultiLevelStreamData(LevelArchive);
-		FLevelStackArchive MultiLevelStack = AddMultiLevelStackData(StreamArchive, PersistentArchive, InGameMode, InGameState);
-		LevelData << MultiLevelStack;
+		OutSnapshot.LevelStack = AddMultiLevelStackData(StreamArchive, PersistentArchive, InGameMode, InGameState);
+		OutSnapshot.bUseStack = true;
 	}
 	else
 	{
-		LevelData << LevelArchive;
+		OutSnapshot.LevelArchive = MoveTemp(LevelArchive);
 	}
 
-	//Fail logging level
-	auto LogFailedToSave = []()
+	//Everything captured from now on belongs to the next snapshot
+	OutSnapshot.Revision = LevelRecordRevision++;
+}
+
+void URPGSaveSubsystem::PrepareLevelDelta(FLevelSaveSnapshot& Snapshot)
+{
+	const FString SaveFile = ActorSaveFile();
+	const bool bDeltaSaving = FSettingHelpers::IsDeltaLevelSaving();
+
+	if (bDeltaSaving && LevelBaseRevision != 0 && LevelBaseNames.IsValid() && LevelBaseFile == SaveFile && LevelDeltaCount < FSettingHelpers::GetMaxDeltaSaves())
 	{
-		UE_LOG(LogRPGSave, Warning, TEXT("Failed to save Level Actors"));
-	};
+		int32 NumChanged = 0;
+		int32 NumTotal = 0;
+		Snapshot.CountChangedActors(LevelBaseRevision, NumChanged, NumTotal);
+
+		//Once most of the records changed, a new base is not more expensive than the delta
+		if (NumChanged * 2 <= NumTotal)
+		{
+			Snapshot.DeltaBaseRevision = LevelBaseRevision;
+			Snapshot.BaseNames = LevelBaseNames;
+			++LevelDeltaCount;
 
-	if (FSaveHelpers::HasSaveArchiveError(LevelData, ESaveErrorType::ER_Level))
+			UE_LOG(LogRPGSave, Verbose, TEXT("Level delta save %d: %d of %d Actors changed since the base"), LevelDeltaCount, NumChanged, NumTotal);
+			return;
+		}
+	}
+
+	//Compaction, the following deltas build on this snapshot
+	Snapshot.DeltaBaseRevision = 0;
+	LevelBaseRevision = bDeltaSaving ? Snapshot.Revision : 0;
+	LevelDeltaCount = 0;
+	LevelBaseFile = SaveFile;
+	LevelBaseNames.Reset();
+
+	//Following deltas only list the records that are gone since this base, instead of every record name
+	if (bDeltaSaving)
 	{
-		LogFailedToSave();
-		return false;
+		TSharedRef<FLevelBaseNames> BaseNames = MakeShared<FLevelBaseNames>();
+		Snapshot.CollectRecordNames(*BaseNames);
+		LevelBaseNames = BaseNames;
 	}
+}
 
-	//Memory only automatic saving for World Partition cells. Much faster as it skips compression etc. 
-	if (bMemoryOnly)
+bool URPGSaveSubsystem::SerializeLevelSnapshot(FLevelSaveSnapshot& Snapshot, FBufferArchive& OutLevelData) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("URPGSaveSubsystem::SerializeLevelSnapshot"));
+	SCOPE_CYCLE_COUNTER(STAT_RPGSave_LevelSerialize);
+
+	//Done here instead of the snapshot, so it stays off the Game Thread for staged saving
+	Snapshot.GroupActorsByLevel();
+
+	WritePackageInfo(OutLevelData);
+
+	if (Snapshot.IsDelta())
 	{
-		bLoadFromMemory = true;
-		UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors stored in memory"));
-		return true;
+		FLevelDeltaSnapshot LevelDelta;
+		LevelDelta.CaptureFrom(Snapshot);
+		OutLevelData << LevelDelta;
+	}
+	else
+	{
+		OutLevelData << Snapshot;
 	}
 
-	if (SaveBinaryArchive(LevelData, ActorSaveFile()))
+	return !FSaveHelpers::HasSaveArchiveError(OutLevelData, ESaveErrorType::ER_Level);
+}
+
+bool URPGSaveSubsystem::SaveLevelArchive(FBufferArchive& LevelData, const bool bDelta, const FString& SaveFile, const FString& DeltaFile) const
+{
+	if (bDelta)
 	{
-		UE_LOG(LogRPGSave, Log, TEXT("Level and Game Actors have been saved"));
-		return true;
+		return SaveBinaryArchive(LevelData, DeltaFile);
 	}
 
-	LogFailedToSave();
+	//A stale delta must never be merged onto a new base. Removed first, so a failed write still leaves a consistent previous base.
+	if (DoesFileExist(DeltaFile))
+	{
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		SaveSystem->DeleteGame(false, *DeltaFile, PlayerIndex);
+	}
 
-	return false;
+	return SaveBinaryArchive(LevelData, SaveFile);
 }
 
 FGameObjectSaveData URPGSaveSubsystem::ParseGameModeObjectForSaving(AActor* Actor) const
@@ -603,12 +849,14 @@ FLevelScriptSaveData URPGSaveSubsystem::ParseLevelScriptForSaving(AActor* Actor)
 	return ScriptArray;
 }
 
-FActorSaveData URPGSaveSubsystem::ParseLevelActorForSaving(AActor* Actor, const EActorType Type) const
+FActorSaveData URPGSaveSubsystem::ParseLevelActorForSaving(AActor* Actor, const EActorType Type, const bool bPreSaveExecuted) const
 {
 	FActorSaveData ActorArray;
 
 	ActorArray.Type = uint8(Type);
 	ActorArray.Name = BytesFromString(GetFullActorName(Actor));
+	ActorArray.Level = FActorHelpers::GetRecordLevelName(Actor);
+	ActorArray.Revision = LevelRecordRevision;
 	
 	//Class is saved for runtime and persistent Actors
 	if (FActorHelpers::IsRuntime(Type))
@@ -616,29 +864,97 @@ FActorSaveData URPGSaveSubsystem::ParseLevelActorForSaving(AActor* Actor, const
 		ActorArray.Class = BytesFromString(Actor->GetClass()->GetPathName());
 	}
 
-	//No transform for persistent Actors or if skipped
-	if (!FActorHelpers::IsPersistent(Type) && FActorHelpers::CanProcessActorTransform(Actor))
+	ActorArray.Transform = FActorHelpers::GetRecordTransform(Actor, Type);
+
+	SaveActorToBinary(Actor, ActorArray.SaveData, bPreSaveExecuted);
+
+	return ActorArray;
+}
+
+FActorSaveData URPGSaveSubsystem::ParseLevelActorCached(AActor* Actor, const EActorType Type)
+{
+	if (!FSettingHelpers::IsDeltaLevelSaving())
 	{
-		ActorArray.Transform = Actor->GetActorTransform();
+		return ParseLevelActorForSaving(Actor, Type);
 	}
-	else
+
+	const FName ActorName(GetFullActorName(Actor));
+
+	//Runs for reused records as well. It comes first, as the Actor may still change or mark itself dirty.
+	ExecuteActorPreSave(Actor);
+
+	FActorSaveData* CachedRecord = ActorRecordCache.Find(ActorName);
+	if (CachedRecord && CachedRecord->Type == uint8(Type) && !IsActorSaveDirty(Actor))
 	{
-		ActorArray.Transform = FTransform::Identity;
+		//Moved, but otherwise unchanged Actors only get their transform patched
+		const FTransform Transform = FActorHelpers::GetRecordTransform(Actor, Type);
+		if (!Transform.Equals(CachedRecord->Transform))
+		{
+			CachedRecord->Transform = Transform;
+			CachedRecord->Revision = LevelRecordRevision;
+		}
+
+		CachedRecord->Level = FActorHelpers::GetRecordLevelName(Actor);
+
+		ExecuteActorSaved(Actor);
+
+		return *CachedRecord;
 	}
 
-	SaveActorToBinary(Actor, ActorArray.SaveData);
+	FActorSaveData ActorArray = ParseLevelActorForSaving(Actor, Type, true);
+	ActorRecordCache.Add(ActorName, ActorArray);
 
 	return ActorArray;
 }
 
+bool URPGSaveSubsystem::IsActorSaveDirty(AActor* Actor)
+{
+	if (IRPGActorSaveInterface::Execute_ActorSaveDirty(Actor))
+	{
+		return true;
+	}
+
+	for (UActorComponent* Component : GetSaveComponents(Actor))
+	{
+		if (HasComponentSaveInterface(Component) && IRPGCompSaveInterface::Execute_ComponentSaveDirty(Component))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void URPGSaveSubsystem::MarkActorSaveDirty(const AActor* Actor)
+{
+	if (!IsValidActor(Actor))
+	{
+		return;
+	}
+
+	//Without a cached record, the Actor is fully saved next time
+	FScopeLock Lock(&RecordCacheScope);
+	ActorRecordCache.Remove(FName(GetFullActorName(Actor)));
+}
+
 void URPGSaveSubsystem::OnAnyActorDestroyed(AActor* Actor)
 {
+	if (!IsValidActor(Actor))
+	{
+		return;
+	}
+
+	//Runtime Actors as well, a new Actor with the same name must not reuse the record
+	MarkActorSaveDirty(Actor);
+
 	//Check for placed, but add as destroyed
-	if (IsValidActor(Actor) && FActorHelpers::IsPlacedActor(Actor))
+	if (FActorHelpers::IsPlacedActor(Actor))
 	{
 		FActorSaveData ActorArray;
 		ActorArray.Type = uint8(EActorType::AT_Destroyed);
 		ActorArray.Name = BytesFromString(GetFullActorName(Actor));
+		ActorArray.Level = FActorHelpers::GetRecordLevelName(Actor);
+		ActorArray.Revision = LevelRecordRevision;
 		ActorArray.Transform = Actor->GetActorTransform();
 
 		DestroyedActors.Add(ActorArray);
@@ -652,7 +968,7 @@ Loading Level Actors
 void URPGSaveSubsystem::LoadGameMode()
 {
 	//Game Mode Actor
-	if (!RPGSave::ArrayEmpty(SavedGameMode.Data))
+	if (!RPGSave::ArrayEmpty(SavedGameMode.GetData()))
 	{
 		AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
 		if (GameMode && IsValidForLoading(GameMode))
@@ -663,7 +979,7 @@ void URPGSaveSubsystem::LoadGameMode()
 	}
 
 	//Game State Actor
-	if (!RPGSave::ArrayEmpty(SavedGameState.Data))
+	if (!RPGSave::ArrayEmpty(SavedGameState.GetData()))
 	{
 		AGameStateBase* GameState = GetWorld()->GetGameState();
 		if (GameState && IsValidForLoading(GameState))
@@ -865,6 +1181,53 @@ void URPGSaveSubsystem::FinishLoadingLevel(const bool bHasLoadedFile)
 	ClearActorList();
 }
 
+uint32 URPGSaveSubsystem::AddLevelLoadWork(const int32 NumActors)
+{
+	if (NumActors > 0)
+	{
+		LevelLoadTotal += NumActors;
+		OnLevelLoadProgress.Broadcast(LevelLoadHandled, LevelLoadTotal);
+	}
+
+	return LevelLoadGeneration;
+}
+
+void URPGSaveSubsystem::AddLevelLoadProgress(const int32 NumActors, const uint32 Generation)
+{
+	//Loader started before the progress was reset
+	if (Generation != LevelLoadGeneration || NumActors <= 0 || LevelLoadTotal <= 0)
+	{
+		return;
+	}
+
+	LevelLoadHandled = FMath::Min(LevelLoadHandled + NumActors, LevelLoadTotal);
+	OnLevelLoadProgress.Broadcast(LevelLoadHandled, LevelLoadTotal);
+
+	//All running loaders are done
+	if (LevelLoadHandled >= LevelLoadTotal)
+	{
+		ResetLevelLoadProgress();
+	}
+}
+
+void URPGSaveSubsystem::RemoveLevelLoadWork(const int32 NumActors, const uint32 Generation)
+{
+	//Work of a loader that was destroyed before finishing
+	if (Generation != LevelLoadGeneration || NumActors <= 0 || LevelLoadTotal <= 0)
+	{
+		return;
+	}
+
+	LevelLoadTotal = FMath::Max(0, LevelLoadTotal - NumActors);
+	LevelLoadHandled = FMath::Min(LevelLoadHandled, LevelLoadTotal);
+	OnLevelLoadProgress.Broadcast(LevelLoadHandled, LevelLoadTotal);
+
+	if (LevelLoadHandled >= LevelLoadTotal)
+	{
+		ResetLevelLoadProgress();
+	}
+}
+
 /**
 Multi-Level Saving System Functions
 **/
@@ -942,6 +1305,11 @@ void URPGSaveSubsystem::UpdateMultiLevelStreamData(const FLevelArchive& LevelArc
 	MultiLevelStreamData.CopyTo(LevelArchive);
 }
 
+void URPGSaveSubsystem::GetStreamingLevelActors(const ULevel* InLevel, TArray<FActorSaveData>& OutActors) const
+{
+	MultiLevelStreamData.GetLevelActors(FActorHelpers::GetRecordLevelName(InLevel), OutActors);
+}
+
 /**
 Saving and Loading Player
 **/
@@ -1298,7 +1666,7 @@ void URPGSaveSubsystem::LoadActorComponents(AActor* Actor, const TArray<FCompone
 				{
 					if (!HasSaveInterface(ChildActor))
 					{
-						SerializeFromBinary(ChildActor, ComponentArray.Data);
+						SerializeFromBinary(ChildActor, ComponentArray.GetData());
 					}
 				}
 			}
@@ -1311,7 +1679,7 @@ void URPGSaveSubsystem::LoadActorComponents(AActor* Actor, const TArray<FCompone
 					IRPGCompSaveInterface::Execute_ComponentPreLoad(Component);
 				}
 
-				SerializeFromBinary(Component, ComponentArray.Data);
+				SerializeFromBinary(Component, ComponentArray.GetData());
 
 				if (bInterface)
 				{
@@ -1405,7 +1773,7 @@ UObject* URPGSaveSubsystem::SerializeFromRawObject(AActor* Actor, const FRawObje
 		if (CompareIdentifiers(ComponentData.Name, FullId))
 		{
 			FStructHelpers::SerializeStruct(Data.Object);
-			SerializeFromBinary(Data.Object, ComponentData.Data);
+			SerializeFromBinary(Data.Object, ComponentData.GetData());
 			UpdateRawObjectData(Actor, ComponentData);
 			break;
 		}
@@ -1529,9 +1897,12 @@ void URPGSaveSubsystem::ExecuteActorLoaded(AActor* Actor) const
 	}
 }
 
-void URPGSaveSubsystem::SaveActorToBinary(AActor* Actor, FGameObjectSaveData& OutData) const
+void URPGSaveSubsystem::SaveActorToBinary(AActor* Actor, FGameObjectSaveData& OutData, const bool bPreSaveExecuted) const
 { 
-	ExecuteActorPreSave(Actor);
+	if (!bPreSaveExecuted)
+	{
+		ExecuteActorPreSave(Actor);
+	}
 
 	SerializeToBinary(Actor, OutData.Data);
 
@@ -1553,6 +1924,15 @@ void URPGSaveSubsystem::SaveActorToBinary(AActor* Actor, FGameObjectSaveData& Ou
 
 void URPGSaveSubsystem::LoadActorFromBinary(AActor* Actor, const FGameObjectSaveData& InData)
 {
+	//The cached record no longer matches the Actor once it was loaded
+	{
+		FScopeLock Lock(&RecordCacheScope);
+		if (!ActorRecordCache.IsEmpty())
+		{
+			ActorRecordCache.Remove(FName(GetFullActorName(Actor)));
+		}
+	}
+
 	ExecuteActorPreLoad(Actor);
 
 	const EActorType Type = GetActorType(Actor);
@@ -1565,7 +1945,7 @@ void URPGSaveSubsystem::LoadActorFromBinary(AActor* Actor, const FGameObjectSave
 
 	Actor->Tags.Add(RPGSave::HasLoadedTag);
 
-	SerializeFromBinary(Actor, InData.Data);
+	SerializeFromBinary(Actor, InData.GetData());
 
 	//Load components for non Level Scripts
 	if (!IsLevelScript(Type))
@@ -1736,6 +2116,7 @@ void URPGSaveSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool b
 	RemoveWorldPartitionStreamDelegates();
 
 	ClearDestroyedActors();
+	ClearActorRecordCache();
 
 	// [주석 해제 및 수정] 사용하시는 엔진 버전(UE 5.5 이상 여부)에 맞춰 하나만 남기거나 if문을 사용하세요.
 	if (World)
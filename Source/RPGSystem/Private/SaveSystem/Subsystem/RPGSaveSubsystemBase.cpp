@@ -2,6 +2,7 @@
 
 
 #include "SaveSystem/Subsystem/RPGSaveSubsystemBase.h"
+#include "SaveSystem/Data/RPGSaveCompression.h"
 #include "SaveSystem/Data/RPGSavePaths.h"
 #include "../ProjectSettings/RPGSaveProjectSetting.h"
 #include "SaveSystem/SaveGame/CustomSaveGame.h"
@@ -12,7 +13,6 @@
 #include "Serialization/BufferArchive.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
-#include "Serialization/ArchiveSaveCompressedProxy.h"
 #include "Serialization/ArchiveLoadCompressedProxy.h"
 #include "GameFramework/SaveGame.h"
 #include "SaveGameSystem.h"
@@ -31,6 +31,7 @@ URPGSaveSubsystemBase::URPGSaveSubsystemBase()
 {
 	bLoadFromMemory = false;
 	LoadedPackageVersion = GPackageFileUEVersion;
+	LoadedArchiveVersion = FSaveArchiveVersion::LatestVersion;
 	LastSlotSaveTime = 0.f;
 }
 
@@ -718,6 +719,9 @@ bool URPGSaveSubsystemBase::SaveObject(const FString& FullSavePath, UObject* Sav
 
 bool URPGSaveSubsystemBase::SaveBinaryData(const TArray<uint8>& SavedData, const FString& FullSavePath) const
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("URPGSaveSubsystemBase::SaveBinaryData"));
+	SCOPE_CYCLE_COUNTER(STAT_RPGSave_ArchiveWrite);
+
 	//Auto backup 
 	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
 	if (URPGSaveProjectSetting::Get()->bAutoBackup && SaveSystem->DoesSaveGameExist(*FullSavePath, PlayerIndex))
@@ -782,18 +786,18 @@ bool URPGSaveSubsystemBase::SaveBinaryArchive(FBufferArchive& BinaryData, const
 	}
 	else
 	{
-		//Compress and save
+		//Compress in independent blocks and save
 		TArray<uint8> CompressedData;
-		FArchiveSaveCompressedProxy Compressor(CompressedData, NAME_Oodle);
-
-		if (Compressor.GetError())
 		{
-			UE_LOG(LogRPGSave, Error, TEXT("Cannot save, compressor error: %s"), *FullSavePath);
-			return false;
-		}
+			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("URPGSaveSubsystemBase::CompressBinaryArchive"));
+			SCOPE_CYCLE_COUNTER(STAT_RPGSave_ArchiveCompress);
 
-		Compressor << BinaryData;
-		Compressor.Flush(); //Finalizes compression
+			if (!FSaveCompression::CompressChunked(BinaryData, CompressedData))
+			{
+				UE_LOG(LogRPGSave, Error, TEXT("Cannot save, compressor error: %s"), *FullSavePath);
+				return false;
+			}
+		}
 
 		if (CompressedData.Num() == 0)
 		{
@@ -807,8 +811,6 @@ bool URPGSaveSubsystemBase::SaveBinaryArchive(FBufferArchive& BinaryData, const
 			UE_LOG(LogRPGSave, Error, TEXT("Failed to save compressed data: %s"), *FullSavePath);
 			return false;
 		}
-
-		Compressor.Close(); //Ensures compression finalization
 	}
 
 	BinaryData.Empty(); //Clears the buffer
@@ -854,11 +856,18 @@ bool URPGSaveSubsystemBase::LoadBinaryArchive(const EDataLoadType LoadType, cons
 	const bool bNoCompression = IsConsoleFileSystem();
 
 	//Eliminates duplication between the compressed and uncompressed code paths.
-	const auto ReadFromArchive = [this, LoadType, Object, bReadVersion](const TArray<uint8>& Archive) -> bool
+	const auto ReadFromArchive = [this, LoadType, Object, bReadVersion](const TSharedRef<const TArray<uint8>>& Archive) -> bool
 	{
-		FMemoryReader MemoryReader(Archive, true);
+		FMemoryReader MemoryReader(*Archive, true);
 		ReadPackageInfo(MemoryReader, true);
 
+		//Loaded records keep the buffer alive and reference their payloads in it, instead of copying each one
+		TOptional<FSaveLoadBufferScope> BufferScope;
+		if (LoadType != EDataLoadType::DATA_Object && FSettingHelpers::IsZeroCopyLoading())
+		{
+			BufferScope.Emplace(Archive, MemoryReader);
+		}
+
 		const bool bSuccess = UnpackBinaryArchive(LoadType, MemoryReader, Object);
 
 		if (bReadVersion)
@@ -871,10 +880,26 @@ bool URPGSaveSubsystemBase::LoadBinaryArchive(const EDataLoadType LoadType, cons
 
 	if (bNoCompression)
 	{
-		bSuccess = ReadFromArchive(BinaryData);
+		bSuccess = ReadFromArchive(MakeShared<TArray<uint8>>(MoveTemp(BinaryData)));
+	}
+	else if (FSaveVersion::IsChunkedArchive(BinaryData))
+	{
+		//Blocks are decompressed in parallel straight into the buffer the reader uses
+		TSharedRef<TArray<uint8>> DecompressedData = MakeShared<TArray<uint8>>();
+		if (!FSaveCompression::DecompressChunked(BinaryData, *DecompressedData))
+		{
+			UE_LOG(LogRPGSave, Error, TEXT("Cannot load, chunked archive is corrupt: %s"), *FullSavePath);
+			return false;
+		}
+
+		//The compressed file is no longer needed, keeps the peak memory down
+		BinaryData.Empty();
+
+		bSuccess = ReadFromArchive(DecompressedData);
 	}
 	else
 	{
+		//Legacy single stream format
 		FArchiveLoadCompressedProxy Decompressor = FArchiveLoadCompressedProxy(BinaryData, NAME_Oodle);
 
 		if (Decompressor.GetError())
@@ -886,7 +911,7 @@ bool URPGSaveSubsystemBase::LoadBinaryArchive(const EDataLoadType LoadType, cons
 		FBufferArchive DecompressedBinary;
 		Decompressor << DecompressedBinary;
 
-		bSuccess = ReadFromArchive(DecompressedBinary);
+		bSuccess = ReadFromArchive(MakeShared<TArray<uint8>>(MoveTemp(static_cast<TArray<uint8>&>(DecompressedBinary))));
 
 		//Proper cleanup
 		Decompressor.Close();        //Close decompressor
@@ -913,19 +938,20 @@ void URPGSaveSubsystemBase::SerializeToBinary(UObject* Object, TArray<uint8>& Ou
 	}
 }
 
-void URPGSaveSubsystemBase::SerializeFromBinary(UObject* Object, const TArray<uint8>& InData)
+void URPGSaveSubsystemBase::SerializeFromBinary(UObject* Object, TArrayView<const uint8> InData)
 {
-	FMemoryReader MemoryReader(InData, true);
-	ReadPackageInfo(MemoryReader);
+	//Reads the payload in place, which might be a slice of the pinned file buffer
+	FMemoryReaderView MemoryReader(FMemoryView(InData.GetData(), InData.Num()), true);
+	MemoryReader.SetUEVer(LoadedPackageVersion);
+	MemoryReader.SetEngineVer(LoadedEngineVersion);
 
 	//Check for Multi-Level package version tag
-	if (FSaveVersion::RequiresPerObjectPackageTag(Object))
+	if (bCheckObjectPackageTags && FSaveVersion::IsPerObjectPackageTagged(Object))
 	{
 		if (!FSaveVersion::CheckObjectPackageTag(InData))
 		{
 			//Without tag, we assume the old package version.
-			const FPackageFileVersion OldPackage = FSaveVersion::GetStaticOldPackageVersion();
-			MemoryReader.SetUEVer(OldPackage);
+			MemoryReader.SetUEVer(LoadedOldPackageVersion);
 		}
 	}
 
@@ -940,13 +966,15 @@ Versioning Functions
 void URPGSaveSubsystemBase::WritePackageInfo(FBufferArchive& ToBinary) const
 {
 	//Package info is written at the beginning of the file as first entry to the top-level FBufferArchive for Player, Level, Object
-	int32 FileTag = RPGSave::UE_SAVEGAME_FILE_TYPE_TAG;
+	int32 FileTag = RPGSave::RPG_SAVEGAME_FILE_TYPE_TAG;
 	FPackageFileVersion Version = GPackageFileUEVersion;
 	FEngineVersion EngineVersion = FEngineVersion::Current();
+	int32 ArchiveVersion = FSaveArchiveVersion::LatestVersion;
 
 	ToBinary << FileTag;
 	ToBinary << Version;
 	ToBinary << EngineVersion;
+	ToBinary << ArchiveVersion;
 }
 
 void URPGSaveSubsystemBase::ReadPackageInfo(FMemoryReader& MemoryReader, const bool bSeekInitialVersion)
@@ -960,8 +988,11 @@ void URPGSaveSubsystemBase::ReadPackageInfo(FMemoryReader& MemoryReader, const b
 
 		MemoryReader << FileTag;
 
+		const bool bHasArchiveVersion = (FileTag == RPGSave::RPG_SAVEGAME_FILE_TYPE_TAG);
+		LoadedArchiveVersion = FSaveArchiveVersion::BeforeArchiveVersion;
+
 		//No file tag means an old file.
-		if (FileTag != RPGSave::UE_SAVEGAME_FILE_TYPE_TAG)
+		if (FileTag != RPGSave::UE_SAVEGAME_FILE_TYPE_TAG && !bHasArchiveVersion)
 		{
 			//Start from beginning
 			MemoryReader.Seek(0);
@@ -978,12 +1009,21 @@ void URPGSaveSubsystemBase::ReadPackageInfo(FMemoryReader& MemoryReader, const b
 
 			LoadedPackageVersion = FileVersion;
 			LoadedEngineVersion = EngineVersion;
+
+			if (bHasArchiveVersion)
+			{
+				MemoryReader << LoadedArchiveVersion;
+			}
 		}
+
+		bCheckObjectPackageTags = FSaveVersion::UsesPerObjectPackageTags();
+		LoadedOldPackageVersion = FSaveVersion::GetStaticOldPackageVersion();
 	}
 
 	//Sub-archives also require the correct version to be set, so we use the initial version globally 
 	MemoryReader.SetUEVer(LoadedPackageVersion);
 	MemoryReader.SetEngineVer(LoadedEngineVersion);
+	FSaveVersion::SetArchiveVersion(MemoryReader, LoadedArchiveVersion);
 }
 
 void URPGSaveSubsystemBase::WriteGameVersionInfo(FBufferArchive& ToBinary) const
@@ -1148,6 +1188,11 @@ FString URPGSaveSubsystemBase::ActorSaveFile(const FString& SaveGameName) const
 	return FullSaveDir(RPGSave::ActorSuffix, SaveGameName);
 }
 
+FString URPGSaveSubsystemBase::ActorDeltaSaveFile(const FString& SaveGameName) const
+{
+	return FullSaveDir(RPGSave::ActorDeltaSuffix, SaveGameName);
+}
+
 FString URPGSaveSubsystemBase::PlayerSaveFile(const FString& SaveGameName) const
 {
 	return FullSaveDir(RPGSave::PlayerSuffix, SaveGameName);
@@ -2,13 +2,23 @@
 
 #include "Shared/Components/ObjectPoolComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Shared/Interfaces/PoolableInterface.h"
 #include "Math/Int128.h" 
 
+// stat ObjectPool
+DECLARE_STATS_GROUP(TEXT("ObjectPool"), STATGROUP_ObjectPool, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Pool Prewarm"), STAT_ObjectPool_Prewarm, STATGROUP_ObjectPool);
+DECLARE_CYCLE_STAT(TEXT("Pool Trim"), STAT_ObjectPool_Trim, STATGROUP_ObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Hits"), STAT_ObjectPool_Hits, STATGROUP_ObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses"), STAT_ObjectPool_Misses, STATGROUP_ObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Spawns"), STAT_ObjectPool_Spawns, STATGROUP_ObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Trimmed"), STAT_ObjectPool_Trimmed, STATGROUP_ObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Invalid Returns"), STAT_ObjectPool_InvalidReturns, STATGROUP_ObjectPool);
+
 // 생성자
 UObjectPoolComponent::UObjectPoolComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
-    LastFoundPoolIndex = INDEX_NONE;
     PooledActorMinSpawnCoordinate = DEFAULT_POOL_OBJECT_MIN_POSITION;
     PooledActorMaxSpawnCoordinate = DEFAULT_POOL_OBJECT_MAX_POSITION;
 }
@@ -38,7 +48,7 @@ void UObjectPoolComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UObjectPoolComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    UpdatePools();
+    UpdatePools(DeltaTime);
 }
 
 // --- 풀 설정 추가 함수 구현 ---
@@ -95,13 +105,18 @@ void UObjectPoolComponent::AddPoolForUserWidgetClass(TSubclassOf<UUserWidget> Wi
     AddOrUpdatePoolConfiguration(Config);
 }
 
+void UObjectPoolComponent::AddPoolFromConfig(const FPooledObjectTypeConfig& Config)
+{
+    AddOrUpdatePoolConfiguration(Config);
+}
+
 
 // --- 오브젝트 가져오기 함수 구현 ---
 
 UObject* UObjectPoolComponent::GetObjectFromPool(TSubclassOf<UObject> ObjectClass)
 {
-    FObjectPoolInstance* PoolInstance = FindPoolInstanceByClass(ObjectClass);
-    if (!PoolInstance)
+    const int32 PoolIndex = FindPoolIndexByClass(ObjectClass);
+    if (PoolIndex == INDEX_NONE)
     {
         // 필요하다면 여기서 자동으로 풀을 생성하고 오브젝트를 반환하는 로직 추가 가능
         // FPooledObjectSpawnSettings DefaultSettings;
@@ -111,24 +126,27 @@ UObject* UObjectPoolComponent::GetObjectFromPool(TSubclassOf<UObject> ObjectClas
         return nullptr;
     }
 
-    if (!PoolInstance->AvailableObjects.IsEmpty())
-    {
-        UObject* PooledObject = PoolInstance->AvailableObjects.Pop(false); // Shrink하지 않음
-        // 상태 활성화 로직 (예: Actor인 경우 SetActorHiddenInGame(false) 등)은 각 타입별 Get 함수에서 처리
-        return PooledObject;
-    }
-
-    // 풀에 사용 가능한 오브젝트가 없으면 새로 생성 (풀 최대 크기 제한은 RetrieveOrCreateObjectForPool에서 처리)
-    return RetrieveOrCreateObjectForPool(*PoolInstance);
+    // 대기 중인 오브젝트가 없으면 새로 생성
+    // 상태 활성화 로직 (예: Actor인 경우 SetActorHiddenInGame(false) 등)은 각 타입별 Get 함수에서 처리
+    return CheckoutFromPool(PoolIndex, nullptr);
 }
 
-AActor* UObjectPoolComponent::GetActorFromPool(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform)
+AActor* UObjectPoolComponent::GetActorFromPool(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* NewOwner, APawn* NewInstigator)
 {
     AActor* PooledActor = Cast<AActor>(GetObjectFromPool(ActorClass));
     if (PooledActor)
     {
-        ManageActorState(PooledActor, true); // Actor 활성화
+        // 위치와 소유자를 먼저 설정하고 활성화 (OnAcquiredFromPool에서 최종 위치/방향/소유자를 쓸 수 있도록)
         PooledActor->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::TeleportPhysics);
+        if (NewOwner)
+        {
+            PooledActor->SetOwner(NewOwner);
+        }
+        if (NewInstigator)
+        {
+            PooledActor->SetInstigator(NewInstigator);
+        }
+        ManageActorState(PooledActor, true); // Actor 활성화
     }
     return PooledActor;
 }
@@ -159,17 +177,26 @@ UUserWidget* UObjectPoolComponent::GetWidgetFromPool(TSubclassOf<UUserWidget> Wi
 
 UMaterialInstanceDynamic* UObjectPoolComponent::GetMaterialInstanceDynamicFromPool(UMaterialInterface* BaseMaterial)
 {
-    FObjectPoolInstance* PoolInstance = FindPoolInstanceByMaterial(BaseMaterial);
-    if (!PoolInstance)
+    const int32 PoolIndex = FindPoolIndexByMaterial(BaseMaterial);
+    if (PoolIndex == INDEX_NONE)
     {
         return nullptr;
     }
 
-    if (!PoolInstance->AvailableObjects.IsEmpty())
+    return Cast<UMaterialInstanceDynamic>(CheckoutFromPool(PoolIndex, nullptr));
+}
+
+UObject* UObjectPoolComponent::CheckoutObjectFromPool(TSubclassOf<UObject> ObjectClass, FPooledObjectHandle& OutHandle)
+{
+    OutHandle.Reset();
+
+    const int32 PoolIndex = FindPoolIndexByClass(ObjectClass);
+    if (PoolIndex == INDEX_NONE)
     {
-        return Cast<UMaterialInstanceDynamic>(PoolInstance->AvailableObjects.Pop(false));
+        return nullptr;
     }
-    return Cast<UMaterialInstanceDynamic>(RetrieveOrCreateObjectForPool(*PoolInstance));
+
+    return CheckoutFromPool(PoolIndex, &OutHandle);
 }
 
 
@@ -182,92 +209,113 @@ void UObjectPoolComponent::ReturnObjectToPool(UObject* ObjectToReturn)
         return;
     }
 
-    FObjectPoolInstance* PoolInstance = nullptr;
-    if (UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(ObjectToReturn))
+    // 풀이 생성한 오브젝트면 (풀, 슬롯)을 바로 찾음
+    const FPooledObjectLocation* Location = PooledObjectLocations.Find(ObjectToReturn);
+    if (!Location)
     {
-        if (TObjectPtr<UMaterialInterface>* BaseMaterialPtr = MaterialToBaseMap.Find(MID))
+        // 풀 밖에서 생성된 오브젝트도 같은 클래스(머티리얼)의 풀이 있으면 편입
+        int32 PoolIndex = INDEX_NONE;
+        if (const UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(ObjectToReturn))
         {
-            PoolInstance = FindPoolInstanceByMaterial(*BaseMaterialPtr);
+            PoolIndex = FindPoolIndexByMaterial(MID->Parent);
         }
-    }
-    else
-    {
-        PoolInstance = FindPoolInstanceByClass(ObjectToReturn->GetClass());
+        else
+        {
+            PoolIndex = FindPoolIndexByClass(ObjectToReturn->GetClass());
+        }
+
+        if (PoolIndex != INDEX_NONE)
+        {
+            AdoptObject(PoolIndex, ObjectToReturn);
+        }
+        else
+        {
+            // 풀이 없는 오브젝트는 그냥 소멸 처리 (혹은 다른 정책)
+            DestroyPooledObject(ObjectToReturn);
+        }
+        return;
     }
 
+    // 이미 반환된 오브젝트면 ReturnSlot에서 경고 후 무시
+    ReturnSlot(Location->PoolIndex, Location->SlotIndex);
+}
 
-    if (!PoolInstance)
+void UObjectPoolComponent::ReturnObjectsToPool(TArray<UObject*>& ObjectsToReturn)
+{
+    for (UObject* Obj : ObjectsToReturn)
     {
-        // 풀이 없는 오브젝트는 그냥 소멸 처리 (혹은 다른 정책)
-        if (AActor* ActorToDestroy = Cast<AActor>(ObjectToReturn)) ActorToDestroy->Destroy();
-        else if (UActorComponent* CompToDestroy = Cast<UActorComponent>(ObjectToReturn)) CompToDestroy->DestroyComponent();
-        // else ObjectToReturn->ConditionalBeginDestroy(); // 일반 UObject
-        return;
+        ReturnObjectToPool(Obj);
     }
+    ObjectsToReturn.Empty(); // 반환 후 배열 비우기 (선택적)
+}
 
-    // 이미 풀에 있거나, 최대 크기를 초과하면 반환하지 않고 파괴 (선택적)
-    // if (PoolInstance->AvailableObjects.Contains(ObjectToReturn) || PoolInstance->AvailableObjects.Num() >= PoolInstance->TypeConfig.SpawnSettings.MaxPoolSize)
-    // {
-    //     // ... 파괴 로직 ...
-    //     return;
-    // }
-
-    // 상태 비활성화 로직
-    if (AActor* ActorToReturn = Cast<AActor>(ObjectToReturn))
+bool UObjectPoolComponent::ReturnObjectToPoolByHandle(FPooledObjectHandle& Handle)
+{
+    const bool bValid = IsPooledObjectHandleValid(Handle);
+    if (bValid)
     {
-        ManageActorState(ActorToReturn, false);
+        ReturnSlot(Handle.PoolIndex, Handle.SlotIndex);
     }
-    else if (UActorComponent* ComponentToReturn = Cast<UActorComponent>(ObjectToReturn))
+    else if (Handle.IsSet() && PoolInstances.IsValidIndex(Handle.PoolIndex))
     {
-        ManageComponentState(ComponentToReturn, false);
+        // 이전 대여의 핸들 (이미 반환되었거나 슬롯이 재사용됨)
+        FObjectPoolInstance& PoolInstance = PoolInstances[Handle.PoolIndex];
+        PoolInstance.Stats.InvalidReturns++;
+        INC_DWORD_STAT(STAT_ObjectPool_InvalidReturns);
+        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: Stale handle returned to pool %d slot %d (generation %d)"),
+            Handle.PoolIndex, Handle.SlotIndex, Handle.Generation);
     }
-    else if (UUserWidget* WidgetToReturn = Cast<UUserWidget>(ObjectToReturn))
+
+    Handle.Reset();
+    return bValid;
+}
+
+bool UObjectPoolComponent::IsPooledObjectHandleValid(const FPooledObjectHandle& Handle) const
+{
+    if (!Handle.IsSet() || !PoolInstances.IsValidIndex(Handle.PoolIndex))
     {
-        ManageWidgetState(WidgetToReturn, false);
+        return false;
     }
-    // Material Instance Dynamic은 특별한 비활성화 로직이 없을 수 있음.
-    
-    if (!PoolInstance->AvailableObjects.Contains(ObjectToReturn))
+
+    const FObjectPoolInstance& PoolInstance = PoolInstances[Handle.PoolIndex];
+    if (!PoolInstance.Slots.IsValidIndex(Handle.SlotIndex))
     {
-        PoolInstance->AvailableObjects.Add(ObjectToReturn);
+        return false;
     }
+
+    const FPooledObjectSlot& Slot = PoolInstance.Slots[Handle.SlotIndex];
+    return Slot.bCheckedOut && Slot.Generation == Handle.Generation && IsValid(Slot.Object);
 }
 
-void UObjectPoolComponent::ReturnObjectsToPool(TArray<UObject*>& ObjectsToReturn)
+UObject* UObjectPoolComponent::GetObjectFromHandle(const FPooledObjectHandle& Handle) const
 {
-    for (UObject* Obj : ObjectsToReturn)
-    {
-        ReturnObjectToPool(Obj);
-    }
-    ObjectsToReturn.Empty(); // 반환 후 배열 비우기 (선택적)
+    return IsPooledObjectHandleValid(Handle) ? PoolInstances[Handle.PoolIndex].Slots[Handle.SlotIndex].Object.Get() : nullptr;
 }
 
 // --- 풀 관리 및 유틸리티 함수 구현 ---
 void UObjectPoolComponent::PrewarmPool(TSubclassOf<UObject> ObjectClass, int32 CountToSpawn)
 {
-    FObjectPoolInstance* PoolInstance = FindPoolInstanceByClass(ObjectClass);
-    if (!PoolInstance)
+    const int32 PoolIndex = FindPoolIndexByClass(ObjectClass);
+    if (PoolIndex == INDEX_NONE)
     {
         return;
     }
 
-    int32 ActuallySpawnedCount = 0;
+    FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
     for (int32 i = 0; i < CountToSpawn; ++i)
     {
-        if (PoolInstance->TotalSpawnedCount >= PoolInstance->TypeConfig.SpawnSettings.MaxPoolSize)
+        if (PoolInstance.Slots.Num() - PoolInstance.VacantSlots.Num() >= PoolInstance.TypeConfig.SpawnSettings.MaxPoolSize)
         {
             break; // 최대 풀 크기 도달
         }
-        UObject* NewObj = RetrieveOrCreateObjectForPool(*PoolInstance);
-        if (NewObj)
-        {
-            ReturnObjectToPool(NewObj); // 생성 후 바로 반환하여 사용 가능 상태로 만듦
-            ActuallySpawnedCount++;
-        }
-        else
+
+        // 생성 후 바로 대기 상태로
+        const int32 SlotIndex = SpawnIntoSlot(PoolInstance, PoolIndex);
+        if (SlotIndex == INDEX_NONE)
         {
             break; 
         }
+        PoolInstance.FreeSlots.Push(SlotIndex);
     }
 }
 
@@ -279,19 +327,8 @@ void UObjectPoolComponent::DestroyObjectsInPoolByClass(TSubclassOf<UObject> Obje
         return;
     }
 
-    for (UObject* Obj : PoolInstance->AvailableObjects)
-    {
-        if (IsValid(Obj))
-        {
-            if (AActor* ActorToDestroy = Cast<AActor>(Obj)) ActorToDestroy->Destroy();
-            else if (UActorComponent* CompToDestroy = Cast<UActorComponent>(Obj)) CompToDestroy->DestroyComponent();
-            // UserWidget이나 MaterialInstanceDynamic은 명시적 Destroy 호출이 다를 수 있음.
-            // else Obj->ConditionalBeginDestroy(); // 일반 UObject
-        }
-    }
-    PoolInstance->AvailableObjects.Empty();
-    // 여기서 PoolInstances 배열에서 해당 PoolInstance 자체를 제거할 수도 있음.
-    // PoolInstances.RemoveAt(FoundIndex); // 단, 인덱스 기반으로 찾아야 함.
+    // 대기 중인 오브젝트만 파괴 (대여 중인 오브젝트는 반환 시 다시 풀로 들어옴)
+    TrimPool(*PoolInstance, 0);
 }
 
 void UObjectPoolComponent::DestroyMaterialInstancesInPool(UMaterialInterface* BaseMaterial)
@@ -302,33 +339,80 @@ void UObjectPoolComponent::DestroyMaterialInstancesInPool(UMaterialInterface* Ba
         return;
     }
     // MaterialInstanceDynamic은 특별한 Destroy 호출이 필요 없을 수 있으나, 참조를 제거하는 것이 중요.
-    for (UObject* Obj : PoolInstance->AvailableObjects)
-    {
-        if (UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(Obj))
-        {
-            MaterialToBaseMap.Remove(MID);
-        }
-    }
-    PoolInstance->AvailableObjects.Empty();
+    TrimPool(*PoolInstance, 0);
 }
 
 void UObjectPoolComponent::DestroyAllPools()
 {
     for (FObjectPoolInstance& PoolInstance : PoolInstances)
     {
-        for (UObject* Obj : PoolInstance.AvailableObjects)
+        TrimPool(PoolInstance, 0);
+    }
+    PoolInstances.Empty();
+    PoolIndexByClass.Empty();
+    PoolIndexByMaterial.Empty();
+    PooledObjectLocations.Empty();
+    NextPrewarmPoolIndex = 0;
+}
+
+int32 UObjectPoolComponent::TrimLeastRecentlyUsed(int32 NumToTrim)
+{
+    if (NumToTrim <= 0)
+    {
+        return 0;
+    }
+
+    // 풀마다 대기 스택 바닥이 가장 오래된 오브젝트이므로, 각 풀의 바닥 중 더 오래된 쪽을 하나씩 고름
+    TArray<int32, TInlineAllocator<16>> NumToTrimPerPool;
+    NumToTrimPerPool.SetNumZeroed(PoolInstances.Num());
+
+    int32 NumSelected = 0;
+    while (NumSelected < NumToTrim)
+    {
+        int32 OldestPoolIndex = INDEX_NONE;
+        double OldestReturnTime = TNumericLimits<double>::Max();
+        for (int32 PoolIndex = 0; PoolIndex < PoolInstances.Num(); ++PoolIndex)
         {
-            if (IsValid(Obj))
+            const FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
+            const int32 Cursor = NumToTrimPerPool[PoolIndex];
+            if (Cursor < PoolInstance.FreeSlots.Num())
             {
-                if (AActor* ActorToDestroy = Cast<AActor>(Obj)) ActorToDestroy->Destroy();
-                else if (UActorComponent* CompToDestroy = Cast<UActorComponent>(Obj)) CompToDestroy->DestroyComponent();
+                const double ReturnTime = PoolInstance.Slots[PoolInstance.FreeSlots[Cursor]].LastReturnTime;
+                if (ReturnTime < OldestReturnTime)
+                {
+                    OldestReturnTime = ReturnTime;
+                    OldestPoolIndex = PoolIndex;
+                }
             }
         }
-        PoolInstance.AvailableObjects.Empty();
+
+        if (OldestPoolIndex == INDEX_NONE)
+        {
+            break; // 대기 중인 오브젝트가 더 없음
+        }
+
+        NumToTrimPerPool[OldestPoolIndex]++;
+        NumSelected++;
     }
-    PoolInstances.Empty();
-    MaterialToBaseMap.Empty();
-    LastFoundPoolIndex = INDEX_NONE;
+
+    for (int32 PoolIndex = 0; PoolIndex < PoolInstances.Num(); ++PoolIndex)
+    {
+        const int32 NumTrimmed = NumToTrimPerPool[PoolIndex];
+        if (NumTrimmed == 0)
+        {
+            continue;
+        }
+
+        FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
+        TrimPool(PoolInstance, PoolInstance.FreeSlots.Num() - NumTrimmed);
+
+        // 다음 축소 구간의 하이 워터마크가 다시 올릴 때까지 프리웜으로 채우지 않음
+        PoolInstance.TargetCapacity = FMath::Min(PoolInstance.TargetCapacity, PoolInstance.Stats.InUse + PoolInstance.FreeSlots.Num());
+        PoolInstance.Stats.Trimmed += NumTrimmed;
+        INC_DWORD_STAT_BY(STAT_ObjectPool_Trimmed, NumTrimmed);
+    }
+
+    return NumSelected;
 }
 
 bool UObjectPoolComponent::IsObjectClassRegistered(TSubclassOf<UObject> ObjectClass) const
@@ -341,12 +425,17 @@ bool UObjectPoolComponent::IsMaterialInterfaceRegistered(UMaterialInterface* Bas
     return FindPoolInstanceByMaterial(BaseMaterial) != nullptr;
 }
 
+bool UObjectPoolComponent::IsPooledObject(const UObject* Object) const
+{
+    return Object && PooledObjectLocations.Contains(Object);
+}
+
 int32 UObjectPoolComponent::GetTotalObjectCountInAllPools() const
 {
     int32 TotalCount = 0;
     for (const FObjectPoolInstance& PoolInstance : PoolInstances)
     {
-        TotalCount += PoolInstance.AvailableObjects.Num();
+        TotalCount += PoolInstance.FreeSlots.Num();
         // 활성 객체 수도 포함하려면 추가 로직 필요
     }
     return TotalCount;
@@ -355,22 +444,42 @@ int32 UObjectPoolComponent::GetTotalObjectCountInAllPools() const
 int32 UObjectPoolComponent::GetAvailableObjectCountForClass(TSubclassOf<UObject> ObjectClass) const
 {
     const FObjectPoolInstance* PoolInstance = FindPoolInstanceByClass(ObjectClass);
-    return PoolInstance ? PoolInstance->AvailableObjects.Num() : 0;
+    return PoolInstance ? PoolInstance->FreeSlots.Num() : 0;
 }
 
 int32 UObjectPoolComponent::GetAvailableMaterialInstanceCount(UMaterialInterface* BaseMaterial) const
 {
     const FObjectPoolInstance* PoolInstance = FindPoolInstanceByMaterial(BaseMaterial);
-    return PoolInstance ? PoolInstance->AvailableObjects.Num() : 0;
+    return PoolInstance ? PoolInstance->FreeSlots.Num() : 0;
+}
+
+FObjectPoolStats UObjectPoolComponent::GetPoolStatsForClass(TSubclassOf<UObject> ObjectClass) const
+{
+    FObjectPoolStats Result;
+    if (const FObjectPoolInstance* PoolInstance = FindPoolInstanceByClass(ObjectClass))
+    {
+        Result = PoolInstance->Stats;
+        Result.Available = PoolInstance->FreeSlots.Num();
+    }
+    return Result;
+}
+
+FObjectPoolStats UObjectPoolComponent::GetPoolStatsForMaterial(UMaterialInterface* BaseMaterial) const
+{
+    FObjectPoolStats Result;
+    if (const FObjectPoolInstance* PoolInstance = FindPoolInstanceByMaterial(BaseMaterial))
+    {
+        Result = PoolInstance->Stats;
+        Result.Available = PoolInstance->FreeSlots.Num();
+    }
+    return Result;
 }
 
 FVector UObjectPoolComponent::GetTemporarySpawnLocationForActors() const
 {
-    return FVector(
-        FMath::RandRange(PooledActorMinSpawnCoordinate, PooledActorMaxSpawnCoordinate),
-        FMath::RandRange(PooledActorMinSpawnCoordinate, PooledActorMaxSpawnCoordinate),
-        FMath::RandRange(PooledActorMinSpawnCoordinate, PooledActorMaxSpawnCoordinate)
-    );
+    // 비활성 액터는 한 지점에 모음 (충돌은 꺼져 있음)
+    // 랜덤 위치는 월드 곳곳의 옥트리 노드/스트리밍 셀을 건드리고 반환할 때마다 위치가 크게 바뀜
+    return FVector(PooledActorMaxSpawnCoordinate);
 }
 
 bool UObjectPoolComponent::IsLocationWithinTemporarySpawnArea(const FVector& Location, float ErrorMargin) const
@@ -418,50 +527,127 @@ FString UObjectPoolComponent::ConvertIntToUniqueString(int32 Value)
 
 // --- Private Helper Functions ---
 
-void UObjectPoolComponent::UpdatePools()
+void UObjectPoolComponent::UpdatePools(float DeltaTime)
 {
+    const int32 NumPools = PoolInstances.Num();
+    if (NumPools == 0)
+    {
+        return;
+    }
+
     for (FObjectPoolInstance& PoolInstance : PoolInstances)
     {
-        UpdateSinglePoolInstance(PoolInstance);
+        UpdatePoolShrink(PoolInstance, DeltaTime);
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_ObjectPool_Prewarm);
+
+    // 생성 비용은 클래스마다 크게 다르므로 개수가 아니라 시간으로 제한
+    const double BudgetEndTime = FPlatformTime::Seconds() + PrewarmTimeBudgetMs / 1000.0;
+    bool bSpawnedThisFrame = false;
+
+    // 예산을 다 쓰면 다음 프레임은 다음 풀부터 시작
+    for (int32 Offset = 0; Offset < NumPools; ++Offset)
+    {
+        const int32 PoolIndex = (NextPrewarmPoolIndex + Offset) % NumPools;
+        if (!UpdateSinglePoolInstance(PoolInstances[PoolIndex], PoolIndex, BudgetEndTime, bSpawnedThisFrame))
+        {
+            NextPrewarmPoolIndex = (PoolIndex + 1) % NumPools;
+            return;
+        }
     }
 }
 
-void UObjectPoolComponent::UpdateSinglePoolInstance(FObjectPoolInstance& PoolInstance)
+bool UObjectPoolComponent::UpdateSinglePoolInstance(FObjectPoolInstance& PoolInstance, int32 PoolIndex, double BudgetEndTime, bool& bInOutSpawnedThisFrame)
 {
-    // 현재 풀에 있는 오브젝트 수 (사용 가능한 것 + 활성화된 것). 정확한 활성 객체 수 파악이 어려우므로, MaxPoolSize 기준으로만 판단.
-    // 실제로는 활성 객체 목록을 따로 관리하거나, GetWorld()->FindAllActors/ObjectsOfClass 등으로 현재 월드에 존재하는 객체 수를 파악해야 함.
-    // 여기서는 단순하게 AvailableObjects.Num()과 MaxPoolSize를 비교.
-    if (PoolInstance.AvailableObjects.Num() >= PoolInstance.TypeConfig.SpawnSettings.MaxPoolSize)
+    // 대여 중인 수는 슬롯에서 정확히 알 수 있으므로, 목표 크기(TargetCapacity)에서 대여 중인 수를 뺀 만큼만 대기 상태로 준비
+    const int32 DesiredAvailable = PoolInstance.GetDesiredAvailableCount();
+    if (PoolInstance.FreeSlots.Num() >= DesiredAvailable)
     {
         PoolInstance.CurrentSpawnDelayFrames = PoolInstance.TypeConfig.SpawnSettings.SpawnDelayInFramesAfterReachingMax;
-        return;
+        return true;
     }
 
     if (PoolInstance.CurrentSpawnDelayFrames > 0)
     {
         PoolInstance.CurrentSpawnDelayFrames--;
-        return;
+        return true;
     }
 
     for (int32 i = 0; i < PoolInstance.TypeConfig.SpawnSettings.NumToSpawnPerFrame; ++i)
     {
-        if (PoolInstance.AvailableObjects.Num() >= PoolInstance.TypeConfig.SpawnSettings.MaxPoolSize) // 다시 한번 최대 크기 체크
+        if (PoolInstance.FreeSlots.Num() >= DesiredAvailable) // 다시 한번 최대 크기 체크
         {
             PoolInstance.CurrentSpawnDelayFrames = PoolInstance.TypeConfig.SpawnSettings.SpawnDelayInFramesAfterReachingMax;
-            return;
+            return true;
         }
 
-        UObject* NewObj = RetrieveOrCreateObjectForPool(PoolInstance);
-        if (NewObj)
+        // 프레임당 최소 한 개는 생성해서 예산이 작아도 프리웜이 진행되도록
+        if (bInOutSpawnedThisFrame && FPlatformTime::Seconds() >= BudgetEndTime)
         {
-            ReturnObjectToPool(NewObj); // 생성 후 바로 풀에 반환 (비활성 상태로)
+            return false;
         }
-        else
+
+        const int32 SlotIndex = SpawnIntoSlot(PoolInstance, PoolIndex);
+        if (SlotIndex == INDEX_NONE)
         {
             // 오브젝트 생성 실패 시 더 이상 시도하지 않음 (혹은 로그만 남기고 계속)
-            return;
+            return true;
         }
+
+        PoolInstance.FreeSlots.Push(SlotIndex); // 생성 후 바로 대기 상태로
+        bInOutSpawnedThisFrame = true;
+    }
+
+    return true;
+}
+
+void UObjectPoolComponent::UpdatePoolShrink(FObjectPoolInstance& PoolInstance, float DeltaTime)
+{
+    const FPooledObjectSpawnSettings& Settings = PoolInstance.TypeConfig.SpawnSettings;
+    if (!Settings.bAutoShrink)
+    {
+        return;
+    }
+
+    PoolInstance.ShrinkElapsedSeconds += DeltaTime;
+    if (PoolInstance.ShrinkElapsedSeconds < Settings.ShrinkIntervalSeconds)
+    {
+        return;
+    }
+    PoolInstance.ShrinkElapsedSeconds = 0.0f;
+
+    // 지난 구간에 동시에 사용된 최대 수만큼만 유지, 그 이상 필요해지면 Miss로 생성되고 다음 구간에 목표가 올라감
+    PoolInstance.TargetCapacity = FMath::Clamp(PoolInstance.Stats.HighWaterMark, FMath::Min(Settings.MinPoolSize, Settings.MaxPoolSize), Settings.MaxPoolSize);
+    PoolInstance.Stats.HighWaterMark = PoolInstance.Stats.InUse;
+
+    const int32 NumBefore = PoolInstance.FreeSlots.Num();
+    TrimPool(PoolInstance, PoolInstance.GetDesiredAvailableCount());
+
+    const int32 NumTrimmed = NumBefore - PoolInstance.FreeSlots.Num();
+    if (NumTrimmed > 0)
+    {
+        PoolInstance.Stats.Trimmed += NumTrimmed;
+        INC_DWORD_STAT_BY(STAT_ObjectPool_Trimmed, NumTrimmed);
+    }
+}
+
+void UObjectPoolComponent::TrimPool(FObjectPoolInstance& PoolInstance, int32 NumToKeep)
+{
+    const int32 NumToTrim = PoolInstance.FreeSlots.Num() - FMath::Max(NumToKeep, 0);
+    if (NumToTrim <= 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_ObjectPool_Trim);
+
+    // 스택 바닥이 가장 오래 쓰이지 않은 오브젝트
+    for (int32 i = 0; i < NumToTrim; ++i)
+    {
+        DestroySlotObject(PoolInstance, PoolInstance.FreeSlots[i]);
     }
+    PoolInstance.FreeSlots.RemoveAt(0, NumToTrim, EAllowShrinking::No);
 }
 
 void UObjectPoolComponent::AddOrUpdatePoolConfiguration(const FPooledObjectTypeConfig& NewConfig)
@@ -475,17 +661,265 @@ void UObjectPoolComponent::AddOrUpdatePoolConfiguration(const FPooledObjectTypeC
     {
         ExistingPool = FindPoolInstanceByMaterial(NewConfig.BaseMaterialInterface);
     }
+    else
+    {
+        return;
+    }
 
     if (ExistingPool)
     {
         // 기존 풀 설정 업데이트 (예: MaxPoolSize 변경 시 처리 등)
         ExistingPool->TypeConfig = NewConfig;
-        ExistingPool->AvailableObjects.Reserve(NewConfig.SpawnSettings.MaxPoolSize);
+        ExistingPool->TargetCapacity = NewConfig.SpawnSettings.MaxPoolSize;
+        ExistingPool->FreeSlots.Reserve(NewConfig.SpawnSettings.MaxPoolSize);
+    }
+    else
+    {
+        const int32 PoolIndex = PoolInstances.Emplace(NewConfig); // 새 풀 인스턴스 생성 및 추가
+        if (IsValid(NewConfig.ObjectClassToPool))
+        {
+            PoolIndexByClass.Add(NewConfig.ObjectClassToPool.Get(), PoolIndex);
+        }
+        else
+        {
+            PoolIndexByMaterial.Add(NewConfig.BaseMaterialInterface.Get(), PoolIndex);
+        }
+    }
+}
+
+int32 UObjectPoolComponent::SpawnIntoSlot(FObjectPoolInstance& PoolInstance, int32 PoolIndex)
+{
+    UObject* NewObject = RetrieveOrCreateObjectForPool(PoolInstance);
+    if (!NewObject)
+    {
+        return INDEX_NONE;
+    }
+
+    // 파괴된 슬롯이 있으면 재사용 (세대는 파괴 시 이미 증가)
+    int32 SlotIndex;
+    if (PoolInstance.VacantSlots.Num() > 0)
+    {
+        SlotIndex = PoolInstance.VacantSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        SlotIndex = PoolInstance.Slots.AddDefaulted();
+    }
+
+    FPooledObjectSlot& Slot = PoolInstance.Slots[SlotIndex];
+    Slot.Object = NewObject;
+    Slot.bCheckedOut = false;
+    Slot.LastReturnTime = FPlatformTime::Seconds();
+
+    PooledObjectLocations.Add(NewObject, { PoolIndex, SlotIndex });
+    TrackPooledActor(NewObject);
+
+    PoolInstance.Stats.Spawned++;
+    INC_DWORD_STAT(STAT_ObjectPool_Spawns);
+
+    return SlotIndex;
+}
+
+UObject* UObjectPoolComponent::CheckoutFromPool(int32 PoolIndex, FPooledObjectHandle* OutHandle)
+{
+    FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
+
+    // LIFO: 가장 최근에 반환된 (캐시에 남아 있을 가능성이 높은) 오브젝트부터
+    int32 SlotIndex = INDEX_NONE;
+    while (PoolInstance.FreeSlots.Num() > 0)
+    {
+        const int32 CandidateIndex = PoolInstance.FreeSlots.Pop(EAllowShrinking::No);
+        if (IsValid(PoolInstance.Slots[CandidateIndex].Object))
+        {
+            SlotIndex = CandidateIndex;
+            break;
+        }
+
+        // 레벨 언로드 등으로 외부에서 파괴된 오브젝트
+        DestroySlotObject(PoolInstance, CandidateIndex);
+    }
+
+    if (SlotIndex != INDEX_NONE)
+    {
+        PoolInstance.Stats.Hits++;
+        INC_DWORD_STAT(STAT_ObjectPool_Hits);
     }
     else
     {
-        PoolInstances.Emplace(NewConfig); // 새 풀 인스턴스 생성 및 추가
+        PoolInstance.Stats.Misses++;
+        INC_DWORD_STAT(STAT_ObjectPool_Misses);
+
+        SlotIndex = SpawnIntoSlot(PoolInstance, PoolIndex);
+        if (SlotIndex == INDEX_NONE)
+        {
+            return nullptr;
+        }
+    }
+
+    FPooledObjectSlot& Slot = PoolInstance.Slots[SlotIndex];
+    Slot.bCheckedOut = true;
+
+    PoolInstance.Stats.InUse++;
+    PoolInstance.Stats.HighWaterMark = FMath::Max(PoolInstance.Stats.HighWaterMark, PoolInstance.Stats.InUse);
+
+    if (OutHandle)
+    {
+        OutHandle->PoolIndex = PoolIndex;
+        OutHandle->SlotIndex = SlotIndex;
+        OutHandle->Generation = Slot.Generation;
+    }
+
+    return Slot.Object;
+}
+
+bool UObjectPoolComponent::ReturnSlot(int32 PoolIndex, int32 SlotIndex)
+{
+    FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
+    FPooledObjectSlot& Slot = PoolInstance.Slots[SlotIndex];
+
+    if (!Slot.bCheckedOut)
+    {
+        PoolInstance.Stats.InvalidReturns++;
+        INC_DWORD_STAT(STAT_ObjectPool_InvalidReturns);
+        UE_LOG(LogTemp, Warning, TEXT("ObjectPool: %s was returned to the pool twice"), *GetNameSafe(Slot.Object));
+        return false;
+    }
+
+    DeactivatePooledObject(Slot.Object);
+
+    // 최대 크기만큼 이미 대기 중이면 보관하지 않고 파괴 (DestroySlotObject가 세대와 InUse를 처리)
+    if (PoolInstance.FreeSlots.Num() >= PoolInstance.TypeConfig.SpawnSettings.MaxPoolSize)
+    {
+        DestroySlotObject(PoolInstance, SlotIndex);
+        PoolInstance.Stats.Trimmed++;
+        INC_DWORD_STAT(STAT_ObjectPool_Trimmed);
+        return true;
+    }
+
+    // 세대를 올려서 이번 대여의 핸들을 무효화
+    Slot.bCheckedOut = false;
+    Slot.Generation++;
+    Slot.LastReturnTime = FPlatformTime::Seconds();
+    PoolInstance.Stats.InUse--;
+    PoolInstance.FreeSlots.Push(SlotIndex);
+
+    return true;
+}
+
+void UObjectPoolComponent::AdoptObject(int32 PoolIndex, UObject* Object)
+{
+    FObjectPoolInstance& PoolInstance = PoolInstances[PoolIndex];
+
+    DeactivatePooledObject(Object);
+
+    // ReturnSlot과 같은 정책: 최대 크기만큼 이미 대기 중이면 보관하지 않고 파괴
+    if (PoolInstance.FreeSlots.Num() >= PoolInstance.TypeConfig.SpawnSettings.MaxPoolSize)
+    {
+        DestroyPooledObject(Object);
+        PoolInstance.Stats.Trimmed++;
+        INC_DWORD_STAT(STAT_ObjectPool_Trimmed);
+        return;
+    }
+
+    int32 SlotIndex;
+    if (PoolInstance.VacantSlots.Num() > 0)
+    {
+        SlotIndex = PoolInstance.VacantSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        SlotIndex = PoolInstance.Slots.AddDefaulted();
+    }
+
+    FPooledObjectSlot& Slot = PoolInstance.Slots[SlotIndex];
+    Slot.Object = Object;
+    Slot.bCheckedOut = false;
+    Slot.LastReturnTime = FPlatformTime::Seconds();
+
+    PooledObjectLocations.Add(Object, { PoolIndex, SlotIndex });
+    TrackPooledActor(Object);
+    PoolInstance.FreeSlots.Push(SlotIndex);
+}
+
+void UObjectPoolComponent::TrackPooledActor(UObject* Object)
+{
+    // 외부 Destroy와 서브레벨 언로드 모두 EndPlay를 거침
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        Actor->OnEndPlay.AddUniqueDynamic(this, &UObjectPoolComponent::HandlePooledActorEndPlay);
+    }
+}
+
+void UObjectPoolComponent::HandlePooledActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    // 풀이 직접 파괴한 액터는 위치 정보가 이미 제거됨
+    FPooledObjectLocation Location;
+    if (!PooledObjectLocations.RemoveAndCopyValue(Actor, Location) || !PoolInstances.IsValidIndex(Location.PoolIndex))
+    {
+        return;
+    }
+
+    FObjectPoolInstance& PoolInstance = PoolInstances[Location.PoolIndex];
+    FPooledObjectSlot& Slot = PoolInstance.Slots[Location.SlotIndex];
+    if (!Slot.bCheckedOut)
+    {
+        // LRU 순서가 유지되도록 순서를 지켜서 제거
+        PoolInstance.FreeSlots.RemoveSingle(Location.SlotIndex);
+    }
+
+    // 오브젝트는 이미 사라지는 중이므로 파괴하지 않고 슬롯만 비움 (대여 중이었으면 InUse도 감소)
+    Slot.Object = nullptr;
+    DestroySlotObject(PoolInstance, Location.SlotIndex);
+}
+
+void UObjectPoolComponent::DeactivatePooledObject(UObject* Object)
+{
+    if (AActor* ActorToReturn = Cast<AActor>(Object))
+    {
+        ManageActorState(ActorToReturn, false);
+    }
+    else if (UActorComponent* ComponentToReturn = Cast<UActorComponent>(Object))
+    {
+        ManageComponentState(ComponentToReturn, false);
     }
+    else if (UUserWidget* WidgetToReturn = Cast<UUserWidget>(Object))
+    {
+        ManageWidgetState(WidgetToReturn, false);
+    }
+    // Material Instance Dynamic은 특별한 비활성화 로직이 없을 수 있음.
+}
+
+void UObjectPoolComponent::DestroySlotObject(FObjectPoolInstance& PoolInstance, int32 SlotIndex)
+{
+    FPooledObjectSlot& Slot = PoolInstance.Slots[SlotIndex];
+    if (Slot.Object)
+    {
+        PooledObjectLocations.Remove(Slot.Object.Get());
+        DestroyPooledObject(Slot.Object);
+    }
+
+    if (Slot.bCheckedOut)
+    {
+        PoolInstance.Stats.InUse--;
+    }
+
+    Slot.Object = nullptr;
+    Slot.bCheckedOut = false;
+    Slot.Generation++;
+    PoolInstance.VacantSlots.Push(SlotIndex);
+}
+
+void UObjectPoolComponent::DestroyPooledObject(UObject* Object)
+{
+    if (!IsValid(Object))
+    {
+        return;
+    }
+
+    if (AActor* ActorToDestroy = Cast<AActor>(Object)) ActorToDestroy->Destroy();
+    else if (UActorComponent* CompToDestroy = Cast<UActorComponent>(Object)) CompToDestroy->DestroyComponent();
+    else if (UUserWidget* WidgetToDestroy = Cast<UUserWidget>(Object)) WidgetToDestroy->RemoveFromParent();
+    // MaterialInstanceDynamic, 일반 UObject는 참조만 제거하면 GC가 정리
 }
 
 
@@ -563,10 +997,6 @@ UObject* UObjectPoolComponent::RetrieveOrCreateObjectForPool(FObjectPoolInstance
         if (PoolInstance.TypeConfig.BaseMaterialInterface)
         {
             NewPooledObject = UMaterialInstanceDynamic::Create(PoolInstance.TypeConfig.BaseMaterialInterface, this);
-            if (UMaterialInstanceDynamic* NewMID = Cast<UMaterialInstanceDynamic>(NewPooledObject))
-            {
-                MaterialToBaseMap.Add(NewMID, PoolInstance.TypeConfig.BaseMaterialInterface);
-            }
         }
         else
         {
@@ -637,74 +1067,44 @@ UObject* UObjectPoolComponent::RetrieveOrCreateObjectForPool(FObjectPoolInstance
     return NewPooledObject;
 }
 
-FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByClass(UClass* ObjectClass)
+int32 UObjectPoolComponent::FindPoolIndexByClass(const UClass* ObjectClass) const
 {
-    if (!ObjectClass) return nullptr;
+    if (!ObjectClass) return INDEX_NONE;
 
-    // 캐시된 인덱스 우선 확인
-    if (PoolInstances.IsValidIndex(LastFoundPoolIndex) &&
-        PoolInstances[LastFoundPoolIndex].TypeConfig.ObjectClassToPool == ObjectClass)
-    {
-        return &PoolInstances[LastFoundPoolIndex];
-    }
+    const int32* PoolIndex = PoolIndexByClass.Find(ObjectClass);
+    return PoolIndex ? *PoolIndex : INDEX_NONE;
+}
 
-    for (int32 i = 0; i < PoolInstances.Num(); ++i)
-    {
-        if (PoolInstances[i].TypeConfig.ObjectClassToPool == ObjectClass)
-        {
-            LastFoundPoolIndex = i;
-            return &PoolInstances[i];
-        }
-    }
-    return nullptr;
+int32 UObjectPoolComponent::FindPoolIndexByMaterial(const UMaterialInterface* BaseMaterial) const
+{
+    if (!BaseMaterial) return INDEX_NONE;
+
+    const int32* PoolIndex = PoolIndexByMaterial.Find(BaseMaterial);
+    return PoolIndex ? *PoolIndex : INDEX_NONE;
 }
-const FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByClass(UClass* ObjectClass) const
+
+FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByClass(UClass* ObjectClass)
 {
-    // const 버전은 mutable LastFoundPoolIndex를 업데이트하지 않음
-     if (!ObjectClass) return nullptr;
-    for (int32 i = 0; i < PoolInstances.Num(); ++i)
-    {
-        if (PoolInstances[i].TypeConfig.ObjectClassToPool == ObjectClass)
-        {
-            return &PoolInstances[i];
-        }
-    }
-    return nullptr;
+    const int32 PoolIndex = FindPoolIndexByClass(ObjectClass);
+    return PoolIndex != INDEX_NONE ? &PoolInstances[PoolIndex] : nullptr;
 }
 
+const FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByClass(UClass* ObjectClass) const
+{
+    const int32 PoolIndex = FindPoolIndexByClass(ObjectClass);
+    return PoolIndex != INDEX_NONE ? &PoolInstances[PoolIndex] : nullptr;
+}
 
 FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByMaterial(UMaterialInterface* BaseMaterial)
 {
-    if (!BaseMaterial) return nullptr;
-
-    if (PoolInstances.IsValidIndex(LastFoundPoolIndex) &&
-        PoolInstances[LastFoundPoolIndex].TypeConfig.BaseMaterialInterface == BaseMaterial)
-    {
-        return &PoolInstances[LastFoundPoolIndex];
-    }
-
-    for (int32 i = 0; i < PoolInstances.Num(); ++i)
-    {
-        if (PoolInstances[i].TypeConfig.BaseMaterialInterface == BaseMaterial)
-        {
-            LastFoundPoolIndex = i;
-            return &PoolInstances[i];
-        }
-    }
-    return nullptr;
+    const int32 PoolIndex = FindPoolIndexByMaterial(BaseMaterial);
+    return PoolIndex != INDEX_NONE ? &PoolInstances[PoolIndex] : nullptr;
 }
 
 const FObjectPoolInstance* UObjectPoolComponent::FindPoolInstanceByMaterial(UMaterialInterface* BaseMaterial) const
 {
-     if (!BaseMaterial) return nullptr;
-    for (int32 i = 0; i < PoolInstances.Num(); ++i)
-    {
-        if (PoolInstances[i].TypeConfig.BaseMaterialInterface == BaseMaterial)
-        {
-            return &PoolInstances[i];
-        }
-    }
-    return nullptr;
+    const int32 PoolIndex = FindPoolIndexByMaterial(BaseMaterial);
+    return PoolIndex != INDEX_NONE ? &PoolInstances[PoolIndex] : nullptr;
 }
 
 
@@ -717,9 +1117,19 @@ void UObjectPoolComponent::ManageActorState(AActor* Actor, bool bActivate)
         Actor->SetActorHiddenInGame(false);
         Actor->SetActorTickEnabled(true); // 필요에 따라 Tick 활성화
         Actor->SetActorEnableCollision(true); // 필요한 경우 Collision 활성화
+
+        if (Actor->Implements<UPoolableInterface>())
+        {
+            IPoolableInterface::Execute_OnAcquiredFromPool(Actor);
+        }
     }
     else
     {
+        if (Actor->Implements<UPoolableInterface>())
+        {
+            IPoolableInterface::Execute_OnReturnedToPool(Actor);
+        }
+
         Actor->SetActorHiddenInGame(true);
         Actor->SetActorTickEnabled(false);
         Actor->SetActorEnableCollision(false); // Collision 비활성화
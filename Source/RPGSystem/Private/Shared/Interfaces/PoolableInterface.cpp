@@ -0,0 +1,6 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Shared/Interfaces/PoolableInterface.h"
+
+// Add default functionality here for any IPoolableInterface functions that are not pure virtual.
@@ -0,0 +1,354 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Shared/RPGBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace RPGBenchmark
+{
+	// 너무 짧은 단계는 오차가 커서 시간 비교에서 제외
+	constexpr double MinComparedMs = 0.5;
+
+	static FString GetBaselineDir()
+	{
+		FString BaselineDir = FPaths::ProjectDir() / TEXT("Build/Benchmarks");
+		FParse::Value(FCommandLine::Get(), TEXT("RPGBenchmarkBaseline="), BaselineDir);
+		return BaselineDir;
+	}
+
+	static float GetTolerancePercent()
+	{
+		float TolerancePercent = 20.f;
+		FParse::Value(FCommandLine::Get(), TEXT("RPGBenchmarkTolerance="), TolerancePercent);
+		return FMath::Max(0.f, TolerancePercent);
+	}
+
+	static FString EscapeJSON(const FString& Value)
+	{
+		return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+}
+
+/**
+ * FRPGBenchmarkReport
+ */
+
+FRPGBenchmarkReport::FRPGBenchmarkReport(const FString& InName)
+	: Name(InName)
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	BaseUsedMemory = MemoryStats.UsedPhysical;
+	BasePeakMemory = MemoryStats.PeakUsedPhysical;
+	PeakUsedMemory = BaseUsedMemory;
+}
+
+int32 FRPGBenchmarkReport::GetParameter(const FString& Key, const int32 DefaultValue)
+{
+	int32 Value = DefaultValue;
+	FParse::Value(FCommandLine::Get(), *(Key + TEXT("=")), Value);
+	Value = FMath::Max(0, Value);
+
+	bCustomParameters |= Value != DefaultValue;
+	Parameters.Emplace(Key, Value);
+	return Value;
+}
+
+double FRPGBenchmarkReport::Measure(const FString& StageName, TFunctionRef<int64()> StageFunction)
+{
+	const double Start = FPlatformTime::Seconds();
+	const int64 Bytes = StageFunction();
+	const double Milliseconds = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	AddStage(StageName, Milliseconds, Bytes);
+	return Milliseconds;
+}
+
+void FRPGBenchmarkReport::AddStage(const FString& StageName, const double Milliseconds, const int64 Bytes)
+{
+	FRPGBenchmarkStage& Stage = Stages.AddDefaulted_GetRef();
+	Stage.Name = StageName;
+	Stage.Milliseconds = Milliseconds;
+	Stage.Bytes = Bytes;
+
+	SampleMemory();
+}
+
+void FRPGBenchmarkReport::SampleMemory()
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	PeakUsedMemory = FMath::Max<uint64>(PeakUsedMemory, MemoryStats.UsedPhysical);
+
+	// 프로세스 최대값이 생성 이후 늘었다면 그 값은 이 리포트 도중의 최대값
+	if (MemoryStats.PeakUsedPhysical > BasePeakMemory)
+	{
+		PeakUsedMemory = FMath::Max<uint64>(PeakUsedMemory, MemoryStats.PeakUsedPhysical);
+	}
+}
+
+int64 FRPGBenchmarkReport::GetPeakMemoryBytes() const
+{
+	return PeakUsedMemory > BaseUsedMemory ? static_cast<int64>(PeakUsedMemory - BaseUsedMemory) : 0;
+}
+
+const FRPGBenchmarkStage* FRPGBenchmarkReport::FindStage(const FString& StageName) const
+{
+	return Stages.FindByPredicate([&StageName](const FRPGBenchmarkStage& Stage)
+	{
+		return Stage.Name == StageName;
+	});
+}
+
+TArray<FRPGBenchmarkStage> FRPGBenchmarkReport::GetResultStages() const
+{
+	TArray<FRPGBenchmarkStage> ResultStages = Stages;
+
+	FRPGBenchmarkStage& PeakMemory = ResultStages.AddDefaulted_GetRef();
+	PeakMemory.Name = TEXT("PeakMemory");
+	PeakMemory.Bytes = GetPeakMemoryBytes();
+
+	return ResultStages;
+}
+
+FString FRPGBenchmarkReport::ToCSV() const
+{
+	FString CSV = TEXT("Stage,Ms,Bytes\n");
+
+	for (const FRPGBenchmarkStage& Stage : GetResultStages())
+	{
+		CSV += FString::Printf(TEXT("%s,%.3f,%lld\n"), *Stage.Name, Stage.Milliseconds, Stage.Bytes);
+	}
+
+	return CSV;
+}
+
+FString FRPGBenchmarkReport::ToJSON() const
+{
+	// 단계 이름은 식별자 수준이라 Json 모듈 없이 직접 기록
+	FString JSON = FString::Printf(TEXT("{\n\t\"Name\": \"%s\",\n\t\"Parameters\": {"), *RPGBenchmark::EscapeJSON(Name));
+
+	for (int32 Index = 0; Index < Parameters.Num(); ++Index)
+	{
+		JSON += FString::Printf(TEXT("%s\n\t\t\"%s\": %d"), Index > 0 ? TEXT(",") : TEXT(""), *RPGBenchmark::EscapeJSON(Parameters[Index].Key), Parameters[Index].Value);
+	}
+
+	JSON += Parameters.IsEmpty() ? TEXT("},\n\t\"Stages\": [") : TEXT("\n\t},\n\t\"Stages\": [");
+
+	const TArray<FRPGBenchmarkStage> ResultStages = GetResultStages();
+	for (int32 Index = 0; Index < ResultStages.Num(); ++Index)
+	{
+		const FRPGBenchmarkStage& Stage = ResultStages[Index];
+		JSON += FString::Printf(TEXT("%s\n\t\t{ \"Name\": \"%s\", \"Ms\": %.3f, \"Bytes\": %lld }"),
+			Index > 0 ? TEXT(",") : TEXT(""), *RPGBenchmark::EscapeJSON(Stage.Name), Stage.Milliseconds, Stage.Bytes);
+	}
+
+	JSON += TEXT("\n\t]\n}\n");
+	return JSON;
+}
+
+bool FRPGBenchmarkReport::Submit(FAutomationTestBase& Test) const
+{
+	for (const TPair<FString, int32>& Parameter : Parameters)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s | -%s=%d"), *Name, *Parameter.Key, Parameter.Value));
+	}
+
+	for (const FRPGBenchmarkStage& Stage : GetResultStages())
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s | %-28s %10.3f ms %12lld"), *Name, *Stage.Name, Stage.Milliseconds, Stage.Bytes));
+	}
+
+	const FString ResultFile = FPaths::ProfilingDir() / TEXT("RPGBenchmark") / FString::Printf(TEXT("%s-%s"), *Name, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	const auto WriteResult = [this, &Test](const FString& File, const FString& Contents)
+	{
+		if (FFileHelper::SaveStringToFile(Contents, *File))
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s | Results written to %s"), *Name, *File));
+		}
+		else
+		{
+			Test.AddWarning(FString::Printf(TEXT("%s | Failed to write %s"), *Name, *File));
+		}
+	};
+
+	WriteResult(ResultFile + TEXT(".csv"), ToCSV());
+	WriteResult(ResultFile + TEXT(".json"), ToJSON());
+
+	// 기준은 기본 실행 조건에서 기록한 결과
+	if (bCustomParameters)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s | Parameters differ from the defaults, comparison skipped"), *Name));
+		return true;
+	}
+
+	// 기준이 없으면 이번 결과를 기준으로 복사해 쓰면 됨
+	const FString BaselineFile = RPGBenchmark::GetBaselineDir() / (Name + TEXT(".csv"));
+	if (!FPaths::FileExists(BaselineFile))
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s | No baseline at %s, comparison skipped"), *Name, *BaselineFile));
+		return true;
+	}
+
+	TArray<FString> Regressions;
+	if (CompareToBaseline(BaselineFile, RPGBenchmark::GetTolerancePercent(), Regressions))
+	{
+		return true;
+	}
+
+	for (const FString& Regression : Regressions)
+	{
+		Test.AddError(FString::Printf(TEXT("%s | Regression: %s"), *Name, *Regression));
+	}
+
+	return false;
+}
+
+bool FRPGBenchmarkReport::CompareToBaseline(const FString& BaselineFile, const float TolerancePercent, TArray<FString>& OutRegressions) const
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *BaselineFile))
+	{
+		OutRegressions.Add(FString::Printf(TEXT("Baseline could not be read: %s"), *BaselineFile));
+		return false;
+	}
+
+	const double Factor = 1.0 + TolerancePercent / 100.0;
+	const TArray<FRPGBenchmarkStage> ResultStages = GetResultStages();
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		TArray<FString> Columns;
+		Lines[LineIndex].ParseIntoArray(Columns, TEXT(","));
+
+		if (Columns.Num() < 3)
+		{
+			continue;
+		}
+
+		const FRPGBenchmarkStage* Stage = ResultStages.FindByPredicate([&Columns](const FRPGBenchmarkStage& ResultStage)
+		{
+			return ResultStage.Name == Columns[0];
+		});
+
+		if (!Stage)
+		{
+			continue;
+		}
+
+		const double BaseMs = FCString::Atod(*Columns[1]);
+		const int64 BaseBytes = FCString::Atoi64(*Columns[2]);
+
+		if (BaseMs >= RPGBenchmark::MinComparedMs && Stage->Milliseconds > BaseMs * Factor)
+		{
+			OutRegressions.Add(FString::Printf(TEXT("%s: %.2f ms (baseline %.2f ms)"), *Stage->Name, Stage->Milliseconds, BaseMs));
+		}
+
+		if (BaseBytes > 0 && Stage->Bytes > BaseBytes * Factor)
+		{
+			OutRegressions.Add(FString::Printf(TEXT("%s: %lld (baseline %lld)"), *Stage->Name, Stage->Bytes, BaseBytes));
+		}
+	}
+
+	return OutRegressions.IsEmpty();
+}
+
+/**
+ * FRPGBenchmarkWorld
+ */
+
+FRPGBenchmarkWorld::FRPGBenchmarkWorld(TSubclassOf<AGameModeBase> GameModeClass)
+{
+	if (!GameModeClass)
+	{
+		GameModeClass = AGameModeBase::StaticClass();
+	}
+
+	// 게임 인스턴스 서브시스템(세이브, 풀링 등)이 초기화된 게임 월드
+	GameInstance.Reset(NewObject<UGameInstance>(GEngine));
+	GameInstance->InitializeStandalone();
+
+	World = GameInstance->GetWorld();
+	check(World);
+
+	FURL URL;
+	URL.AddOption(*FString::Printf(TEXT("game=%s"), *GameModeClass->GetPathName()));
+
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+}
+
+FRPGBenchmarkWorld::~FRPGBenchmarkWorld()
+{
+	if (GameInstance)
+	{
+		GameInstance->Shutdown();
+	}
+
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+	}
+
+	GameInstance.Reset();
+}
+
+APlayerController* FRPGBenchmarkWorld::SpawnPlayer(TSubclassOf<APawn> PawnClass, const FTransform& SpawnTransform, TSubclassOf<APlayerController> ControllerClass) const
+{
+	if (!World || !PawnClass)
+	{
+		return nullptr;
+	}
+
+	if (!ControllerClass)
+	{
+		ControllerClass = APlayerController::StaticClass();
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// 컨트롤러는 스폰 시 월드의 플레이어 컨트롤러 목록에 등록되고 카메라 매니저/플레이어 스테이트를 만듦
+	APlayerController* PlayerController = World->SpawnActor<APlayerController>(ControllerClass, SpawnTransform, SpawnParams);
+	APawn* Pawn = World->SpawnActor<APawn>(PawnClass, SpawnTransform, SpawnParams);
+
+	if (!PlayerController || !Pawn)
+	{
+		if (PlayerController)
+		{
+			PlayerController->Destroy();
+		}
+
+		if (Pawn)
+		{
+			Pawn->Destroy();
+		}
+
+		return nullptr;
+	}
+
+	PlayerController->Possess(Pawn);
+	return PlayerController;
+}
+
+void FRPGBenchmarkWorld::Tick(const float DeltaSeconds) const
+{
+	if (World)
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+}
+
+#endif
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Shared/RPGQueryStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(RPGSYSTEM_API, RPGQuery, true);
+
+UE_TRACE_CHANNEL_DEFINE(RPGQueryChannel);
+
+FRPGQueryCounters FRPGQueryStats::Counters[static_cast<int32>(ERPGQuerySource::Num)];
+
+void FRPGQueryStats::AddQueries(ERPGQuerySource Source, int32 NumQueries, int32 NumHits)
+{
+	FRPGQueryCounters& SourceCounters = Counters[static_cast<int32>(Source)];
+	SourceCounters.Queries += NumQueries;
+	SourceCounters.Hits += NumHits;
+
+	switch (Source)
+	{
+	case ERPGQuerySource::HitBox:
+		INC_DWORD_STAT_BY(STAT_RPGQuery_HitBoxTraces, NumQueries);
+		INC_DWORD_STAT_BY(STAT_RPGQuery_HitBoxHits, NumHits);
+		CSV_CUSTOM_STAT(RPGQuery, HitBoxTraces, NumQueries, ECsvCustomStatOp::Accumulate);
+		CSV_CUSTOM_STAT(RPGQuery, HitBoxHits, NumHits, ECsvCustomStatOp::Accumulate);
+		break;
+	case ERPGQuerySource::Interaction:
+		INC_DWORD_STAT_BY(STAT_RPGQuery_InteractionTraces, NumQueries);
+		INC_DWORD_STAT_BY(STAT_RPGQuery_InteractionHits, NumHits);
+		CSV_CUSTOM_STAT(RPGQuery, InteractionTraces, NumQueries, ECsvCustomStatOp::Accumulate);
+		CSV_CUSTOM_STAT(RPGQuery, InteractionHits, NumHits, ECsvCustomStatOp::Accumulate);
+		break;
+	case ERPGQuerySource::CameraDither:
+		INC_DWORD_STAT_BY(STAT_RPGQuery_CameraDitherTraces, NumQueries);
+		INC_DWORD_STAT_BY(STAT_RPGQuery_CameraDitherHits, NumHits);
+		CSV_CUSTOM_STAT(RPGQuery, CameraDitherOverlaps, NumQueries, ECsvCustomStatOp::Accumulate);
+		CSV_CUSTOM_STAT(RPGQuery, CameraDitherHits, NumHits, ECsvCustomStatOp::Accumulate);
+		break;
+	default:
+		break;
+	}
+}
+
+void FRPGQueryStats::AddDedupRejections(ERPGQuerySource Source, int32 NumRejections)
+{
+	Counters[static_cast<int32>(Source)].DedupRejections += NumRejections;
+
+	switch (Source)
+	{
+	case ERPGQuerySource::HitBox:
+		INC_DWORD_STAT_BY(STAT_RPGQuery_HitBoxDedup, NumRejections);
+		CSV_CUSTOM_STAT(RPGQuery, HitBoxDedupRejections, NumRejections, ECsvCustomStatOp::Accumulate);
+		break;
+	case ERPGQuerySource::CameraDither:
+		INC_DWORD_STAT_BY(STAT_RPGQuery_CameraDitherDedup, NumRejections);
+		CSV_CUSTOM_STAT(RPGQuery, CameraDitherDedupRejections, NumRejections, ECsvCustomStatOp::Accumulate);
+		break;
+	default:
+		break;
+	}
+}
+
+void FRPGQueryStats::AddTime(ERPGQuerySource Source, double Seconds)
+{
+	Counters[static_cast<int32>(Source)].Seconds += Seconds;
+}
+
+const FRPGQueryCounters& FRPGQueryStats::Get(ERPGQuerySource Source)
+{
+	return Counters[static_cast<int32>(Source)];
+}
+
+const TCHAR* FRPGQueryStats::GetSourceName(ERPGQuerySource Source)
+{
+	switch (Source)
+	{
+	case ERPGQuerySource::HitBox:
+		return TEXT("HitBox");
+	case ERPGQuerySource::Interaction:
+		return TEXT("Interaction");
+	case ERPGQuerySource::CameraDither:
+		return TEXT("CameraDither");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+void FRPGQueryStats::Reset()
+{
+	for (FRPGQueryCounters& SourceCounters : Counters)
+	{
+		SourceCounters = FRPGQueryCounters();
+	}
+}
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Shared/RPGTestItems.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Item/Data/ItemDefinition.h"
+#include "UObject/Package.h"
+
+TArray<TStrongObjectPtr<UItemDefinition>> RPGTestItems::CreateItemDefinitions()
+{
+	TArray<TStrongObjectPtr<UItemDefinition>> ItemDefs;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		UItemDefinition* ItemDef = NewObject<UItemDefinition>(GetTransientPackage());
+		ItemDef->bStackable = i < 3;
+		ItemDef->MaxStackSize = ItemDef->bStackable ? 5 + i * 10 : 1;
+		ItemDef->Weight = 0.5f + i;
+		ItemDefs.Emplace(ItemDef);
+	}
+	return ItemDefs;
+}
+
+#endif
@@ -0,0 +1,370 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Shared/Subsystems/ObjectPoolSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<int32> CVarPoolMaxIdleObjects(
+    TEXT("RPGPool.MaxIdleObjects"),
+    512,
+    TEXT("Maximum number of idle objects kept across all shared pools. The least recently used ones are destroyed above this."));
+
+static TAutoConsoleVariable<int32> CVarPoolLowMemoryMB(
+    TEXT("RPGPool.LowMemoryMB"),
+    512,
+    TEXT("When available physical memory drops below this, shared pools drop their least recently used idle objects. 0 disables the check."));
+
+static TAutoConsoleVariable<float> CVarPoolMemoryCheckInterval(
+    TEXT("RPGPool.MemoryCheckInterval"),
+    1.0f,
+    TEXT("Seconds between available memory checks of the shared pools."));
+
+namespace ObjectPoolSubsystem
+{
+    // 메모리가 부족할 때 한 번에 파괴할 대기 오브젝트 비율
+    constexpr float LowMemoryTrimFraction = 0.5f;
+}
+
+UObjectPoolSubsystem::UObjectPoolSubsystem()
+{
+    // 공용 풀은 쓰이는 만큼만 자라고, 자주 쓰는 클래스는 RegisterPool로 프리웜
+    DefaultSpawnSettings.MaxPoolSize = 32;
+    DefaultSpawnSettings.NumToSpawnPerFrame = 0;
+}
+
+void UObjectPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UObjectPoolSubsystem::HandleLevelRemovedFromWorld);
+    MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddUObject(this, &UObjectPoolSubsystem::HandleMemoryTrim);
+}
+
+void UObjectPoolSubsystem::Deinitialize()
+{
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+
+    // 호스트 액터는 월드와 함께 정리됨 (EndPlay에서 대기 오브젝트 파괴)
+    ContextLevels.Empty();
+    PoolComponent = nullptr;
+    PoolHostActor = nullptr;
+
+    Super::Deinitialize();
+}
+
+void UObjectPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+    GetOrCreatePoolComponent();
+}
+
+TStatId UObjectPoolSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UObjectPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UObjectPoolSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // 프리웜과 구간별 축소는 풀 컴포넌트가 자체 Tick에서 처리
+    UpdateMemoryPressure(DeltaTime);
+}
+
+bool UObjectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UObjectPoolSubsystem* UObjectPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr;
+}
+
+bool UObjectPoolSubsystem::ReleaseToPool(AActor* Actor)
+{
+    UObjectPoolSubsystem* Subsystem = Get(Actor);
+    return Subsystem && Subsystem->ReleaseActor(Actor);
+}
+
+// --- 풀 설정 ---
+
+void UObjectPoolSubsystem::RegisterPool(const FPooledObjectTypeConfig& Config)
+{
+    if (UObjectPoolComponent* Pool = GetOrCreatePoolComponent())
+    {
+        Pool->AddPoolFromConfig(Config);
+    }
+}
+
+void UObjectPoolSubsystem::PrewarmPool(TSubclassOf<UObject> ObjectClass, int32 CountToSpawn)
+{
+    if (!ObjectClass)
+    {
+        return;
+    }
+
+    EnsurePoolForClass(ObjectClass);
+    if (PoolComponent)
+    {
+        PoolComponent->PrewarmPool(ObjectClass, CountToSpawn);
+    }
+}
+
+// --- 꺼내기 / 반환 ---
+
+AActor* UObjectPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* NewOwner, APawn* NewInstigator)
+{
+    if (!ActorClass)
+    {
+        return nullptr;
+    }
+
+    EnsurePoolForClass(ActorClass);
+    if (!PoolComponent)
+    {
+        return nullptr;
+    }
+
+    // 소유자/가해자는 OnAcquiredFromPool보다 먼저 설정되어야 함
+    APawn* Instigator = NewInstigator ? NewInstigator : (NewOwner ? NewOwner->GetInstigator() : nullptr);
+    AActor* Actor = PoolComponent->GetActorFromPool(ActorClass, SpawnTransform, NewOwner, Instigator);
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    TrackContextLevel(Actor, NewOwner);
+    Actor->OnEndPlay.AddUniqueDynamic(this, &UObjectPoolSubsystem::HandleAcquiredActorEndPlay);
+
+    return Actor;
+}
+
+UUserWidget* UObjectPoolSubsystem::AcquireWidget(TSubclassOf<UUserWidget> WidgetClass)
+{
+    if (!WidgetClass)
+    {
+        return nullptr;
+    }
+
+    EnsurePoolForClass(WidgetClass);
+    return PoolComponent ? PoolComponent->GetWidgetFromPool(WidgetClass) : nullptr;
+}
+
+bool UObjectPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+    if (!IsValid(Actor) || !PoolComponent || !PoolComponent->IsPooledObject(Actor))
+    {
+        return false;
+    }
+
+    // 대기 중에는 이전 사용자의 소유권/가해자 정보를 들고 있지 않도록
+    Actor->SetOwner(nullptr);
+    Actor->SetInstigator(nullptr);
+
+    return ReleaseObject(Actor);
+}
+
+bool UObjectPoolSubsystem::ReleaseObject(UObject* Object)
+{
+    if (!IsValid(Object) || !PoolComponent || !PoolComponent->IsPooledObject(Object))
+    {
+        return false;
+    }
+
+    ContextLevels.Remove(Object);
+    PoolComponent->ReturnObjectToPool(Object);
+    return true;
+}
+
+// --- 관리 ---
+
+int32 UObjectPoolSubsystem::TrimIdleObjects(int32 MaxToTrim)
+{
+    return PoolComponent ? PoolComponent->TrimLeastRecentlyUsed(MaxToTrim) : 0;
+}
+
+int32 UObjectPoolSubsystem::GetNumIdleObjects() const
+{
+    return PoolComponent ? PoolComponent->GetTotalObjectCountInAllPools() : 0;
+}
+
+FObjectPoolStats UObjectPoolSubsystem::GetPoolStats(TSubclassOf<UObject> ObjectClass) const
+{
+    return PoolComponent ? PoolComponent->GetPoolStatsForClass(ObjectClass) : FObjectPoolStats();
+}
+
+UObjectPoolComponent* UObjectPoolSubsystem::GetOrCreatePoolComponent()
+{
+    if (PoolComponent)
+    {
+        return PoolComponent;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World || World->bIsTearingDown)
+    {
+        return nullptr;
+    }
+
+    // 퍼시스턴트 레벨에 생성해서 서브레벨 언로드와 무관하게 유지
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("SharedObjectPoolHost"));
+    SpawnParams.ObjectFlags |= RF_Transient;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    PoolHostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+    if (!PoolHostActor)
+    {
+        return nullptr;
+    }
+
+    PoolComponent = NewObject<UObjectPoolComponent>(PoolHostActor, TEXT("SharedObjectPool"));
+    PoolComponent->RegisterComponent();
+
+    return PoolComponent;
+}
+
+void UObjectPoolSubsystem::EnsurePoolForClass(UClass* ObjectClass)
+{
+    UObjectPoolComponent* Pool = GetOrCreatePoolComponent();
+    if (Pool && ObjectClass && !Pool->IsObjectClassRegistered(ObjectClass))
+    {
+        Pool->AddPoolForUObjectClass(ObjectClass, DefaultSpawnSettings);
+    }
+}
+
+void UObjectPoolSubsystem::TrackContextLevel(UObject* Object, const AActor* ContextActor)
+{
+    ULevel* ContextLevel = ContextActor ? ContextActor->GetLevel() : nullptr;
+    if (ContextLevel && !ContextLevel->IsPersistentLevel())
+    {
+        ContextLevels.Add(Object, ContextLevel);
+    }
+    else
+    {
+        ContextLevels.Remove(Object);
+    }
+}
+
+void UObjectPoolSubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld)
+{
+    // Level이 nullptr이면 월드 전체 정리 (풀 호스트도 같이 정리됨)
+    if (InWorld != GetWorld() || !Level || !PoolComponent)
+    {
+        return;
+    }
+
+    TArray<UObject*> ObjectsToRelease;
+    for (auto It = ContextLevels.CreateIterator(); It; ++It)
+    {
+        UObject* Object = It.Key().ResolveObjectPtr();
+        if (!Object)
+        {
+            It.RemoveCurrent(); // 외부에서 파괴됨
+            continue;
+        }
+
+        const ULevel* ContextLevel = It.Value().Get();
+        if (!ContextLevel || ContextLevel == Level)
+        {
+            ObjectsToRelease.Add(Object);
+        }
+    }
+
+    for (UObject* Object : ObjectsToRelease)
+    {
+        if (AActor* Actor = Cast<AActor>(Object))
+        {
+            ReleaseActor(Actor);
+        }
+        else
+        {
+            ReleaseObject(Object);
+        }
+    }
+
+    UE_CLOG(ObjectsToRelease.Num() > 0, LogTemp, Verbose, TEXT("ObjectPool: Returned %d pooled objects on unload of %s"),
+        ObjectsToRelease.Num(), *GetNameSafe(Level->GetOuter()));
+}
+
+void UObjectPoolSubsystem::HandleAcquiredActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    ContextLevels.Remove(Actor);
+}
+
+void UObjectPoolSubsystem::HandleMemoryTrim()
+{
+    // OS 메모리 경고, 대기 중인 오브젝트는 모두 버림
+    const int32 NumTrimmed = TrimIdleObjects(MAX_int32);
+    UE_CLOG(NumTrimmed > 0, LogTemp, Log, TEXT("ObjectPool: Memory trim destroyed %d idle pooled objects"), NumTrimmed);
+}
+
+void UObjectPoolSubsystem::UpdateMemoryPressure(float DeltaTime)
+{
+    if (!PoolComponent)
+    {
+        return;
+    }
+
+    // 전체 대기 수 상한
+    const int32 MaxIdleObjects = CVarPoolMaxIdleObjects.GetValueOnGameThread();
+    const int32 NumIdle = PoolComponent->GetTotalObjectCountInAllPools();
+    if (MaxIdleObjects >= 0 && NumIdle > MaxIdleObjects)
+    {
+        PoolComponent->TrimLeastRecentlyUsed(NumIdle - MaxIdleObjects);
+    }
+
+    MemoryCheckElapsedSeconds += DeltaTime;
+    if (MemoryCheckElapsedSeconds < CVarPoolMemoryCheckInterval.GetValueOnGameThread())
+    {
+        return;
+    }
+    MemoryCheckElapsedSeconds = 0.0f;
+
+    const int32 LowMemoryMB = CVarPoolLowMemoryMB.GetValueOnGameThread();
+    if (LowMemoryMB <= 0)
+    {
+        return;
+    }
+
+    const uint64 AvailablePhysicalMB = FPlatformMemory::GetStats().AvailablePhysical / (1024 * 1024);
+    if (AvailablePhysicalMB < static_cast<uint64>(LowMemoryMB))
+    {
+        // 압박이 계속되면 검사 주기마다 절반씩 줄어듦
+        const int32 NumIdleNow = PoolComponent->GetTotalObjectCountInAllPools();
+        const int32 NumTrimmed = PoolComponent->TrimLeastRecentlyUsed(FMath::CeilToInt32(NumIdleNow * ObjectPoolSubsystem::LowMemoryTrimFraction));
+        UE_CLOG(NumTrimmed > 0, LogTemp, Log, TEXT("ObjectPool: Low memory (%llu MB available), destroyed %d idle pooled objects"),
+            AvailablePhysicalMB, NumTrimmed);
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+
+static void TrimSharedObjectPoolsCommand(const TArray<FString>& Args, UWorld* World)
+{
+    UObjectPoolSubsystem* Subsystem = World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr;
+    if (!Subsystem)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RPGPool.Trim: No shared object pool in this world"));
+        return;
+    }
+
+    const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : MAX_int32;
+    const int32 NumTrimmed = Subsystem->TrimIdleObjects(Count);
+    UE_LOG(LogTemp, Log, TEXT("RPGPool.Trim: Destroyed %d idle objects, %d remain"), NumTrimmed, Subsystem->GetNumIdleObjects());
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GRPGPoolTrimCommand(
+    TEXT("RPGPool.Trim"),
+    TEXT("Destroys the least recently used idle objects of the shared object pool. [Count] (default: all)"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&TrimSharedObjectPoolsCommand));
+
+#endif
@@ -6,6 +6,7 @@
 #include "Status/StatsComponent.h"
 #include "Status/Cues/CueManagerSubsystem.h"
 #include "Status/Effects/RPGEffect.h"
+#include "Status/Effects/EffectSimulationSubsystem.h"
 
 UEffectComponent::UEffectComponent()
 {
@@ -26,6 +27,32 @@ void UEffectComponent::BeginPlay()
         }
     }
     StatsComponent = GetOwner() ? GetOwner()->FindComponentByClass<UStatsComponent>() : nullptr;
+
+    // Opt-in: the world subsystem advances our timers, so this component no longer ticks
+    if (bUseWorldEffectSimulation)
+    {
+        EffectSimulation = GetWorld() ? GetWorld()->GetSubsystem<UEffectSimulationSubsystem>() : nullptr;
+        if (EffectSimulation)
+        {
+            SetComponentTickEnabled(false);
+
+            for (const FActiveEffectHandle& Effect : ActiveEffects)
+            {
+                EffectSimulation->RegisterEffect(this, Effect);
+            }
+        }
+    }
+}
+
+void UEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (EffectSimulation)
+    {
+        EffectSimulation->UnregisterComponent(this);
+        EffectSimulation = nullptr;
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -132,6 +159,10 @@ FActiveEffectHandle UEffectComponent::ApplyEffect(URPGEffect* EffectToApply, con
         FActiveEffectHandle* ExistingEffect = HandleStacking(EffectToApply, Context);
         if (ExistingEffect)
         {
+            if (EffectSimulation)
+            {
+                EffectSimulation->UpdateEffect(*ExistingEffect);
+            }
             ReapplyPersistentEffectStatModifiers(*ExistingEffect);
             return *ExistingEffect; // Return the modified existing effect
         }
@@ -164,9 +195,20 @@ FActiveEffectHandle UEffectComponent::ApplyEffect(URPGEffect* EffectToApply, con
     // Add to active effects
     ActiveEffects.Add(NewEffect);
 
+    if (EffectSimulation)
+    {
+        EffectSimulation->RegisterEffect(this, NewEffect);
+    }
+
     // Update granted tags
     RefreshGrantedTags();
 
+    // A new effect can conflict with tags that were already granted
+    if (EffectToApply->RemoveOnTags.Num() > 0)
+    {
+        MarkGrantedTagsChanged();
+    }
+
     // Broadcast event
     OnEffectApplied.Broadcast(EffectToApply, Context, NewEffect);
 
@@ -205,9 +247,7 @@ bool UEffectComponent::RemoveEffect(const FActiveEffectHandle& Handle)
     {
         if (ActiveEffects[i] == Handle)
         {
-            FActiveEffectHandle RemovedEffect = ActiveEffects[i];
-            ActiveEffects.RemoveAt(i);
-            OnEffectRemovedInternal(RemovedEffect);
+            RemoveEffectAt(i);
             return true;
         }
     }
@@ -222,9 +262,7 @@ int32 UEffectComponent::RemoveEffectsByTag(const FGameplayTag& EffectTag)
     {
         if (ActiveEffects[i].MatchesTag(EffectTag))
         {
-            FActiveEffectHandle RemovedEffect = ActiveEffects[i];
-            ActiveEffects.RemoveAt(i);
-            OnEffectRemovedInternal(RemovedEffect);
+            RemoveEffectAt(i);
             RemovedCount++;
         }
     }
@@ -245,9 +283,7 @@ int32 UEffectComponent::RemoveEffectsFromSource(AActor* SourceActor)
     {
         if (ActiveEffects[i].Context.SourceActor.Get() == SourceActor)
         {
-            FActiveEffectHandle RemovedEffect = ActiveEffects[i];
-            ActiveEffects.RemoveAt(i);
-            OnEffectRemovedInternal(RemovedEffect);
+            RemoveEffectAt(i);
             RemovedCount++;
         }
     }
@@ -257,13 +293,16 @@ int32 UEffectComponent::RemoveEffectsFromSource(AActor* SourceActor)
 
 void UEffectComponent::RemoveAllEffects()
 {
-    for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+    // Removal callbacks can apply new effects, so take the list first
+    TArray<FActiveEffectHandle> RemovedEffects = MoveTemp(ActiveEffects);
+    ActiveEffects.Reset();
+
+    for (int32 i = RemovedEffects.Num() - 1; i >= 0; --i)
     {
-        FActiveEffectHandle RemovedEffect = ActiveEffects[i];
-        OnEffectRemovedInternal(RemovedEffect);
+        SyncSimulatedTimers(RemovedEffects[i]);
+        OnEffectRemovedInternal(RemovedEffects[i]);
     }
     
-    ActiveEffects.Empty();
     RefreshGrantedTags();
 }
 
@@ -289,13 +328,23 @@ TArray<FActiveEffectHandle> UEffectComponent::GetEffectsByTag(const FGameplayTag
     {
         if (Effect.MatchesTag(EffectTag))
         {
-            MatchingEffects.Add(Effect);
+            SyncSimulatedTimers(MatchingEffects.Add_GetRef(Effect));
         }
     }
     
     return MatchingEffects;
 }
 
+TArray<FActiveEffectHandle> UEffectComponent::GetAllActiveEffects() const
+{
+    TArray<FActiveEffectHandle> Effects = ActiveEffects;
+    for (FActiveEffectHandle& Effect : Effects)
+    {
+        SyncSimulatedTimers(Effect);
+    }
+    return Effects;
+}
+
 float UEffectComponent::GetTotalMagnitudeForTag(const FGameplayTag& EffectTag) const
 {
     float TotalMagnitude = 0.0f;
@@ -365,6 +414,9 @@ FActiveEffectHandle* UEffectComponent::HandleStacking(URPGEffect* IncomingEffect
     {
         if (ExistingEffect.EffectDefinition == IncomingEffect)
         {
+            // Stacking reads the remaining duration (StackDuration adds to it)
+            SyncSimulatedTimers(ExistingEffect);
+
             // Apply stacking policy
             switch (IncomingEffect->StackPolicy)
             {
@@ -452,32 +504,85 @@ void UEffectComponent::UpdateActiveEffects(float DeltaTime)
     // Update timers and check for ticks/expiration
     for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
     {
+        // Callbacks below may remove other effects
+        if (!ActiveEffects.IsValidIndex(i))
+        {
+            continue;
+        }
+
         FActiveEffectHandle& Effect = ActiveEffects[i];
         
-        // Update timers
-        Effect.UpdateTimers(DeltaTime);
-
-        // Check for periodic tick
-        if (Effect.ShouldTick())
+        // Update timers, check for periodic tick
+        if (Effect.UpdateTimers(DeltaTime))
         {
             ExecuteEffectTick(Effect);
         }
 
         // Check for expiration
-        if (Effect.IsExpired())
+        if (ActiveEffects.IsValidIndex(i) && ActiveEffects[i].IsExpired())
         {
-            FActiveEffectHandle ExpiredEffect = Effect;
-            ActiveEffects.RemoveAt(i);
-            OnEffectRemovedInternal(ExpiredEffect);
+            RemoveEffectAt(i);
         }
     }
 
     // Check if any effects should be removed due to tag conflicts
-    CheckForRemovalTags();
+    ProcessGrantedTagChanges();
+}
+
+void UEffectComponent::HandleSimulatedEffectEvents(TConstArrayView<FEffectSimulationEvent> Events)
+{
+    for (const FEffectSimulationEvent& Event : Events)
+    {
+        const int32 Index = ActiveEffects.IndexOfByPredicate([&Event](const FActiveEffectHandle& Effect)
+        {
+            return Effect.InstanceID == Event.InstanceID;
+        });
+
+        if (Index == INDEX_NONE)
+        {
+            continue;
+        }
+
+        FActiveEffectHandle& Effect = ActiveEffects[Index];
+        Effect.RemainingDuration = Event.RemainingDuration;
+        Effect.TimeUntilNextTick = Event.TimeUntilNextTick;
+
+        if (Event.bTicked)
+        {
+            ExecuteEffectTick(Effect);
+        }
+        else if (Event.bExpired)
+        {
+            RemoveEffectAt(Index);
+        }
+    }
+}
+
+void UEffectComponent::SyncSimulatedTimers(FActiveEffectHandle& Handle) const
+{
+    if (EffectSimulation)
+    {
+        EffectSimulation->GetEffectTimers(Handle.InstanceID, Handle.RemainingDuration, Handle.TimeUntilNextTick);
+    }
+}
+
+void UEffectComponent::RemoveEffectAt(int32 Index)
+{
+    FActiveEffectHandle RemovedEffect = MoveTemp(ActiveEffects[Index]);
+    SyncSimulatedTimers(RemovedEffect);
+
+    // Swap-remove: ActiveEffects is unordered and loops over it walk backwards
+    ActiveEffects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    OnEffectRemovedInternal(RemovedEffect);
 }
 
 void UEffectComponent::OnEffectRemovedInternal(const FActiveEffectHandle& RemovedEffect)
 {
+    if (EffectSimulation)
+    {
+        EffectSimulation->UnregisterEffect(RemovedEffect.InstanceID);
+    }
+
     RemoveEffectStatModifiers(RemovedEffect.InstanceID);
     // Broadcast removal event
     if (RemovedEffect.EffectDefinition)
@@ -501,21 +606,54 @@ void UEffectComponent::OnEffectRemovedInternal(const FActiveEffectHandle& Remove
 
 void UEffectComponent::RefreshGrantedTags()
 {
-    GrantedTags.Reset();
+    FGameplayTagContainer NewGrantedTags;
 
     for (const FActiveEffectHandle& Effect : ActiveEffects)
     {
         if (Effect.EffectDefinition)
         {
-            GrantedTags.AppendTags(Effect.EffectDefinition->GrantedTags);
+            NewGrantedTags.AppendTags(Effect.EffectDefinition->GrantedTags);
         }
     }
+
+    if (NewGrantedTags == GrantedTags)
+    {
+        return;
+    }
+
+    GrantedTags = MoveTemp(NewGrantedTags);
+
+    // Tag conflicts can only appear when granted tags change
+    MarkGrantedTagsChanged();
+}
+
+void UEffectComponent::MarkGrantedTagsChanged()
+{
+    bGrantedTagsChanged = true;
+    if (EffectSimulation)
+    {
+        EffectSimulation->RequestTagConflictCheck(this);
+    }
+}
+
+void UEffectComponent::ProcessGrantedTagChanges()
+{
+    if (bGrantedTagsChanged)
+    {
+        bGrantedTagsChanged = false;
+        CheckForRemovalTags();
+    }
 }
 
 void UEffectComponent::CheckForRemovalTags()
 {
     for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
     {
+        if (!ActiveEffects.IsValidIndex(i))
+        {
+            continue;
+        }
+
         const FActiveEffectHandle& Effect = ActiveEffects[i];
         
         if (Effect.EffectDefinition && Effect.EffectDefinition->RemoveOnTags.Num() > 0)
@@ -523,9 +661,7 @@ void UEffectComponent::CheckForRemovalTags()
             // Check if we have any of the removal tags
             if (GrantedTags.HasAny(Effect.EffectDefinition->RemoveOnTags))
             {
-                FActiveEffectHandle RemovedEffect = ActiveEffects[i];
-                ActiveEffects.RemoveAt(i);
-                OnEffectRemovedInternal(RemovedEffect);
+                RemoveEffectAt(i);
             }
         }
     }
@@ -551,7 +687,7 @@ void UEffectComponent::DebugPrintActiveEffects() const
 {
     UE_LOG(LogTemp, Log, TEXT("=== Active Effects on %s ==="), *GetOwner()->GetName());
     
-    for (const FActiveEffectHandle& Effect : ActiveEffects)
+    for (const FActiveEffectHandle& Effect : GetAllActiveEffects())
     {
         if (Effect.EffectDefinition)
         {
@@ -574,7 +710,7 @@ FString UEffectComponent::GetActiveEffectsDebugString() const
 {
     FString DebugStr = FString::Printf(TEXT("Active Effects (%d):\n"), ActiveEffects.Num());
     
-    for (const FActiveEffectHandle& Effect : ActiveEffects)
+    for (const FActiveEffectHandle& Effect : GetAllActiveEffects())
     {
         if (Effect.EffectDefinition)
         {
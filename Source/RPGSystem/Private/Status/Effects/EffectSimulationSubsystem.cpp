@@ -0,0 +1,310 @@
+// EffectSimulationSubsystem.cpp
+
+#include "Status/Effects/EffectSimulationSubsystem.h"
+#include "Status/Effects/EffectComponent.h"
+#include "Status/Effects/ActiveEffectHandle.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarEffectParallelSimulation(
+    TEXT("RPGEffects.ParallelSimulation"),
+    true,
+    TEXT("Advance world-simulated effect timers with ParallelFor when there are enough of them."));
+
+static TAutoConsoleVariable<int32> CVarEffectParallelSimulationMinEffects(
+    TEXT("RPGEffects.ParallelSimulationMinEffects"),
+    2048,
+    TEXT("Minimum number of simulated effects before the timer pass is split across worker threads."));
+
+namespace EffectSimulation
+{
+    enum EEventFlags : uint8
+    {
+        None    = 0,
+        Ticked  = 1 << 0,
+        Expired = 1 << 1
+    };
+
+    // Effects per ParallelFor task, small enough to balance and large enough to hide the dispatch cost
+    constexpr int32 ChunkSize = 512;
+}
+
+// ========== LIFECYCLE ==========
+
+void UEffectSimulationSubsystem::Deinitialize()
+{
+    RemainingDurations.Empty();
+    TimesUntilNextTick.Empty();
+    Periods.Empty();
+    InstanceIDs.Empty();
+    Owners.Empty();
+    EventFlags.Empty();
+    InstanceToIndex.Empty();
+    PendingEvents.Empty();
+    DispatchScratch.Empty();
+    PendingTagChecks.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UEffectSimulationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEffectSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UEffectSimulationSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const int32 NumEffects = InstanceIDs.Num();
+    if (NumEffects > 0)
+    {
+        EventFlags.SetNumUninitialized(NumEffects, EAllowShrinking::No);
+
+        // 1. Pure timer math, no UObject access
+        if (CVarEffectParallelSimulation.GetValueOnGameThread() && NumEffects >= CVarEffectParallelSimulationMinEffects.GetValueOnGameThread())
+        {
+            const int32 NumChunks = FMath::DivideAndRoundUp(NumEffects, EffectSimulation::ChunkSize);
+            ParallelFor(NumChunks, [this, NumEffects, DeltaTime](const int32 ChunkIndex)
+            {
+                const int32 BeginIndex = ChunkIndex * EffectSimulation::ChunkSize;
+                AdvanceTimers(BeginIndex, FMath::Min(BeginIndex + EffectSimulation::ChunkSize, NumEffects), DeltaTime);
+            });
+        }
+        else
+        {
+            AdvanceTimers(0, NumEffects, DeltaTime);
+        }
+
+        // 2. Collect events, expired effects leave the arrays here
+        PendingEvents.Reset();
+        for (int32 Index = NumEffects - 1; Index >= 0; --Index)
+        {
+            UEffectComponent* Component = Owners[Index].Get();
+            if (!Component)
+            {
+                RemoveAtSwap(Index);
+                continue;
+            }
+
+            const uint8 Flags = EventFlags[Index];
+            if (Flags == EffectSimulation::None)
+            {
+                continue;
+            }
+
+            FPendingEvent& Pending = PendingEvents.AddDefaulted_GetRef();
+            Pending.Component = Component;
+            Pending.Event.InstanceID = InstanceIDs[Index];
+            Pending.Event.RemainingDuration = RemainingDurations[Index];
+            Pending.Event.TimeUntilNextTick = TimesUntilNextTick[Index];
+            Pending.Event.bTicked = (Flags & EffectSimulation::Ticked) != 0;
+            Pending.Event.bExpired = (Flags & EffectSimulation::Expired) != 0;
+
+            if (Pending.Event.bExpired)
+            {
+                RemoveAtSwap(Index);
+            }
+        }
+
+        // 3. One call per component
+        DispatchEvents();
+    }
+
+    // 4. Tag conflicts only for components whose granted tags changed
+    if (PendingTagChecks.Num() > 0)
+    {
+        TArray<TWeakObjectPtr<UEffectComponent>> Components = MoveTemp(PendingTagChecks);
+        PendingTagChecks.Reset();
+
+        for (const TWeakObjectPtr<UEffectComponent>& Component : Components)
+        {
+            if (UEffectComponent* EffectComponent = Component.Get())
+            {
+                EffectComponent->ProcessGrantedTagChanges();
+            }
+        }
+    }
+}
+
+void UEffectSimulationSubsystem::AdvanceTimers(int32 BeginIndex, int32 EndIndex, float DeltaTime)
+{
+    for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+    {
+        uint8 Flags = EffectSimulation::None;
+
+        const float Remaining = RemainingDurations[Index] - DeltaTime;
+        RemainingDurations[Index] = Remaining;
+
+        const float Period = Periods[Index];
+        if (Period > 0.0f)
+        {
+            float UntilNextTick = TimesUntilNextTick[Index] - DeltaTime;
+            if (UntilNextTick <= 0.0f && Remaining > 0.0f)
+            {
+                UntilNextTick = Period;
+                Flags |= EffectSimulation::Ticked;
+            }
+            TimesUntilNextTick[Index] = UntilNextTick;
+        }
+
+        if (Remaining <= 0.0f)
+        {
+            Flags |= EffectSimulation::Expired;
+        }
+
+        EventFlags[Index] = Flags;
+    }
+}
+
+void UEffectSimulationSubsystem::DispatchEvents()
+{
+    if (PendingEvents.Num() == 0)
+    {
+        return;
+    }
+
+    // Group by component, stable so each component sees its events in a consistent order
+    Algo::StableSortBy(PendingEvents, [](const FPendingEvent& Pending)
+    {
+        return reinterpret_cast<UPTRINT>(Pending.Component);
+    });
+
+    // Components may apply or remove effects while handling events, so dispatch from a copy
+    TArray<FPendingEvent> Events = MoveTemp(PendingEvents);
+    PendingEvents.Reset();
+
+    int32 RangeStart = 0;
+    while (RangeStart < Events.Num())
+    {
+        UEffectComponent* Component = Events[RangeStart].Component;
+
+        DispatchScratch.Reset();
+        int32 RangeEnd = RangeStart;
+        for (; RangeEnd < Events.Num() && Events[RangeEnd].Component == Component; ++RangeEnd)
+        {
+            DispatchScratch.Add(Events[RangeEnd].Event);
+        }
+
+        if (IsValid(Component))
+        {
+            Component->HandleSimulatedEffectEvents(DispatchScratch);
+        }
+
+        RangeStart = RangeEnd;
+    }
+
+    // Keep the allocation for next frame
+    PendingEvents = MoveTemp(Events);
+    PendingEvents.Reset();
+}
+
+// ========== REGISTRATION ==========
+
+void UEffectSimulationSubsystem::RegisterEffect(UEffectComponent* Component, const FActiveEffectHandle& Handle)
+{
+    if (!Component || !Handle.EffectDefinition)
+    {
+        return;
+    }
+
+    if (InstanceToIndex.Contains(Handle.InstanceID))
+    {
+        UpdateEffect(Handle);
+        return;
+    }
+
+    const int32 Index = InstanceIDs.Add(Handle.InstanceID);
+    RemainingDurations.Add(Handle.RemainingDuration);
+    TimesUntilNextTick.Add(Handle.TimeUntilNextTick);
+    Periods.Add(Handle.EffectDefinition->IsPeriodic() ? Handle.EffectDefinition->Period : 0.0f);
+    Owners.Add(Component);
+
+    InstanceToIndex.Add(Handle.InstanceID, Index);
+}
+
+void UEffectSimulationSubsystem::UpdateEffect(const FActiveEffectHandle& Handle)
+{
+    if (const int32* Index = InstanceToIndex.Find(Handle.InstanceID))
+    {
+        RemainingDurations[*Index] = Handle.RemainingDuration;
+        TimesUntilNextTick[*Index] = Handle.TimeUntilNextTick;
+    }
+}
+
+void UEffectSimulationSubsystem::UnregisterEffect(const FGuid& InstanceID)
+{
+    if (const int32* Index = InstanceToIndex.Find(InstanceID))
+    {
+        RemoveAtSwap(*Index);
+    }
+}
+
+void UEffectSimulationSubsystem::UnregisterComponent(const UEffectComponent* Component)
+{
+    for (int32 Index = Owners.Num() - 1; Index >= 0; --Index)
+    {
+        if (Owners[Index].Get() == Component || !Owners[Index].IsValid())
+        {
+            RemoveAtSwap(Index);
+        }
+    }
+
+    PendingTagChecks.RemoveAll([Component](const TWeakObjectPtr<UEffectComponent>& Pending)
+    {
+        return Pending.Get() == Component;
+    });
+}
+
+bool UEffectSimulationSubsystem::GetEffectTimers(const FGuid& InstanceID, float& OutRemainingDuration, float& OutTimeUntilNextTick) const
+{
+    if (const int32* Index = InstanceToIndex.Find(InstanceID))
+    {
+        OutRemainingDuration = RemainingDurations[*Index];
+        OutTimeUntilNextTick = TimesUntilNextTick[*Index];
+        return true;
+    }
+    return false;
+}
+
+void UEffectSimulationSubsystem::RequestTagConflictCheck(UEffectComponent* Component)
+{
+    if (Component)
+    {
+        PendingTagChecks.AddUnique(Component);
+    }
+}
+
+void UEffectSimulationSubsystem::RemoveAtSwap(int32 Index)
+{
+    const int32 LastIndex = InstanceIDs.Num() - 1;
+    InstanceToIndex.Remove(InstanceIDs[Index]);
+
+    if (Index != LastIndex)
+    {
+        RemainingDurations[Index] = RemainingDurations[LastIndex];
+        TimesUntilNextTick[Index] = TimesUntilNextTick[LastIndex];
+        Periods[Index] = Periods[LastIndex];
+        InstanceIDs[Index] = InstanceIDs[LastIndex];
+        Owners[Index] = Owners[LastIndex];
+
+        // Only valid during the collection pass, which walks backwards and has already read LastIndex
+        if (EventFlags.IsValidIndex(LastIndex))
+        {
+            EventFlags[Index] = EventFlags[LastIndex];
+        }
+
+        InstanceToIndex[InstanceIDs[Index]] = Index;
+    }
+
+    RemainingDurations.Pop(EAllowShrinking::No);
+    TimesUntilNextTick.Pop(EAllowShrinking::No);
+    Periods.Pop(EAllowShrinking::No);
+    InstanceIDs.Pop(EAllowShrinking::No);
+    Owners.Pop(EAllowShrinking::No);
+    if (EventFlags.Num() > InstanceIDs.Num())
+    {
+        EventFlags.Pop(EAllowShrinking::No);
+    }
+}
@@ -0,0 +1,275 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Status/StatRecalculationBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Status/StatsComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagsManager.h"
+#include "RPGSystemGameplayTags.h"
+#include "Shared/RPGBenchmark.h"
+#include "UObject/Package.h"
+
+namespace StatRecalculationBenchmark
+{
+	constexpr int32 NumCharacters = 1000;
+	constexpr int32 StatsPerCharacter = 30;
+	constexpr int32 ModifiersPerStat = 20;
+	constexpr int32 NumFrames = 10;
+
+	// 프레임마다 스탯별로 교체되는 Modifier 수
+	constexpr int32 ChangesPerStat = 2;
+	constexpr int32 Seed = 1337;
+
+	// 이전 FStatEntry (Modifier 배열 하나, 재계산마다 정렬)
+	struct FLegacyStatEntry
+	{
+		float BaseValue = 0.0f;
+		float CurrentValue = 0.0f;
+		TArray<FStatModifier> Modifiers;
+
+		void RecalculateValue()
+		{
+			float FinalValue = BaseValue;
+			float FlatBonus = 0.0f;
+			float PercentBonus = 1.0f;
+
+			Modifiers.Sort([](const FStatModifier& A, const FStatModifier& B)
+			{
+				return A.Priority < B.Priority;
+			});
+
+			for (const FStatModifier& Mod : Modifiers)
+			{
+				switch (Mod.ModifierType)
+				{
+				case EModifierSourceType::Flat:
+					FlatBonus += Mod.ModifierValue;
+					break;
+				case EModifierSourceType::Percentage:
+					PercentBonus *= (1.0f + Mod.ModifierValue);
+					break;
+				case EModifierSourceType::Override:
+					CurrentValue = FMath::Max(0.0f, Mod.ModifierValue);
+					return;
+				}
+			}
+
+			FinalValue = (FinalValue + FlatBonus) * PercentBonus;
+			CurrentValue = FMath::Max(0.0f, FinalValue);
+		}
+
+		void RemoveModifier(const FGameplayTag& ModifierTag)
+		{
+			Modifiers.RemoveAll([&ModifierTag](const FStatModifier& Mod)
+			{
+				return Mod.ModifierTag == ModifierTag;
+			});
+		}
+	};
+
+	// 장비/버프와 비슷한 분포 (Flat 75%, Percent 25%)
+	FStatModifier MakeModifier(FRandomStream& Random, const FGameplayTag& ModifierTag)
+	{
+		const bool bPercent = Random.FRand() < 0.25f;
+		FStatModifier Modifier(ModifierTag,
+			bPercent ? Random.FRandRange(0.01f, 0.2f) : Random.FRandRange(1.0f, 10.0f),
+			bPercent ? EModifierSourceType::Percentage : EModifierSourceType::Flat);
+		Modifier.Priority = Random.RandRange(0, 10);
+		return Modifier;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatRecalculationBenchmark, "RPGSystem.Benchmark.Stats.Recalculation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FStatRecalculationBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace StatRecalculationBenchmark;
+
+	// 교체 시 같은 태그끼리 덮어쓰도록 서로 다른 태그가 필요
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+	TArray<FGameplayTag> ModifierTags;
+	AllTags.GetGameplayTagArray(ModifierTags);
+
+	const int32 NumModifiers = FMath::Min(ModifiersPerStat, ModifierTags.Num());
+	const int32 NumStats = NumCharacters * StatsPerCharacter;
+	const int32 NumChanges = FMath::Min(ChangesPerStat, NumModifiers);
+
+	if (!TestTrue(TEXT("Enough gameplay tags for distinct modifiers"), NumModifiers > 0))
+	{
+		return false;
+	}
+
+	if (NumModifiers < ModifiersPerStat)
+	{
+		AddWarning(FString::Printf(TEXT("Only %d gameplay tags registered, using %d modifiers per stat"), NumModifiers, NumModifiers));
+	}
+
+	// 초기 Modifier와 교체 순서를 미리 생성 (측정에서 난수 비용 제외)
+	FRandomStream Random(Seed);
+
+	TArray<float> BaseValues;
+	TArray<FStatModifier> InitialModifiers;
+	BaseValues.SetNumUninitialized(NumStats);
+	InitialModifiers.Reserve(NumStats * NumModifiers);
+
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		BaseValues[StatIndex] = Random.FRandRange(10.0f, 100.0f);
+		for (int32 ModIndex = 0; ModIndex < NumModifiers; ++ModIndex)
+		{
+			InitialModifiers.Add(MakeModifier(Random, ModifierTags[ModIndex]));
+		}
+	}
+
+	TArray<FStatModifier> Changes;
+	Changes.Reserve(NumFrames * NumStats * NumChanges);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+		{
+			for (int32 Change = 0; Change < NumChanges; ++Change)
+			{
+				Changes.Add(MakeModifier(Random, ModifierTags[Random.RandRange(0, NumModifiers - 1)]));
+			}
+		}
+	}
+
+	FRPGBenchmarkReport Report(TEXT("StatRecalculation"));
+
+	// Legacy: 제거/추가 때마다 정렬 + 전체 순회 (이전 UStatsComponent 동작)
+	TArray<FLegacyStatEntry> LegacyEntries;
+	LegacyEntries.SetNum(NumStats);
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		FLegacyStatEntry& Entry = LegacyEntries[StatIndex];
+		Entry.BaseValue = BaseValues[StatIndex];
+		Entry.Modifiers.Append(&InitialModifiers[StatIndex * NumModifiers], NumModifiers);
+		Entry.RecalculateValue();
+	}
+
+	Report.Measure(TEXT("Legacy"), [&]()
+	{
+		int32 ChangeIndex = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FLegacyStatEntry& Entry : LegacyEntries)
+			{
+				for (int32 Change = 0; Change < NumChanges; ++Change)
+				{
+					const FStatModifier& Modifier = Changes[ChangeIndex++];
+
+					Entry.RemoveModifier(Modifier.ModifierTag);
+					Entry.RecalculateValue();
+
+					Entry.RemoveModifier(Modifier.ModifierTag);
+					Entry.Modifiers.Add(Modifier);
+					Entry.RecalculateValue();
+				}
+			}
+		}
+		return int64(0);
+	});
+
+	// Bucketed: UStatsComponent처럼 변경 때마다 즉시 재계산
+	TArray<FStatEntry> BucketedEntries;
+	BucketedEntries.SetNum(NumStats);
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		FStatEntry& Entry = BucketedEntries[StatIndex];
+		Entry.BaseValue = BaseValues[StatIndex];
+		for (int32 ModIndex = 0; ModIndex < NumModifiers; ++ModIndex)
+		{
+			Entry.AddModifier(InitialModifiers[StatIndex * NumModifiers + ModIndex]);
+		}
+		Entry.RecalculateValue();
+	}
+
+	Report.Measure(TEXT("Bucketed"), [&]()
+	{
+		int32 ChangeIndex = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FStatEntry& Entry : BucketedEntries)
+			{
+				for (int32 Change = 0; Change < NumChanges; ++Change)
+				{
+					const FStatModifier& Modifier = Changes[ChangeIndex++];
+
+					Entry.RemoveModifier(Modifier.ModifierTag);
+					Entry.RecalculateValue();
+
+					Entry.AddModifier(Modifier);
+					Entry.RecalculateValue();
+				}
+			}
+		}
+		return int64(0);
+	});
+
+	int32 NumMismatches = 0;
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		const float Expected = LegacyEntries[StatIndex].CurrentValue;
+		const float Tolerance = FMath::Max(1.0f, FMath::Abs(Expected)) * 1.e-3f;
+		NumMismatches += !FMath::IsNearlyEqual(BucketedEntries[StatIndex].CurrentValue, Expected, Tolerance);
+	}
+	TestEqual(TEXT("Bucketed values that differ from the legacy recalculation"), NumMismatches, 0);
+
+	return Report.Submit(*this) && NumMismatches == 0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatModifierNotifyTest, "RPGSystem.Stats.ModifierNotify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStatModifierNotifyTest::RunTest(const FString& Parameters)
+{
+	const FGameplayTag StatTag = RPGGameplayTags::Attribute_Primary_Strength.GetTag();
+	const FGameplayTag ModifierTag = RPGGameplayTags::Item_Type_Weapon.GetTag();
+
+	FRPGBenchmarkWorld World;
+	AActor* Owner = World.GetWorld()->SpawnActor<AActor>();
+	if (!TestNotNull(TEXT("Owner actor"), Owner))
+	{
+		return false;
+	}
+
+	// 등록하지 않음 (BeginPlay의 스탯 설정 에셋 없이 SetStatValue로 스탯 추가)
+	UStatsComponent* Stats = NewObject<UStatsComponent>(Owner);
+	const TStrongObjectPtr<UStatModifiedTestListener> Listener(NewObject<UStatModifiedTestListener>(GetTransientPackage()));
+	Stats->OnStatModified.AddDynamic(Listener.Get(), &UStatModifiedTestListener::OnStatModified);
+
+	Stats->SetStatValue(StatTag, 100.0f);
+	Stats->SetMaxStatValue(StatTag, 1000.0f);
+
+	Stats->AddItemStatBonus(StatTag, ModifierTag, 10.0f);
+	TestEqual(TEXT("Value right after adding a modifier"), Stats->GetStatValue(StatTag), 110.0f);
+
+	// 같은 프레임의 SetStatValue는 다음 Tick의 처리로 덮어써지지 않아야 함
+	Stats->SetStatValue(StatTag, 50.0f);
+	Stats->FlushPendingStatChanges();
+	TestEqual(TEXT("SetStatValue after a modifier change survives the flush"), Stats->GetStatValue(StatTag), 50.0f);
+
+	Stats->RemoveItemStatBonus(StatTag, ModifierTag);
+	TestEqual(TEXT("Value right after removing the modifier"), Stats->GetStatValue(StatTag), 100.0f);
+	Stats->FlushPendingStatChanges();
+
+	// 각 알림의 이전 값은 직전 알림의 새 값
+	const TArray<TPair<float, float>>& Events = Listener->Events;
+	if (TestEqual(TEXT("OnStatModified count"), Events.Num(), 2))
+	{
+		TestEqual(TEXT("SetStatValue reports the modified value as old value"), Events[0].Key, 110.0f);
+		TestEqual(TEXT("SetStatValue new value"), Events[0].Value, 50.0f);
+		TestEqual(TEXT("Coalesced modifier change starts from the set value"), Events[1].Key, 50.0f);
+		TestEqual(TEXT("Coalesced modifier change new value"), Events[1].Value, 100.0f);
+	}
+
+	return true;
+}
+
+#endif
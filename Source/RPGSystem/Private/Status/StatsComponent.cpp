@@ -18,6 +18,11 @@ UStatsComponent::UStatsComponent()
 
 void FStatArray::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
 {
+	for (const int32 Index : AddedIndices)
+	{
+		Items[Index].InvalidateModifierCache();
+	}
+
 	if (OwnerComponent)
 	{
 		OwnerComponent->OnStatsReplicated();
@@ -26,6 +31,11 @@ void FStatArray::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 F
 
 void FStatArray::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
 {
+	for (const int32 Index : ChangedIndices)
+	{
+		Items[Index].InvalidateModifierCache();
+	}
+
 	if (OwnerComponent)
 	{
 		OwnerComponent->OnStatsReplicated();
@@ -79,6 +89,7 @@ void UStatsComponent::BeginDestroy()
 
     // 캐시 정리
     StatIndexCache.Empty();
+    PendingChangedStatIndices.Empty();
     
     Super::BeginDestroy();
 }
@@ -87,12 +98,12 @@ void UStatsComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// 스탯 재계산이 필요한 경우
-	if (bNeedsStatRecalculation)
+	// Modifier로 바뀐 스탯의 복제/알림
+	if (bHasPendingStatChanges)
 	{
-		// RecalculateAllStats();
-		bNeedsStatRecalculation = false;
+		FlushPendingStatChanges();
 	}
+	SetComponentTickEnabled(false);
 }
 
 #pragma region Core_Stat_Functions
@@ -158,6 +169,9 @@ void UStatsComponent::SetStatValue(const FGameplayTag& StatTag, float Value)
 		{
 			Entry.CurrentValue = NewValue;
 			StatArray.MarkItemDirty(Entry);
+
+			// 대기 중인 Modifier 알림은 이 값부터 보고 (같은 변경을 두 번 알리지 않음)
+			Entry.ValueBeforeChange = NewValue;
             
 			// 두 델리게이트 모두 브로드캐스트
 			OnStatChanged.Broadcast(StatTag, NewValue);
@@ -205,6 +219,7 @@ void UStatsComponent::SetMaxStatValue(const FGameplayTag& StatTag, float MaxValu
 	if (Entry.CurrentValue > Entry.MaxValue)
 	{
 		Entry.CurrentValue = Entry.MaxValue;
+		Entry.ValueBeforeChange = Entry.CurrentValue;
         
 		StatArray.MarkItemDirty(Entry);
 		OnStatMaxValueChanged.Broadcast(StatTag);
@@ -283,6 +298,49 @@ void UStatsComponent::RebuildStatCache()
 	}
 }
 
+void UStatsComponent::RecalculateStat(int32 StatIndex)
+{
+	FStatEntry& Entry = StatArray.Items[StatIndex];
+	if (!Entry.bChangeNotifyPending)
+	{
+		Entry.bChangeNotifyPending = true;
+		Entry.ValueBeforeChange = Entry.CurrentValue;
+		PendingChangedStatIndices.Add(StatIndex);
+	}
+
+	// 조회/SetStatValue가 바로 최신 값을 보도록 값은 즉시 재계산 (캐시된 합계라 저렴)
+	Entry.RecalculateValue();
+
+	if (!bHasPendingStatChanges)
+	{
+		bHasPendingStatChanges = true;
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UStatsComponent::FlushPendingStatChanges()
+{
+	bHasPendingStatChanges = false;
+
+	// 브로드캐스트 중 다시 Modifier가 추가될 수 있으므로 먼저 비움
+	TArray<int32> StatIndices = MoveTemp(PendingChangedStatIndices);
+	PendingChangedStatIndices.Reset();
+
+	for (const int32 StatIndex : StatIndices)
+	{
+		if (!StatArray.Items.IsValidIndex(StatIndex)) continue;
+
+		FStatEntry& Entry = StatArray.Items[StatIndex];
+		Entry.bChangeNotifyPending = false;
+		StatArray.MarkItemDirty(Entry);
+
+		if (!FMath::IsNearlyEqual(Entry.ValueBeforeChange, Entry.CurrentValue, 0.01f))
+		{
+			OnStatModified.Broadcast(Entry.StatTag, Entry.ValueBeforeChange, Entry.CurrentValue);
+		}
+	}
+}
+
 #pragma endregion
 
 void UStatsComponent::AddStatModifier(const FGameplayTag& StatTag, const FStatModifier& Modifier)
@@ -295,26 +353,17 @@ void UStatsComponent::AddStatModifier(const FGameplayTag& StatTag, const FStatMo
 
 	FStatEntry& Entry = StatArray.Items[*Index];
 
-	Entry.Modifiers.RemoveAll([&](const FStatModifier& Mod)
-	{
-		return Mod.ModifierTag == Modifier.ModifierTag;
-	});
-
 	FStatModifier NewModifier = Modifier;
 	NewModifier.StartTime = GetWorld()->GetTimeSeconds();
-	Entry.Modifiers.Add(NewModifier);
+	Entry.AddModifier(NewModifier);
 
-	Entry.RecalculateValue();
-    
-	// 네트워크 복제
-	StatArray.MarkItemDirty(Entry);
+	// 값은 즉시, 복제/알림은 프레임당 한 번
+	RecalculateStat(*Index);
 
 	if (Modifier.Duration > 0.0f)
 	{
 		EnsureModifierCleanupTimerRunning();
 	}
-	
-	OnStatModified.Broadcast(StatTag, Entry.BaseValue, Entry.CurrentValue);
 }
 
 void UStatsComponent::RemoveStatModifier(const FGameplayTag& StatTag, const FGameplayTag& ModifierTag)
@@ -325,18 +374,10 @@ void UStatsComponent::RemoveStatModifier(const FGameplayTag& StatTag, const FGam
 	if (!Index) return;
 
 	FStatEntry& Entry = StatArray.Items[*Index];
-	float OldValue = Entry.CurrentValue;
 
-	int32 RemovedCount = Entry.Modifiers.RemoveAll([&](const FStatModifier& Mod)
+	if (Entry.RemoveModifier(ModifierTag) > 0)
 	{
-		return Mod.ModifierTag == ModifierTag;
-	});
-
-	if (RemovedCount > 0)
-	{
-		Entry.RecalculateValue();
-		StatArray.MarkItemDirty(Entry);
-		OnStatModified.Broadcast(StatTag, OldValue, Entry.CurrentValue);
+		RecalculateStat(*Index);
 	}
 }
 
@@ -349,13 +390,10 @@ void UStatsComponent::RemoveAllModifiers(const FGameplayTag& StatTag)
 
 	FStatEntry& Entry = StatArray.Items[*Index];
     
-	if (Entry.Modifiers.Num() > 0)
+	if (Entry.GetNumModifiers() > 0)
 	{	
-		float OldValue = Entry.CurrentValue;
-		Entry.Modifiers.Empty();
-		Entry.RecalculateValue();
-		StatArray.MarkItemDirty(Entry);
-		OnStatModified.Broadcast(StatTag, OldValue, Entry.CurrentValue);
+		Entry.ClearModifiers();
+		RecalculateStat(*Index);
 	}
 
 	StopModifierCleanupTimerIfUnused();
@@ -365,7 +403,7 @@ TArray<FStatModifier> UStatsComponent::GetStatModifiers(const FGameplayTag& Stat
 {
 	if (const int32* Index = StatIndexCache.Find(StatTag))
 	{
-		return StatArray.Items[*Index].Modifiers;
+		return StatArray.Items[*Index].GetAllModifiers();
 	}
 	return TArray<FStatModifier>();
 }
@@ -422,12 +460,9 @@ void UStatsComponent::StopModifierCleanupTimerIfUnused()
 
 	for (const FStatEntry& Entry : StatArray.Items)
 	{
-		for (const FStatModifier& Modifier : Entry.Modifiers)
+		if (Entry.HasTimedModifiers())
 		{
-			if (Modifier.Duration > 0.0f)
-			{
-				return;
-			}
+			return;
 		}
 	}
 
@@ -440,19 +475,11 @@ void UStatsComponent::CleanupExpiredModifiers()
 
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 
-	for (FStatEntry& Entry : StatArray.Items)
+	for (int32 i = 0; i < StatArray.Items.Num(); ++i)
 	{
-		int32 RemovedCount = Entry.Modifiers.RemoveAll([CurrentTime](const FStatModifier& Mod)
+		if (StatArray.Items[i].RemoveExpiredModifiers(CurrentTime) > 0)
 		{
-			return Mod.IsExpired(CurrentTime);
-		});
-
-		if (RemovedCount > 0)
-		{
-			float OldValue = Entry.CurrentValue;
-			Entry.RecalculateValue();
-			StatArray.MarkItemDirty(Entry);
-			OnStatModified.Broadcast(Entry.StatTag, OldValue, Entry.CurrentValue);
+			RecalculateStat(i);
 		}
 	}
 	StopModifierCleanupTimerIfUnused();
@@ -3,6 +3,11 @@
 
 #include "UI/Navigation/Compass/CompassWidget.h"
 
+#include "Components/Overlay.h"
+#include "UI/UIUtilityLibrary.h"
+#include "UI/Navigation/NavigationMarkerLayerWidget.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
+#include "UI/Navigation/Compass/CompassMarkerWidget.h"
 
 
 void UCompassWidget::NativePreConstruct()
@@ -24,3 +29,93 @@ void UCompassWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
 	Super::NativeTick(MyGeometry, InDeltaTime);
 }
+
+void UCompassWidget::AddOrUpdateCompassMarker(UObject* MarkerObject, const FCompassMarkerInfo& MarkerInfo)
+{
+	UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this);
+	if (Layer_CompassMarkers && MarkerSubsystem)
+	{
+		// 미니맵/월드 마커가 같은 대상을 등록했으면 그 뷰는 유지, 대상 검증은 서브시스템이 함
+		ENavigationMarkerFlags Flags = MarkerSubsystem->GetMarkerViews(MarkerObject) | ENavigationMarkerFlags::Compass;
+		if (MarkerInfo.ScreenPersistance)
+		{
+			Flags |= ENavigationMarkerFlags::ClampToEdge;
+		}
+		MarkerSubsystem->AddOrUpdateMarker(MarkerObject, MarkerInfo.MarkerIcon, MarkerInfo.MarkerColor, MarkerInfo.MarkerScale, static_cast<int32>(Flags));
+		if (MarkerSubsystem->HasMarker(MarkerObject))
+		{
+			LayerMarkers.Add(MarkerObject);
+		}
+		return;
+	}
+
+	// 배치 레이어가 없는 블루프린트는 기존 마커 위젯 사용
+	if (!MarkerObject || !CompassMarkerClass)
+	{
+		return;
+	}
+
+	UCompassMarkerWidget* MarkerWidget = MarkerMap.FindRef(MarkerObject);
+	if (!MarkerWidget)
+	{
+		MarkerWidget = CreateWidget<UCompassMarkerWidget>(this, CompassMarkerClass);
+		if (!MarkerWidget)
+		{
+			return;
+		}
+		MarkerWidget->MarkerObject = MarkerObject;
+		MarkerWidget->Parent = this;
+		UUIUtilityLibrary::AddChildToOverlay(Overlay_MarkerParent, MarkerWidget, VAlign_Center, HAlign_Center);
+		MarkerMap.Add(MarkerObject, MarkerWidget);
+	}
+
+	MarkerWidget->MarkerInfo = MarkerInfo;
+	MarkerWidget->PingMarker = MarkerInfo.PingMarker;
+	MarkerWidget->ShowMarkerDistance = MarkerInfo.ShowMarkerDistance;
+	MarkerWidget->MarkerVisibilityRadius = MarkerInfo.MarkerVisibilityRadius;
+	MarkerWidget->MarkerVisibilitySmoothTransition = MarkerInfo.MarkerVisibilitySmoothTransition;
+	MarkerWidget->ScreenPersistance = MarkerInfo.ScreenPersistance;
+}
+
+void UCompassWidget::RemoveCompassMarker(UObject* MarkerObject)
+{
+	if (LayerMarkers.Remove(MarkerObject) > 0)
+	{
+		if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+		{
+			MarkerSubsystem->RemoveMarkerViews(MarkerObject, ENavigationMarkerFlags::Compass);
+		}
+	}
+
+	UCompassMarkerWidget* MarkerWidget = nullptr;
+	if (MarkerMap.RemoveAndCopyValue(MarkerObject, MarkerWidget) && MarkerWidget)
+	{
+		MarkerWidget->RemoveFromParent();
+	}
+}
+
+void UCompassWidget::RemoveAllCompassMarkers()
+{
+	// 이 나침반이 등록한 레이어 마커의 나침반 뷰만 제거 (다른 뷰의 마커는 유지)
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+	{
+		for (const TWeakObjectPtr<UObject>& Marker : LayerMarkers)
+		{
+			// 파괴된 대상의 마커는 서브시스템이 이미 제거함
+			if (UObject* MarkerObject = Marker.Get())
+			{
+				MarkerSubsystem->RemoveMarkerViews(MarkerObject, ENavigationMarkerFlags::Compass);
+			}
+		}
+	}
+	LayerMarkers.Empty();
+
+	for (const TPair<UObject*, UCompassMarkerWidget*>& Pair : MarkerMap)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->RemoveFromParent();
+		}
+	}
+	MarkerMap.Empty();
+}
@@ -0,0 +1,316 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/Minimap/MinimapTileCacheSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
+
+static TAutoConsoleVariable<int32> CVarMinimapTileCacheBudgetMB(
+	TEXT("RPGMinimap.TileCacheBudgetMB"),
+	64,
+	TEXT("Memory budget (MB) of resident minimap tiles. Least recently used tiles are released above it, tiles drawn this frame are always kept."));
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld CmdMinimapTileCacheStats(
+	TEXT("RPGMinimap.TileCacheStats"),
+	TEXT("Logs the number and size of resident minimap tiles."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UMinimapTileCacheSubsystem* TileCache = UMinimapTileCacheSubsystem::Get(World))
+		{
+			TileCache->LogStats();
+		}
+	}));
+#endif
+
+void UMinimapTileCacheSubsystem::Deinitialize()
+{
+	Flush();
+
+	Super::Deinitialize();
+}
+
+bool UMinimapTileCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UMinimapTileCacheSubsystem* UMinimapTileCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UMinimapTileCacheSubsystem>() : nullptr;
+}
+
+UMinimapTileCacheSubsystem::FTileEntry* UMinimapTileCacheSubsystem::FindEntry(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY, FSoftObjectPath& OutPath)
+{
+	if (!TileSet)
+	{
+		return nullptr;
+	}
+
+	OutPath = TileSet->GetTile(Level, TileX, TileY).ToSoftObjectPath();
+	return OutPath.IsNull() ? nullptr : Tiles.Find(OutPath);
+}
+
+const FSlateBrush* UMinimapTileCacheSubsystem::FindResidentTile(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY)
+{
+	FSoftObjectPath TilePath;
+	FTileEntry* Entry = FindEntry(TileSet, Level, TileX, TileY, TilePath);
+	if (!Entry || !Entry->bLoaded)
+	{
+		return nullptr;
+	}
+
+	Entry->LastUsedFrame = GFrameCounter;
+	return &Entry->Brush;
+}
+
+const FSlateBrush* UMinimapTileCacheSubsystem::RequestTile(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY)
+{
+	FSoftObjectPath TilePath;
+	if (FTileEntry* Entry = FindEntry(TileSet, Level, TileX, TileY, TilePath))
+	{
+		Entry->LastUsedFrame = GFrameCounter;
+		return Entry->bLoaded ? &Entry->Brush : nullptr;
+	}
+
+	if (TilePath.IsNull() || MissingTiles.Contains(TilePath))
+	{
+		return nullptr;
+	}
+
+	// 로드 전에는 압축 포맷 기준 대략적인 크기로 예산 계산
+	FTileEntry& NewEntry = Tiles.Add(TilePath);
+	NewEntry.SizeBytes = static_cast<int64>(TileSet->TileSize) * TileSet->TileSize;
+	NewEntry.LastUsedFrame = GFrameCounter;
+	ResidentBytes += NewEntry.SizeBytes;
+
+	// 이미 로드된 타일이면 완료 콜백이 이 안에서 바로 호출됨
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		TilePath,
+		FStreamableDelegate::CreateUObject(this, &UMinimapTileCacheSubsystem::HandleTileLoaded, TilePath),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	FTileEntry* Entry = Tiles.Find(TilePath);
+	if (Entry)
+	{
+		Entry->Handle = Handle;
+	}
+
+	EvictOverBudget();
+
+	Entry = Tiles.Find(TilePath);
+	return Entry && Entry->bLoaded ? &Entry->Brush : nullptr;
+}
+
+void UMinimapTileCacheSubsystem::HandleTileLoaded(FSoftObjectPath TilePath)
+{
+	FTileEntry* Entry = Tiles.Find(TilePath);
+	if (!Entry)
+	{
+		return;
+	}
+
+	// 핸들이 아직 저장되지 않았을 수 있으므로 경로로 찾음
+	UTexture2D* Texture = Cast<UTexture2D>(TilePath.ResolveObject());
+	if (!Texture)
+	{
+		// 빠진 타일은 추정 크기가 예산을 계속 차지하지 않도록 엔트리를 빼고 경로만 기록해 다시 요청하지 않음
+		UE_LOG(LogTemp, Warning, TEXT("UMinimapTileCacheSubsystem: failed to load tile %s"), *TilePath.ToString());
+
+		FTileEntry FailedEntry;
+		if (Tiles.RemoveAndCopyValue(TilePath, FailedEntry))
+		{
+			ResidentBytes -= FailedEntry.SizeBytes;
+			ReleaseEntry(FailedEntry);
+		}
+		MissingTiles.Add(TilePath);
+		return;
+	}
+
+	Entry->Brush = FSlateBrush();
+	Entry->Brush.SetResourceObject(Texture);
+	Entry->Brush.ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+	Entry->bLoaded = true;
+
+	// 추정치를 실제 크기로 교체
+	ResidentBytes -= Entry->SizeBytes;
+	Entry->SizeBytes = Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+	ResidentBytes += Entry->SizeBytes;
+
+	EvictOverBudget();
+}
+
+void UMinimapTileCacheSubsystem::EvictOverBudget()
+{
+	const int64 BudgetBytes = static_cast<int64>(FMath::Max(1, CVarMinimapTileCacheBudgetMB.GetValueOnGameThread())) * 1024 * 1024;
+	if (ResidentBytes <= BudgetBytes)
+	{
+		return;
+	}
+
+	struct FEvictionCandidate
+	{
+		FSoftObjectPath Path;
+		uint64 LastUsedFrame;
+	};
+
+	TArray<FEvictionCandidate> Candidates;
+	Candidates.Reserve(Tiles.Num());
+	for (const TPair<FSoftObjectPath, FTileEntry>& Pair : Tiles)
+	{
+		if (Pair.Value.LastUsedFrame < GFrameCounter)
+		{
+			Candidates.Add({ Pair.Key, Pair.Value.LastUsedFrame });
+		}
+	}
+
+	Candidates.Sort([](const FEvictionCandidate& A, const FEvictionCandidate& B)
+	{
+		return A.LastUsedFrame < B.LastUsedFrame;
+	});
+
+	for (const FEvictionCandidate& Candidate : Candidates)
+	{
+		if (ResidentBytes <= BudgetBytes)
+		{
+			break;
+		}
+
+		FTileEntry Entry;
+		if (Tiles.RemoveAndCopyValue(Candidate.Path, Entry))
+		{
+			ResidentBytes -= Entry.SizeBytes;
+
+			ReleaseEntry(Entry);
+		}
+	}
+}
+
+void UMinimapTileCacheSubsystem::ReleaseEntry(FTileEntry& Entry)
+{
+	if (!Entry.Handle.IsValid())
+	{
+		return;
+	}
+
+	// 로드 중이면 취소, 로드됐으면 참조를 놓아 GC가 정리
+	if (Entry.Handle->IsLoadingInProgress())
+	{
+		Entry.Handle->CancelHandle();
+	}
+	else
+	{
+		Entry.Handle->ReleaseHandle();
+	}
+	Entry.Handle.Reset();
+}
+
+void UMinimapTileCacheSubsystem::Flush()
+{
+	for (TPair<FSoftObjectPath, FTileEntry>& Pair : Tiles)
+	{
+		ReleaseEntry(Pair.Value);
+	}
+
+	Tiles.Empty();
+	MissingTiles.Empty();
+	ResidentBytes = 0;
+}
+
+void UMinimapTileCacheSubsystem::LogStats() const
+{
+	int32 NumLoaded = 0;
+	for (const TPair<FSoftObjectPath, FTileEntry>& Pair : Tiles)
+	{
+		NumLoaded += Pair.Value.bLoaded ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UMinimapTileCacheSubsystem: %d tiles (%d loaded, %d loading, %d missing), %.2f / %d MB"),
+		Tiles.Num(), NumLoaded, Tiles.Num() - NumLoaded, MissingTiles.Num(),
+		ResidentBytes / (1024.0 * 1024.0), CVarMinimapTileCacheBudgetMB.GetValueOnGameThread());
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * 예산을 넘으면 이번 프레임에 쓰이지 않은 타일만 오래된 순으로, 예산 안으로 들어올 때까지 해제하는지 검사
+ * 타일은 로드하지 않고 엔트리만 채움 (크기는 현재 예산 기준)
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinimapTileCacheEvictionTest, "RPGSystem.Minimap.TileCache.Eviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinimapTileCacheEvictionTest::RunTest(const FString& Parameters)
+{
+	// 마지막 사용 프레임이 현재보다 이전이어야 후보가 되므로 프레임 카운터가 충분히 커야 함
+	constexpr int32 NumTiles = 6;
+	if (!TestTrue(TEXT("Frame counter is past the test frames"), GFrameCounter > NumTiles))
+	{
+		return false;
+	}
+
+	const TStrongObjectPtr<UMinimapTileCacheSubsystem> TileCache(NewObject<UMinimapTileCacheSubsystem>(GetTransientPackage()));
+
+	// 타일 3개가 예산에 들어가는 크기
+	const int64 BudgetBytes = static_cast<int64>(FMath::Max(1, CVarMinimapTileCacheBudgetMB.GetValueOnGameThread())) * 1024 * 1024;
+	const int64 TileBytes = BudgetBytes / 3;
+
+	const auto GetTilePath = [](int32 Index)
+	{
+		return FSoftObjectPath(FString::Printf(TEXT("/Game/MinimapTileCacheTest/Tile_%d.Tile_%d"), Index, Index));
+	};
+
+	// 인덱스별로 몇 프레임 전에 쓰였는지 (0은 이번 프레임)
+	const auto FillTiles = [&TileCache, TileBytes, &GetTilePath](const int32 (&FramesAgo)[NumTiles])
+	{
+		TileCache->Flush();
+		for (int32 i = 0; i < NumTiles; ++i)
+		{
+			UMinimapTileCacheSubsystem::FTileEntry& Entry = TileCache->Tiles.Add(GetTilePath(i));
+			Entry.SizeBytes = TileBytes;
+			Entry.LastUsedFrame = GFrameCounter - FramesAgo[i];
+			TileCache->ResidentBytes += TileBytes;
+		}
+	};
+
+	// 두 배로 넘친 상태: 이번 프레임 타일(0)은 남기고 가장 오래된 1, 3, 5부터 해제
+	const int32 MixedFramesAgo[NumTiles] = { 0, 5, 1, 4, 2, 3 };
+	FillTiles(MixedFramesAgo);
+	TileCache->EvictOverBudget();
+
+	TestEqual(TEXT("Evicted down to the budget"), TileCache->GetNumTiles(), 3);
+	TestTrue(TEXT("Resident bytes within the budget"), TileCache->GetResidentBytes() <= BudgetBytes);
+	for (int32 i = 0; i < NumTiles; ++i)
+	{
+		const bool bExpectResident = MixedFramesAgo[i] <= 2;
+		TestTrue(FString::Printf(TEXT("Tile %d (%d frames ago) %s"), i, MixedFramesAgo[i], bExpectResident ? TEXT("kept") : TEXT("evicted")),
+			TileCache->Tiles.Contains(GetTilePath(i)) == bExpectResident);
+	}
+
+	// 모두 이번 프레임에 쓰였으면 예산을 넘어도 해제하지 않음
+	const int32 CurrentFramesAgo[NumTiles] = { 0, 0, 0, 0, 0, 0 };
+	FillTiles(CurrentFramesAgo);
+	TileCache->EvictOverBudget();
+	TestEqual(TEXT("Tiles used this frame are kept over the budget"), TileCache->GetNumTiles(), NumTiles);
+
+	// 이번 프레임 타일 외에는 모두 해제해도 넘치면 이번 프레임 타일만 남음
+	const int32 MostlyCurrentFramesAgo[NumTiles] = { 0, 0, 0, 0, 1, 2 };
+	FillTiles(MostlyCurrentFramesAgo);
+	TileCache->EvictOverBudget();
+	TestEqual(TEXT("Only tiles used this frame remain"), TileCache->GetNumTiles(), 4);
+
+	TileCache->Flush();
+	return true;
+}
+
+#endif
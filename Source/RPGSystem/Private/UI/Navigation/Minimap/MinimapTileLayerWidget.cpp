@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/Minimap/MinimapTileLayerWidget.h"
+#include "UI/Navigation/Minimap/MinimapTileCacheSubsystem.h"
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
+#include "UI/Navigation/Minimap/SMinimapTileLayer.h"
+
+#define LOCTEXT_NAMESPACE "Minimap"
+
+UMinimapTileLayerWidget::UMinimapTileLayerWidget()
+{
+	SetVisibilityInternal(ESlateVisibility::HitTestInvisible);
+}
+
+void UMinimapTileLayerWidget::SetTileSet(UMinimapTileSet* InTileSet)
+{
+	TileSet = InTileSet;
+	if (MyTileLayer.IsValid())
+	{
+		MyTileLayer->SetTileSet(TileSet);
+	}
+}
+
+void UMinimapTileLayerWidget::SetTint(FLinearColor InTint)
+{
+	Tint = InTint;
+	if (MyTileLayer.IsValid())
+	{
+		MyTileLayer->SetAppearance(Tint, LevelBias);
+	}
+}
+
+TSharedRef<SWidget> UMinimapTileLayerWidget::RebuildWidget()
+{
+	MyTileLayer = SNew(SMinimapTileLayer);
+	return MyTileLayer.ToSharedRef();
+}
+
+void UMinimapTileLayerWidget::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (MyTileLayer.IsValid())
+	{
+		MyTileLayer->SetTileSet(TileSet);
+		MyTileLayer->SetAppearance(Tint, LevelBias);
+		MyTileLayer->SetTileCache(UMinimapTileCacheSubsystem::Get(this));
+	}
+}
+
+void UMinimapTileLayerWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyTileLayer.Reset();
+}
+
+#if WITH_EDITOR
+const FText UMinimapTileLayerWidget::GetPaletteCategory()
+{
+	return LOCTEXT("PaletteCategory", "RPG");
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
+#include "Engine/Texture2D.h"
+
+const TSoftObjectPtr<UTexture2D>& UMinimapTileSet::GetTile(int32 Level, int32 TileX, int32 TileY) const
+{
+	static const TSoftObjectPtr<UTexture2D> EmptyTile;
+
+	if (!Levels.IsValidIndex(Level))
+	{
+		return EmptyTile;
+	}
+
+	const FMinimapTileLevel& TileLevel = Levels[Level];
+	if (TileX < 0 || TileY < 0 || TileX >= TileLevel.NumTilesX || TileY >= TileLevel.NumTilesY)
+	{
+		return EmptyTile;
+	}
+
+	const int32 TileIndex = TileY * TileLevel.NumTilesX + TileX;
+	return TileLevel.Tiles.IsValidIndex(TileIndex) ? TileLevel.Tiles[TileIndex] : EmptyTile;
+}
+
+int32 UMinimapTileSet::SelectLevel(float SourcePixelsPerScreenPixel, float Bias) const
+{
+	if (Levels.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// 단계 L은 원본 픽셀 2^L개를 타일 픽셀 하나로 줄인 것
+	const float Ratio = FMath::Max(SourcePixelsPerScreenPixel, 1.0f);
+	const int32 Level = FMath::FloorToInt32(FMath::Log2(Ratio) + Bias);
+	return FMath::Clamp(Level, 0, Levels.Num() - 1);
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace MinimapTileSetTest
+{
+	FString GetTilePath(int32 Level, int32 TileX, int32 TileY)
+	{
+		const FString TileName = FString::Printf(TEXT("Test_L%d_%d_%d"), Level, TileX, TileY);
+		return FString::Printf(TEXT("/Game/MinimapTileSetTest/%s.%s"), *TileName, *TileName);
+	}
+
+	// 단계마다 절반 크기인 가짜 타일 참조 (텍스처는 로드하지 않음)
+	UMinimapTileSet* CreateTileSet(int32 NumTilesX, int32 NumTilesY, int32 NumLevels)
+	{
+		UMinimapTileSet* TileSet = NewObject<UMinimapTileSet>(GetTransientPackage());
+		TileSet->TileSize = 256;
+		TileSet->SourceSize = FIntPoint(NumTilesX * 256, NumTilesY * 256);
+
+		for (int32 Level = 0; Level < NumLevels; ++Level)
+		{
+			FMinimapTileLevel& TileLevel = TileSet->Levels.AddDefaulted_GetRef();
+			TileLevel.NumTilesX = NumTilesX;
+			TileLevel.NumTilesY = NumTilesY;
+
+			for (int32 TileY = 0; TileY < NumTilesY; ++TileY)
+			{
+				for (int32 TileX = 0; TileX < NumTilesX; ++TileX)
+				{
+					TileLevel.Tiles.Emplace(FSoftObjectPath(GetTilePath(Level, TileX, TileY)));
+				}
+			}
+
+			NumTilesX = FMath::Max(1, (NumTilesX + 1) / 2);
+			NumTilesY = FMath::Max(1, (NumTilesY + 1) / 2);
+		}
+		return TileSet;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinimapTileSetSelectLevelTest, "RPGSystem.Minimap.TileSet.SelectLevel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinimapTileSetSelectLevelTest::RunTest(const FString& Parameters)
+{
+	const TStrongObjectPtr<UMinimapTileSet> TileSet(MinimapTileSetTest::CreateTileSet(4, 3, 4));
+
+	// 2의 거듭제곱 경계는 Log2 오차를 피해 약간 벗어난 값으로 검사
+	TestEqual(TEXT("Magnified uses level 0"), TileSet->SelectLevel(0.25f), 0);
+	TestEqual(TEXT("1:1 uses level 0"), TileSet->SelectLevel(1.0f), 0);
+	TestEqual(TEXT("Below 2:1 uses level 0"), TileSet->SelectLevel(1.9f), 0);
+	TestEqual(TEXT("2.5:1 uses level 1"), TileSet->SelectLevel(2.5f), 1);
+	TestEqual(TEXT("4.5:1 uses level 2"), TileSet->SelectLevel(4.5f), 2);
+	TestEqual(TEXT("8.5:1 uses level 3"), TileSet->SelectLevel(8.5f), 3);
+	TestEqual(TEXT("Beyond the last level is clamped"), TileSet->SelectLevel(1000.0f), 3);
+
+	TestEqual(TEXT("Positive bias is coarser"), TileSet->SelectLevel(1.5f, 1.0f), 1);
+	TestEqual(TEXT("Negative bias is finer"), TileSet->SelectLevel(4.5f, -1.0f), 1);
+	TestEqual(TEXT("Negative bias is clamped to level 0"), TileSet->SelectLevel(1.0f, -2.0f), 0);
+	TestEqual(TEXT("Positive bias is clamped to the last level"), TileSet->SelectLevel(8.5f, 2.0f), 3);
+
+	const TStrongObjectPtr<UMinimapTileSet> EmptyTileSet(NewObject<UMinimapTileSet>(GetTransientPackage()));
+	TestEqual(TEXT("Empty tile set has no level"), EmptyTileSet->SelectLevel(1.0f), static_cast<int32>(INDEX_NONE));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinimapTileSetGetTileTest, "RPGSystem.Minimap.TileSet.GetTile",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinimapTileSetGetTileTest::RunTest(const FString& Parameters)
+{
+	using namespace MinimapTileSetTest;
+
+	// 0단계 3x2, 1단계 2x1, 2단계 1x1
+	const TStrongObjectPtr<UMinimapTileSet> TileSet(CreateTileSet(3, 2, 3));
+
+	// 행 우선 순서
+	for (int32 TileY = 0; TileY < 2; ++TileY)
+	{
+		for (int32 TileX = 0; TileX < 3; ++TileX)
+		{
+			TestEqual(FString::Printf(TEXT("Level 0 tile (%d, %d)"), TileX, TileY),
+				TileSet->GetTile(0, TileX, TileY).ToString(), GetTilePath(0, TileX, TileY));
+		}
+	}
+	TestEqual(TEXT("Level 1 last tile"), TileSet->GetTile(1, 1, 0).ToString(), GetTilePath(1, 1, 0));
+	TestEqual(TEXT("Level 2 single tile"), TileSet->GetTile(2, 0, 0).ToString(), GetTilePath(2, 0, 0));
+
+	TestTrue(TEXT("Negative X is empty"), TileSet->GetTile(0, -1, 0).IsNull());
+	TestTrue(TEXT("Negative Y is empty"), TileSet->GetTile(0, 0, -1).IsNull());
+	TestTrue(TEXT("X past the row is empty (does not wrap to the next row)"), TileSet->GetTile(0, 3, 0).IsNull());
+	TestTrue(TEXT("Y past the last row is empty"), TileSet->GetTile(0, 0, 2).IsNull());
+	TestTrue(TEXT("X inside level 0 but outside level 1 is empty"), TileSet->GetTile(1, 2, 0).IsNull());
+	TestTrue(TEXT("Negative level is empty"), TileSet->GetTile(-1, 0, 0).IsNull());
+	TestTrue(TEXT("Level past the last is empty"), TileSet->GetTile(3, 0, 0).IsNull());
+
+	// 타일 배열이 타일 수보다 짧은 (잘못 만든) 단계
+	TileSet->Levels[0].Tiles.SetNum(4);
+	TestEqual(TEXT("Tile inside a truncated level"), TileSet->GetTile(0, 0, 1).ToString(), GetTilePath(0, 0, 1));
+	TestTrue(TEXT("Tile missing from a truncated level is empty"), TileSet->GetTile(0, 2, 1).IsNull());
+
+	return true;
+}
+
+#endif
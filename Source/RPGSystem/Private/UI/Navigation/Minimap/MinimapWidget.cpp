@@ -9,11 +9,14 @@
 #include "Components/Image.h"
 #include "Components/Overlay.h"
 #include "Components/RetainerBox.h"
-#include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "UI/UIUtilityLibrary.h"
+#include "UI/Navigation/NavigationMarkerLayerWidget.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
 #include "UI/Navigation/Minimap/MinimapDistantMarkerWidget.h"
 #include "UI/Navigation/Minimap/MinimapMarkerWidget.h"
+#include "UI/Navigation/Minimap/MinimapTileLayerWidget.h"
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
 
 UMinimapWidget::UMinimapWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -119,19 +122,65 @@ void UMinimapWidget::AddOrUpdateMarker(UObject* Marker, bool ScaleWithZoom, FMin
 	}
 }
 
+void UMinimapWidget::AddOrUpdateMarker(UObject* Marker, const FMinimapMarkerInfo& MarkerInfo)
+{
+	UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this);
+	if (!Layer_MapMarkers || !MarkerSubsystem)
+	{
+		// 배치 레이어가 없는 블루프린트는 기존 마커 위젯 사용
+		AddOrUpdateMarker(Marker, false, MiniMapInfo);
+		return;
+	}
+
+	// 원거리 마커 위젯 대신 가장자리 고정, 대상 검증(액터 또는 씬 컴포넌트)은 서브시스템이 함
+	// 나침반/월드 마커가 같은 대상을 등록했으면 그 뷰는 유지
+	const ENavigationMarkerFlags Flags = MarkerSubsystem->GetMarkerViews(Marker) | ENavigationMarkerFlags::Minimap | ENavigationMarkerFlags::ClampToEdge;
+	MarkerSubsystem->AddOrUpdateMarker(Marker, MarkerInfo.MarkerIcon, MarkerInfo.MarkerColor, MarkerInfo.MarkerScale, static_cast<int32>(Flags));
+	if (MarkerSubsystem->HasMarker(Marker))
+	{
+		LayerMarkers.Add(Marker);
+	}
+}
+
 void UMinimapWidget::RemoveMarker(UObject* Marker)
 {
-	// 마커 제거 로직 (구현 필요 시 추가)
+	// 레이어 마커만 제거 (마커 위젯 제거 로직은 구현 필요 시 추가)
+	if (LayerMarkers.Remove(Marker) > 0)
+	{
+		if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+		{
+			MarkerSubsystem->RemoveMarkerViews(Marker, ENavigationMarkerFlags::Minimap);
+		}
+	}
 }
 
 void UMinimapWidget::RemoveAllMinimapMarker()
 {
-	// 모든 마커 제거 로직 (구현 필요 시 추가)
+	// 이 미니맵이 등록한 레이어 마커의 미니맵 뷰만 제거 (다른 뷰의 마커는 유지)
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+	{
+		for (const TWeakObjectPtr<UObject>& Marker : LayerMarkers)
+		{
+			// 파괴된 대상의 마커는 서브시스템이 이미 제거함
+			if (UObject* MarkerObject = Marker.Get())
+			{
+				MarkerSubsystem->RemoveMarkerViews(MarkerObject, ENavigationMarkerFlags::Minimap);
+			}
+		}
+	}
+	LayerMarkers.Empty();
 }
 
 void UMinimapWidget::SetupMinimapInfo(FMiniMapInfo& Info)
 {
 	MiniMapInfo = Info;
+
+	// 마커 레이어(UNavigationMarkerLayerWidget)도 같은 경계로 투영
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this))
+	{
+		MarkerSubsystem->SetMinimapBounds(MiniMapInfo.BottomLeftActor, MiniMapInfo.TopRightActor);
+	}
+
 	SetupMap();
 	SetMinimapInfoToMarker();
 }
@@ -143,20 +192,39 @@ void UMinimapWidget::SetupMap()
 	TopRight = MiniMapInfo.TopRightCoordinates;
 	TRCache = TopRight;
 
+	// 타일 피라미드가 있으면 텍스처 한 장 대신 보이는 타일만 스트리밍
+	if (MiniMapInfo.MinimapTileSet && Tile_Map)
+	{
+		Tile_Map->SetTileSet(MiniMapInfo.MinimapTileSet);
+		Tile_Map->SetVisibility(ESlateVisibility::HitTestInvisible);
+		if (Img_Map)
+		{
+			// 캔버스 슬롯 위치/크기 기준으로는 계속 쓰므로 Collapsed가 아닌 Hidden
+			Img_Map->SetVisibility(ESlateVisibility::Hidden);
+		}
+		return;
+	}
+
+	if (Tile_Map)
+	{
+		Tile_Map->SetTileSet(nullptr);
+		Tile_Map->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	if (Img_Map)
+	{
+		Img_Map->SetVisibility(ESlateVisibility::Visible);
+	}
 	UUIUtilityLibrary::SetImageBrush(Img_Map, MiniMapInfo.MinimapTexture);
 }
 
 void UMinimapWidget::SetMinimapInfoToMarker()
 {
-	if(!OV_MapMarkers) return;
-
-	TArray<UWidget*> Widgets = OV_MapMarkers->GetAllChildren();
-
-	for(auto& Widget : Widgets)
+	// OV_MapMarkers의 자식은 모두 MarkerMap에 등록된 마커이므로 자식 순회/Cast 없이 맵만 순회
+	for(const TPair<UObject*, UMinimapMarkerWidget*>& Pair : MarkerMap)
 	{
-		if(UMinimapMarkerWidget* MarkerWidget = Cast<UMinimapMarkerWidget>(Widget))
+		if(Pair.Value)
 		{
-			MarkerWidget->MiniMapInfo = MiniMapInfo;
+			Pair.Value->MiniMapInfo = MiniMapInfo;
 		}
 	}
 }
@@ -186,15 +254,10 @@ FVector2D UMinimapWidget::GetPlayerLocation2D() const
 
 FVector2D UMinimapWidget::GetBottomLeftLocation2D() const
 {
+	// 경계 액터는 UNavigationMarkerSubsystem이 클래스별로 한 번만 찾아 캐시
 	if (IsValid(MiniMapInfo.BottomLeftActor))
 	{
-		TArray<AActor*> Actors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), MiniMapInfo.BottomLeftActor, Actors);
-       
-		if (Actors.Num() > 0 && Actors[0])
-		{
-			return FVector2D(Actors[0]->GetActorLocation());
-		}
+		return FVector2D(UUIUtilityLibrary::GetMiniMapActorLocation(GetWorld(), MiniMapInfo.BottomLeftActor));
 	}
     
 	return FVector2D::ZeroVector;
@@ -202,15 +265,10 @@ FVector2D UMinimapWidget::GetBottomLeftLocation2D() const
 
 FVector2D UMinimapWidget::GetTopRightLocation2D() const
 {
+	// 경계 액터는 UNavigationMarkerSubsystem이 클래스별로 한 번만 찾아 캐시
 	if (IsValid(MiniMapInfo.TopRightActor))
 	{
-		TArray<AActor*> Actors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), MiniMapInfo.TopRightActor, Actors);
-       
-		if (Actors.Num() > 0 && Actors[0])
-		{
-			return FVector2D(Actors[0]->GetActorLocation());
-		}
+		return FVector2D(UUIUtilityLibrary::GetMiniMapActorLocation(GetWorld(), MiniMapInfo.TopRightActor));
 	}
     
 	return FVector2D::ZeroVector;
@@ -254,6 +312,10 @@ void UMinimapWidget::SetCanvasMapPosition(FVector2D InPosition) const
 	{
 		UWidgetLayoutLibrary::SlotAsCanvasSlot(B_MapMarkers)->SetPosition(InPosition);
 	}
+	if(UCanvasPanelSlot* TileMapSlot = UWidgetLayoutLibrary::SlotAsCanvasSlot(Tile_Map))
+	{
+		TileMapSlot->SetPosition(InPosition);
+	}
 }
 
 void UMinimapWidget::SetCanvasMapSize(float InSize) const
@@ -267,10 +329,18 @@ void UMinimapWidget::SetCanvasMapSize(float InSize) const
 	{
 		UWidgetLayoutLibrary::SlotAsCanvasSlot(B_MapMarkers)->SetSize(SizeVector);
 	}
+	if(UCanvasPanelSlot* TileMapSlot = UWidgetLayoutLibrary::SlotAsCanvasSlot(Tile_Map))
+	{
+		TileMapSlot->SetSize(SizeVector);
+	}
 }
 
 float UMinimapWidget::GetMapTextureSize() const
 {
+	if(MiniMapInfo.MinimapTileSet)
+	{
+		return MiniMapInfo.MinimapTileSet->SourceSize.X;
+	}
 	if(Img_Map)
 	{
 		FSlateBrush MapBrush = Img_Map->GetBrush();
@@ -332,6 +402,10 @@ void UMinimapWidget::SetMinimapTint(FLinearColor InColor)
 	{
 		Img_Map->SetColorAndOpacity(InColor);
 	}
+	if(Tile_Map)
+	{
+		Tile_Map->SetTint(InColor);
+	}
 }
 
 float UMinimapWidget::FindAngleByDirection(int32 InAngle)
@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/Minimap/SMinimapTileLayer.h"
+#include "Rendering/DrawElements.h"
+#include "UI/Navigation/Minimap/MinimapTileCacheSubsystem.h"
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
+
+void SMinimapTileLayer::Construct(const FArguments& InArgs)
+{
+	// 맵이 매 프레임 이동/줌하므로 캐싱하지 않음
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+void SMinimapTileLayer::SetTileSet(const UMinimapTileSet* InTileSet)
+{
+	TileSet = InTileSet;
+}
+
+void SMinimapTileLayer::SetTileCache(UMinimapTileCacheSubsystem* InTileCache)
+{
+	TileCache = InTileCache;
+}
+
+void SMinimapTileLayer::SetAppearance(const FLinearColor& InTint, float InLevelBias)
+{
+	Tint = InTint;
+	LevelBias = InLevelBias;
+}
+
+int32 SMinimapTileLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UMinimapTileSet* Tiles = TileSet.Get();
+	UMinimapTileCacheSubsystem* Cache = TileCache.Get();
+	if (!Tiles || !Cache || !Tiles->IsValidTileSet())
+	{
+		return LayerId;
+	}
+
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+	if (LocalSize.X <= 0.0 || LocalSize.Y <= 0.0)
+	{
+		return LayerId;
+	}
+
+	// 컬링 영역을 로컬 좌표로 (미니맵 회전을 고려해 네 모서리의 경계 상자)
+	FBox2D VisibleBox(ForceInit);
+	VisibleBox += AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft());
+	VisibleBox += AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopRight());
+	VisibleBox += AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomLeft());
+	VisibleBox += AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight());
+
+	const FVector2D VisibleMin = FVector2D::Max(VisibleBox.Min, FVector2D::ZeroVector);
+	const FVector2D VisibleMax = FVector2D::Min(VisibleBox.Max, LocalSize);
+	if (VisibleMin.X >= VisibleMax.X || VisibleMin.Y >= VisibleMax.Y)
+	{
+		return LayerId;
+	}
+
+	// 화면에 그려지는 맵 폭 대비 원본 해상도로 단계 선택
+	const FVector2D SourceSize(Tiles->SourceSize);
+	const float ScreenWidth = LocalSize.X * AllottedGeometry.Scale;
+	const int32 Level = Tiles->SelectLevel(ScreenWidth > 0.0f ? SourceSize.X / ScreenWidth : 1.0f, LevelBias);
+	const FMinimapTileLevel& TileLevel = Tiles->Levels[Level];
+
+	// 단계 L의 타일 하나가 덮는 로컬 크기
+	const FVector2D SourceToLocal = LocalSize / SourceSize;
+	const FVector2D TileLocalSize = SourceToLocal * static_cast<double>(Tiles->TileSize << Level);
+
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt32(VisibleMin.X / TileLocalSize.X), 0, TileLevel.NumTilesX - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt32(VisibleMin.Y / TileLocalSize.Y), 0, TileLevel.NumTilesY - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt32(VisibleMax.X / TileLocalSize.X), 0, TileLevel.NumTilesX - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt32(VisibleMax.Y / TileLocalSize.Y), 0, TileLevel.NumTilesY - 1);
+
+	const FLinearColor DrawTint = Tint * InWidgetStyle.GetColorAndOpacityTint();
+	const int32 CoarsestLevel = Tiles->GetNumLevels() - 1;
+
+	for (int32 TileY = MinY; TileY <= MaxY; ++TileY)
+	{
+		for (int32 TileX = MinX; TileX <= MaxX; ++TileX)
+		{
+			const FVector2D TilePosition(TileX * TileLocalSize.X, TileY * TileLocalSize.Y);
+
+			if (const FSlateBrush* TileBrush = Cache->RequestTile(Tiles, Level, TileX, TileY))
+			{
+				FSlateDrawElement::MakeBox(
+					OutDrawElements,
+					LayerId,
+					AllottedGeometry.ToPaintGeometry(TileLocalSize, FSlateLayoutTransform(TilePosition)),
+					TileBrush,
+					ESlateDrawEffect::None,
+					DrawTint);
+				continue;
+			}
+
+			// 로드 중에는 상위 단계 타일의 해당 부분으로 대신 그림
+			bool bDrewFallback = false;
+			for (int32 ParentLevel = Level + 1; ParentLevel <= CoarsestLevel && !bDrewFallback; ++ParentLevel)
+			{
+				const int32 LevelDelta = ParentLevel - Level;
+				const int32 ParentX = TileX >> LevelDelta;
+				const int32 ParentY = TileY >> LevelDelta;
+
+				const FSlateBrush* ParentBrush = Cache->FindResidentTile(Tiles, ParentLevel, ParentX, ParentY);
+				if (!ParentBrush)
+				{
+					continue;
+				}
+
+				const float UVSize = 1.0f / static_cast<float>(1 << LevelDelta);
+				const FVector2f UVMin((TileX - (ParentX << LevelDelta)) * UVSize, (TileY - (ParentY << LevelDelta)) * UVSize);
+
+				FSlateBrush SubBrush = *ParentBrush;
+				SubBrush.SetUVRegion(FBox2f(UVMin, UVMin + FVector2f(UVSize)));
+
+				FSlateDrawElement::MakeBox(
+					OutDrawElements,
+					LayerId,
+					AllottedGeometry.ToPaintGeometry(TileLocalSize, FSlateLayoutTransform(TilePosition)),
+					&SubBrush,
+					ESlateDrawEffect::None,
+					DrawTint);
+				bDrewFallback = true;
+			}
+
+			// 대신 그릴 것이 없으면 가장 거친 단계부터 로드 (다음 타일 누락 때 바로 대체 가능)
+			if (!bDrewFallback && Level < CoarsestLevel)
+			{
+				const int32 LevelDelta = CoarsestLevel - Level;
+				Cache->RequestTile(Tiles, CoarsestLevel, TileX >> LevelDelta, TileY >> LevelDelta);
+			}
+		}
+	}
+
+	return LayerId;
+}
@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class UMinimapTileCacheSubsystem;
+class UMinimapTileSet;
+
+/**
+ * UMinimapTileLayerWidget의 Slate 구현
+ * 위젯 크기 전체가 맵 이미지 전체, 그 중 컬링 영역과 겹치는 타일만 현재 화면 해상도에 맞는 단계에서 요청해서 그림
+ * 아직 로드되지 않은 타일은 이미 로드된 상위 단계 타일의 해당 영역으로 대신 그림
+ */
+class SMinimapTileLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SMinimapTileLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetTileSet(const UMinimapTileSet* InTileSet);
+	void SetTileCache(UMinimapTileCacheSubsystem* InTileCache);
+	void SetAppearance(const FLinearColor& InTint, float InLevelBias);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	TWeakObjectPtr<const UMinimapTileSet> TileSet;
+	TWeakObjectPtr<UMinimapTileCacheSubsystem> TileCache;
+
+	FLinearColor Tint = FLinearColor::White;
+	float LevelBias = 0.0f;
+};
@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/NavigationMarkerLayerWidget.h"
+#include "UI/Navigation/SNavigationMarkerLayer.h"
+
+#define LOCTEXT_NAMESPACE "NavigationMarker"
+
+UNavigationMarkerLayerWidget::UNavigationMarkerLayerWidget()
+{
+	SetVisibilityInternal(ESlateVisibility::HitTestInvisible);
+}
+
+TSharedRef<SWidget> UNavigationMarkerLayerWidget::RebuildWidget()
+{
+	MyMarkerLayer = SNew(SNavigationMarkerLayer);
+	return MyMarkerLayer.ToSharedRef();
+}
+
+void UNavigationMarkerLayerWidget::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (MyMarkerLayer.IsValid())
+	{
+		UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(this);
+		APlayerController* OwningPlayer = GetOwningPlayer();
+		if (!IsDesignTime())
+		{
+			RegisterView(MarkerSubsystem, OwningPlayer);
+		}
+
+		MyMarkerLayer->SetView(View);
+		MyMarkerLayer->SetAppearance(IconSize, EdgeMargin, CompassFieldOfView);
+		MyMarkerLayer->SetSubsystem(MarkerSubsystem, OwningPlayer);
+	}
+}
+
+void UNavigationMarkerLayerWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	UnregisterView();
+	MyMarkerLayer.Reset();
+}
+
+void UNavigationMarkerLayerWidget::RegisterView(UNavigationMarkerSubsystem* MarkerSubsystem, APlayerController* Player)
+{
+	// SynchronizeProperties는 여러 번 호출되므로 같은 플레이어는 한 번만 등록
+	if (RegisteredSubsystem.Get() == MarkerSubsystem && RegisteredPlayer.Get() == Player)
+	{
+		return;
+	}
+
+	UnregisterView();
+
+	if (MarkerSubsystem && Player)
+	{
+		MarkerSubsystem->RegisterView(Player);
+		RegisteredSubsystem = MarkerSubsystem;
+		RegisteredPlayer = Player;
+	}
+}
+
+void UNavigationMarkerLayerWidget::UnregisterView()
+{
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = RegisteredSubsystem.Get())
+	{
+		MarkerSubsystem->UnregisterView(RegisteredPlayer.Get());
+	}
+
+	RegisteredSubsystem.Reset();
+	RegisteredPlayer.Reset();
+}
+
+#if WITH_EDITOR
+const FText UNavigationMarkerLayerWidget::GetPaletteCategory()
+{
+	return LOCTEXT("PaletteCategory", "RPG");
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
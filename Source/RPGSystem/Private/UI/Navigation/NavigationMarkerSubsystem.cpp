@@ -0,0 +1,493 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+namespace
+{
+	// 마커를 표시할 뷰 플래그 (ClampToEdge 같은 표시 옵션 제외)
+	constexpr ENavigationMarkerFlags NavigationMarkerViewFlags =
+		ENavigationMarkerFlags::Minimap | ENavigationMarkerFlags::Compass | ENavigationMarkerFlags::WorldMarker;
+}
+
+void UNavigationMarkerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ActorSpawnedHandle = GetWorld()->AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateUObject(this, &UNavigationMarkerSubsystem::HandleActorSpawned));
+
+	// 스트리밍 레벨의 액터는 OnActorSpawned가 호출되지 않음
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UNavigationMarkerSubsystem::HandleLevelAddedToWorld);
+}
+
+void UNavigationMarkerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	RemoveAllMarkers();
+	Projections.Empty();
+
+	Brushes.Empty();
+	BrushResources.Empty();
+	BrushIndexByIcon.Empty();
+	BoundsActorCache.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UNavigationMarkerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UNavigationMarkerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNavigationMarkerSubsystem, STATGROUP_Tickables);
+}
+
+UNavigationMarkerSubsystem* UNavigationMarkerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UNavigationMarkerSubsystem>() : nullptr;
+}
+
+void UNavigationMarkerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 마커를 그릴 레이어가 없으면 투영하지 않음
+	if (MarkerKeys.Num() == 0 || Projections.Num() == 0)
+	{
+		return;
+	}
+
+	UpdateWorldPositions();
+
+	// 미니맵: 경계 액터 기준 정규화
+	FVector2D BoundsMin, BoundsMax;
+	const bool bHasMinimapBounds = GetMinimapWorldBounds(BoundsMin, BoundsMax)
+		&& !FMath::IsNearlyZero(BoundsMax.X - BoundsMin.X)
+		&& !FMath::IsNearlyZero(BoundsMax.Y - BoundsMin.Y);
+	const FVector2D InvBoundsSize = bHasMinimapBounds ? FVector2D(1.0) / (BoundsMax - BoundsMin) : FVector2D::ZeroVector;
+
+	for (FNavigationMarkerProjection& Projection : Projections)
+	{
+		ProjectMarkers(Projection, bHasMinimapBounds, BoundsMin, InvBoundsSize);
+	}
+}
+
+// --- 마커 ---
+
+void UNavigationMarkerSubsystem::AddOrUpdateMarker(UObject* Target, UObject* Icon, FLinearColor Color, float Scale, int32 Flags)
+{
+	USceneComponent* TargetComponent = Cast<USceneComponent>(Target);
+	if (!TargetComponent)
+	{
+		if (const AActor* TargetActor = Cast<AActor>(Target))
+		{
+			TargetComponent = TargetActor->GetRootComponent();
+		}
+	}
+
+	if (!TargetComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UNavigationMarkerSubsystem: %s is not an actor with a root component or a scene component"), *GetNameSafe(Target));
+		return;
+	}
+
+	int32 Index = INDEX_NONE;
+	if (const int32* ExistingIndex = KeyToIndex.Find(Target))
+	{
+		Index = *ExistingIndex;
+	}
+	else
+	{
+		Index = MarkerKeys.Add(Target);
+		KeyToIndex.Add(Target, Index);
+
+		MarkerTargets.AddDefaulted();
+		WorldPositions.AddUninitialized();
+		MarkerBrushIndices.AddUninitialized();
+		MarkerColors.AddUninitialized();
+		MarkerScales.AddUninitialized();
+		MarkerFlags.AddUninitialized();
+
+		// 투영 결과는 다음 Tick까지 비어 있음
+		for (FNavigationMarkerProjection& Projection : Projections)
+		{
+			Projection.Flags.Add(0);
+			Projection.MinimapUVs.AddZeroed();
+			Projection.CompassAngles.AddZeroed();
+			Projection.ScreenPositions.AddZeroed();
+		}
+	}
+
+	MarkerTargets[Index] = TargetComponent;
+	WorldPositions[Index] = TargetComponent->GetComponentLocation();
+	MarkerBrushIndices[Index] = FindOrAddBrush(Icon);
+	MarkerColors[Index] = Color;
+	MarkerScales[Index] = Scale;
+	MarkerFlags[Index] = static_cast<uint8>(Flags);
+}
+
+void UNavigationMarkerSubsystem::RemoveMarker(UObject* Target)
+{
+	if (const int32* Index = KeyToIndex.Find(Target))
+	{
+		RemoveAtSwap(*Index);
+	}
+}
+
+void UNavigationMarkerSubsystem::RemoveAllMarkers()
+{
+	MarkerKeys.Reset();
+	MarkerTargets.Reset();
+	WorldPositions.Reset();
+	MarkerBrushIndices.Reset();
+	MarkerColors.Reset();
+	MarkerScales.Reset();
+	MarkerFlags.Reset();
+	KeyToIndex.Reset();
+
+	for (FNavigationMarkerProjection& Projection : Projections)
+	{
+		Projection.Flags.Reset();
+		Projection.MinimapUVs.Reset();
+		Projection.CompassAngles.Reset();
+		Projection.ScreenPositions.Reset();
+	}
+}
+
+void UNavigationMarkerSubsystem::RemoveMarkerViews(UObject* Target, ENavigationMarkerFlags Views)
+{
+	const int32* Index = KeyToIndex.Find(Target);
+	if (!Index)
+	{
+		return;
+	}
+
+	const ENavigationMarkerFlags Flags = static_cast<ENavigationMarkerFlags>(MarkerFlags[*Index]) & ~Views;
+	if (!EnumHasAnyFlags(Flags, NavigationMarkerViewFlags))
+	{
+		RemoveAtSwap(*Index);
+		return;
+	}
+	MarkerFlags[*Index] = static_cast<uint8>(Flags);
+}
+
+ENavigationMarkerFlags UNavigationMarkerSubsystem::GetMarkerViews(UObject* Target) const
+{
+	if (const int32* Index = KeyToIndex.Find(Target))
+	{
+		return static_cast<ENavigationMarkerFlags>(MarkerFlags[*Index]) & NavigationMarkerViewFlags;
+	}
+	return ENavigationMarkerFlags::None;
+}
+
+bool UNavigationMarkerSubsystem::HasMarker(UObject* Target) const
+{
+	return KeyToIndex.Contains(Target);
+}
+
+void UNavigationMarkerSubsystem::RemoveAtSwap(int32 Index)
+{
+	const int32 LastIndex = MarkerKeys.Num() - 1;
+
+	KeyToIndex.Remove(MarkerKeys[Index]);
+	if (Index != LastIndex)
+	{
+		KeyToIndex[MarkerKeys[LastIndex]] = Index;
+	}
+
+	MarkerKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MarkerTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	WorldPositions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MarkerBrushIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MarkerColors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MarkerScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MarkerFlags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	for (FNavigationMarkerProjection& Projection : Projections)
+	{
+		Projection.Flags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Projection.MinimapUVs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Projection.CompassAngles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Projection.ScreenPositions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+// --- 뷰 ---
+
+void UNavigationMarkerSubsystem::RegisterView(APlayerController* Player)
+{
+	if (!Player)
+	{
+		return;
+	}
+
+	for (FNavigationMarkerProjection& Projection : Projections)
+	{
+		if (Projection.Player.Get() == Player)
+		{
+			++Projection.NumViews;
+			return;
+		}
+	}
+
+	// 다른 플레이어 뷰와 같은 인덱스를 유지하도록 마커 수만큼 채움
+	FNavigationMarkerProjection& Projection = Projections.AddDefaulted_GetRef();
+	Projection.Player = Player;
+	Projection.NumViews = 1;
+	Projection.Flags.SetNumZeroed(MarkerKeys.Num());
+	Projection.MinimapUVs.SetNumZeroed(MarkerKeys.Num());
+	Projection.CompassAngles.SetNumZeroed(MarkerKeys.Num());
+	Projection.ScreenPositions.SetNumZeroed(MarkerKeys.Num());
+}
+
+void UNavigationMarkerSubsystem::UnregisterView(APlayerController* Player)
+{
+	for (int32 Index = 0; Index < Projections.Num(); ++Index)
+	{
+		if (Projections[Index].Player.Get() == Player && --Projections[Index].NumViews <= 0)
+		{
+			Projections.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			return;
+		}
+	}
+}
+
+const FNavigationMarkerProjection* UNavigationMarkerSubsystem::FindProjection(const APlayerController* Player) const
+{
+	if (!Player)
+	{
+		return nullptr;
+	}
+
+	return Projections.FindByPredicate([Player](const FNavigationMarkerProjection& Projection)
+	{
+		return Projection.Player.Get() == Player;
+	});
+}
+
+int32 UNavigationMarkerSubsystem::FindOrAddBrush(UObject* Icon)
+{
+	if (!Icon)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* BrushIndex = BrushIndexByIcon.Find(Icon))
+	{
+		return *BrushIndex;
+	}
+
+	FSlateBrush& Brush = Brushes.AddDefaulted_GetRef();
+	Brush.SetResourceObject(Icon);
+	if (const UTexture2D* Texture = Cast<UTexture2D>(Icon))
+	{
+		Brush.ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+	}
+
+	BrushResources.Add(Icon);
+	return BrushIndexByIcon.Add(Icon, Brushes.Num() - 1);
+}
+
+// --- 프레임 갱신 ---
+
+void UNavigationMarkerSubsystem::UpdateWorldPositions()
+{
+	for (int32 Index = MarkerTargets.Num() - 1; Index >= 0; --Index)
+	{
+		if (const USceneComponent* TargetComponent = MarkerTargets[Index].Get())
+		{
+			WorldPositions[Index] = TargetComponent->GetComponentLocation();
+		}
+		else
+		{
+			RemoveAtSwap(Index);
+		}
+	}
+}
+
+void UNavigationMarkerSubsystem::ProjectMarkers(FNavigationMarkerProjection& Projection, bool bHasMinimapBounds,
+	const FVector2D& BoundsMin, const FVector2D& InvBoundsSize)
+{
+	// 나침반: 레이어를 등록한 플레이어의 카메라 위치/Yaw
+	const APlayerController* PC = Projection.Player.Get();
+	const APlayerCameraManager* CameraManager = PC ? PC->PlayerCameraManager.Get() : nullptr;
+	const bool bHasCamera = CameraManager != nullptr;
+	const FVector ViewLocation = bHasCamera ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+	const float ViewYaw = bHasCamera ? CameraManager->GetCameraRotation().Yaw : 0.0f;
+
+	// 월드 마커: 뷰-프로젝션 행렬은 프레임당 한 번
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	FSceneViewProjectionData ProjectionData;
+	const bool bHasProjection = LocalPlayer && LocalPlayer->ViewportClient && LocalPlayer->ViewportClient->Viewport
+		&& LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData);
+
+	FMatrix ViewProjectionMatrix = FMatrix::Identity;
+	FIntRect ViewRect;
+	Projection.ViewportSize = FVector2D::ZeroVector;
+	if (bHasProjection)
+	{
+		ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+		ViewRect = ProjectionData.GetConstrainedViewRect();
+		LocalPlayer->ViewportClient->GetViewportSize(Projection.ViewportSize);
+	}
+
+	for (int32 Index = 0; Index < MarkerKeys.Num(); ++Index)
+	{
+		const ENavigationMarkerFlags Flags = static_cast<ENavigationMarkerFlags>(MarkerFlags[Index]);
+		const FVector& WorldPosition = WorldPositions[Index];
+		ENavigationMarkerProjectionFlags ProjectionFlags = ENavigationMarkerProjectionFlags::None;
+
+		if (bHasMinimapBounds && EnumHasAnyFlags(Flags, ENavigationMarkerFlags::Minimap))
+		{
+			const FVector2D UV = (FVector2D(WorldPosition) - BoundsMin) * InvBoundsSize;
+			Projection.MinimapUVs[Index] = FVector2f(UV);
+
+			ProjectionFlags |= ENavigationMarkerProjectionFlags::HasMinimapUV;
+			if (UV.X >= 0.0 && UV.X <= 1.0 && UV.Y >= 0.0 && UV.Y <= 1.0)
+			{
+				ProjectionFlags |= ENavigationMarkerProjectionFlags::InMinimap;
+			}
+		}
+
+		if (bHasCamera && EnumHasAnyFlags(Flags, ENavigationMarkerFlags::Compass))
+		{
+			const FVector Direction = WorldPosition - ViewLocation;
+			const float DirectionYaw = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+			Projection.CompassAngles[Index] = FMath::FindDeltaAngleDegrees(ViewYaw, DirectionYaw);
+
+			ProjectionFlags |= ENavigationMarkerProjectionFlags::HasCompassAngle;
+		}
+
+		if (bHasProjection && EnumHasAnyFlags(Flags, ENavigationMarkerFlags::WorldMarker))
+		{
+			// FSceneView::ProjectWorldToScreen과 같지만 카메라 뒤쪽도 가장자리 고정용으로 계산
+			const FPlane Clip = ViewProjectionMatrix.TransformFVector4(FVector4(WorldPosition, 1.0));
+			if (!FMath::IsNearlyZero(Clip.W))
+			{
+				const double InvW = 1.0 / Clip.W;
+				const double NormalizedX = 0.5 + Clip.X * InvW * 0.5;
+				const double NormalizedY = 0.5 - Clip.Y * InvW * 0.5;
+				Projection.ScreenPositions[Index] = FVector2f(
+					ViewRect.Min.X + NormalizedX * ViewRect.Width(),
+					ViewRect.Min.Y + NormalizedY * ViewRect.Height());
+
+				ProjectionFlags |= ENavigationMarkerProjectionFlags::HasScreenPosition;
+				if (Clip.W > 0.0)
+				{
+					ProjectionFlags |= ENavigationMarkerProjectionFlags::InFront;
+				}
+			}
+		}
+
+		Projection.Flags[Index] = static_cast<uint8>(ProjectionFlags);
+	}
+}
+
+// --- 미니맵 경계 ---
+
+void UNavigationMarkerSubsystem::SetMinimapBounds(TSubclassOf<AActor> BottomLeftClass, TSubclassOf<AActor> TopRightClass)
+{
+	MinimapBottomLeftClass = BottomLeftClass;
+	MinimapTopRightClass = TopRightClass;
+}
+
+bool UNavigationMarkerSubsystem::GetMinimapWorldBounds(FVector2D& OutBottomLeft, FVector2D& OutTopRight)
+{
+	const AActor* BottomLeftActor = FindBoundsActor(MinimapBottomLeftClass);
+	const AActor* TopRightActor = FindBoundsActor(MinimapTopRightClass);
+	if (!BottomLeftActor || !TopRightActor)
+	{
+		return false;
+	}
+
+	OutBottomLeft = FVector2D(BottomLeftActor->GetActorLocation());
+	OutTopRight = FVector2D(TopRightActor->GetActorLocation());
+	return true;
+}
+
+AActor* UNavigationMarkerSubsystem::FindBoundsActor(TSubclassOf<AActor> ActorClass)
+{
+	if (!ActorClass)
+	{
+		return nullptr;
+	}
+
+	if (const FCachedBoundsActor* Cached = BoundsActorCache.Find(ActorClass.Get()))
+	{
+		// 이전에 찾지 못했으면 해당 클래스가 스폰될 때까지 다시 찾지 않음
+		if (!Cached->bFound)
+		{
+			return nullptr;
+		}
+
+		// 찾았던 액터가 파괴됐으면 다시 찾음
+		if (AActor* CachedActor = Cached->Actor.Get())
+		{
+			return CachedActor;
+		}
+	}
+
+	FCachedBoundsActor& Cached = BoundsActorCache.FindOrAdd(ActorClass.Get());
+	Cached = FCachedBoundsActor();
+
+	// GetAllActorsOfClass의 첫 액터와 같음
+	for (TActorIterator<AActor> It(GetWorld(), ActorClass); It; ++It)
+	{
+		Cached.Actor = *It;
+		Cached.bFound = true;
+		break;
+	}
+
+	return Cached.Actor.Get();
+}
+
+void UNavigationMarkerSubsystem::InvalidateMissingBoundsActors(const AActor* SpawnedActor)
+{
+	// 못 찾았던 클래스만 다시 찾도록 항목 제거
+	for (auto It = BoundsActorCache.CreateIterator(); It; ++It)
+	{
+		if (It.Value().bFound)
+		{
+			continue;
+		}
+
+		const UClass* CachedClass = It.Key().ResolveObjectPtr();
+		if (!SpawnedActor || !CachedClass || SpawnedActor->IsA(CachedClass))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UNavigationMarkerSubsystem::HandleActorSpawned(AActor* SpawnedActor)
+{
+	InvalidateMissingBoundsActors(SpawnedActor);
+}
+
+void UNavigationMarkerSubsystem::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	// 레벨의 액터를 클래스별로 확인하지 않고 못 찾았던 항목을 모두 비움 (다음 조회에서 한 번 다시 찾음)
+	if (World == GetWorld())
+	{
+		InvalidateMissingBoundsActors(nullptr);
+	}
+}
@@ -0,0 +1,224 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/Navigation/SNavigationMarkerLayer.h"
+#include "Rendering/DrawElements.h"
+
+void SNavigationMarkerLayer::Construct(const FArguments& InArgs)
+{
+	// 매 프레임 마커가 움직이므로 캐싱하지 않음
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+void SNavigationMarkerLayer::SetSubsystem(UNavigationMarkerSubsystem* InSubsystem, APlayerController* InViewPlayer)
+{
+	Subsystem = InSubsystem;
+	ViewPlayer = InViewPlayer;
+}
+
+void SNavigationMarkerLayer::SetView(ENavigationMarkerView InView)
+{
+	View = InView;
+}
+
+void SNavigationMarkerLayer::SetAppearance(const FVector2D& InIconSize, float InEdgeMargin, float InCompassFieldOfView)
+{
+	IconSize = InIconSize;
+	EdgeMargin = FMath::Max(0.0f, InEdgeMargin);
+	CompassFieldOfView = FMath::Clamp(InCompassFieldOfView, 1.0f, 360.0f);
+}
+
+int32 SNavigationMarkerLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UNavigationMarkerSubsystem* MarkerSubsystem = Subsystem.Get();
+	if (!MarkerSubsystem || MarkerSubsystem->GetNumMarkers() == 0)
+	{
+		return LayerId;
+	}
+
+	const FNavigationMarkerProjection* Projection = MarkerSubsystem->FindProjection(ViewPlayer.Get());
+	if (!Projection)
+	{
+		return LayerId;
+	}
+
+	ENavigationMarkerFlags ViewFlag = ENavigationMarkerFlags::WorldMarker;
+	switch (View)
+	{
+	case ENavigationMarkerView::Minimap:	ViewFlag = ENavigationMarkerFlags::Minimap; break;
+	case ENavigationMarkerView::Compass:	ViewFlag = ENavigationMarkerFlags::Compass; break;
+	default:								break;
+	}
+
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+
+	// 뷰포트 픽셀 -> 이 위젯의 로컬 좌표 (월드 마커 레이어는 뷰포트 전체를 덮는다고 가정)
+	FVector2D PixelToLocal = FVector2D::ZeroVector;
+	if (View == ENavigationMarkerView::WorldMarker)
+	{
+		const FVector2D ViewportSize = Projection->ViewportSize;
+		if (ViewportSize.X <= 0.0 || ViewportSize.Y <= 0.0)
+		{
+			return LayerId;
+		}
+		PixelToLocal = LocalSize / ViewportSize;
+	}
+
+	const TConstArrayView<uint8> MarkerFlags = MarkerSubsystem->GetMarkerFlags();
+	const TConstArrayView<int32> BrushIndices = MarkerSubsystem->GetMarkerBrushIndices();
+	const TConstArrayView<FLinearColor> Colors = MarkerSubsystem->GetMarkerColors();
+	const TConstArrayView<float> Scales = MarkerSubsystem->GetMarkerScales();
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+
+	// 투영 배열은 마커 배열과 같은 길이로 유지됨
+	if (!ensure(Projection->Flags.Num() == MarkerFlags.Num()))
+	{
+		return LayerId;
+	}
+
+	for (int32 Index = 0; Index < MarkerFlags.Num(); ++Index)
+	{
+		const ENavigationMarkerFlags Flags = static_cast<ENavigationMarkerFlags>(MarkerFlags[Index]);
+		if (!EnumHasAnyFlags(Flags, ViewFlag))
+		{
+			continue;
+		}
+
+		const FSlateBrush* Brush = MarkerSubsystem->GetBrush(BrushIndices[Index]);
+		if (!Brush)
+		{
+			continue;
+		}
+
+		const bool bClampToEdge = EnumHasAnyFlags(Flags, ENavigationMarkerFlags::ClampToEdge);
+		FVector2D Center;
+		bool bVisible = false;
+		switch (View)
+		{
+		case ENavigationMarkerView::Minimap:
+			bVisible = GetMinimapPosition(*Projection, Index, bClampToEdge, LocalSize, Center);
+			break;
+		case ENavigationMarkerView::Compass:
+			bVisible = GetCompassPosition(*Projection, Index, bClampToEdge, LocalSize, Center);
+			break;
+		default:
+			bVisible = GetWorldMarkerPosition(*Projection, Index, bClampToEdge, LocalSize, PixelToLocal, Center);
+			break;
+		}
+
+		if (!bVisible)
+		{
+			continue;
+		}
+
+		const FVector2D DrawSize = IconSize * Scales[Index];
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(DrawSize, FSlateLayoutTransform(Center - DrawSize * 0.5)),
+			Brush,
+			ESlateDrawEffect::None,
+			Colors[Index] * Tint);
+	}
+
+	return LayerId;
+}
+
+bool SNavigationMarkerLayer::GetMinimapPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge,
+	const FVector2D& LocalSize, FVector2D& OutPosition) const
+{
+	const ENavigationMarkerProjectionFlags ProjectionFlags = static_cast<ENavigationMarkerProjectionFlags>(Projection.Flags[Index]);
+	if (!EnumHasAnyFlags(ProjectionFlags, ENavigationMarkerProjectionFlags::HasMinimapUV))
+	{
+		return false;
+	}
+	if (!bClampToEdge && !EnumHasAnyFlags(ProjectionFlags, ENavigationMarkerProjectionFlags::InMinimap))
+	{
+		return false;
+	}
+
+	// 맵 이미지 전체를 덮는 위치(B_MapMarkers)에 배치, 월드 Y가 클수록 위쪽
+	const FVector2f UV = Projection.MinimapUVs[Index];
+	const FVector2D ClampedUV(FMath::Clamp(UV.X, 0.0f, 1.0f), FMath::Clamp(UV.Y, 0.0f, 1.0f));
+	OutPosition = FVector2D(ClampedUV.X * LocalSize.X, (1.0 - ClampedUV.Y) * LocalSize.Y);
+	return true;
+}
+
+bool SNavigationMarkerLayer::GetCompassPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge,
+	const FVector2D& LocalSize, FVector2D& OutPosition) const
+{
+	const ENavigationMarkerProjectionFlags ProjectionFlags = static_cast<ENavigationMarkerProjectionFlags>(Projection.Flags[Index]);
+	if (!EnumHasAnyFlags(ProjectionFlags, ENavigationMarkerProjectionFlags::HasCompassAngle))
+	{
+		return false;
+	}
+
+	// 나침반 띠의 가로 폭이 CompassFieldOfView 범위, 중앙이 카메라 정면
+	const float HalfFieldOfView = CompassFieldOfView * 0.5f;
+	float Angle = Projection.CompassAngles[Index];
+	if (FMath::Abs(Angle) > HalfFieldOfView)
+	{
+		if (!bClampToEdge)
+		{
+			return false;
+		}
+		Angle = FMath::Clamp(Angle, -HalfFieldOfView, HalfFieldOfView);
+	}
+
+	OutPosition = FVector2D((0.5 + Angle / CompassFieldOfView) * LocalSize.X, 0.5 * LocalSize.Y);
+	return true;
+}
+
+bool SNavigationMarkerLayer::GetWorldMarkerPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge,
+	const FVector2D& LocalSize, const FVector2D& PixelToLocal, FVector2D& OutPosition) const
+{
+	const ENavigationMarkerProjectionFlags ProjectionFlags = static_cast<ENavigationMarkerProjectionFlags>(Projection.Flags[Index]);
+	if (!EnumHasAnyFlags(ProjectionFlags, ENavigationMarkerProjectionFlags::HasScreenPosition))
+	{
+		return false;
+	}
+
+	const bool bInFront = EnumHasAnyFlags(ProjectionFlags, ENavigationMarkerProjectionFlags::InFront);
+	if (!bInFront && !bClampToEdge)
+	{
+		return false;
+	}
+
+	const FVector2D LocalCenter = LocalSize * 0.5;
+	FVector2D Position = FVector2D(Projection.ScreenPositions[Index]) * PixelToLocal;
+
+	// 카메라 뒤쪽은 투영이 중심 기준으로 뒤집히므로 되돌림
+	if (!bInFront)
+	{
+		Position = LocalCenter * 2.0 - Position;
+	}
+
+	const FVector2D Min(EdgeMargin, EdgeMargin);
+	const FVector2D Max = LocalSize - Min;
+	const bool bOnScreen = Position.X >= Min.X && Position.X <= Max.X && Position.Y >= Min.Y && Position.Y <= Max.Y;
+	if (bOnScreen && bInFront)
+	{
+		OutPosition = Position;
+		return true;
+	}
+	if (!bClampToEdge)
+	{
+		return false;
+	}
+
+	// 중심에서 마커 방향으로 가장자리 여백까지 밀어냄 (뒤쪽 마커는 화면 안이어도 가장자리로)
+	const FVector2D Direction = Position - LocalCenter;
+	const FVector2D HalfExtent = (Max - Min) * 0.5;
+	if (Direction.IsNearlyZero() || HalfExtent.X <= 0.0 || HalfExtent.Y <= 0.0)
+	{
+		OutPosition = FVector2D(LocalCenter.X, Max.Y);
+		return true;
+	}
+
+	const double ScaleX = FMath::IsNearlyZero(Direction.X) ? MAX_dbl : HalfExtent.X / FMath::Abs(Direction.X);
+	const double ScaleY = FMath::IsNearlyZero(Direction.Y) ? MAX_dbl : HalfExtent.Y / FMath::Abs(Direction.Y);
+	OutPosition = LocalCenter + Direction * FMath::Min(ScaleX, ScaleY);
+	return true;
+}
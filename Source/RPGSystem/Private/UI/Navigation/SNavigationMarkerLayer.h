@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
+
+/**
+ * UNavigationMarkerLayerWidget의 Slate 구현
+ * 서브시스템이 뷰 플레이어 기준으로 이미 투영한 좌표를 위젯 로컬 좌표로 옮기고 마커마다 박스 하나를 그림
+ * 같은 아이콘은 서브시스템의 같은 브러시를 쓰므로 한 번의 드로우로 배치됨
+ */
+class SNavigationMarkerLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SNavigationMarkerLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetSubsystem(UNavigationMarkerSubsystem* InSubsystem, APlayerController* InViewPlayer);
+	void SetView(ENavigationMarkerView InView);
+	void SetAppearance(const FVector2D& InIconSize, float InEdgeMargin, float InCompassFieldOfView);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	/** 마커 중심의 로컬 좌표, 그리지 않으면 false */
+	bool GetMinimapPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge, const FVector2D& LocalSize, FVector2D& OutPosition) const;
+	bool GetCompassPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge, const FVector2D& LocalSize, FVector2D& OutPosition) const;
+	bool GetWorldMarkerPosition(const FNavigationMarkerProjection& Projection, int32 Index, bool bClampToEdge, const FVector2D& LocalSize, const FVector2D& PixelToLocal, FVector2D& OutPosition) const;
+
+	TWeakObjectPtr<UNavigationMarkerSubsystem> Subsystem;
+
+	// 레이어를 소유한 플레이어, 이 플레이어의 카메라/뷰포트 기준 투영 결과를 그림
+	TWeakObjectPtr<APlayerController> ViewPlayer;
+
+	ENavigationMarkerView View = ENavigationMarkerView::WorldMarker;
+
+	FVector2D IconSize = FVector2D(32.0);
+	float EdgeMargin = 32.0f;
+	float CompassFieldOfView = 120.0f;
+};
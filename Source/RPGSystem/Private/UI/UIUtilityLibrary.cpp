@@ -14,6 +14,7 @@
 #include "Components/VerticalBoxSlot.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
 
 
 #pragma region SizeBox
@@ -181,6 +182,13 @@ UOverlaySlot* UUIUtilityLibrary::AddChildToOverlay(UOverlay* _Overlay, UUserWidg
 
 FVector UUIUtilityLibrary::GetMiniMapActorLocation(UObject* WorldContextObject, TSubclassOf<AActor> ActorClass)
 {
+	// 게임/PIE 월드는 서브시스템 캐시 사용 (매 호출마다 GetAllActorsOfClass 하지 않음)
+	if (UNavigationMarkerSubsystem* MarkerSubsystem = UNavigationMarkerSubsystem::Get(WorldContextObject))
+	{
+		const AActor* BoundsActor = MarkerSubsystem->FindBoundsActor(ActorClass);
+		return BoundsActor ? BoundsActor->GetActorLocation() : FVector{};
+	}
+
 	TArray<AActor*> Actors;
 	UGameplayStatics::GetAllActorsOfClass(WorldContextObject,ActorClass,Actors);
 
@@ -62,11 +62,49 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Save and Load", meta = (DisplayName = "Multi-Thread Saving"))
 	bool bMultiThreadSaving = false;
 
+	/**
+	* Level Actors are saved in stages instead of in one go: Actor state is captured on the Game Thread,
+	* the archive is serialized on worker threads and compression and file writing happen in the background.
+	* The capture still serializes the properties of every changed Actor and its components on the Game Thread,
+	* combine with Delta Level Saving to keep that stage short.
+	* Takes priority over Multi-Thread Saving for Level Actors. Off by default.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = "Save and Load", meta = (DisplayName = "Staged Level Saving"))
+	bool bStagedLevelSaving = false;
+
+	/**
+	* Level Actors that did not change since the last save reuse their previous record, and only changed records
+	* are written to disk as a delta on top of the last full Level file.
+	* An Actor is only serialized again once 'Mark Actor Save Dirty' was called for it, or 'Actor Save Dirty' of the Actor Save Interface returns true.
+	* Off by default, as Actors that change 'Save Game' variables without marking themselves dirty would keep their old record.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = "Save and Load", meta = (DisplayName = "Delta Level Saving"))
+	bool bDeltaLevelSaving = false;
+
+	/**Number of delta saves before the Level file is compacted into a new full base.*/
+	UPROPERTY(config, EditAnywhere, AdvancedDisplay, Category = "Save and Load", meta = (UIMin = 1, ClampMin = 1, DisplayName = "Max Delta Saves", EditCondition = "bDeltaLevelSaving"))
+	int32 MaxDeltaSaves = 8;
+
 	/**The method that is used to load level-actors.*/
 	UPROPERTY(config, EditAnywhere, Category = "Save and Load", meta = (DisplayName = "Level Load Method"))
 	ELoadMethod LoadMethod = ELoadMethod::LM_Default;
 
-	/**Estimated Number of Actors to load in one batch when using Multi-Thread or Deferred Loading.*/
+	/**
+	* Loaded Actor and Component data references the decompressed file instead of copying it per object.
+	* The file buffer stays in memory as long as loaded data from it is in use.
+	*/
+	UPROPERTY(config, EditAnywhere, AdvancedDisplay, Category = "Save and Load", meta = (DisplayName = "Zero-Copy Loading"))
+	bool bZeroCopyLoading = true;
+
+	/**
+	* Time in milliseconds that Multi-Thread or Deferred Loading may spend on level-actors per frame.
+	* The cost of each Actor class is measured while loading, so expensive Actors are spread over more frames.
+	* If 0, the fixed Load Batch Size is used instead.
+	*/
+	UPROPERTY(config, EditAnywhere, AdvancedDisplay, Category = "Save and Load", meta = (UIMin = 0, ClampMin = 0, Units = "ms", DisplayName = "Load Frame Budget", EditCondition = "LoadMethod != ELoadMethod::LM_Default"))
+	float LoadFrameBudget = 4.f;
+
+	/**Estimated Number of Actors to load in one batch when using Multi-Thread or Deferred Loading without a Load Frame Budget.*/
 	UPROPERTY(config, EditAnywhere, AdvancedDisplay, Category = "Save and Load", meta = (UIMin=1, ClampMin=1, DisplayName = "Load Batch Size", EditCondition = "LoadMethod != ELoadMethod::LM_Default"))
 	int DeferredLoadStackSize = 20;
 
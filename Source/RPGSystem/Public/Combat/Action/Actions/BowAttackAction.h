@@ -6,12 +6,36 @@
 #include "Combat/Action/Actions/BaseAttackAction.h"
 #include "BowAttackAction.generated.h"
 
+class AArrowProjectile;
+
 /**
- * 
+ * 활 공격, 화살은 월드 공용 오브젝트 풀(UObjectPoolSubsystem)에서 꺼내서 재사용
  */
 UCLASS()
 class RPGSYSTEM_API UBowAttackAction : public UBaseAttackAction
 {
 	GENERATED_BODY()
-	
+
+public:
+	// 조준 방향으로 화살 발사 (몽타주 노티파이/BP에서 호출), 풀이 없는 월드면 nullptr
+	UFUNCTION(BlueprintCallable, Category = "Bow")
+	AArrowProjectile* FireArrow();
+
+protected:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Bow")
+	TSubclassOf<AArrowProjectile> ArrowClass;
+
+	// 화살이 생성되는 소켓, 없으면 캐릭터 앞
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Bow")
+	FName ArrowSpawnSocket = NAME_None;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Bow")
+	float ArrowSpeed = 4000.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Bow")
+	float ArrowGravityScale = 1.f;
+
+	// 소켓이 없을 때 캐릭터 중심에서 조준 방향으로 띄우는 거리
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Bow")
+	float ArrowSpawnForwardOffset = 60.f;
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Combat/CombatData.h"
 #include "GameFramework/Actor.h"
+#include "Shared/Interfaces/PoolableInterface.h"
 #include "ArrowProjectile.generated.h"
 
 class USphereComponent;
@@ -10,9 +11,10 @@ class UProjectileMovementComponent;
 class UPrimitiveComponent;
 class UStaticMeshComponent;
 class UParticleSystem;
+class UParticleSystemComponent;
 
 UCLASS()
-class RPGSYSTEM_API AArrowProjectile : public AActor
+class RPGSYSTEM_API AArrowProjectile : public AActor, public IPoolableInterface
 {
 	GENERATED_BODY()
 
@@ -23,8 +25,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Projectile")
 	void InitializeArrowProjectile(const FDamageInfo& InDamageInfo, float InitialSpeed, float GravityScale);
 
+	// IPoolableInterface
+	virtual void OnAcquiredFromPool_Implementation() override;
+	virtual void OnReturnedToPool_Implementation() override;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void LifeSpanExpired() override;
+
+	/** Return to the shared pool when spawned from it, destroy otherwise. */
+	void ReleaseArrow();
+
+	/** Lifetime and tracer, on BeginPlay for plain spawns and on every pool checkout. */
+	void StartFlight();
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<USphereComponent> CollisionComponent;
@@ -35,7 +48,11 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<UProjectileMovementComponent> ProjectileMovement;
 
-	/** Optional one-shot trail/tracer at spawn time. */
+	/** Plays TracerTemplate while the arrow is in flight, reused across pool checkouts. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UParticleSystemComponent> TracerComponent;
+
+	/** Optional trail/tracer while in flight. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX")
 	TObjectPtr<UParticleSystem> TracerTemplate;
 
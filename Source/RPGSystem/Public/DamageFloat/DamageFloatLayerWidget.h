@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "Fonts/SlateFontInfo.h"
+#include "DamageFloatLayerWidget.generated.h"
+
+class SDamageFloatLayer;
+class UDamageFloatManagerComponent;
+
+/**
+ * 데미지 숫자 전체를 그리는 레이어
+ *
+ * 숫자마다 UDamageFloatWidget을 만들지 않고 Slate 리프 위젯 하나가 OnPaint에서 전부 그림
+ * 같은 레이어의 텍스트는 폰트 아틀라스가 같으면 한 번의 드로우로 배치됨
+ * 뷰포트 전체를 덮도록 배치 (HUD 최상단 캔버스, 앵커 전체)
+ */
+UCLASS()
+class RPGSYSTEM_API UDamageFloatLayerWidget : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	UDamageFloatLayerWidget();
+
+	// 비어 있으면 소유 플레이어 컨트롤러의 UDamageFloatManagerComponent
+	UFUNCTION(BlueprintCallable, Category = "Damage Float")
+	void SetDamageFloatManager(UDamageFloatManagerComponent* InManager);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	FSlateFontInfo Font;
+
+	// 크리티컬 숫자의 폰트 크기 배율
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance", meta = (ClampMin = "0.1"))
+	float CriticalFontScale = 1.4f;
+
+	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	UDamageFloatManagerComponent* ResolveManager() const;
+
+	TSharedPtr<SDamageFloatLayer> MyDamageFloatLayer;
+
+	TWeakObjectPtr<UDamageFloatManagerComponent> Manager;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "DamageFloatManagerComponent.generated.h"
 
 USTRUCT(BlueprintType)
@@ -40,6 +41,9 @@ struct FDamageFloatData
     /** Spawn 시간 (디버깅용) */
     float SpawnTime = 0.0f;
 
+    /** 렌더링용 문자열 캐시 (매 프레임 변환하지 않도록 데미지가 바뀔 때만 갱신) */
+    FString DamageText;
+
     FDamageFloatData() = default;
 
     FDamageFloatData(float InDamage, const FVector& InWorldPosition, bool bInCritical = false)
@@ -49,6 +53,7 @@ struct FDamageFloatData
         , bIsCritical(bInCritical)
     {
         TextColor = bInCritical ? FLinearColor::Red : FLinearColor::White;
+        DamageText = FString::FromInt(FMath::RoundToInt(InDamage));
         
         // 같은 위치에서 연속 hit 시 겹침 방지
         HorizontalOffset = FVector2D(
@@ -71,6 +76,10 @@ struct FDamageFloatData
 /**
  * Damage Float Manager Component
  * 플레이어 컨트롤러나 HUD에 부착하여 사용
+ *
+ * 시뮬레이션 데이터는 고정 용량 버퍼에 빈틈없이 저장 (제거는 swap-remove, 가득 차면 가장 오래된 것을 교체)
+ * 매 프레임 갱신하는 값(수명, 수직 오프셋)은 별도 float 배열로 분리해서 한 루프로 처리
+ * 화면 표시는 UDamageFloatLayerWidget 하나가 전부 그림
  */
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
@@ -92,9 +101,10 @@ public:
      * @param DamageAmount - Damage value
      * @param WorldPosition - 공격받은 순간의 정확한 월드 위치 (이후 고정됨!)
      * @param bIsCritical - Critical hit flag
+     * @param DamagedActor - 피격당한 액터, 같은 프레임에 같은 액터가 받은 데미지는 하나로 합침 (nullptr이면 합치지 않음)
      */
     UFUNCTION(BlueprintCallable, Category = "Damage Float")
-    void SpawnDamageFloat(float DamageAmount, FVector WorldPosition, bool bIsCritical = false);
+    void SpawnDamageFloat(float DamageAmount, FVector WorldPosition, bool bIsCritical = false, AActor* DamagedActor = nullptr);
 
     /**
      * Convenience function: Spawn at actor's location + offset
@@ -128,12 +138,41 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Optimization", meta = (EditCondition = "bCullOffScreenFloats"))
     float MaxDistanceFromCamera = 5000.0f;
 
+    /** 같은 프레임에 같은 액터가 받은 데미지를 하나로 합칠지 여부 (다단히트) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Optimization")
+    bool bCoalesceSameFrameHits = true;
+
 private:
+    /** 표시용 데이터, 수명/오프셋/알파는 Tick에서 아래 배열의 값으로 갱신됨 */
     UPROPERTY()
     TArray<FDamageFloatData> ActiveFloats;
 
+    /** ActiveFloats와 같은 인덱스, 매 프레임 갱신되는 값만 분리 */
+    TArray<float> RemainingLifetimes;
+    TArray<float> VerticalOffsets;
+
+    /** 이번 프레임에 생성된 데미지 (합치기 대상) */
+    struct FSpawnedFloat
+    {
+        int32 Index = INDEX_NONE;
+        TObjectKey<AActor> DamagedActor;
+    };
+    TArray<FSpawnedFloat> SpawnedThisFrame;
+
+    TWeakObjectPtr<APlayerController> CachedPlayerController;
+
     void PreallocatePool();
-    void CullDistantFloats();
+
+    /** 같은 프레임에 DamagedActor가 받은 데미지, 없으면 INDEX_NONE */
+    int32 FindCoalesceTarget(const AActor* DamagedActor) const;
+
+    /** 남은 수명이 가장 짧은 (가장 오래된) 데미지 */
+    int32 FindOldestFloat() const;
+
+    /** 마지막 요소를 Index로 옮기고 제거 */
+    void RemoveFloatAtSwap(int32 Index);
+
+    bool GetCameraLocation(FVector& OutLocation);
 
     /** 현재 월드 시간 캐싱 (디버깅용) */
     float CurrentWorldTime = 0.0f;
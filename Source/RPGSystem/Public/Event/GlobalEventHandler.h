@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "Event/RPGEventPayloads.h"
 #include "GlobalEventHandler.generated.h"
 
 class URPGEventBase;
@@ -260,6 +261,122 @@ public:
 		void ClearAllGlobalEventGameplayTags(const bool bForceClear = false);
 
 	static UGlobalEventHandler* Get(const UObject* WorldContextObject);
+
+	/**
+	* Native fast path. Events carry a typed payload and are dispatched to TDelegate subscribers without reflection or string copies.
+	* Blueprint listeners of the same GameplayTag still receive the event, with the payload converted to Metadata only if any are bound.
+	* Game Thread only.
+	*/
+
+	/**
+	* Subscribe a native delegate to a GameplayTag.
+	* @param bMatchChildTags - Also receive events of child tags, e.g. Event.Combat receives Event.Combat.Kill.
+	*/
+	FDelegateHandle SubscribeNative(const FGameplayTag& EventGameplayTag, FRPGNativeEventDelegate&& Delegate, const bool bMatchChildTags = false);
+	void UnsubscribeNative(const FGameplayTag& EventGameplayTag, const FDelegateHandle& Handle);
+	void UnsubscribeAllNative(const void* UserObject);
+
+	/**
+	* Publish an event with a typed payload, dispatched immediately.
+	* The payload type must derive from FRPGEventPayload.
+	*/
+	template<typename TPayload>
+	void PublishEvent(UObject* Publisher, const FGameplayTag& EventGameplayTag, UObject* Target, const TPayload& Payload);
+
+	/**
+	* Same as PublishEvent, but the payload is copied into a queue that is drained once on the next tick.
+	* Useful for mass events(e.g. many kills in one frame) that don't need to be handled right away.
+	*/
+	template<typename TPayload>
+	void PublishEventDeferred(UObject* Publisher, const FGameplayTag& EventGameplayTag, UObject* Target, const TPayload& Payload);
+
+	void FlushDeferredEvents();
+
+	//Queued payloads can hold object references
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	virtual void Deinitialize() override;
+
+	bool HasBlueprintListeners(const FGameplayTag& EventGameplayTag) const;
+
+private:
+
+	using FAppendMetadataFunc = void(*)(const void* /*Payload*/, TArray<FString>& /*OutMetadata*/);
+
+	template<typename TPayload>
+	static void AppendPayloadMetadata(const void* Payload, TArray<FString>& OutMetadata)
+	{
+		static_cast<const TPayload*>(Payload)->AppendMetadata(OutMetadata);
+	}
+
+	struct FNativeSubscriber
+	{
+		FRPGNativeEventDelegate Delegate;
+		FDelegateHandle Handle;
+		bool bMatchChildTags = false;
+
+		//Removed while dispatching, erased afterwards
+		bool bRemoved = false;
+	};
+
+	static constexpr uint32 DeferredPayloadAlignment = 16;
+
+	struct FDeferredEvent
+	{
+		FGameplayTag EventTag;
+		TWeakObjectPtr<UObject> Publisher;
+		TWeakObjectPtr<UObject> Target;
+
+		//Native payload types only, never collected
+		const UScriptStruct* PayloadType = nullptr;
+
+		//Into the payload memory of the queue, which may move while it grows
+		int32 PayloadOffset = 0;
+
+		FAppendMetadataFunc AppendMetadata = nullptr;
+	};
+
+	//Payloads are copied into one linear buffer per queue instead of one allocation per event.
+	//The buffer keeps its capacity after a flush, so steady traffic does not allocate. Structs are relocatable, so growing it is safe.
+	struct FDeferredEventQueue
+	{
+		TArray<FDeferredEvent> Events;
+		TArray<uint8, TAlignedHeapAllocator<DeferredPayloadAlignment>> PayloadMemory;
+
+		uint8* GetPayload(const FDeferredEvent& Deferred) { return PayloadMemory.GetData() + Deferred.PayloadOffset; }
+
+		void Add(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata);
+		void AddReferencedObjects(FReferenceCollector& Collector);
+
+		//Destroys the payloads, keeps the memory
+		void Reset();
+	};
+
+	void DispatchEvent(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata);
+	void DispatchNative(const FRPGNativeEvent& Event);
+	void EnqueueEvent(const FRPGNativeEvent& Event, FAppendMetadataFunc AppendMetadata);
+
+	void AddNativeSubscriber(const FGameplayTag& EventGameplayTag, FNativeSubscriber&& Subscriber);
+	void CompactNativeSubscribers();
+
+	//Subscribed tags that receive an event of the given tag, the tag itself and its parents
+	void GetNativeRoute(const FGameplayTag& EventGameplayTag, TArray<FGameplayTag, TInlineAllocator<8>>& OutRoute);
+
+	TMap<FGameplayTag, TArray<FNativeSubscriber>> NativeSubscribers;
+
+	//Published tag -> subscribed tags. Rebuilt lazily when the set of subscribed tags changes.
+	TMap<FGameplayTag, TArray<FGameplayTag, TInlineAllocator<8>>> NativeRoutes;
+
+	//Subscriptions made while dispatching are added afterwards, removals only flag the subscriber until then
+	TArray<TPair<FGameplayTag, FNativeSubscriber>> PendingSubscribers;
+	int32 DispatchDepth = 0;
+	bool bHasRemovedSubscribers = false;
+
+	//Double buffered, so events published while flushing wait for the next tick. Payloads are reported to GC in AddReferencedObjects.
+	FDeferredEventQueue DeferredEvents;
+	FDeferredEventQueue FlushingEvents;
+	bool bIsFlushing = false;
+
 private:
 	/**
 	* Call a global event by name or by class
@@ -347,3 +464,33 @@ private:
 		}
 	};
 };
+
+template<typename TPayload>
+void UGlobalEventHandler::PublishEvent(UObject* Publisher, const FGameplayTag& EventGameplayTag, UObject* Target, const TPayload& Payload)
+{
+	static_assert(TIsDerivedFrom<TPayload, FRPGEventPayload>::Value, "Event payloads must derive from FRPGEventPayload");
+
+	FRPGNativeEvent Event;
+	Event.EventTag = EventGameplayTag;
+	Event.Publisher = Publisher;
+	Event.Target = Target;
+	Event.PayloadType = TPayload::StaticStruct();
+	Event.Payload = &Payload;
+
+	DispatchEvent(Event, &AppendPayloadMetadata<TPayload>);
+}
+
+template<typename TPayload>
+void UGlobalEventHandler::PublishEventDeferred(UObject* Publisher, const FGameplayTag& EventGameplayTag, UObject* Target, const TPayload& Payload)
+{
+	static_assert(TIsDerivedFrom<TPayload, FRPGEventPayload>::Value, "Event payloads must derive from FRPGEventPayload");
+
+	FRPGNativeEvent Event;
+	Event.EventTag = EventGameplayTag;
+	Event.Publisher = Publisher;
+	Event.Target = Target;
+	Event.PayloadType = TPayload::StaticStruct();
+	Event.Payload = &Payload;
+
+	EnqueueEvent(Event, &AppendPayloadMetadata<TPayload>);
+}
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Event/RPGEventPayloads.h"
+#include "UObject/Object.h"
+#include "RPGEventBenchmark.generated.h"
+
+/**
+* Automation tests (non-shipping):
+*	RPGSystem.Benchmark.Event.Dispatch - Blueprint (dynamic multicast + Metadata strings) path against the native and deferred native paths
+*	RPGSystem.Event.DeferredPayloadReferences - objects referenced by a queued payload survive GC until the queue is flushed
+*/
+
+UCLASS(Transient)
+class URPGEventBenchmarkListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	//Parses the amount like the quest objectives do
+	UFUNCTION()
+	void OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata);
+
+	void OnNativeEvent(const FRPGNativeEvent& Event);
+
+	int32 TotalAmount = 0;
+
+	//Trigger of the last location event
+	TWeakObjectPtr<UObject> LastTrigger;
+};
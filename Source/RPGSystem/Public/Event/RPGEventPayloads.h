@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "RPGEventPayloads.generated.h"
+
+class AActor;
+
+/**
+* Base of all typed event payloads. Derived payloads shadow AppendMetadata,
+* so Blueprint listeners still receive the payload as "Key=Value" Metadata strings.
+*/
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FRPGEventPayload
+{
+	GENERATED_BODY()
+
+	void AppendMetadata(TArray<FString>& OutMetadata) const
+	{
+	}
+};
+
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FRPGKillEventPayload : public FRPGEventPayload
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Event")
+	TObjectPtr<AActor> Killer = nullptr;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Event")
+	int32 Amount = 1;
+
+	void AppendMetadata(TArray<FString>& OutMetadata) const
+	{
+		OutMetadata.Add(FString::Printf(TEXT("Amount=%d"), Amount));
+		OutMetadata.Add(FString::Printf(TEXT("Killer=%s"), *GetPathNameSafe(Killer)));
+	}
+};
+
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FRPGInteractEventPayload : public FRPGEventPayload
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Event")
+	FGameplayTag InteractTag;
+
+	void AppendMetadata(TArray<FString>& OutMetadata) const
+	{
+		if (InteractTag.IsValid())
+		{
+			OutMetadata.Add(FString::Printf(TEXT("InteractTag=%s"), *InteractTag.ToString()));
+		}
+	}
+};
+
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FRPGLocationEventPayload : public FRPGEventPayload
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Event")
+	FGameplayTag LocationTag;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Event")
+	TObjectPtr<UObject> Trigger = nullptr;
+
+	void AppendMetadata(TArray<FString>& OutMetadata) const
+	{
+		OutMetadata.Add(FString::Printf(TEXT("LocationTag=%s"), *LocationTag.ToString()));
+		OutMetadata.Add(FString::Printf(TEXT("Trigger=%s"), *GetPathNameSafe(Trigger)));
+	}
+};
+
+/**
+* A published event as seen by native subscribers. Only valid during the callback, the payload is not copied.
+*/
+struct FRPGNativeEvent
+{
+	FGameplayTag EventTag;
+	UObject* Publisher = nullptr;
+	UObject* Target = nullptr;
+
+	const UScriptStruct* PayloadType = nullptr;
+	const void* Payload = nullptr;
+
+	//Set instead of a payload if the event was published through the Blueprint API
+	const TArray<FString>* Metadata = nullptr;
+
+	//Null if the payload is not of the requested type
+	template<typename TPayload>
+	const TPayload* GetPayload() const
+	{
+		return PayloadType && PayloadType->IsChildOf(TPayload::StaticStruct()) ? static_cast<const TPayload*>(Payload) : nullptr;
+	}
+};
+
+DECLARE_DELEGATE_OneParam(FRPGNativeEventDelegate, const FRPGNativeEvent& /*Event*/);
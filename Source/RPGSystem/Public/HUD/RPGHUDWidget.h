@@ -4,8 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "UI/Navigation/WorldMarkers/WorldMarkerWidget.h"
 #include "RPGHUDWidget.generated.h"
 
+class UNavigationMarkerLayerWidget;
 class UStatsComponent;
 class UProgressBarWidget;
 class UStatsViewModel;
@@ -26,6 +28,17 @@ public:
 	
 	UFUNCTION(BlueprintCallable)
 	void SetViewModel(UStatsViewModel* InViewModel);
+
+	// 월드 마커 추가/갱신, Layer_WorldMarkers가 있으면 마커 위젯 대신 UNavigationMarkerSubsystem에 등록
+	// ScreenPersistance면 화면 밖 마커를 가장자리에 고정
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	void AddOrUpdateWorldMarker(UObject* MarkerObject, const FWorldMarkerInfo& MarkerInfo);
+
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	void RemoveWorldMarker(UObject* MarkerObject);
+
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	void RemoveAllWorldMarkers();
 protected:
 	virtual bool NativeOnDrop(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent, UDragDropOperation* InOperation) override;
 	virtual void NativeConstruct() override;
@@ -40,6 +53,20 @@ protected:
 	
 	// UPROPERTY(meta = (BindWidget))
 	// TObjectPtr<UStatBarWidget> WB_StatBars;
+
+	// 배치 월드 마커 레이어 (최상단 캔버스에 앵커 전체로 배치, View는 WorldMarker)
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	TObjectPtr<UNavigationMarkerLayerWidget> Layer_WorldMarkers;
+
+	// 배치 레이어가 없을 때 마커마다 화면에 추가하는 위젯 클래스
+	UPROPERTY(EditDefaultsOnly, Category = "Navigation")
+	TSubclassOf<UWorldMarkerWidget> WorldMarkerClass;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UObject>, TObjectPtr<UWorldMarkerWidget>> WorldMarkerMap;
+
+	// Layer_WorldMarkers로 그리도록 서브시스템에 등록한 마커 대상
+	TSet<TWeakObjectPtr<UObject>> LayerWorldMarkers;
 	
 private:
 	// 캐싱된 폰 참조 (Tick에서 위치 업데이트용)
@@ -66,7 +66,20 @@ class RPGSYSTEM_API UAnimNotify_SpawnHitboxProjectile : public UAnimNotify_Hitbo
 {
 	GENERATED_BODY()
 
+public:
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
 protected:
+	/*
+	 * Projectile actor taken from the world's shared object pool (UObjectPoolSubsystem).
+	 * It should implement IPoolableInterface to reset its state on reuse and call UObjectPoolSubsystem::ReleaseToPool instead of Destroy.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile Setup")
+	TSubclassOf<AActor> ProjectileClass;
+
+	// World transform of every projectile in one burst, forward is the launch direction
+	void GetProjectileSpawnTransforms(const FTransform& BaseTransform, TArray<FTransform>& OutTransforms) const;
+
 	// Settings governing projectiles' spawn distribution
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile Setup")
 	FHitboxSpawnTypeSettings ProjectileSpawnSettings;
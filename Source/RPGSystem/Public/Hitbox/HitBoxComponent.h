@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
 #include "HitBoxComponent.generated.h"
 
 class ACharacter;
@@ -17,6 +18,8 @@ namespace HitBoxConstants
     static constexpr float DEFAULT_DEBUG_DURATION = 2.0f;
     static constexpr float DEFAULT_MULTI_HIT_DELAY = 0.1f;
     static constexpr float DEFAULT_HIT_STOP_DURATION = 0.1f;
+    static constexpr float DEFAULT_SUB_STEP_DISTANCE = 25.0f;
+    static constexpr int32 DEFAULT_MAX_SUB_STEPS = 8;
 }
 
 UENUM(BlueprintType)
@@ -176,6 +179,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HitBox|Debug", meta = (ClampMin = "0.1"))
     float DebugDrawDuration = HitBoxConstants::DEFAULT_DEBUG_DURATION;
 
+    // === 서브스텝 트레이스 ===
+    // 이전 프레임과 현재 프레임 사이의 소켓 위치를 보간해서 스윕 (빠른 스윙/낮은 프레임에서 관통 방지)
+    // 스윕은 비동기로 요청되고 결과는 다음 프레임에 처리됨 (1프레임 지연)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HitBox|SubStep")
+    bool bUseSubSteppedTrace = false;
+
+    // 서브스텝 하나당 소켓의 최대 이동 거리, 스윙 속도에 따라 서브스텝 수가 결정됨
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HitBox|SubStep", meta = (EditCondition = "bUseSubSteppedTrace", ClampMin = "1.0"))
+    float SubStepDistance = HitBoxConstants::DEFAULT_SUB_STEP_DISTANCE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HitBox|SubStep", meta = (EditCondition = "bUseSubSteppedTrace", ClampMin = "1", ClampMax = "32"))
+    int32 MaxSubSteps = HitBoxConstants::DEFAULT_MAX_SUB_STEPS;
+
     // === 데미지 설정 ===
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HitBox|Damage")
     float BaseDamage = 20.0f;
@@ -264,12 +280,38 @@ protected:
     FTimerHandle CooldownTimer;
 
     // === 트레이스 캐시 ===
+    // TraceSocketNames와 같은 순서/개수, 메시에 없는 소켓은 Valid 비트가 꺼지고 그 소켓을 쓰는 구간은 건너뜀
     TArray<FVector> PreviousTracePositions;
+    TArray<FVector> CurrentTracePositions;
+    TBitArray<> PreviousSocketValid;
+    TBitArray<> CurrentSocketValid;
     FCollisionQueryParams CachedQueryParams;
 
+    // === 비동기 트레이스 ===
+    // 이번 프레임에 요청한 스윕, 다음 프레임에 QueryTraceData로 결과를 가져옴
+    // 결과를 받기 전에 비활성화되면 FlushPendingSweeps에서, 결과를 받지 못한 구간은 동기 스윕으로 같은 구간을 처리
+    struct FPendingSweep
+    {
+        FTraceHandle Handle;
+        FVector Start = FVector::ZeroVector;
+        FVector End = FVector::ZeroVector;
+    };
+    TArray<FPendingSweep> PendingSweeps;
+
+    // 활성화 직후에는 이전 포즈도 스윕해야 함
+    bool bPreviousPoseTraced = false;
+
 private:
 	// === 내부 함수들 ===
 	void PerformTrace();
+	void PerformSubSteppedTrace();
+	void ConsumeAsyncTraceResults();
+	void FlushPendingSweeps();
+	// 비동기 결과를 받을 수 없는 구간(아직 처리 중이거나 만료됨)은 동기로 다시 스윕
+	void CollectSweepHits(const TArray<FPendingSweep>& Sweeps, TArray<TArray<FHitResult>>& OutSweepHits);
+	void ProcessSweepResults(const TArray<TArray<FHitResult>>& SweepHits);
+	void RequestAsyncSweep(const FVector& Start, const FVector& End, const FCollisionShape& Shape);
+	FCollisionShape MakeTraceShape() const;
 	void SetHitBoxState(EHitBoxState NewState);
 	
 	// 트레이스 함수들
@@ -292,6 +334,9 @@ private:
 	// 유틸리티
 	void UpdateQueryParams();
 	void CacheTracePositions();
+	void GatherSocketPositions(TArray<FVector>& OutPositions, TBitArray<>& OutValid) const;
+	bool IsSegmentValid(int32 EndSocketIndex) const;
+	int32 CalculateSubStepCount() const;
 
 public:
 	// === 메인 함수들 ===
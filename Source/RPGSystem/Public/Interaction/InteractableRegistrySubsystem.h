@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/Function.h"
+#include "InteractableRegistrySubsystem.generated.h"
+
+class UInteractableComponent;
+
+/**
+ * 상호작용 대상 공간 레지스트리
+ *
+ * UInteractableComponent가 BeginPlay/EndPlay에서 등록/해제하고, 상호작용 영역(InteractableArea) 중심을 XY 균일 그리드 셀에 보관
+ * 영역이 없으면 오너 위치를 보관
+ * UInteractionComponent는 물리 트레이스 대신 이 그리드에서 반경/원뿔 조회로 후보를 고른 뒤
+ * 최종 후보 하나만 같은 영역 중심까지 라인 트레이스로 가림 여부를 확인
+ *
+ * 움직일 수 있는 영역(Static이 아닌)은 TransformUpdated로 셀을 갱신하므로 매 프레임 폴링하지 않음
+ *
+ * Console:
+ *	RPGInteraction.GridCellSize 1000 (다음 월드부터 적용)
+ */
+
+struct FInteractableGridEntry
+{
+	TWeakObjectPtr<UInteractableComponent> Component;
+	FVector Location = FVector::ZeroVector;
+};
+
+UCLASS()
+class RPGSYSTEM_API UInteractableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 월드 컨텍스트의 레지스트리, 게임/PIE 월드가 아니면 nullptr */
+	static UInteractableRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	// --- 등록 ---
+
+	void RegisterInteractable(UInteractableComponent* Component);
+	void UnregisterInteractable(UInteractableComponent* Component);
+
+	/** 상호작용 영역 교체, 텔레포트 등 위치 기준이 바뀐 경우 수동 갱신 */
+	void UpdateInteractableLocation(UInteractableComponent* Component);
+
+	// --- 조회 ---
+
+	/**
+	 * Origin에서 Radius 안, Direction 기준 반각 ConeHalfAngleDegrees 안의 후보 중 최고 점수 하나
+	 * 점수는 정면일수록, 가까울수록 높음 (반각 180이면 구 조회)
+	 * Filter는 기하 조건을 통과한 후보에만 호출
+	 */
+	UInteractableComponent* FindBestInteractable(
+		const FVector& Origin,
+		const FVector& Direction,
+		float Radius,
+		float ConeHalfAngleDegrees,
+		TFunctionRef<bool(UInteractableComponent*)> Filter
+	) const;
+
+	/** Origin에서 Radius 안의 모든 대상, 찾은 수 반환 */
+	int32 QueryInteractablesInRadius(const FVector& Origin, float Radius, TArray<UInteractableComponent*>& OutComponents) const;
+
+	int32 GetNumInteractables() const { return Registered.Num(); }
+
+	/** 그리드에 보관하는 위치 (상호작용 영역 중심, 영역이 없으면 오너 위치) */
+	static FVector GetInteractableLocation(const UInteractableComponent* Component);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FRegisteredInteractable
+	{
+		FIntPoint Cell = FIntPoint::ZeroValue;
+
+		// 움직일 수 있는 위치 기준 컴포넌트만 추적
+		TWeakObjectPtr<USceneComponent> TrackedComponent;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** 위치 기준 컴포넌트 (상호작용 영역, 없으면 오너 루트) */
+	static USceneComponent* GetLocationComponent(const UInteractableComponent* Component);
+
+	void TrackLocationComponent(UInteractableComponent* Component, FRegisteredInteractable& Info);
+	void UntrackLocationComponent(FRegisteredInteractable& Info);
+
+	/** 셀 범위 내 엔트리 순회 (Visitor가 false를 반환하면 중단) */
+	void ForEachEntryInRadius(const FVector& Origin, float Radius, TFunctionRef<bool(const FInteractableGridEntry&, float /*DistanceSquared*/)> Visitor) const;
+
+	void MoveEntry(UInteractableComponent* Component, FRegisteredInteractable& Info, const FVector& NewLocation);
+	void RemoveFromCell(const FIntPoint& Cell, const UInteractableComponent* Component);
+
+	void HandleTrackedTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TWeakObjectPtr<UInteractableComponent> WeakComponent);
+
+	float CellSize = 1000.0f;
+
+	TMap<FIntPoint, TArray<FInteractableGridEntry>> Cells;
+	TMap<TObjectKey<UInteractableComponent>, FRegisteredInteractable> Registered;
+};
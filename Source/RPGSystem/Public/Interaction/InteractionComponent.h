@@ -43,14 +43,26 @@ protected:
 	void RemoveInteractionFromCurrent();
 	void AssignInteractionToLocal(UInteractableComponent* InteractableComponent);
 	
-	// 트레이스 설정
+	// 탐색 설정 (UInteractableRegistrySubsystem 원뿔 조회)
 	// ====================
+	/** 카메라 방향 탐색 반경 */
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace")
 	float CameraTraceLength = 500.f;
+	/** 폰 전방 탐색 반경 */
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace")
 	float OwnerTraceLength = 250.f;
+	/** 카메라 방향 탐색 원점 높이 (폰 위치 기준) */
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace")
 	float InteractionDistance = 110.f;
+	/** 카메라 방향 원뿔 반각 (도) */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace", meta=(ClampMin="0", ClampMax="180"))
+	float CameraConeHalfAngle = 15.f;
+	/** 폰 전방 원뿔 반각 (도) */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace", meta=(ClampMin="0", ClampMax="180"))
+	float OwnerConeHalfAngle = 45.f;
+	/** 최종 후보의 가림 확인 라인 트레이스 채널 */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Trace")
+	TEnumAsByte<ECollisionChannel> LineOfSightChannel = ECC_Visibility;
 
 	// 디버그 설정
 	// ====================
@@ -89,24 +101,20 @@ protected:
 	FTimerHandle InteractionTimer;
 	
 private:
-	// 트레이스 헬퍼 함수
+	// 탐색 헬퍼 함수
 	// ====================
-	
-	/** 캡슐 트레이스 수행 */
-	bool PerformInteractionTrace(
-		TArray<FHitResult>& OutHits, 
-		const FVector& StartLocation, 
-		const FVector& EndLocation,
-		const TArray<AActor*>& IgnoredActors,
-		float CapsuleRadius = 50.0f, 
-		float CapsuleHalfHeight = 100.0f
-	);
 
-	/** 전방 벡터 기반 트레이스로 상호작용 대상 찾기 */
-	UInteractableComponent* FindInteractableViaForwardTrace();
+	/** 레지스트리에서 원뿔 조회로 최적 후보 찾기 (트레이스 없음) */
+	UInteractableComponent* FindInteractableInCone(const FVector& Origin, const FVector& Direction, float Radius, float ConeHalfAngle) const;
+
+	/** 폰 전방 원뿔로 상호작용 대상 찾기 */
+	UInteractableComponent* FindInteractableInFront() const;
 	
-	/** 카메라 시선 기반 트레이스로 상호작용 대상 찾기 */
-	UInteractableComponent* FindInteractableViaTrace();
+	/** 카메라 시선 원뿔로 상호작용 대상 찾기 */
+	UInteractableComponent* FindInteractableInView() const;
+
+	/** 폰 시점에서 대상까지 가리는 것이 없는지 라인 트레이스 한 번으로 확인 */
+	bool HasLineOfSight(UInteractableComponent* Component);
 	
 	/** 상호작용 가능한 컴포넌트인지 유효성 검사 */
 	bool IsValidInteractable(UInteractableComponent* Component) const;
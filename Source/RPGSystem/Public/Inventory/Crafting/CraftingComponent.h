@@ -32,7 +32,8 @@ public:
 protected:
 	UInventoryCoreComponent* GetInventoryCore() const;
 	void ConsumeIngredients(const UCraftingRecipe* Recipe, int32 Amount);
-	void GrantResults(const UCraftingRecipe* Recipe, int32 Amount);
+	/** 결과물이 전부 들어가면 true */
+	bool GrantResults(const UCraftingRecipe* Recipe, int32 Amount);
 
 public:
 	UPROPERTY(BlueprintAssignable, Category = "Crafting")
@@ -29,8 +29,28 @@ enum class EInventoryWeightPolicy : uint8
     BlockOverflow    // 초과 시 추가 불가
 };
 
+/** 일괄 이동 요청 (ServerMoveItemsBatch) */
+USTRUCT(BlueprintType)
+struct FInventoryMoveRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+    FGuid SourceGuid;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+    int32 SourceIndex = -1;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+    FGuid DestGuid;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+    int32 DestIndex = -1;
+};
+
 // 델리게이트 선언
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInventoryChanged, FGuid /*InventoryGuid*/, int32 /*SlotIndex*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInventoryBatchChanged, FGuid /*InventoryGuid*/, const TArray<int32>& /*SlotIndices*/);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnItemAdded, FGuid /*InventoryGuid*/, int32 /*SlotIndex*/, const UItemDefinition* /*ItemDef*/);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnItemRemoved, FGuid /*InventoryGuid*/, int32 /*SlotIndex*/, const UItemDefinition* /*ItemDef*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnWeightChanged, FGuid /*InventoryGuid*/, float /*CurrentWeight*/);
@@ -42,6 +62,8 @@ class RPGSYSTEM_API UInventoryCoreComponent : public UActorComponent
     GENERATED_BODY()
     
     friend class UInventoryInitializer;
+    friend struct FInventoryList;
+    friend struct FInventorySlotList;
 public:
     UInventoryCoreComponent(const FObjectInitializer& ObjectInitializer);
 
@@ -51,8 +73,14 @@ public:
   
     UFUNCTION(Server,Reliable)
     void ServerMoveItemToSlot(FGuid SourceGuid, int32 SourceIdx, FGuid DestGuid, int32 DestIdx);
+
+    /** 여러 이동을 RPC 한 번으로 처리, 하나라도 실패하면 전부 롤백 */
+    UFUNCTION(Server,Reliable)
+    void ServerMoveItemsBatch(const TArray<FInventoryMoveRequest>& Moves);
     
     FOnInventoryChanged OnInventoryChanged;
+    /** 트랜잭션 커밋 시 인벤토리마다 한 번, 바뀐 슬롯 전체 (-1 포함 시 전체 갱신) */
+    FOnInventoryBatchChanged OnInventoryBatchChanged;
     FOnItemAdded OnItemAdded;
     FOnItemRemoved OnItemRemoved;
     FOnWeightChanged OnWeightChanged;
@@ -61,6 +89,10 @@ public:
 protected:
     UPROPERTY(Replicated)
     FInventoryList InventoryList;
+
+    /** 슬롯 단위 복제 (InventoryList는 GUID/메타데이터/슬롯 수만 복제) */
+    UPROPERTY(Replicated)
+    FInventorySlotList InventorySlots;
    
     /** 에디터에서 직접 설정하는 인벤토리 설정들 */
     UPROPERTY(EditDefaultsOnly, Category = "Inventory|Initialization")
@@ -158,6 +190,25 @@ public:
     float CalculateCurrentWeight(FGuid InventoryGuid) const;
     int32 GetInventoryCount() const;
 
+    // ========================================
+    // 트랜잭션 (일괄 처리)
+    // ========================================
+
+    /**
+     * Begin ~ Commit 사이의 변경은 알림/무게 갱신/복제 dirty 마킹을 모았다가 커밋 시 한 번에 처리
+     * 중첩 가능, 가장 바깥 Commit에서 반영되며 안쪽에서 Rollback하면 전체가 롤백됨
+     */
+    void BeginTransaction();
+    void CommitTransaction();
+    void RollbackTransaction();
+    bool IsInTransaction() const { return TransactionDepth > 0; }
+
+    /** 조회 인덱스가 슬롯 배열 전체 스캔 결과와 같은지 검사 (디버그용) */
+    bool VerifyLookupIndex(FGuid InventoryGuid, FString* OutMismatch = nullptr) const;
+
+    /** 슬롯 단위 복제 목록 (복제 테스트/벤치마크용) */
+    const FInventorySlotList& GetReplicatedSlots() const { return InventorySlots; }
+
 protected:
 
     /**
@@ -168,6 +219,15 @@ protected:
     int32 InsertItem_Internal(FGuid InventoryGuid, const UItemDefinition* ItemDef, int32 Quantity, UItemInstance* SpecificInstance);
 
     void HandleInventoryChanged(FGuid InventoryGuid, int32 SlotIndex, EInventoryRefreshType RefreshType, const UItemDefinition* ItemDefAddedOrRemoved, bool bWasAdded);
+
+    /** 슬롯 변경을 조회 인덱스에 반영 (SlotIndex -1이면 전체 재구성) */
+    void UpdateLookupIndex(FGuid InventoryGuid, int32 SlotIndex);
+
+    /** [서버] 슬롯 변경을 InventorySlots에 반영 (SlotIndex -1이면 전체 슬롯, 바뀐 슬롯만 dirty) */
+    void SyncReplicatedSlots(FGuid InventoryGuid, int32 SlotIndex);
+
+    /** [클라이언트] 복제된 엔트리의 슬롯 배열 크기를 맞추고 받은 슬롯을 적용 */
+    void RefreshReplicatedEntry(FInventoryEntry& Entry);
     
     int32 FindPartialStack(FGuid InventoryGuid, const UItemDefinition* ItemDef) const;
     bool IsItemStackable(const UItemDefinition* ItemDef) const;
@@ -181,5 +241,88 @@ protected:
     bool CanInsertSpecificInstance(FGuid InventoryGuid, const UItemDefinition* ItemDef, int32 Quantity) const;
     void AddToStack(FGuid InventoryGuid, int32 SlotIndex, int32 Quantity);  
     FGuid GetGuidByName_NoLog(FName InventoryName) const;
-    
+
+    /** ServerMoveItemToSlot의 이동/스택/교환 로직, 아무것도 바뀌지 않으면 false */
+    bool MoveOrSwapSlot(FGuid SourceGuid, int32 SourceIdx, FGuid DestGuid, int32 DestIdx);
+
+    // ========================================
+    // 트랜잭션 내부 상태
+    // ========================================
+
+    /** 트랜잭션 중 처음 변경되기 직전의 인벤토리 상태 */
+    struct FTransactionSnapshot
+    {
+        bool bExisted = false;
+        FInventoryMetaData MetaData;
+        TArray<FInventorySlot> Slots;
+    };
+
+    struct FPendingItemEvent
+    {
+        FGuid InventoryGuid;
+        int32 SlotIndex = -1;
+        const UItemDefinition* ItemDef = nullptr;
+        bool bWasAdded = false;
+
+        bool operator==(const FPendingItemEvent& Other) const
+        {
+            return InventoryGuid == Other.InventoryGuid && SlotIndex == Other.SlotIndex && ItemDef == Other.ItemDef && bWasAdded == Other.bWasAdded;
+        }
+    };
+
+    /** 변경 직전에 호출, 트랜잭션 중이면 인벤토리별로 한 번만 스냅샷 */
+    void RecordTransactionSnapshot(FGuid InventoryGuid);
+    void FlushTransaction();
+    void RestoreTransactionSnapshots();
+
+    int32 TransactionDepth = 0;
+    bool bTransactionRollbackRequested = false;
+    TMap<FGuid, FTransactionSnapshot> TransactionSnapshots;
+    TMap<FGuid, TSet<int32>> PendingChangedSlots;
+    TArray<FPendingItemEvent> PendingItemEvents;
+};
+
+/**
+ * 스코프 트랜잭션, 명시적으로 Rollback하지 않으면 스코프 종료 시 커밋
+ *
+ *	FInventoryTransactionScope Transaction(Inventory);
+ *	if (!Inventory->RemoveItemByDef(...)) { Transaction.Rollback(); return; }
+ */
+struct FInventoryTransactionScope
+{
+    explicit FInventoryTransactionScope(UInventoryCoreComponent* InInventory)
+        : Inventory(InInventory)
+    {
+        if (Inventory)
+        {
+            Inventory->BeginTransaction();
+        }
+    }
+
+    ~FInventoryTransactionScope()
+    {
+        Commit();
+    }
+
+    void Commit()
+    {
+        if (Inventory && !bFinished)
+        {
+            bFinished = true;
+            Inventory->CommitTransaction();
+        }
+    }
+
+    void Rollback()
+    {
+        if (Inventory && !bFinished)
+        {
+            bFinished = true;
+            Inventory->RollbackTransaction();
+        }
+    }
+
+private:
+    UInventoryCoreComponent* Inventory = nullptr;
+    bool bFinished = false;
 };
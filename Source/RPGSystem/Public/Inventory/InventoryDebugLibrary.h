@@ -29,6 +29,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory|Debug")
 	static void LogInventoryByName(UInventoryCoreComponent* InventoryComp, FName InventoryName);
 
+	/** 조회 인덱스(아이템별 슬롯, 빈 슬롯, 개수, 무게)가 슬롯 전체 스캔 결과와 같은지 검사합니다. */
+	UFUNCTION(BlueprintCallable, Category = "Inventory|Debug")
+	static bool ValidateLookupIndex(UInventoryCoreComponent* InventoryComp);
+
 	/** 화면(Viewport)에 현재 인벤토리들의 요약 정보를 텍스트로 표시합니다. (PrintString 대체) */
 	UFUNCTION(BlueprintCallable, Category = "Inventory|Debug")
 	static void DrawDebugInventoryOnScreen(UInventoryCoreComponent* InventoryComp, float Duration = 5.0f);
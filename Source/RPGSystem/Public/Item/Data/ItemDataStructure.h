@@ -17,7 +17,7 @@ class UItemInstance;
  * - 각 슬롯은 고유한 런타임 상태를 가진 아이템을 보관
  */
 USTRUCT(BlueprintType)
-struct FInventorySlot
+struct RPGSYSTEM_API FInventorySlot
 {
 	GENERATED_BODY()
 	
@@ -44,6 +44,19 @@ struct FInventorySlot
 	bool IsEmpty() const { return ItemInstance == nullptr || Quantity <= 0; }
 	bool IsValid() const { return !IsEmpty(); }
 	void Clear() { ItemInstance = nullptr; Quantity = 0; }
+
+	/** 내용(아이템, 수량)만 교환, SlotIndex는 배열 위치이므로 그대로 둠 */
+	void SwapContents(FInventorySlot& Other)
+	{
+		Swap(ItemInstance, Other.ItemInstance);
+		Swap(Quantity, Other.Quantity);
+	}
+
+	bool operator==(const FInventorySlot& Other) const
+	{
+		return SlotIndex == Other.SlotIndex && ItemInstance == Other.ItemInstance && Quantity == Other.Quantity;
+	}
+	bool operator!=(const FInventorySlot& Other) const { return !(*this == Other); }
 };
 
 /**
@@ -51,7 +64,7 @@ struct FInventorySlot
  * 인벤토리의 제약사항 및 설정
  */
 USTRUCT(BlueprintType)
-struct FInventoryMetaData
+struct RPGSYSTEM_API FInventoryMetaData
 {
 	GENERATED_BODY()
 
@@ -150,8 +163,49 @@ struct FInventoryCreateConfig : public FTableRowBase
 	int32 CreationPriority = 0;
 };
 
+/**
+ * 인벤토리 조회용 보조 인덱스 (복제하지 않음, 서버/클라이언트 각각 유지)
+ * 슬롯이 바뀔 때마다 UpdateSlot으로 동기화되어 개수/빈 슬롯/부분 스택/무게 조회가 슬롯 수와 무관해짐
+ */
+struct RPGSYSTEM_API FInventoryLookupIndex
+{
+	/** 슬롯 배열 전체로 다시 구성 */
+	void Rebuild(const TArray<FInventorySlot>& Slots);
+
+	/** 한 슬롯의 변경을 반영 (이전 상태는 인덱스가 기억) */
+	void UpdateSlot(int32 SlotIndex, const FInventorySlot& Slot);
+
+	int32 GetItemCount(const UItemDefinition* ItemDef) const { return CountByDef.FindRef(ItemDef); }
+
+	/** 해당 아이템이 들어있는 슬롯 (오름차순), 없으면 nullptr */
+	const TArray<int32>* FindSlotsByDef(const UItemDefinition* ItemDef) const { return SlotsByDef.Find(ItemDef); }
+
+	int32 FindFirstEmptySlot() const { return EmptySlots.Find(true); }
+	int32 GetNumEmptySlots() const { return NumEmptySlots; }
+
+	/** 아이템 종류 수에 비례 (슬롯 수와 무관) */
+	float GetTotalWeight() const;
+
+	/** 슬롯 배열을 전부 훑어 만든 결과와 같은지 검사 (디버그용) */
+	bool Matches(const TArray<FInventorySlot>& Slots, FString* OutMismatch = nullptr) const;
+
+private:
+	struct FCachedSlot
+	{
+		const UItemDefinition* ItemDef = nullptr;
+		int32 Quantity = 0;
+		bool bOccupied = false;
+	};
+
+	TArray<FCachedSlot> CachedSlots;
+	TMap<const UItemDefinition*, TArray<int32>> SlotsByDef;
+	TMap<const UItemDefinition*, int32> CountByDef;
+	TBitArray<> EmptySlots;
+	int32 NumEmptySlots = 0;
+};
+
 USTRUCT()
-struct FInventoryEntry : public FFastArraySerializerItem
+struct RPGSYSTEM_API FInventoryEntry : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 public:
@@ -163,10 +217,17 @@ public:
 	UPROPERTY()
 	FInventoryMetaData MetaData;
     
-	/** 슬롯 배열 */
+	/** 슬롯 개수 (클라이언트는 이 크기로 Slots를 만들고 FInventorySlotList에서 내용을 채움) */
 	UPROPERTY()
+	int32 NumSlots = 0;
+
+	/** 슬롯 배열 (복제하지 않음, 슬롯 단위로 FInventorySlotList를 통해 복제) */
+	UPROPERTY(NotReplicated)
 	TArray<FInventorySlot> Slots;
 
+	/** Slots 조회 인덱스 */
+	FInventoryLookupIndex LookupIndex;
+
 	FInventoryEntry()
 		: InventoryGuid()
 	{}
@@ -174,8 +235,11 @@ public:
 	FInventoryEntry(const FGuid& InGuid, const FInventoryMetaData& InMetaData, const TArray<FInventorySlot>& InSlots)
 		: InventoryGuid(InGuid)
 		, MetaData(InMetaData)
+		, NumSlots(InSlots.Num())
 		, Slots(InSlots)
-	{}
+	{
+		LookupIndex.Rebuild(Slots);
+	}
 };
 
 class UInventoryCoreComponent;
@@ -186,7 +250,7 @@ class UInventoryCoreComponent;
  */
 
 USTRUCT()
-struct FInventoryList : public FFastArraySerializer
+struct RPGSYSTEM_API FInventoryList : public FFastArraySerializer
 {
     GENERATED_BODY()
 
@@ -243,11 +307,94 @@ struct FInventoryList : public FFastArraySerializer
 	TArray<FGuid> GetAllInventoryGuids() const;
 	int32 GetInventoryCount() const;
 	bool IsEmpty() const;
+
+private:
+	int32 FindIndexByGuid(const FGuid& InGuid) const;
+	void RebuildGuidIndex() const;
+
+	/** GUID -> Entries 인덱스, 복제로 배열이 바뀌면 다음 조회 때 재구성 */
+	mutable TMap<FGuid, int32> GuidToIndex;
+	mutable bool bGuidIndexDirty = true;
 };
 
 // TStructOpsTypeTraits 특수화 (필수)
 template<>
 struct TStructOpsTypeTraits<FInventoryList> : public TStructOpsTypeTraitsBase2<FInventoryList>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/**
+ * 슬롯 단위 복제 항목
+ * (InventoryGuid, SlotIndex)로 식별되어, 스택 하나가 바뀌면 그 슬롯만 전송됨
+ */
+USTRUCT()
+struct RPGSYSTEM_API FInventorySlotEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGuid InventoryGuid;
+
+	UPROPERTY()
+	FInventorySlot Slot;
+};
+
+/**
+ * 슬롯 목록 (네트워크 복제용)
+ * 서버는 FInventoryEntry::Slots가 바뀔 때 SyncSlot으로 반영, 클라이언트는 콜백에서 Slots에 다시 적용
+ * 한 번도 채워진 적 없는 슬롯은 항목을 만들지 않음 (클라이언트 기본값이 빈 슬롯)
+ */
+USTRUCT()
+struct RPGSYSTEM_API FInventorySlotList : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FInventorySlotEntry> Items;
+
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UInventoryCoreComponent> OwnerComponent = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FInventorySlotEntry, FInventorySlotList>(
+            Items, DeltaParms, *this);
+    }
+
+    // ========================================
+    // 콜백 함수들 (복제 시 자동 호출, 바뀐 슬롯만 갱신)
+    // ========================================
+
+    void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+    void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+    void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+
+    // ========================================
+    // 헬퍼 함수들
+    // ========================================
+
+    /** [서버] Slots[SlotIndex]의 내용을 복제 항목에 반영, 내용이 같으면 dirty 마킹하지 않음 */
+    void SyncSlot(const FGuid& InGuid, int32 SlotIndex, const FInventorySlot& InSlot);
+
+    /** [서버] 인벤토리의 모든 복제 항목 제거 */
+    void RemoveInventory(const FGuid& InGuid);
+
+    /** [클라이언트] 이미 받은 슬롯들을 엔트리에 적용 (엔트리가 슬롯보다 늦게 도착한 경우) */
+    void ApplyToEntry(FInventoryEntry& Entry) const;
+
+private:
+    void ApplyReplicatedSlots(const TArrayView<int32> Indices, bool bRemoved);
+
+    /** (InventoryGuid, SlotIndex) -> Items 인덱스, 서버에서만 사용 */
+    TMap<TPair<FGuid, int32>, int32> ItemIndexMap;
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventorySlotList> : public TStructOpsTypeTraitsBase2<FInventorySlotList>
 {
     enum
     {
@@ -47,6 +47,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Quest | Component")
 	TMap<int, FQuestGiverEntry> QuestList;
 
+	// 퀘스트 데이터의 QuestGiverID와 매칭, 해당 퀘스트들이 QuestList에 추가됨
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Quest | Component")
+	FName QuestGiverID = NAME_None;
+
 	UFUNCTION(Category = "Quest | Events")
 	void OnQuestStateChangedWrapper(URPGQuest* QuestUpdate, EQuestState NewState);
 	
@@ -113,6 +117,8 @@ private:
 	TObjectPtr<UQuestMarkerWidget> VisualMarkWidget;
 private:
 	void CreateQuestMarkerWidget();
+	// QuestList의 퀘스트 데이터가 비동기 로드된 뒤 호출
+	void OnQuestsLoaded();
 	void MarkerFloatingMovement(float DeltaTime);
 	// UQuestPlayerChannels* GetPlayerChannelsFromActor(AActor* Actor) const;
 	// UQuestManagerComponent* GetQuestManagerFromActor(AActor* Actor) const;
@@ -27,6 +27,7 @@ protected:
 	virtual void BeginPlay() override;
 
 	void ListenToQuests();
+	void OnQuestsLoaded();
 
 	/* References */
 	UPROPERTY(BlueprintReadOnly, Category = "Quest | Quest")
@@ -11,7 +11,19 @@ class URPGQuestData;
 class URPGQuest;
 class UQuestEventMediator;
 class UQuestSpecialEventData;
+struct FStreamableHandle;
 
+// 에셋을 로드하지 않고 레지스트리 태그에서 읽어온 퀘스트 정보
+struct FQuestAssetInfo
+{
+	FSoftObjectPath AssetPath;
+	FName QuestGiverID;
+	TArray<int32> PrerequisiteQuests;
+	TArray<FGameplayTag> SpecialEventTags;
+};
+
+DECLARE_DELEGATE(FOnQuestsLoadedNative);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQuestLoaded, URPGQuest*, Quest);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQuestAccepted, URPGQuest*, Quest);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQuestCompleted, URPGQuest*, Quest);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQuestFailed, URPGQuest*, Quest);
@@ -34,13 +46,45 @@ protected:
 	void UnregisterQuestObjectives(URPGQuest* Quest);
 	void InitializeSpecialEventTracking();
 
+	// 레지스트리 태그로 QuestAssetIndex 구성 (태그가 없는 구버전 에셋은 로드해서 읽음)
+	void BuildQuestAssetIndex();
+	URPGQuest* CreateQuestInstance(int32 QuestID, URPGQuestData* Data);
+	void HandleQuestsLoaded(TArray<int32> QuestIDs, FOnQuestsLoadedNative OnLoaded);
+
 	UFUNCTION()
 	void HandleTrackedSpecialEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata);
 
 
 public:
+	// 로드되지 않은 퀘스트는 동기 로드 후 반환 (가능하면 RequestQuestsAsync 사용)
 	UFUNCTION(BlueprintCallable, Category = "Quest | Quest")
 	URPGQuest* QueryQuest(int QuestID);
+
+	// 로드된 퀘스트만 반환, 로드를 일으키지 않음
+	UFUNCTION(BlueprintPure, Category = "Quest | Quest")
+	URPGQuest* FindLoadedQuest(int32 QuestID) const;
+
+	UFUNCTION(BlueprintPure, Category = "Quest | Quest")
+	bool IsQuestLoaded(int32 QuestID) const;
+
+	/** Async Loading **/
+	// 아직 로드되지 않은 퀘스트를 비동기로 로드하고, 모두 준비되면 OnLoaded 호출 (이미 로드된 경우 즉시 호출)
+	void RequestQuestsAsync(const TArray<int32>& QuestIDs, FOnQuestsLoadedNative OnLoaded = FOnQuestsLoadedNative());
+
+	UFUNCTION(BlueprintCallable, Category = "Quest | Loading")
+	void PreloadQuests(const TArray<int32>& QuestIDs);
+
+	// 스트리밍 셀의 퀘스트 NPC가 로드될 때 호출
+	UFUNCTION(BlueprintCallable, Category = "Quest | Loading")
+	void PreloadQuestsForGiver(FName QuestGiverID);
+
+	UFUNCTION(BlueprintPure, Category = "Quest | Query")
+	void GetQuestIDsForGiver(FName QuestGiverID, TArray<int32>& OutQuestIDs) const;
+
+	UFUNCTION(BlueprintPure, Category = "Quest | Query")
+	void GetQuestPrerequisites(int32 QuestID, TArray<int32>& OutQuestIDs) const;
+
+	const FQuestAssetInfo* FindQuestAssetInfo(int32 QuestID) const { return QuestAssetIndex.Find(QuestID); }
 	
 	/* Delegates */
 	// UPROPERTY(BlueprintCallable, Category = "Quest | Date")
@@ -63,6 +107,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest | Quest")
 	bool FailQuestByID(int32 QuestID);
 
+	// 로드된 퀘스트만 포함 (수락된 퀘스트는 항상 로드되어 있음)
 	UFUNCTION(BlueprintCallable, Category = "Quest | Query")
 	void GetAllQuests(TArray<URPGQuest*>& OutQuests) const;
 
@@ -81,6 +126,12 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Quest | Quest")
 	TMap<int, URPGQuest*> QuestDataCenter;
 
+	TMap<int32, FQuestAssetInfo> QuestAssetIndex;
+	TMultiMap<FName, int32> QuestsByGiver;
+
+	// 진행 중인 비동기 로드, 완료되면 URPGQuest가 데이터를 참조함
+	TArray<TSharedPtr<FStreamableHandle>> PendingLoadHandles;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UQuestEventMediator> QuestEventMediator;
 
@@ -94,6 +145,9 @@ protected:
 	TSet<FName> TriggeredSpecialEventAssets;
 
 public:
+	UPROPERTY(BlueprintAssignable, Category = "Quest | Events")
+	FOnQuestLoaded OnQuestLoaded;
+
 	UPROPERTY(BlueprintAssignable, Category = "Quest | Events")
 	FOnQuestAccepted OnQuestAccepted;
 
@@ -109,6 +163,7 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Quest | Save-Load")
 	void SaveQuestData();
 
+	// 로드되지 않은 퀘스트는 nullptr
 	UFUNCTION(BlueprintCallable, Category = "Quest | Query")
 	const URPGQuestData* GetQuestDataByID(int32 QuestID) const;		
 };
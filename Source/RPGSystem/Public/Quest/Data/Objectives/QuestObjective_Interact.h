@@ -26,10 +26,10 @@ public:
 	virtual void DeactivateObjective() override;
 	virtual FString GetProgressString() const override;
 	virtual TArray<FGameplayTag> GetListenedEventTags() const override;
+	virtual FGameplayTag GetListenedTargetTag(const FGameplayTag& EventTag) const override;
+	virtual bool OnQuestEvent(const FQuestEventPayload& Payload) override;
 
 private:
 	UFUNCTION()
 	void OnInteracted(const FGameplayTag& InteractTag);
-
-	virtual void OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata) override;
 };
@@ -28,7 +28,8 @@ public:
 	virtual void DeactivateObjective() override;
 	virtual FString GetProgressString() const override;
 	virtual TArray<FGameplayTag> GetListenedEventTags() const override;
+	virtual FGameplayTag GetListenedTargetTag(const FGameplayTag& EventTag) const override;
 
-private:
-	virtual void OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata) override;
+	/** 대상 태그는 Mediator가 라우팅 단계에서 이미 확인함 */
+	virtual bool OnQuestEvent(const FQuestEventPayload& Payload) override;
 };
@@ -22,10 +22,10 @@ public:
 	virtual void ActivateObjective(URPGQuest* OwnerQuest) override;
 	virtual void DeactivateObjective() override;
 	virtual TArray<FGameplayTag> GetListenedEventTags() const override;
+	virtual FGameplayTag GetListenedTargetTag(const FGameplayTag& EventTag) const override;
+	virtual bool OnQuestEvent(const FQuestEventPayload& Payload) override;
 	
 private:
 	UFUNCTION()
 	void OnLocationEntered(const FGameplayTag& LocationTag);
-
-	virtual void OnGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata) override;
 };
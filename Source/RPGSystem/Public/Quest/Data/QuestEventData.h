@@ -18,6 +18,10 @@ struct FQuestEventPayload
 	UPROPERTY(BlueprintReadOnly, Category = "Quest Event")
 	FGameplayTag EventTag;
 
+	// 이벤트 대상의 태그 (처치된 액터, 상호작용/위치 태그). 라우팅에 사용
+	UPROPERTY(BlueprintReadOnly, Category = "Quest Event")
+	FGameplayTagContainer TargetTags;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Quest Event")
 	TArray<FString> Metadata;
 
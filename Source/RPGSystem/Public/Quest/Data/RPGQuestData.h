@@ -41,9 +41,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest | Quest Overview")
 	FString QuestSummary = FString();
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest | Quest Overview")
+	// 에셋 레지스트리 태그로도 노출되어, 에셋을 로드하지 않고 퀘스트 목록을 만들 수 있음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AssetRegistrySearchable, Category = "Quest | Quest Overview")
 	int QuestID = 0;
 
+	// 이 퀘스트를 주는 NPC (QuestGiverComponent의 QuestGiverID와 매칭, 스트리밍 셀 프리로드용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AssetRegistrySearchable, Category = "Quest | Quest Overview")
+	FName QuestGiverID = NAME_None;
+
 	/* Requirements */
 	UPROPERTY(EditAnywhere, Instanced, BlueprintReadOnly, Category = "Quest | Requirements")
 	TArray<TObjectPtr<UQuestRequirementBase>> Requirements;
@@ -62,4 +67,11 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest | Quest Overview")
 	TMap<UItemDefinition*, int> ItemsReward;
+
+	/** Asset Registry **/
+	// 선행 퀘스트 ID, 스페셜 이벤트 태그를 레지스트리 태그로 기록 (QuestManager가 로드 없이 인덱스를 구성)
+	static const FName PrerequisiteQuestsTag;
+	static const FName SpecialEventTagsTag;
+
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
 };
@@ -23,6 +23,10 @@ class RPGSYSTEM_API IQuestEventListener
 	GENERATED_BODY()
 
 public:
+	//Return true once no more events are needed, e.g. the objective is completed
 	virtual bool OnQuestEvent(const FQuestEventPayload& Payload) = 0;
 	virtual TArray<FGameplayTag> GetListenedEventTags() const = 0;
+
+	//Only events with this tag in their target tags are routed to the listener. If invalid, all events of the listened tags are.
+	virtual FGameplayTag GetListenedTargetTag(const FGameplayTag& EventTag) const { return FGameplayTag(); }
 };
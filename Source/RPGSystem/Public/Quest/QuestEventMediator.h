@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Event/RPGEventPayloads.h"
+#include "Quest/Data/QuestEventData.h"
 #include "UObject/NoExportTypes.h"
+#include "UObject/ObjectKey.h"
 #include "QuestEventMediator.generated.h"
 
+class IQuestEventListener;
 class UGlobalEventHandler;
 class UQuestObjectiveBase;
 class URPGQuest;
@@ -19,6 +23,7 @@ class RPGSYSTEM_API UQuestEventMediator : public UObject
 	GENERATED_BODY()
 public:
 	void Initialize(UGlobalEventHandler* InGlobalEventHandler);
+	virtual void BeginDestroy() override;
 	
 	/** ListenerObject는 IQuestEventListener를 구현한 UObject 여야 함 */
 	void RegisterListener(UObject* ListenerObject);
@@ -27,14 +32,52 @@ public:
 	
 protected:
 	/** GlobalEventHandler로부터 이벤트 수신 (내부 콜백) */
-	UFUNCTION()
-	void HandleGlobalEvent(UObject* Publisher, UObject* Payload, const TArray<FString>& Metadata);
+	void HandleGlobalEvent(const FRPGNativeEvent& Event);
 
 	/** 특정 태그에 대한 GlobalEvent 바인딩 보장 */
 	void BindTagIfNeeded(const FGameplayTag& Tag);
+	void UnbindTag(const FGameplayTag& Tag);
+
+	/** 이벤트의 대상 태그와 수량을 페이로드에서 한 번만 추출 */
+	static void BuildQuestPayload(const FRPGNativeEvent& Event, FQuestEventPayload& OutPayload);
 	
 private:
-	TMap<FGameplayTag, TArray<TWeakObjectPtr<UObject>>> ListenersByTag;
+	/** 미리 캐스팅된 리스너 */
+	struct FListenerEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+		IQuestEventListener* Listener = nullptr;
+	};
+
+	/** 이벤트 태그 하나의 라우팅 인덱스. 대상 태그별로 리스너를 나눔 */
+	struct FEventRoute
+	{
+		TArray<FListenerEntry> AnyTarget;
+		TMap<FGameplayTag, TArray<FListenerEntry>> ByTargetTag;
+
+		bool IsEmpty() const
+		{
+			return AnyTarget.Num() == 0 && ByTargetTag.Num() == 0;
+		}
+	};
+
+	/** (이벤트 태그, 대상 태그) */
+	using FRouteKey = TPair<FGameplayTag, FGameplayTag>;
+
+	void AddToRoute(const FRouteKey& Key, const FListenerEntry& Entry);
+	void RemoveFromRoutes(const UObject* ListenerObject);
+	void CompactRoutes();
+
+	TMap<FGameplayTag, FEventRoute> Routes;
+
+	/** 리스너별 등록된 키. 해제 시 전체 인덱스를 순회하지 않도록 */
+	TMap<TObjectKey<UObject>, TArray<FRouteKey>> ListenerKeys;
+
 	TWeakObjectPtr<UGlobalEventHandler> GlobalEventHandler;
-	TSet<FGameplayTag> BoundTags;
+	TMap<FGameplayTag, FDelegateHandle> BoundTags;
+
+	/** 디스패치 중 등록은 끝난 뒤에 추가, 해제는 엔트리를 비워두고 끝난 뒤에 정리 */
+	TArray<TPair<FRouteKey, FListenerEntry>> PendingEntries;
+	int32 DispatchDepth = 0;
+	bool bHasRemovedEntries = false;
 };
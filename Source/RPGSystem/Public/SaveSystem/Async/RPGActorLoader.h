@@ -13,10 +13,6 @@ class URPGSaveSubsystem;
 
 DECLARE_DELEGATE(FOnLoaderComplete);
 
-DECLARE_STATS_GROUP(TEXT("RPGSave"), STATGROUP_RPGSave, STATCAT_Advanced);
-DECLARE_CYCLE_STAT(TEXT("RPGSave Loader Tick"), STAT_RPGSaveLoader_Tick, STATGROUP_RPGSave);
-DECLARE_CYCLE_STAT(TEXT("RPGSave Loader Gather"), STAT_RPGSaveLoader_Gather, STATGROUP_RPGSave);
-
 
 USTRUCT()
 struct FLoaderInitData
@@ -58,6 +54,9 @@ public:
     void Start();
     FOnLoaderComplete OnComplete;
 
+    //Share of saved records that have been handled, 0 to 1
+    float GetProgress() const;
+
 private:
 
     //ProcessData holds save data + pre-resolved actor pointer
@@ -87,13 +86,23 @@ private:
 
     void StartBatchTick();
     void ProcessNextBatch();
-    void ProcessActorBatch(const TArray<FActorProcessData>& Batch);
 
     void EvaluateAndProcess(const FActorSaveData& Data);
     bool ShouldEvaluateData(const FActorSaveData& Data, TWeakObjectPtr<AActor>& OutActorPtr) const;
     void ProcessActor(const FActorProcessData& ProcessData);
     bool ShouldContinueTicking();
 
+    //Frame budget
+    void BeginFrameBudget();
+    bool HasFrameBudget(const FName& CostKey) const;
+    void ProcessActorTimed(const FActorProcessData& ProcessData, const FName& CostKey);
+
+    static FName GetCostKey(const FActorProcessData& ProcessData);
+    static double GetEstimatedCost(const FName& CostKey);
+    static void UpdateEstimatedCost(const FName& CostKey, const double Seconds);
+
+    void ReportProgress(const int32 NumRecords);
+
     bool CheckActorLimits(int32& IterationCount);
 
     void Destroy();
@@ -113,7 +122,10 @@ private:
     TObjectPtr<URPGSaveSubsystem> RPGSaveSubsystem;
 
     TArray<FActorSaveData> SavedActors;
-    TArray<TArray<FActorProcessData>> Batches;
+
+    //Gathered records in load order. Consumed from the head, so taking the next one is O(1).
+    TArray<FActorProcessData> LoadQueue;
+    int32 QueueHead = 0;
 
     TMap<FName, const TWeakObjectPtr<AActor>> ActorMap;
 
@@ -126,4 +138,18 @@ private:
 
     int32 CurrentIndex = 0;
     int32 BatchSize = 0;
+
+    //Seconds per frame, zero uses the fixed batch size
+    double FrameBudget = 0.0;
+    double FrameStartTime = 0.0;
+    int32 FrameProcessedCount = 0;
+
+    //Records added to and handled in the subsystem progress
+    int32 NumWork = 0;
+    int32 NumHandled = 0;
+    uint32 LoadGeneration = 0;
+
+    //Moving average of load seconds per Actor class. Shared by all loaders, Game Thread only.
+    static TMap<FName, double> ClassLoadCost;
+    static double AverageLoadCost;
 };
@@ -70,6 +70,7 @@ private:
 
 	void SaveLevel();
 	void InternalSaveLevel();
+	void InternalSaveLevelStaged();
 
 	void FinishSaving();
 	void CompleteSavingTask();
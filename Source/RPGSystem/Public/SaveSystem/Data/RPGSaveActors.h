@@ -12,6 +12,7 @@ struct FActorSaveData;
 struct FRawObjectSaveData;
 
 class UWorld;
+class ULevel;
 class AActor;
 class APlayerController;
 class USceneComponent;
@@ -45,6 +46,8 @@ public:
 	static EActorType GetActorType(const AActor* Actor);
 
 	static FString GetActorLevelName(const AActor* Actor);
+	static FName GetRecordLevelName(const ULevel* Level);
+	static FName GetRecordLevelName(const AActor* Actor);
 	static FString GetFullActorName(const AActor* Actor);
 	static FString GetComponentName(const AActor* Actor/*ToSave*/, const UActorComponent* Comp);
 
@@ -53,6 +56,7 @@ public:
 	static bool IsMovable(const USceneComponent* SceneComp);
 	static bool HasValidTransform(const FTransform& CheckTransform);
 	static bool CanProcessActorTransform(const AActor* Actor);
+	static FTransform GetRecordTransform(const AActor* Actor, const EActorType Type);
 
 	static void SortLevelActors(TArray<FActorSaveData>& ToSort, const APlayerController* PC);
 	static bool CompareDistance(const FVector& VecA, const FVector& VecB, const APlayerController* PC);
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSystem/Data/RPGSaveTypes.h"
+
+/**
+Chunked Archive
+
+File layout:
+	Header | Block Index | Block 0 | Block 1 | ... 
+
+Every block is compressed on its own, so blocks can be compressed and decompressed in parallel
+and the decompressed data is written straight into one buffer without an intermediate archive.
+**/
+
+struct FChunkedArchiveBlock
+{
+	//Offset of the compressed block, relative to the end of the block index
+	int64 Offset = 0;
+	int32 CompressedSize = 0;
+	int32 UncompressedSize = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FChunkedArchiveBlock& Block)
+	{
+		Ar << Block.Offset;
+		Ar << Block.CompressedSize;
+		Ar << Block.UncompressedSize;
+		return Ar;
+	}
+
+	//Blocks that would not get smaller are stored raw
+	inline bool IsStoredRaw() const
+	{
+		return CompressedSize == UncompressedSize;
+	}
+};
+
+struct FChunkedArchiveHeader
+{
+	uint32 Tag = RPGSave::CHUNKED_ARCHIVE_TAG;
+	uint32 Version = RPGSave::CHUNKED_ARCHIVE_VERSION;
+	int32 BlockSize = 0;
+	int64 UncompressedSize = 0;
+	TArray<FChunkedArchiveBlock> Blocks;
+
+	friend FArchive& operator<<(FArchive& Ar, FChunkedArchiveHeader& Header)
+	{
+		Ar << Header.Tag;
+		Ar << Header.Version;
+		Ar << Header.BlockSize;
+		Ar << Header.UncompressedSize;
+		Ar << Header.Blocks;
+		return Ar;
+	}
+};
+
+class RPGSYSTEM_API FSaveCompression
+{
+
+public:
+
+	static bool CompressChunked(const TArray<uint8>& InData, TArray<uint8>& OutCompressed);
+	static bool DecompressChunked(const TArray<uint8>& InCompressed, TArray<uint8>& OutData);
+
+	static bool ReadChunkedHeader(const TArray<uint8>& InCompressed, FChunkedArchiveHeader& OutHeader, int64& OutDataStart);
+};
@@ -44,6 +44,79 @@ struct FSaveSlotInfo
 	TArray<FString> Players;
 };
 
+/**
+Archive Helpers
+**/
+
+struct FActorSaveData;
+
+//Slice of a pinned, decompressed file buffer. Loaded payloads reference the file instead of owning a copy.
+struct FSaveBufferView
+{
+	TSharedPtr<const TArray<uint8>> Buffer;
+	int32 Offset = 0;
+	int32 Num = 0;
+
+	inline bool IsSet() const
+	{
+		return Buffer.IsValid();
+	}
+
+	inline TArrayView<const uint8> Get() const
+	{
+		return TArrayView<const uint8>(Buffer->GetData() + Offset, Num);
+	}
+};
+
+//While in scope, payloads read from the given reader on this thread reference its buffer
+class RPGSYSTEM_API FSaveLoadBufferScope
+{
+
+public:
+
+	FSaveLoadBufferScope(const TSharedRef<const TArray<uint8>>& InBuffer, const FArchive& InReader);
+	~FSaveLoadBufferScope();
+
+	static const FSaveLoadBufferScope* Get();
+
+	inline bool IsReading(const FArchive& Ar) const
+	{
+		return &Ar == Reader;
+	}
+
+	inline const TSharedRef<const TArray<uint8>>& GetBuffer() const
+	{
+		return Buffer;
+	}
+
+private:
+
+	TSharedRef<const TArray<uint8>> Buffer;
+	const FArchive* Reader;
+	const FSaveLoadBufferScope* Previous;
+};
+
+class RPGSYSTEM_API FArchiveHelpers
+{
+
+public:
+
+	//Byte-identical to 'Ar << Actors', but large arrays are written on worker threads when saving.
+	//Only the archive layout runs in parallel: the property bytes of each record were already serialized on the Game Thread
+	//when the Actor was parsed, as that runs save interface events and reads live objects. Used by every level save,
+	//staged saving (off by default) only moves the whole call off the Game Thread.
+	static void SerializeActorArray(FArchive& Ar, TArray<FActorSaveData>& Actors);
+
+	//Trailing level index. Records of archives saved before it existed load with RPGSave::UnindexedLevel.
+	static void SerializeLevelIndex(FArchive& Ar, TArray<FActorSaveData>& Actors);
+
+	//Keeps the level index down to one range per level
+	static void GroupActorsByLevel(TArray<FActorSaveData>& Actors);
+
+	//Same layout as 'Ar << Data'. Loads into the view instead, if a load buffer scope is active for the archive.
+	static void SerializePayload(FArchive& Ar, TArray<uint8>& Data, FSaveBufferView& View);
+};
+
 /**
 Generic Save Archives
 **/
@@ -82,11 +155,19 @@ struct FComponentSaveData
 	FTransform Transform;
 	TArray<uint8> Data;
 
+	//Used instead of Data when loaded without copies
+	FSaveBufferView DataView;
+
+	inline TArrayView<const uint8> GetData() const
+	{
+		return DataView.IsSet() ? DataView.Get() : TArrayView<const uint8>(Data);
+	}
+
 	friend FArchive& operator<<(FArchive& Ar, FComponentSaveData& ComponentData)
 	{
 		Ar << ComponentData.Name;
 		Ar << ComponentData.Transform;
-		Ar << ComponentData.Data;
+		FArchiveHelpers::SerializePayload(Ar, ComponentData.Data, ComponentData.DataView);
 		return Ar;
 	}
 };
@@ -99,9 +180,17 @@ struct FGameObjectSaveData
 	TArray<uint8> Data;
 	TArray<FComponentSaveData> Components;
 
+	//Used instead of Data when loaded without copies
+	FSaveBufferView DataView;
+
+	inline TArrayView<const uint8> GetData() const
+	{
+		return DataView.IsSet() ? DataView.Get() : TArrayView<const uint8>(Data);
+	}
+
 	friend FArchive& operator<<(FArchive& Ar, FGameObjectSaveData& GameObjectData)
 	{
-		Ar << GameObjectData.Data;
+		FArchiveHelpers::SerializePayload(Ar, GameObjectData.Data, GameObjectData.DataView);
 		Ar << GameObjectData.Components;
 		return Ar;
 	}
@@ -118,6 +207,12 @@ struct FActorSaveData
 	uint8 Type;
 	FGameObjectSaveData SaveData;
 
+	//Level the Actor was saved from. Not part of the record, restored from the level index of the archive.
+	FName Level;
+
+	//Snapshot the record was captured in. Runtime only, tells delta saves which records changed since the base file.
+	uint32 Revision = 0;
+
 	friend FArchive& operator<<(FArchive& Ar, FActorSaveData& ActorData)
 	{
 		Ar << ActorData.Class;
@@ -139,6 +234,22 @@ inline uint32 GetTypeHash(const FActorSaveData& Data)
 	return GetTypeHash(Data.Name);
 }
 
+//A contiguous run of Actor records that were saved from the same level
+struct FActorRecordRange
+{
+	FName Level;
+	int32 Start = 0;
+	int32 Num = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FActorRecordRange& Range)
+	{
+		Ar << Range.Level;
+		Ar << Range.Start;
+		Ar << Range.Num;
+		return Ar;
+	}
+};
+
 /**
 Level Save Archives
 **/
@@ -177,11 +288,12 @@ struct FLevelArchive
 
 	friend FArchive& operator<<(FArchive& Ar, FLevelArchive& LevelArchive)
 	{
-		Ar << LevelArchive.SavedActors;
+		FArchiveHelpers::SerializeActorArray(Ar, LevelArchive.SavedActors);
 		Ar << LevelArchive.SavedScripts;
 		Ar << LevelArchive.SavedGameMode;
 		Ar << LevelArchive.SavedGameState;
 		Ar << LevelArchive.Level;
+		FArchiveHelpers::SerializeLevelIndex(Ar, LevelArchive.SavedActors);
 		return Ar;
 	}
 
@@ -229,6 +341,122 @@ struct FLevelStackArchive
 	}
 };
 
+//Record names of each level archive in the full base file, keyed by the archive level
+using FLevelBaseNames = TMap<FName, TSet<FName>>;
+
+//Top-level Level data captured on the Game Thread, serialized later by the staged save
+struct FLevelSaveSnapshot
+{
+	FLevelArchive LevelArchive;
+	FLevelStackArchive LevelStack;
+	bool bUseStack = false;
+
+	//Revision of the records captured by this snapshot
+	uint32 Revision = 0;
+
+	//Records newer than this revision are written as a delta segment. Zero writes a full base file.
+	uint32 DeltaBaseRevision = 0;
+
+	//Records of the base file, so a delta can list the ones that are gone. Shared and never modified once set.
+	TSharedPtr<const FLevelBaseNames> BaseNames;
+
+	inline bool IsDelta() const
+	{
+		return DeltaBaseRevision != 0;
+	}
+
+	void CountChangedActors(const uint32 BaseRevision, int32& OutChanged, int32& OutTotal) const;
+	void CollectRecordNames(FLevelBaseNames& OutNames) const;
+
+	inline void GroupActorsByLevel()
+	{
+		FArchiveHelpers::GroupActorsByLevel(LevelArchive.SavedActors);
+
+		for (FLevelArchive& StackedArchive : LevelStack.Archives)
+		{
+			FArchiveHelpers::GroupActorsByLevel(StackedArchive.SavedActors);
+		}
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FLevelSaveSnapshot& Snapshot)
+	{
+		if (Snapshot.bUseStack)
+		{
+			Ar << Snapshot.LevelStack;
+		}
+		else
+		{
+			Ar << Snapshot.LevelArchive;
+		}
+		return Ar;
+	}
+};
+
+//Changed records of one level archive, merged onto the archive with the same name in the base file
+struct FLevelDeltaArchive
+{
+	FName Level;
+
+	//Records of the base file that are no longer saved
+	TArray<FName> RemovedActors;
+
+	//Records that changed or were added since the base file
+	TArray<FActorSaveData> ChangedActors;
+
+	//Small enough to always be written in full
+	TArray<FLevelScriptSaveData> SavedScripts;
+	FGameObjectSaveData SavedGameMode;
+	FGameObjectSaveData SavedGameState;
+
+	void CaptureFrom(const FLevelArchive& A, const uint32 BaseRevision, const TSet<FName>* BaseNames);
+	void ApplyTo(FLevelArchive& A) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FLevelDeltaArchive& DeltaArchive)
+	{
+		Ar << DeltaArchive.Level;
+		Ar << DeltaArchive.RemovedActors;
+		FArchiveHelpers::SerializeActorArray(Ar, DeltaArchive.ChangedActors);
+		Ar << DeltaArchive.SavedScripts;
+		Ar << DeltaArchive.SavedGameMode;
+		Ar << DeltaArchive.SavedGameState;
+		FArchiveHelpers::SerializeLevelIndex(Ar, DeltaArchive.ChangedActors);
+		return Ar;
+	}
+};
+
+//Delta segment on top of the last full Level file. Cumulative, so only the latest segment is ever kept.
+struct FLevelDeltaSnapshot
+{
+	TArray<FLevelDeltaArchive> Archives;
+	FGameObjectSaveData SavedGameMode;
+	FGameObjectSaveData SavedGameState;
+	bool bUseStack = false;
+
+	void CaptureFrom(const FLevelSaveSnapshot& Snapshot);
+	void ApplyTo(FLevelArchive& A) const;
+	void ApplyTo(FLevelStackArchive& Stack) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FLevelDeltaSnapshot& Delta)
+	{
+		uint32 Tag = RPGSave::LEVEL_DELTA_TAG;
+		uint32 Version = RPGSave::LEVEL_DELTA_VERSION;
+		Ar << Tag;
+		Ar << Version;
+
+		if (Ar.IsLoading() && (Tag != RPGSave::LEVEL_DELTA_TAG || Version != RPGSave::LEVEL_DELTA_VERSION))
+		{
+			Ar.SetError();
+			return Ar;
+		}
+
+		Ar << Delta.bUseStack;
+		Ar << Delta.Archives;
+		Ar << Delta.SavedGameMode;
+		Ar << Delta.SavedGameState;
+		return Ar;
+	}
+};
+
 USTRUCT()
 struct FMultiLevelStreamingData
 {
@@ -236,17 +464,26 @@ struct FMultiLevelStreamingData
 
 	TArray<FActorSaveData> ActorArray;
 	TArray<FLevelScriptSaveData> ScriptArray;
-	TMap<FName, FActorSaveData> ActorMap;
+
+	//Actor name -> index in ActorArray
+	TMap<FName, int32> ActorIndexMap;
+
+	//Level -> indices in ActorArray, so a streaming level only touches its own records
+	TMap<FName, TArray<int32>> LevelIndexMap;
 
 public:
 
 	template <typename TSaveData, typename TSaveDataArray>
 	void ReplaceOrAddToArray(const TSaveData& Data, TSaveDataArray& OuputArray);
 
+	void ReplaceOrAddActor(const FActorSaveData& ActorData);
+
 	void CopyActors(const TArray<FActorSaveData>& InData);
 	void CopyTo(const FLevelArchive& A);
 	void CopyFrom(FLevelArchive& A);
 
+	void GetLevelActors(const FName& InLevel, TArray<FActorSaveData>& OutActors) const;
+
 	inline bool HasData() const
 	{
 		return !RPGSave::ArrayEmpty(ActorArray) || !RPGSave::ArrayEmpty(ScriptArray);
@@ -333,7 +570,7 @@ public:
 
 	inline bool HasPlayerState() const
 	{
-		return !RPGSave::ArrayEmpty(State.Data);
+		return !RPGSave::ArrayEmpty(State.GetData());
 	}
 
 	inline TArray<FComponentSaveData> GetControllerComps() const
@@ -23,10 +23,15 @@ public:
 	static bool IsConsoleFileSystem();
 
 	static bool IsMultiThreadSaving();
+	static bool IsStagedLevelSaving();
+	static bool IsDeltaLevelSaving();
 	static bool IsMultiThreadLoading();
 	static bool IsDeferredLoading();
+	static bool IsZeroCopyLoading();
 
 	static uint32 GetLoadBatchSize();
+	static double GetLoadFrameBudget();
+	static int32 GetMaxDeltaSaves();
 };
 
 class RPGSYSTEM_API FAsyncSaveHelpers
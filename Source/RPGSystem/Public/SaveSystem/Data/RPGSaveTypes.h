@@ -1,11 +1,21 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 #include "UObject/NoExportTypes.h"
 #include "RPGSaveTypes.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRPGSave, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("RPGSave"), STATGROUP_RPGSave, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Loader Tick"), STAT_RPGSaveLoader_Tick, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Loader Gather"), STAT_RPGSaveLoader_Gather, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Level Snapshot"), STAT_RPGSave_LevelSnapshot, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Level Serialize"), STAT_RPGSave_LevelSerialize, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Archive Compress"), STAT_RPGSave_ArchiveCompress, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Archive Write"), STAT_RPGSave_ArchiveWrite, STATGROUP_RPGSave);
+DECLARE_CYCLE_STAT(TEXT("RPGSave Archive Decompress"), STAT_RPGSave_ArchiveDecompress, STATGROUP_RPGSave);
+
 #define RPG_VERSION_NUMBER 174
 #define RPG_ENGINE_MIN_UE55 (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
 #define RPG_PLATFORM_DESKTOP (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
@@ -42,6 +52,7 @@ namespace RPGSave
 
 	static const FString PlayerSuffix(TEXT("Player"));
 	static const FString ActorSuffix(TEXT("Level"));
+	static const FString ActorDeltaSuffix(TEXT("LevelDelta"));
 	static const FString SlotSuffix(TEXT("Slot"));
 	static const FString ThumbSuffix(TEXT("Thumb"));
 
@@ -54,6 +65,9 @@ namespace RPGSave
 
 	static const FName PersistentActors(TEXT("VirtualPersistentActorLevel"));
 
+	//Level of records loaded from archives without a level index, relevant for every level
+	static const FName UnindexedLevel(TEXT("RPG_UnindexedLevel"));
+
 	static constexpr TCHAR RuntimeLevelInstance[] = (TEXT("LevelStreamingDynamic"));
 
 	static constexpr TCHAR NativeDesktopSavePath[] = TEXT("%sSaveGames/%s.sav");
@@ -66,6 +80,9 @@ namespace RPGSave
 
 	constexpr uint32 MinAsyncWaitFrames = 5;
 
+	//Below this, writing Actor records on worker threads costs more than it saves
+	constexpr int32 ParallelSerializeMinActors = 64;
+
 	static const FString ImgFormatPNG(TEXT("png"));
 	static const FString ImgFormatJPG(TEXT("jpg"));
 
@@ -78,9 +95,21 @@ namespace RPGSave
 	static const uint8 UE_OBJECT_PACKAGE_TAG[RPG_PKG_TAG_SIZE] = { 0xAB, 0xCD, 0xEF, 0x12, 0x34, 0x56, 0x78, 0x9A };
 	static const int UE_SAVEGAME_FILE_TYPE_TAG = 0x53415647; // "SAVG"
 
+	//Same as above, followed by the archive version after the engine version
+	static const int RPG_SAVEGAME_FILE_TYPE_TAG = 0x52505347; // "RPSG"
+
 	static const int ARCHIVE_DATA_TAG = 0x41534456; // "ASDV"  
 	static const uint32 ACTOR_DATA_VERSION = 1;
 
+	//Chunked compression container, files without this tag use the legacy single stream
+	static const uint32 CHUNKED_ARCHIVE_TAG = 0x52504743; // "RPGC"
+	static const uint32 CHUNKED_ARCHIVE_VERSION = 1;
+	constexpr int32 ChunkedBlockSize = 1024 * 1024;
+
+	//Delta segment written on top of the last full Level file
+	static const uint32 LEVEL_DELTA_TAG = 0x524C4454; // "RLDT"
+	static const uint32 LEVEL_DELTA_VERSION = 2;
+
 	template <typename TArrayType>
 	inline static bool ArrayEmpty(const TArrayType& InArray) { return InArray.Num() <= 0; }
 
@@ -111,6 +140,7 @@ enum class EDataLoadType : uint8
 	DATA_Level,
 	DATA_Player,
 	DATA_Object,
+	DATA_LevelDelta,
 };
 
 UENUM()
@@ -41,6 +41,24 @@ public:
 	FString Game;
 };
 
+//Layout version of the archives, written to the package info at the beginning of every file
+struct RPGSYSTEM_API FSaveArchiveVersion
+{
+	enum Type
+	{
+		//Files with the plain package info
+		BeforeArchiveVersion = 0,
+
+		//Level archives end with an index that maps levels to ranges of Actor records
+		LevelRecordIndex,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+};
+
 class RPGSYSTEM_API FSaveVersion
 {
 
@@ -51,12 +69,17 @@ public:
 	static bool IsSaveGameVersionEqual(const FSaveVersionInfo& SaveVersion);
 
 	static FPackageFileVersion GetStaticOldPackageVersion();
+	static bool UsesPerObjectPackageTags();
+	static bool IsPerObjectPackageTagged(const UObject* Object);
 	static bool RequiresPerObjectPackageTag(const UObject* Object);
 
 	static void WriteObjectPackageTag(TArray<uint8>& Data);
-	static bool CheckObjectPackageTag(const TArray<uint8>& Data);
+	static bool CheckObjectPackageTag(TArrayView<const uint8> Data);
 
 	static uint8 UpdateArchiveVersion(FArchive& Ar);
+	static void SetArchiveVersion(FArchive& Ar, const int32 Version);
+
+	static bool IsChunkedArchive(const TArray<uint8>& Data);
 
 	static EFileValidity IsSaveFileValid(const FString& InSavePath, const bool bLog = true);
 };
@@ -30,6 +30,16 @@ public:
 	void ActorSaved();
 	virtual void ActorSaved_Implementation() {}
 
+	/**
+	* Only used with Delta Level Saving. Return true if the Actor changed since the last 'Actor Saved' event and must be serialized again.
+	* By default the record from the last save is reused until 'Mark Actor Save Dirty' is called.
+	* 'Actor Pre Save' and 'Actor Saved' still fire for reused records. 'Actor Pre Save' runs before this check.
+	* Transform changes are detected automatically. Components with the Component Save Interface are asked as well.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = "RPG Save")
+	bool ActorSaveDirty();
+	virtual bool ActorSaveDirty_Implementation() { return false; }
+
 	/**Executed right before the Actor and all of it's components are loaded.*/
 	UFUNCTION(BlueprintNativeEvent, Category = "RPG Save")
 	void ActorPreLoad();
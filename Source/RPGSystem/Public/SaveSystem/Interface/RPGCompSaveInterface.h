@@ -32,6 +32,11 @@ public:
 	void ComponentSaved();
 	virtual void ComponentSaved_Implementation() {}
 
+	/**Only used with Delta Level Saving. Return true if the Component changed since the last 'Component Saved' event. Defaults to false.*/
+	UFUNCTION(BlueprintNativeEvent, Category = "RPG Save")
+	bool ComponentSaveDirty();
+	virtual bool ComponentSaveDirty_Implementation() { return false; }
+
 	/**Executed right before the Component is loaded.*/
 	UFUNCTION(BlueprintNativeEvent, Category = "RPG Save")
 	void ComponentPreLoad();
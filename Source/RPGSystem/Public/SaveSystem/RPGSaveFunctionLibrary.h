@@ -143,6 +143,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RPG Save | Actors", meta = (WorldContext = "WorldContextObject"))
 	static void SetActorSaveProperties(UObject* WorldContextObject, bool bSkipSave, bool bPersistent, bool bSkipTransform, ELoadedStateMod LoadedState);
 
+	/**
+	* Only relevant with Delta Level Saving. Makes sure the Actor is fully saved again the next time, even if 'Actor Save Dirty' returns false.
+	* A good place to call it is right after changing a 'Save Game' variable.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RPG Save | Actors", meta = (WorldContext = "WorldContextObject"))
+	static void MarkActorSaveDirty(UObject* WorldContextObject);
+
 	/**
 	* Checks if SaveGameActors or LoadGameActors is currently active.
 	* 
@@ -151,6 +158,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RPG Save | Actors", meta = (WorldContext = "WorldContextObject"))
 	static bool IsSavingOrLoading(UObject* WorldContextObject);
 
+	/**
+	* Progress of the level-actors that are currently loading. Use 'On Level Load Progress' of the Subsystem to get notified.
+	* 
+	* @return - From 0 to 1. Is 1 if no level-actors are loading.
+	*/
+	UFUNCTION(BlueprintPure, Category = "RPG Save | Actors", meta = (WorldContext = "WorldContextObject"))
+	static float GetLevelLoadProgress(UObject* WorldContextObject);
+
 	/**
 	* Saves either all Custom Save Objects or a specific one, based on the input.
 	* If no SaveGame object is provided, all registered Custom Save Objects will be saved automatically.
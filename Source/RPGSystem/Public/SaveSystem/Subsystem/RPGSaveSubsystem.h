@@ -7,6 +7,7 @@
 #include "RPGSystem/ProjectSettings/RPGSaveProjectSetting.h"
 #include "SaveSystem/Data/RPGSaveData.h"
 #include "SaveSystem/Data/RPGSaveLevel.h"
+#include "Async/Future.h"
 #include "Serialization/BufferArchive.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "RPGSaveSubsystem.generated.h"
@@ -25,6 +26,8 @@ class APlayerController;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRPGLoadPlayerComplete, const APlayerController*, LoadedPlayer);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRPGLoadLevelComplete, const TArray<TSoftObjectPtr<AActor>>&, LoadedActors);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRPGLoadLevelProgress, int32, HandledActors, int32, TotalActors);
+DECLARE_DELEGATE_OneParam(FRPGOnLevelSaveFinished, const bool /*bSuccess*/);
 
 UCLASS(BlueprintType, meta = (DisplayName = "RPG Save SubSystem", Keywords = "Save, RPGSave"))
 class RPGSYSTEM_API URPGSaveSubsystem : public URPGSaveSubsystemBase
@@ -47,6 +50,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "RPG Save | Delegates")
 	FRPGLoadLevelComplete OnPartitionLoaded;
 
+	//Fires each frame while level-actors are loaded with Multi-Thread or Deferred Loading
+	UPROPERTY(BlueprintAssignable, Category = "RPG Save | Delegates")
+	FRPGLoadLevelProgress OnLevelLoadProgress;
+
 private:
 
 	FCriticalSection SaveActorsScope;
@@ -60,6 +67,25 @@ private:
 
 	FDelegateHandle ActorDestroyedDelegate;
 
+	//Background serialize, compress and write stage of the staged level save, true if the files were written
+	TFuture<bool> PendingLevelSave;
+
+	//Delta saving: revision of the next snapshot, and the full base file the deltas build on
+	FCriticalSection RecordCacheScope;
+	uint32 LevelRecordRevision;
+	uint32 LevelBaseRevision;
+	int32 LevelDeltaCount;
+	FString LevelBaseFile;
+	TSharedPtr<const FLevelBaseNames> LevelBaseNames;
+
+	//Read before the base file and merged into it while unpacking
+	TOptional<FLevelDeltaSnapshot> LoadedLevelDelta;
+
+	//Saved records of all running level loaders. Loaders from before the last reset belong to an older generation.
+	int32 LevelLoadTotal;
+	int32 LevelLoadHandled;
+	uint32 LevelLoadGeneration;
+
 private:
 
 	UPROPERTY(Transient)
@@ -102,6 +128,9 @@ private:
 	UPROPERTY(Transient)
 	TMap<TWeakObjectPtr<AActor>, FGameObjectSaveData> RawObjectData;
 
+	UPROPERTY(Transient)
+	TMap<FName, FActorSaveData> ActorRecordCache;
+
 	UPROPERTY(Transient)
 	TArray<TSoftObjectPtr<AActor>> RealLoadedActors;
 
@@ -132,12 +161,16 @@ public:
 
 	void OnAnyActorDestroyed(AActor* DestroyedActor);
 
+	void MarkActorSaveDirty(const AActor* Actor);
+
 	void PrepareLoadAndSaveActors(const uint32 Flags, const EAsyncCheckType FunctionType, const EPrepareType PrepareType);
 
 	bool SavePlayerActors(APlayerController* Controller, const FString& FileName);
 	void LoadPlayerActors(APlayerController* Controller);
 
 	bool SaveLevelActors(const bool bMemoryOnly);
+	void SaveLevelActorsStaged(const bool bMemoryOnly, const FRPGOnLevelSaveFinished& OnFinished);
+	bool IsLevelSavePending() const;
 	void LoadLevelActors(URPGAsyncLoadGame* LoadTask);
 	void LoadGameMode();
 	void LoadLevelScripts();
@@ -159,7 +192,7 @@ public:
 
 public:
 
-	void SaveActorToBinary(AActor* Actor, FGameObjectSaveData& OutData) const;
+	void SaveActorToBinary(AActor* Actor, FGameObjectSaveData& OutData, const bool bPreSaveExecuted = false) const;
 	void LoadActorFromBinary(AActor* Actor, const FGameObjectSaveData& InData);
 
 	void SpawnLevelActor(const FActorSaveData& ActorArray);
@@ -190,7 +223,15 @@ private:
 	
 	FGameObjectSaveData ParseGameModeObjectForSaving(AActor* Actor) const;
 	FLevelScriptSaveData ParseLevelScriptForSaving(AActor* Actor) const;
-	FActorSaveData ParseLevelActorForSaving(AActor* Actor, const EActorType Type) const;
+	FActorSaveData ParseLevelActorForSaving(AActor* Actor, const EActorType Type, const bool bPreSaveExecuted = false) const;
+	FActorSaveData ParseLevelActorCached(AActor* Actor, const EActorType Type);
+	bool IsActorSaveDirty(AActor* Actor);
+
+	void SnapshotLevelActors(FLevelSaveSnapshot& OutSnapshot);
+	bool SerializeLevelSnapshot(FLevelSaveSnapshot& Snapshot, FBufferArchive& OutLevelData) const;
+	bool SaveLevelArchive(FBufferArchive& LevelData, const bool bDelta, const FString& SaveFile, const FString& DeltaFile) const;
+	void PrepareLevelDelta(FLevelSaveSnapshot& Snapshot);
+	void WaitForPendingLevelSave();
 
 	void ExecuteActorPreSave(AActor* Actor) const;
 	void ExecuteActorSaved(AActor* Actor) const;
@@ -259,6 +300,23 @@ public:
 		return !RPGSave::ArrayEmpty(RealLoadedActors);
 	}
 
+	//Returns the load generation the loader reports its progress with
+	uint32 AddLevelLoadWork(const int32 NumActors);
+	void AddLevelLoadProgress(const int32 NumActors, const uint32 Generation);
+	void RemoveLevelLoadWork(const int32 NumActors, const uint32 Generation);
+
+	inline void ResetLevelLoadProgress()
+	{
+		LevelLoadTotal = 0;
+		LevelLoadHandled = 0;
+		++LevelLoadGeneration;
+	}
+
+	inline float GetLevelLoadProgress() const
+	{
+		return LevelLoadTotal > 0 ? float(LevelLoadHandled) / LevelLoadTotal : 1.f;
+	}
+
 /** Clear Data Functions  */
 
 public:
@@ -268,6 +326,7 @@ public:
 		ClearSavedLevelActors();
 		ClearStreamingData();
 		ClearMultiSaveLevels();
+		ClearLevelDeltaBase();
 		LevelArchiveList.Empty();
 		PlayerStackData = FPlayerStackArchive();
 		bLoadFromMemory = false;
@@ -318,6 +377,20 @@ private:
 		DestroyedActors.Empty();
 	}
 
+	inline void ClearLevelDeltaBase()
+	{
+		LevelBaseRevision = 0;
+		LevelDeltaCount = 0;
+		LevelBaseFile.Empty();
+		LevelBaseNames.Reset();
+	}
+
+	inline void ClearActorRecordCache()
+	{
+		FScopeLock Lock(&RecordCacheScope);
+		ActorRecordCache.Empty();
+	}
+
 	inline void ClearUserData() override
 	{
 		Super::ClearUserData();
@@ -325,6 +398,7 @@ private:
 		//When setting/deleting a Save User, we need to clear this
 		ClearMultiLevelSave();
 		ClearWorldPartition();
+		ResetLevelLoadProgress();
 	}
 
 /** Actor Helpers  */
@@ -370,11 +444,13 @@ public:
 		return IsValidActor(Actor) && !IsLoaded(Actor);
 	}
 
-	inline FMultiLevelStreamingData GetMultiLevelStreamData() const
+	inline const FMultiLevelStreamingData& GetMultiLevelStreamData() const
 	{
 		return MultiLevelStreamData;
 	}
 
+	void GetStreamingLevelActors(const ULevel* InLevel, TArray<FActorSaveData>& OutActors) const;
+
 	inline bool HasStreamingLevels()
 	{
 		return FStreamHelpers::HasStreamingLevels(GetWorld());
@@ -384,8 +460,8 @@ public:
 	{
 		return !RPGSave::ArrayEmpty(SavedActors) 
 			|| !RPGSave::ArrayEmpty(SavedScripts) 
-			|| !RPGSave::ArrayEmpty(SavedGameMode.Data)
-			|| !RPGSave::ArrayEmpty(SavedGameState.Data)
+			|| !RPGSave::ArrayEmpty(SavedGameMode.GetData())
+			|| !RPGSave::ArrayEmpty(SavedGameState.GetData())
 			|| MultiLevelStreamData.HasData();
 	}
 
@@ -42,6 +42,11 @@ private:
 	FSaveVersionInfo LastReadVersion;
 	FPackageFileVersion LoadedPackageVersion;
 	FEngineVersion LoadedEngineVersion;
+	int32 LoadedArchiveVersion;
+
+	//Resolved once per file, instead of for every loaded object
+	FPackageFileVersion LoadedOldPackageVersion;
+	bool bCheckObjectPackageTags = false;
 
 private:
 
@@ -157,7 +162,7 @@ protected:
 protected:
 
 	void SerializeToBinary(UObject* Object, TArray<uint8>& OutData) const;
-	void SerializeFromBinary(UObject* Object, const TArray<uint8>& InData);
+	void SerializeFromBinary(UObject* Object, TArrayView<const uint8> InData);
 
 /** Versioning Functions  */
 
@@ -179,6 +184,7 @@ public:
 	FString SlotInfoSaveFile(const FString& SaveGameName = FString()) const;
 	FString CustomSaveFile(const FString& CustomSaveName, const FString& SlotName) const;
 	FString ActorSaveFile(const FString& SaveGameName = FString()) const;
+	FString ActorDeltaSaveFile(const FString& SaveGameName = FString()) const;
 	FString PlayerSaveFile(const FString& SaveGameName = FString())  const;
 
 protected:
@@ -6,13 +6,19 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Materials/MaterialInterface.h"
 #include "Blueprint/UserWidget.h"
+#include "UObject/ObjectKey.h"
 #include "ObjectPoolComponent.generated.h"
 
+class APawn;
+
 
 // 기본 풀 위치 값 (상수는 헤더나 전용 Constants.h 파일에 정의 가능)
 constexpr float DEFAULT_POOL_OBJECT_MIN_POSITION = 0.0f;
 constexpr float DEFAULT_POOL_OBJECT_MAX_POSITION = 100000.0f;
 
+// 프레임당 프리웜에 쓸 기본 시간 (ms)
+constexpr float DEFAULT_POOL_PREWARM_BUDGET_MS = 1.0f;
+
 /**
  * @enum EPooledObjectType
  * @brief 풀링될 오브젝트의 주요 타입을 정의합니다.
@@ -41,7 +47,7 @@ struct FPooledObjectSpawnSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings")
     FString ObjectBaseName;
 
-    /** 풀에 유지할 최대 오브젝트 수 */
+    /** 풀에 유지할 최대 오브젝트 수 (대기 중인 오브젝트가 이미 이만큼이면 반환된 오브젝트는 파괴) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings", meta = (ClampMin = "0"))
     int32 MaxPoolSize = 10;
 
@@ -53,6 +59,18 @@ struct FPooledObjectSpawnSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings", meta = (ClampMin = "0"))
     int32 SpawnDelayInFramesAfterReachingMax = 0;
 
+    /** 최근 사용량에 맞춰 남는 오브젝트를 자동으로 파괴할지 여부 (끄면 MaxPoolSize까지 채운 상태를 유지) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings")
+    bool bAutoShrink = false;
+
+    /** 자동 축소 시에도 유지할 최소 오브젝트 수 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings", meta = (ClampMin = "0", EditCondition = "bAutoShrink"))
+    int32 MinPoolSize = 0;
+
+    /** 최대 동시 사용 수(하이 워터마크)를 집계하는 구간 (초), 구간이 끝날 때마다 목표 크기를 다시 계산 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool|SpawnSettings", meta = (ClampMin = "0.1", EditCondition = "bAutoShrink"))
+    float ShrinkIntervalSeconds = 10.0f;
+
     FPooledObjectSpawnSettings() {}
 };
 
@@ -84,6 +102,92 @@ struct FPooledObjectTypeConfig
     FPooledObjectTypeConfig() {}
 };
 
+/**
+ * @struct FPooledObjectHandle
+ * @brief 풀에서 꺼낸 오브젝트의 핸들. 반환되면 세대(Generation)가 바뀌어 이전 핸들은 무효가 됩니다.
+ */
+USTRUCT(BlueprintType)
+struct FPooledObjectHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 PoolIndex = INDEX_NONE;
+
+    UPROPERTY()
+    int32 SlotIndex = INDEX_NONE;
+
+    UPROPERTY()
+    int32 Generation = 0;
+
+    bool IsSet() const { return PoolIndex != INDEX_NONE && SlotIndex != INDEX_NONE; }
+    void Reset() { *this = FPooledObjectHandle(); }
+};
+
+/**
+ * @struct FPooledObjectSlot
+ * @brief 풀이 생성한 오브젝트 하나. 대여 중이든 대기 중이든 파괴될 때까지 같은 슬롯을 사용합니다.
+ */
+USTRUCT()
+struct FPooledObjectSlot
+{
+    GENERATED_BODY()
+
+    /** nullptr이면 빈 슬롯 (축소로 파괴됨) */
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    TObjectPtr<UObject> Object = nullptr;
+
+    /** 반환/파괴될 때마다 증가, 핸들과 다르면 이미 반환된 대여 */
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    int32 Generation = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    bool bCheckedOut = false;
+
+    /** 마지막으로 대기 상태가 된 시간 (FPlatformTime), 풀 사이의 LRU 축소용 */
+    double LastReturnTime = 0.0;
+};
+
+/**
+ * @struct FObjectPoolStats
+ * @brief 풀 하나의 누적 사용 통계입니다.
+ */
+USTRUCT(BlueprintType)
+struct FObjectPoolStats
+{
+    GENERATED_BODY()
+
+    /** 대기 중인 오브젝트를 바로 꺼낸 횟수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 Hits = 0;
+
+    /** 대기 중인 오브젝트가 없어 요청 시점에 생성한 횟수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 Misses = 0;
+
+    /** 생성한 오브젝트 수 (프리웜 + Miss) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 Spawned = 0;
+
+    /** 자동 축소, 최대 크기 초과, LRU 축소로 파괴한 오브젝트 수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 Trimmed = 0;
+
+    /** 중복 반환, 이전 핸들로의 반환 횟수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 InvalidReturns = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 InUse = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 Available = 0;
+
+    /** 현재 집계 구간의 최대 동시 사용 수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ObjectPool|Stats")
+    int32 HighWaterMark = 0;
+};
+
 /**
  * @struct FObjectPoolInstance
  * @brief 특정 타입의 오브젝트 풀 인스턴스 정보를 관리합니다.
@@ -93,9 +197,17 @@ struct FObjectPoolInstance
 {
     GENERATED_BODY()
 
-    /** 현재 풀에 사용 가능한 (비활성) 오브젝트 목록 */
+    /** 이 풀이 생성한 모든 오브젝트 (대여 중 포함) */
     UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
-    TArray<TObjectPtr<UObject>> AvailableObjects;
+    TArray<FPooledObjectSlot> Slots;
+
+    /** 대기 중인 슬롯 인덱스 스택 (LIFO, 가장 최근에 반환된 오브젝트를 먼저 재사용) */
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    TArray<int32> FreeSlots;
+
+    /** 오브젝트가 파괴되어 다시 쓸 수 있는 슬롯 인덱스 */
+    UPROPERTY()
+    TArray<int32> VacantSlots;
 
     /** 이 풀에 대한 설정 정보 */
     UPROPERTY(EditAnywhere, Category = "ObjectPool|InstanceData")
@@ -113,8 +225,25 @@ struct FObjectPoolInstance
     UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
     EPooledObjectType PoolType = EPooledObjectType::Undefined;
 
+    /** 유지할 전체 오브젝트 수 (대여 중 + 대기), 자동 축소가 하이 워터마크로 갱신 */
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    int32 TargetCapacity = 0;
+
+    /** 현재 집계 구간의 경과 시간 */
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    float ShrinkElapsedSeconds = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "ObjectPool|InstanceData")
+    FObjectPoolStats Stats;
+
     FObjectPoolInstance() {}
 
+    /** 지금 대기 상태로 준비해 둘 오브젝트 수 */
+    int32 GetDesiredAvailableCount() const
+    {
+        return FMath::Clamp(TargetCapacity - Stats.InUse, 0, TypeConfig.SpawnSettings.MaxPoolSize);
+    }
+
     FObjectPoolInstance(const FPooledObjectTypeConfig& InConfig)
         : TypeConfig(InConfig)
     {
@@ -138,7 +267,9 @@ struct FObjectPoolInstance
         {
             PoolType = EPooledObjectType::Undefined;
         }
-        AvailableObjects.Reserve(TypeConfig.SpawnSettings.MaxPoolSize);
+        Slots.Reserve(TypeConfig.SpawnSettings.MaxPoolSize);
+        FreeSlots.Reserve(TypeConfig.SpawnSettings.MaxPoolSize);
+        TargetCapacity = TypeConfig.SpawnSettings.MaxPoolSize;
     }
 };
 
@@ -174,12 +305,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Setup", meta = (DisplayName = "Add User Widget Pool"))
     void AddPoolForUserWidgetClass(TSubclassOf<UUserWidget> WidgetClass, UUserWidget* OwningWidgetOrPlayerController, const FPooledObjectSpawnSettings& Settings);
 
+    /** 설정 구조체로 풀을 추가합니다. 이미 있는 풀이면 설정만 갱신 */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Setup", meta = (DisplayName = "Add Pool From Config"))
+    void AddPoolFromConfig(const FPooledObjectTypeConfig& Config);
+
     // --- 오브젝트 가져오기 함수 ---
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Get Pooled Object"))
     UObject* GetObjectFromPool(TSubclassOf<UObject> ObjectClass);
 
+    /** NewOwner/NewInstigator를 주면 활성화(OnAcquiredFromPool) 전에 설정 */
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Get Pooled Actor"))
-    AActor* GetActorFromPool(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform);
+    AActor* GetActorFromPool(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* NewOwner = nullptr, APawn* NewInstigator = nullptr);
 
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Get Pooled ActorComponent"))
     UActorComponent* GetActorComponentFromPool(TSubclassOf<UActorComponent> ComponentClass, AActor* NewOwner);
@@ -190,6 +326,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Get Pooled MaterialInstanceDynamic"))
     UMaterialInstanceDynamic* GetMaterialInstanceDynamicFromPool(UMaterialInterface* BaseMaterial);
 
+    /** GetObjectFromPool과 같지만 반환 시 사용할 핸들도 돌려줍니다 (상태 활성화는 호출자가 처리) */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Checkout Pooled Object"))
+    UObject* CheckoutObjectFromPool(TSubclassOf<UObject> ObjectClass, FPooledObjectHandle& OutHandle);
+
     // --- 오브젝트 반환 함수 ---
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Return Object To Pool"))
     void ReturnObjectToPool(UObject* ObjectToReturn);
@@ -197,6 +337,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Return Multiple Objects To Pool"))
     void ReturnObjectsToPool(UPARAM(ref) TArray<UObject*>& ObjectsToReturn);
 
+    /** 핸들로 반환합니다. 이미 반환된 핸들이면 false (핸들은 초기화됨) */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Usage", meta = (DisplayName = "Return Object To Pool By Handle"))
+    bool ReturnObjectToPoolByHandle(UPARAM(ref) FPooledObjectHandle& Handle);
+
+    /** 핸들이 아직 대여 중인 오브젝트를 가리키는지 확인합니다. */
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Usage")
+    bool IsPooledObjectHandleValid(const FPooledObjectHandle& Handle) const;
+
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Usage")
+    UObject* GetObjectFromHandle(const FPooledObjectHandle& Handle) const;
+
     // --- 풀 관리 및 유틸리티 함수 ---
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Management", meta = (DisplayName = "Prewarm Pool For Class"))
     void PrewarmPool(TSubclassOf<UObject> ObjectClass, int32 CountToSpawn);
@@ -210,12 +361,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ObjectPool|Management", meta = (DisplayName = "Destroy All Pooled Objects"))
     void DestroyAllPools();
 
+    /**
+     * 모든 풀을 통틀어 가장 오래 대기 중인 오브젝트부터 최대 NumToTrim개를 파괴합니다. (메모리 부족 대응)
+     * 파괴한 만큼 목표 크기도 낮춰서 프리웜이 바로 다시 채우지 않음
+     * @return 실제로 파괴한 수
+     */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Management")
+    int32 TrimLeastRecentlyUsed(int32 NumToTrim);
+
     UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
     bool IsObjectClassRegistered(TSubclassOf<UObject> ObjectClass) const;
     
     UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
     bool IsMaterialInterfaceRegistered(UMaterialInterface* BaseMaterial) const;
 
+    /** 이 컴포넌트의 풀이 생성한 오브젝트인지 (대여 중/대기 중 모두) */
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
+    bool IsPooledObject(const UObject* Object) const;
+
     UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
     int32 GetTotalObjectCountInAllPools() const;
 
@@ -225,6 +388,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
     int32 GetAvailableMaterialInstanceCount(UMaterialInterface* BaseMaterial) const;
 
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
+    FObjectPoolStats GetPoolStatsForClass(TSubclassOf<UObject> ObjectClass) const;
+
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Query")
+    FObjectPoolStats GetPoolStatsForMaterial(UMaterialInterface* BaseMaterial) const;
+
     UFUNCTION(BlueprintPure, Category = "ObjectPool|Utility")
     FVector GetTemporarySpawnLocationForActors() const;
 
@@ -238,21 +407,54 @@ public:
     static FString ConvertIntToUniqueString(int32 Value);
 
 private:
-    /** 주기적으로 풀을 업데이트하여 필요시 오브젝트를 추가 생성합니다. */
-    void UpdatePools();
-    void UpdateSinglePoolInstance(FObjectPoolInstance& PoolInstance);
+    /** 시간 예산 안에서 부족한 풀을 채우고, 집계 구간이 끝난 풀은 축소합니다. */
+    void UpdatePools(float DeltaTime);
+
+    /** 풀 하나를 채웁니다. 예산을 다 쓰면 false */
+    bool UpdateSinglePoolInstance(FObjectPoolInstance& PoolInstance, int32 PoolIndex, double BudgetEndTime, bool& bInOutSpawnedThisFrame);
+
+    /** 집계 구간이 끝나면 하이 워터마크로 목표 크기를 갱신하고 남는 대기 오브젝트를 파괴합니다. */
+    void UpdatePoolShrink(FObjectPoolInstance& PoolInstance, float DeltaTime);
+    void TrimPool(FObjectPoolInstance& PoolInstance, int32 NumToKeep);
 
     /** 새로운 타입의 풀 설정을 추가하거나 기존 설정을 업데이트합니다. */
     void AddOrUpdatePoolConfiguration(const FPooledObjectTypeConfig& NewConfig);
 
-    /** 특정 풀 인스턴스에서 사용 가능한 오브젝트를 가져오거나 새로 생성합니다. */
+    /** 특정 풀 인스턴스에 새 오브젝트를 생성합니다. (비활성 상태) */
     UObject* RetrieveOrCreateObjectForPool(FObjectPoolInstance& PoolInstance);
 
-    /** 내부적으로 UClass를 키로 사용하여 풀 인스턴스를 찾습니다. */
+    /** 오브젝트를 새로 생성해서 대기 상태의 슬롯에 넣습니다. 실패하면 INDEX_NONE */
+    int32 SpawnIntoSlot(FObjectPoolInstance& PoolInstance, int32 PoolIndex);
+
+    /** 대기 중인 오브젝트를 꺼내거나 새로 생성해서 대여 상태로 만듭니다. */
+    UObject* CheckoutFromPool(int32 PoolIndex, FPooledObjectHandle* OutHandle);
+
+    /** 슬롯을 대기 상태로 되돌립니다. 대여 중이 아니면 false */
+    bool ReturnSlot(int32 PoolIndex, int32 SlotIndex);
+
+    /** 풀 밖에서 생성된 같은 클래스(머티리얼)의 오브젝트를 대기 상태로 받아들입니다. 풀이 가득 차 있으면 파괴 */
+    void AdoptObject(int32 PoolIndex, UObject* Object);
+
+    /** 반환/편입되는 오브젝트를 타입에 맞게 비활성화합니다. */
+    void DeactivatePooledObject(UObject* Object);
+
+    /** 풀 액터가 외부에서 파괴되거나 레벨과 함께 사라지면 슬롯을 비웁니다. */
+    void TrackPooledActor(UObject* Object);
+
+    UFUNCTION()
+    void HandlePooledActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+    /** 슬롯의 오브젝트를 파괴하고 빈 슬롯으로 만듭니다. */
+    void DestroySlotObject(FObjectPoolInstance& PoolInstance, int32 SlotIndex);
+    static void DestroyPooledObject(UObject* Object);
+
+    /** UClass / UMaterialInterface 키로 풀 인덱스를 찾습니다. (해시) */
+    int32 FindPoolIndexByClass(const UClass* ObjectClass) const;
+    int32 FindPoolIndexByMaterial(const UMaterialInterface* BaseMaterial) const;
+
     FObjectPoolInstance* FindPoolInstanceByClass(UClass* ObjectClass);
     const FObjectPoolInstance* FindPoolInstanceByClass(UClass* ObjectClass) const;
 
-    /** 내부적으로 UMaterialInterface를 키로 사용하여 풀 인스턴스를 찾습니다. */
     FObjectPoolInstance* FindPoolInstanceByMaterial(UMaterialInterface* BaseMaterial);
     const FObjectPoolInstance* FindPoolInstanceByMaterial(UMaterialInterface* BaseMaterial) const;
 
@@ -270,18 +472,30 @@ private:
     UPROPERTY(VisibleInstanceOnly, Category = "ObjectPool|Internal")
     TArray<FObjectPoolInstance> PoolInstances;
     
-    /** MID -> BaseMaterial 매핑 (반환 시 정확한 풀 식별용) */
-    UPROPERTY(Transient)
-    TMap<TObjectPtr<UMaterialInstanceDynamic>, TObjectPtr<UMaterialInterface>> MaterialToBaseMap;
+    /** 풀 키 -> PoolInstances 인덱스 (풀은 DestroyAllPools 전까지 제거되지 않으므로 인덱스가 유지됨) */
+    TMap<TObjectKey<UClass>, int32> PoolIndexByClass;
+    TMap<TObjectKey<UMaterialInterface>, int32> PoolIndexByMaterial;
+
+    /** 풀이 생성한 오브젝트 -> (풀, 슬롯), 반환 시 풀 식별과 중복 반환 검사용 */
+    struct FPooledObjectLocation
+    {
+        int32 PoolIndex = INDEX_NONE;
+        int32 SlotIndex = INDEX_NONE;
+    };
+    TMap<TObjectKey<UObject>, FPooledObjectLocation> PooledObjectLocations;
+
+    /** 프리웜을 시작할 풀 (매 프레임 순환해서 특정 풀만 예산을 쓰지 않도록) */
+    int32 NextPrewarmPoolIndex = 0;
 
-    /** 마지막으로 찾은 풀 인스턴스의 인덱스 (캐싱용) */
-    mutable int32 LastFoundPoolIndex = INDEX_NONE;
+    /** 프레임당 프리웜(오브젝트 생성)에 쓸 수 있는 시간 (ms), 한 프레임에 최소 한 개는 생성 */
+    UPROPERTY(EditAnywhere, Category = "ObjectPool|Internal", meta = (ClampMin = "0.0"))
+    float PrewarmTimeBudgetMs = DEFAULT_POOL_PREWARM_BUDGET_MS;
 
     /** 비활성 액터를 임시로 위치시킬 공간의 최소 좌표 */
     UPROPERTY(EditAnywhere, Category = "ObjectPool|Internal")
     float PooledActorMinSpawnCoordinate = DEFAULT_POOL_OBJECT_MIN_POSITION;
 
-    /** 비활성 액터를 임시로 위치시킬 공간의 최대 좌표 */
+    /** 비활성 액터를 임시로 위치시킬 공간의 최대 좌표 (비활성 액터는 모두 (Max, Max, Max) 한 곳에 모음) */
     UPROPERTY(EditAnywhere, Category = "ObjectPool|Internal")
     float PooledActorMaxSpawnCoordinate = DEFAULT_POOL_OBJECT_MAX_POSITION;
 		
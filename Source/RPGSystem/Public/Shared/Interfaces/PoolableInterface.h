@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "PoolableInterface.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(BlueprintType, meta = (DisplayName = "Poolable Interface"))
+class UPoolableInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * 오브젝트 풀에서 재사용되는 액터
+ *
+ * BeginPlay는 처음 생성될 때 한 번만 불리므로, 발사체처럼 매번 초기화가 필요한 상태는 여기서 처리
+ * 풀은 숨김/충돌/액터 Tick만 끄므로 ProjectileMovement 같은 컴포넌트는 OnReturnedToPool에서 직접 멈춰야 함
+ */
+class RPGSYSTEM_API IPoolableInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	/** 풀에서 꺼내져 활성화된 직후 (트랜스폼은 이미 적용됨) */
+	UFUNCTION(BlueprintNativeEvent, Category = "ObjectPool")
+	void OnAcquiredFromPool();
+	virtual void OnAcquiredFromPool_Implementation() {}
+
+	/** 풀로 돌아가 비활성화되기 직전, 처음 생성되어 풀에 들어갈 때도 호출 */
+	UFUNCTION(BlueprintNativeEvent, Category = "ObjectPool")
+	void OnReturnedToPool();
+	virtual void OnReturnedToPool_Implementation() {}
+};
@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Templates/SubclassOf.h"
+
+class AGameModeBase;
+class APawn;
+class APlayerController;
+class UGameInstance;
+class UWorld;
+
+/**
+ * 성능 자동화 테스트 공용 도우미 (RPGSystem.Benchmark.*)
+ *
+ * - FRPGBenchmarkReport: 단계별 시간/바이트와 최대 메모리 기록, Saved/Profiling/RPGBenchmark/ 에 CSV와 JSON 저장, 기준 CSV와 비교
+ * - FRPGBenchmarkWorld: 게임 인스턴스와 게임 모드가 있는 독립 게임 월드 (테스트에서 직접 틱)
+ *
+ * 기준 CSV: -RPGBenchmarkBaseline=<Dir> (기본 <Project>/Build/Benchmarks), 파일 이름은 <리포트 이름>.csv
+ * 허용 오차: -RPGBenchmarkTolerance=<Percent> (기본 20)
+ * 기준보다 느려지거나 커진 단계는 테스트 에러로 기록됨
+ * 실행 조건(GetParameter)을 커맨드 라인으로 기본값과 다르게 주면 기준 비교는 건너뜀
+ *
+ * 실행: Automation RunTests RPGSystem.Benchmark
+ */
+
+struct FRPGBenchmarkStage
+{
+	FString Name;
+	double Milliseconds = 0.0;
+
+	// 단계가 만든 바이트 수 (또는 처리한 개수), 0이면 비교하지 않음
+	int64 Bytes = 0;
+};
+
+class RPGSYSTEM_API FRPGBenchmarkReport
+{
+
+public:
+
+	explicit FRPGBenchmarkReport(const FString& InName);
+
+	// 실행 조건, 커맨드 라인 -<Key>=<Value> 로 덮어씀 (최소 0), 결과 파일에 함께 기록
+	int32 GetParameter(const FString& Key, const int32 DefaultValue);
+
+	// 단계 실행 시간을 기록, 함수의 반환값은 Bytes로 기록
+	double Measure(const FString& StageName, TFunctionRef<int64()> StageFunction);
+	void AddStage(const FString& StageName, const double Milliseconds, const int64 Bytes = 0);
+
+	// 사용 중인 물리 메모리를 최대값에 반영, Measure/AddStage는 자동으로 호출 (레이턴트 프레임에서는 직접 호출)
+	void SampleMemory();
+
+	// 리포트 생성 이후 늘어난 최대 메모리, 결과 파일에는 PeakMemory 단계로 기록
+	int64 GetPeakMemoryBytes() const;
+
+	const FRPGBenchmarkStage* FindStage(const FString& StageName) const;
+	FString ToCSV() const;
+	FString ToJSON() const;
+
+	// 결과를 테스트 로그와 CSV/JSON으로 남기고 기준 CSV와 비교, 회귀가 있으면 false
+	bool Submit(FAutomationTestBase& Test) const;
+
+private:
+
+	// 기록된 단계 + PeakMemory
+	TArray<FRPGBenchmarkStage> GetResultStages() const;
+
+	bool CompareToBaseline(const FString& BaselineFile, const float TolerancePercent, TArray<FString>& OutRegressions) const;
+
+	FString Name;
+	TArray<FRPGBenchmarkStage> Stages;
+	TArray<TPair<FString, int32>> Parameters;
+
+	// 기본값과 다른 실행 조건이 있으면 기준 비교를 건너뜀
+	bool bCustomParameters = false;
+
+	// 생성 시점의 사용 메모리와 프로세스 최대 메모리, 단계 중간의 최대값은 프로세스 최대 메모리가 늘었을 때만 잡힘
+	uint64 BaseUsedMemory = 0;
+	uint64 BasePeakMemory = 0;
+	uint64 PeakUsedMemory = 0;
+};
+
+class RPGSYSTEM_API FRPGBenchmarkWorld
+{
+
+public:
+
+	// 게임 모드를 지정하지 않으면 AGameModeBase (프로젝트 기본 게임 모드의 부가 액터 없이)
+	explicit FRPGBenchmarkWorld(TSubclassOf<AGameModeBase> GameModeClass = nullptr);
+	~FRPGBenchmarkWorld();
+
+	FRPGBenchmarkWorld(const FRPGBenchmarkWorld&) = delete;
+	FRPGBenchmarkWorld& operator=(const FRPGBenchmarkWorld&) = delete;
+
+	UWorld* GetWorld() const { return World; }
+	UGameInstance* GetGameInstance() const { return GameInstance.Get(); }
+
+	// 플레이어 컨트롤러와 폰을 스폰해 빙의 (로컬 플레이어 없이), 실패하면 nullptr
+	APlayerController* SpawnPlayer(TSubclassOf<APawn> PawnClass, const FTransform& SpawnTransform, TSubclassOf<APlayerController> ControllerClass = nullptr) const;
+
+	// 타이머 매니저는 프레임당 한 번만 틱하므로 레이턴트 커맨드에서 프레임마다 한 번 호출
+	void Tick(const float DeltaSeconds = 1.f / 60.f) const;
+
+private:
+
+	TStrongObjectPtr<UGameInstance> GameInstance;
+	UWorld* World = nullptr;
+};
+
+#endif
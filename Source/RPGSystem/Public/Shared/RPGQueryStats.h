@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Trace/Trace.h"
+
+/**
+ * 충돌 쿼리 계측 (히트박스 / 상호작용 / 카메라 디더링)
+ *
+ * 같은 수치를 세 곳에 기록
+ * - stat RPGQuery: 프레임별 쿼리 수, 히트 수, 중복 제외 수, 쿼리 시간
+ * - Unreal Insights: RPGQueryChannel 채널의 CPU 스코프 (-trace=cpu,rpgquery)
+ * - CSV 프로파일러: RPGQuery 카테고리 (csvprofile start)
+ *
+ * 누적 값은 FRPGQueryStats로 코드에서도 읽을 수 있음 (RPGSystem.Benchmark.Combat.Stress)
+ * Shipping 빌드에서는 모두 컴파일되지 않음
+ */
+
+#define RPG_QUERY_STATS !UE_BUILD_SHIPPING
+
+DECLARE_STATS_GROUP(TEXT("RPGQuery"), STATGROUP_RPGQuery, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("HitBox Query"), STAT_RPGQuery_HitBox, STATGROUP_RPGQuery);
+DECLARE_CYCLE_STAT(TEXT("Interaction Query"), STAT_RPGQuery_Interaction, STATGROUP_RPGQuery);
+DECLARE_CYCLE_STAT(TEXT("Camera Dither Query"), STAT_RPGQuery_CameraDither, STATGROUP_RPGQuery);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("HitBox Traces"), STAT_RPGQuery_HitBoxTraces, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("HitBox Hits"), STAT_RPGQuery_HitBoxHits, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("HitBox Dedup Rejections"), STAT_RPGQuery_HitBoxDedup, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Traces"), STAT_RPGQuery_InteractionTraces, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Hits"), STAT_RPGQuery_InteractionHits, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Dither Overlaps"), STAT_RPGQuery_CameraDitherTraces, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Dither Hits"), STAT_RPGQuery_CameraDitherHits, STATGROUP_RPGQuery);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Dither Dedup Rejections"), STAT_RPGQuery_CameraDitherDedup, STATGROUP_RPGQuery);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(RPGSYSTEM_API, RPGQuery);
+
+UE_TRACE_CHANNEL_EXTERN(RPGQueryChannel, RPGSYSTEM_API);
+
+enum class ERPGQuerySource : uint8
+{
+	HitBox,
+	Interaction,
+	CameraDither,
+
+	Num
+};
+
+struct FRPGQueryCounters
+{
+	// 트레이스/스윕/오버랩 요청 수
+	int64 Queries = 0;
+
+	int64 Hits = 0;
+
+	// 이미 처리한 대상이라 버려진 히트 (히트박스: 이미 맞은 액터, 디더링: 이미 디더링 중인 액터)
+	int64 DedupRejections = 0;
+
+	// 게임 스레드에서 쿼리 요청과 결과 수집에 쓴 시간 (히트 처리 같은 게임플레이 작업과 비동기 물리 시간은 포함하지 않음)
+	double Seconds = 0.0;
+};
+
+class RPGSYSTEM_API FRPGQueryStats
+{
+
+public:
+
+	static void AddQueries(ERPGQuerySource Source, int32 NumQueries, int32 NumHits);
+	static void AddDedupRejections(ERPGQuerySource Source, int32 NumRejections);
+	static void AddTime(ERPGQuerySource Source, double Seconds);
+
+	static const FRPGQueryCounters& Get(ERPGQuerySource Source);
+	static const TCHAR* GetSourceName(ERPGQuerySource Source);
+
+	static void Reset();
+
+private:
+
+	// 게임 스레드 전용
+	static FRPGQueryCounters Counters[static_cast<int32>(ERPGQuerySource::Num)];
+};
+
+// 누적 시간용 스코프 타이머
+class FRPGQueryScopeTimer
+{
+
+public:
+
+	explicit FRPGQueryScopeTimer(ERPGQuerySource InSource)
+		: Source(InSource)
+		, StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FRPGQueryScopeTimer()
+	{
+		FRPGQueryStats::AddTime(Source, FPlatformTime::Seconds() - StartTime);
+	}
+
+private:
+
+	ERPGQuerySource Source;
+	double StartTime;
+};
+
+#if RPG_QUERY_STATS
+
+// stat / Insights / CSV 스코프와 누적 시간을 한 번에 기록
+// StatName은 STAT_ 접두사를 뺀 이름 (RPGQuery_HitBox)
+#define RPG_QUERY_SCOPE(Source, StatName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(StatName, RPGQueryChannel); \
+	SCOPE_CYCLE_COUNTER(STAT_##StatName); \
+	CSV_SCOPED_TIMING_STAT(RPGQuery, StatName); \
+	FRPGQueryScopeTimer ANONYMOUS_VARIABLE(RPGQueryScopeTimer)(Source)
+
+#define RPG_QUERY_RECORD(Source, NumQueries, NumHits) FRPGQueryStats::AddQueries(Source, NumQueries, NumHits)
+#define RPG_QUERY_RECORD_DEDUP(Source, NumRejections) FRPGQueryStats::AddDedupRejections(Source, NumRejections)
+
+#else
+
+#define RPG_QUERY_SCOPE(Source, StatName)
+#define RPG_QUERY_RECORD(Source, NumQueries, NumHits)
+#define RPG_QUERY_RECORD_DEDUP(Source, NumRejections)
+
+#endif
@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "UObject/StrongObjectPtr.h"
+
+class UItemDefinition;
+
+/**
+ * 인벤토리 자동화 테스트 공용 아이템 (RPGSystem.Inventory.*, RPGSystem.Benchmark.Inventory.*)
+ */
+namespace RPGTestItems
+{
+	// 임시 패키지의 아이템 정의 4개: 최대 스택 5/15/25인 스택형 3개와 스택 불가 1개, 무게 0.5/1.5/2.5/3.5
+	RPGSYSTEM_API TArray<TStrongObjectPtr<UItemDefinition>> CreateItemDefinitions();
+}
+
+#endif
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Shared/Components/ObjectPoolComponent.h"
+#include "ObjectPoolSubsystem.generated.h"
+
+class ULevel;
+
+/**
+ * 월드 공용 오브젝트 풀
+ *
+ * UObjectPoolComponent는 액터마다 따로 풀을 가지므로, 화살/히트박스 발사체/피격 FX/위젯처럼
+ * 여러 액터가 같은 클래스를 스폰하는 경우 월드에 하나뿐인 풀을 공유
+ * 내부적으로 퍼시스턴트 레벨의 임시 호스트 액터에 UObjectPoolComponent 하나를 붙여서 사용
+ *
+ * - 클래스별 상한: FPooledObjectTypeConfig의 MaxPoolSize (초과 반환은 파괴), 등록하지 않은 클래스는 DefaultSpawnSettings
+ * - 메모리 부족: 가용 물리 메모리가 임계값 아래로 떨어지거나 OS 메모리 경고가 오면 모든 풀에서 가장 오래 쉰 오브젝트부터 파괴
+ * - 레벨 스트리밍: 서브레벨의 액터가 꺼낸 액터는 그 레벨이 언로드될 때 풀로 반환
+ *   (풀 액터 자체는 항상 퍼시스턴트 레벨에 생성되므로 같이 언로드되지 않음)
+ *
+ * 사용
+ *	AActor* Arrow = UObjectPoolSubsystem::Get(this)->AcquireActor(ArrowClass, Transform, Owner);
+ *	if (!UObjectPoolSubsystem::ReleaseToPool(Arrow)) Arrow->Destroy();
+ *
+ * Console:
+ *	RPGPool.MaxIdleObjects 512
+ *	RPGPool.LowMemoryMB 512
+ *	RPGPool.Trim [Count]
+ */
+UCLASS()
+class RPGSYSTEM_API UObjectPoolSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UObjectPoolSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 월드 컨텍스트의 풀, 게임/PIE 월드가 아니면 nullptr */
+    static UObjectPoolSubsystem* Get(const UObject* WorldContextObject);
+
+    /** 풀로 반환합니다. 풀이 생성한 액터가 아니면 false (호출자가 Destroy) */
+    static bool ReleaseToPool(AActor* Actor);
+
+    // --- 풀 설정 ---
+
+    /** 클래스(또는 머티리얼)의 풀 설정을 등록합니다. 이미 있으면 설정만 갱신 */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared")
+    void RegisterPool(const FPooledObjectTypeConfig& Config);
+
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared")
+    void PrewarmPool(TSubclassOf<UObject> ObjectClass, int32 CountToSpawn);
+
+    // --- 꺼내기 / 반환 ---
+
+    /**
+     * 풀에서 액터를 꺼내 SpawnTransform에 활성화합니다. 등록하지 않은 클래스는 기본 설정으로 풀을 만듦
+     * NewOwner가 서브레벨에 있으면 그 레벨이 언로드될 때 자동으로 반환
+     */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared", meta = (DeterminesOutputType = "ActorClass"))
+    AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* NewOwner = nullptr, APawn* NewInstigator = nullptr);
+
+    template<typename T>
+    T* AcquireActor(TSubclassOf<T> ActorClass, const FTransform& SpawnTransform, AActor* NewOwner = nullptr, APawn* NewInstigator = nullptr)
+    {
+        return Cast<T>(AcquireActor(TSubclassOf<AActor>(ActorClass), SpawnTransform, NewOwner, NewInstigator));
+    }
+
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared", meta = (DeterminesOutputType = "WidgetClass"))
+    UUserWidget* AcquireWidget(TSubclassOf<UUserWidget> WidgetClass);
+
+    /** 풀이 생성한 액터면 반환하고 true, 아니면 false (호출자가 Destroy) */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared")
+    bool ReleaseActor(AActor* Actor);
+
+    /** 위젯 등 액터가 아닌 풀 오브젝트 반환 */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared")
+    bool ReleaseObject(UObject* Object);
+
+    // --- 관리 ---
+
+    /** 모든 풀을 통틀어 가장 오래 쉰 대기 오브젝트부터 파괴, 실제로 파괴한 수 반환 */
+    UFUNCTION(BlueprintCallable, Category = "ObjectPool|Shared")
+    int32 TrimIdleObjects(int32 MaxToTrim);
+
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Shared")
+    int32 GetNumIdleObjects() const;
+
+    UFUNCTION(BlueprintPure, Category = "ObjectPool|Shared")
+    FObjectPoolStats GetPoolStats(TSubclassOf<UObject> ObjectClass) const;
+
+    UObjectPoolComponent* GetPoolComponent() const { return PoolComponent; }
+
+    /** 등록하지 않은 클래스를 처음 꺼낼 때 만드는 풀의 설정 (프리웜 없이 사용량만큼 자람) */
+    FPooledObjectSpawnSettings DefaultSpawnSettings;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    /** 호스트 액터와 풀 컴포넌트를 필요할 때 생성 */
+    UObjectPoolComponent* GetOrCreatePoolComponent();
+
+    void EnsurePoolForClass(UClass* ObjectClass);
+
+    /** 꺼낸 오브젝트를 요청한 쪽의 서브레벨에 묶음 (퍼시스턴트 레벨이면 추적하지 않음) */
+    void TrackContextLevel(UObject* Object, const AActor* ContextActor);
+
+    void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld);
+
+    /** 대여 중에 외부에서 파괴된 액터의 서브레벨 추적 정리 (풀 슬롯은 풀 컴포넌트가 비움) */
+    UFUNCTION()
+    void HandleAcquiredActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+    void HandleMemoryTrim();
+
+    /** 전체 대기 수 상한과 가용 메모리를 확인해서 필요하면 LRU 축소 */
+    void UpdateMemoryPressure(float DeltaTime);
+
+    UPROPERTY(Transient)
+    TObjectPtr<AActor> PoolHostActor = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UObjectPoolComponent> PoolComponent = nullptr;
+
+    /** 대여 중인 오브젝트 -> 꺼낸 쪽의 서브레벨 */
+    TMap<TObjectKey<UObject>, TWeakObjectPtr<ULevel>> ContextLevels;
+
+    float MemoryCheckElapsedSeconds = 0.0f;
+
+    FDelegateHandle LevelRemovedHandle;
+    FDelegateHandle MemoryTrimHandle;
+};
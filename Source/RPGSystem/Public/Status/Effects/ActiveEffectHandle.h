@@ -147,8 +147,11 @@ struct FActiveEffectHandle
         }
     }
 
-    /** Update timers (called every frame by EffectComponent) */
-    void UpdateTimers(float DeltaTime)
+    /**
+     * Update timers (called every frame by EffectComponent)
+     * @return True if a periodic tick is due this frame
+     */
+    bool UpdateTimers(float DeltaTime)
     {
         RemainingDuration -= DeltaTime;
 
@@ -160,8 +163,10 @@ struct FActiveEffectHandle
             if (TimeUntilNextTick <= 0.0f && RemainingDuration > 0.0f)
             {
                 TimeUntilNextTick = EffectDefinition->Period;
+                return true;
             }
         }
+        return false;
     }
 
     /** Equality operator for finding effects */
@@ -10,6 +10,8 @@
 class URPGEffect;
 class UCueManagerSubsystem;
 class UStatsComponent;
+class UEffectSimulationSubsystem;
+struct FEffectSimulationEvent;
 
 USTRUCT()
 struct FAppliedEffectDelta
@@ -52,6 +54,8 @@ class RPGSYSTEM_API UEffectComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    friend class UEffectSimulationSubsystem;
+
 public:
     UEffectComponent();
 
@@ -74,10 +78,25 @@ protected:
 
     /** Runtime mapping of effect instance -> applied stat modifier tags */
     TMap<FGuid, TArray<FAppliedEffectDelta>> AppliedEffectDeltas;
+
+    /**
+     * Let the world's UEffectSimulationSubsystem advance this component's effect timers
+     * instead of ticking the component. Worth it for actors that exist in large numbers (enemies with DoTs).
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Effects|Performance")
+    bool bUseWorldEffectSimulation = false;
+
+    /** Set in BeginPlay when bUseWorldEffectSimulation is on and the world has the subsystem */
+    UPROPERTY()
+    TObjectPtr<UEffectSimulationSubsystem> EffectSimulation = nullptr;
+
+    /** Granted tags changed since the last tag-conflict check */
+    bool bGrantedTagsChanged = false;
 public:
     // ========== LIFECYCLE ==========
     
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     void ApplyEffectStatModifiers(const FActiveEffectHandle& EffectHandle, bool bPersistentModifier);
@@ -161,7 +180,7 @@ public:
      * Get all currently active effects (read-only)
      */
     UFUNCTION(BlueprintPure, Category = "Effects")
-    TArray<FActiveEffectHandle> GetAllActiveEffects() const { return ActiveEffects; }
+    TArray<FActiveEffectHandle> GetAllActiveEffects() const;
 
     // ========== TAGS ==========
     
@@ -253,6 +272,31 @@ protected:
      */
     void CheckForRemovalTags();
 
+    /**
+     * Run CheckForRemovalTags only if granted tags changed since the last check
+     */
+    void ProcessGrantedTagChanges();
+
+    /**
+     * Schedule a tag-conflict check (next tick, or after the world simulation's dispatch)
+     */
+    void MarkGrantedTagsChanged();
+
+    /**
+     * Handle this frame's ticks and expirations from the world simulation (one call per frame)
+     */
+    void HandleSimulatedEffectEvents(TConstArrayView<FEffectSimulationEvent> Events);
+
+    /**
+     * Copy simulated timers into a handle (no-op when the component ticks itself)
+     */
+    void SyncSimulatedTimers(FActiveEffectHandle& Handle) const;
+
+    /**
+     * Remove the effect at an index (swap-remove, order of ActiveEffects is not preserved)
+     */
+    void RemoveEffectAt(int32 Index);
+
     /**
      * Play the appropriate gameplay cue for an effect event
      */
@@ -0,0 +1,112 @@
+// EffectSimulationSubsystem.h
+// World-level timer simulation for active effects
+// Components opt in with UEffectComponent::bUseWorldEffectSimulation and stop ticking themselves
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EffectSimulationSubsystem.generated.h"
+
+class UEffectComponent;
+struct FActiveEffectHandle;
+
+/**
+ * One effect that ticked and/or expired this frame
+ * Timers are the simulated values, the component copies them into its handle before dispatching
+ */
+struct FEffectSimulationEvent
+{
+    FGuid InstanceID;
+    float RemainingDuration = 0.0f;
+    float TimeUntilNextTick = 0.0f;
+    bool bTicked = false;
+    bool bExpired = false;
+};
+
+/**
+ * Owns the timers of every opted-in active effect in the world
+ *
+ * DATA LAYOUT: Struct-of-arrays, the same index in every array is the same effect.
+ * The per-frame pass only touches the timer arrays, so hundreds of DoTs advance in one
+ * cache-friendly loop (split across ParallelFor when large) instead of one tick per actor.
+ *
+ * DISPATCH: Ticks and expirations are grouped by component and handed back in one call
+ * per component. The component still owns the effect definition, context and stacks.
+ *
+ * Console:
+ *   RPGEffects.ParallelSimulation 0/1
+ *   RPGEffects.ParallelSimulationMinEffects 2048
+ */
+UCLASS()
+class RPGSYSTEM_API UEffectSimulationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ========== LIFECYCLE ==========
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ========== REGISTRATION ==========
+
+    /** Start simulating an effect that was just added to the component */
+    void RegisterEffect(UEffectComponent* Component, const FActiveEffectHandle& Handle);
+
+    /** Push timer changes made by stacking (refresh, added duration) */
+    void UpdateEffect(const FActiveEffectHandle& Handle);
+
+    /** Stop simulating an effect (removed, expired or cleansed) */
+    void UnregisterEffect(const FGuid& InstanceID);
+
+    /** Stop simulating every effect of a component (EndPlay) */
+    void UnregisterComponent(const UEffectComponent* Component);
+
+    /** Current simulated timers, false if the effect is not simulated */
+    bool GetEffectTimers(const FGuid& InstanceID, float& OutRemainingDuration, float& OutTimeUntilNextTick) const;
+
+    /** Run the component's tag-conflict check after this frame's dispatch */
+    void RequestTagConflictCheck(UEffectComponent* Component);
+
+    int32 GetNumSimulatedEffects() const { return InstanceIDs.Num(); }
+
+protected:
+    /** Advance timers of [BeginIndex, EndIndex) and write this frame's event flags */
+    void AdvanceTimers(int32 BeginIndex, int32 EndIndex, float DeltaTime);
+
+    /** Swap-remove one effect from every array */
+    void RemoveAtSwap(int32 Index);
+
+    /** Hand collected events back to their components, one call per component */
+    void DispatchEvents();
+
+    // ========== STRUCT-OF-ARRAYS ==========
+
+    TArray<float> RemainingDurations;
+    TArray<float> TimesUntilNextTick;
+
+    /** <= 0 for non-periodic effects */
+    TArray<float> Periods;
+
+    TArray<FGuid> InstanceIDs;
+    TArray<TWeakObjectPtr<UEffectComponent>> Owners;
+
+    /** Written by AdvanceTimers, read by the collection pass (EEventFlags) */
+    TArray<uint8> EventFlags;
+
+    TMap<FGuid, int32> InstanceToIndex;
+
+    // ========== PER-FRAME SCRATCH ==========
+
+    struct FPendingEvent
+    {
+        UEffectComponent* Component = nullptr;
+        FEffectSimulationEvent Event;
+    };
+
+    TArray<FPendingEvent> PendingEvents;
+    TArray<FEffectSimulationEvent> DispatchScratch;
+    TArray<TWeakObjectPtr<UEffectComponent>> PendingTagChecks;
+};
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+#include "StatRecalculationBenchmark.generated.h"
+
+/**
+ * 스탯 재계산 자동화 테스트
+ *
+ * - RPGSystem.Benchmark.Stats.Recalculation (장비 교체/오라/주기 효과)
+ *	같은 랜덤 Modifier 교체를 두 방식에 적용하고 시간을 비교 (기준 비교는 Shared/RPGBenchmark.h)
+ *	Legacy: 이전 FStatEntry, Modifier 배열 하나를 변경 때마다 Priority 정렬 후 전체 순회
+ *	Bucketed: 타입별 정렬 버킷 + 캐시된 합계 (현재 FStatEntry)
+ *	교체는 같은 ModifierTag의 제거 후 추가, Override는 포함하지 않음
+ * - RPGSystem.Stats.ModifierNotify
+ *	Modifier 변경 직후 조회/SetStatValue가 최신 값을 쓰고, OnStatModified의 이전 값이 이어지는지 검사
+ */
+
+/** OnStatModified 기록 (ModifierNotify 테스트 전용) */
+UCLASS(Transient)
+class UStatModifiedTestListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION()
+	void OnStatModified(const FGameplayTag& StatTag, float OldValue, float NewValue)
+	{
+		Events.Add({ OldValue, NewValue });
+	}
+
+	TArray<TPair<float, float>> Events;
+};
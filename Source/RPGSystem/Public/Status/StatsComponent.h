@@ -7,6 +7,8 @@
 #include "StatData.h"
 #include "Components/ActorComponent.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 #include "StatsComponent.generated.h"
 
 class UDataAsset_StatConfig;
@@ -34,8 +36,15 @@ public:
 	UPROPERTY()
 	float MaxValue = 0.0f;
 
+	/** 타입별 Modifier, 각 배열은 Priority 오름차순으로 삽입 시 정렬 유지 */
 	UPROPERTY()
-	TArray<FStatModifier> Modifiers;
+	TArray<FStatModifier> FlatModifiers;
+
+	UPROPERTY()
+	TArray<FStatModifier> PercentModifiers;
+
+	UPROPERTY()
+	TArray<FStatModifier> OverrideModifiers;
 
 	FStatEntry() = default;
 
@@ -46,39 +55,206 @@ public:
 	, MaxValue(InMax)
 	{}
 
-	void RecalculateValue()
+	/** 같은 ModifierTag가 있으면 교체, Priority 순서 유지 */
+	void AddModifier(const FStatModifier& Modifier)
 	{
-		float FinalValue = BaseValue;
-		float FlatBonus = 0.0f;
-		float PercentBonus = 1.0f;
+		RemoveModifier(Modifier.ModifierTag);
 
-		// Priority로 정렬
-		Modifiers.Sort([](const FStatModifier& A, const FStatModifier& B)
+		TArray<FStatModifier>& Bucket = GetBucket(Modifier.ModifierType);
+		const int32 InsertIndex = Algo::UpperBoundBy(Bucket, Modifier.Priority, &FStatModifier::Priority);
+		Bucket.Insert(Modifier, InsertIndex);
+
+		if (Modifier.Duration > 0.0f)
 		{
-			return A.Priority < B.Priority;
-		});
+			++NumTimedModifiers;
+		}
 
-		// Modifier 적용
-		for (const FStatModifier& Mod : Modifiers)
+		if (!bAggregatesDirty)
 		{
-			switch (Mod.ModifierType)
+			switch (Modifier.ModifierType)
 			{
 			case EModifierSourceType::Flat:
-				FlatBonus += Mod.ModifierValue;
+				FlatSum += Modifier.ModifierValue;
 				break;
 			case EModifierSourceType::Percentage:
-				PercentBonus *= (1.0f + Mod.ModifierValue);
+				PercentProduct *= (1.0f + Modifier.ModifierValue);
+				break;
+			default:
 				break;
-			case EModifierSourceType::Override:
-				CurrentValue = FMath::Max(0.0f, Mod.ModifierValue);
-				return;  // Override는 다른 Modifier 무시
 			}
 		}
+	}
+
+	/** @return 제거된 Modifier 수 */
+	int32 RemoveModifier(const FGameplayTag& ModifierTag)
+	{
+		return RemoveModifiersIf([&ModifierTag](const FStatModifier& Mod)
+		{
+			return Mod.ModifierTag == ModifierTag;
+		});
+	}
+
+	int32 RemoveExpiredModifiers(float CurrentTime)
+	{
+		if (NumTimedModifiers == 0) return 0;
+
+		return RemoveModifiersIf([CurrentTime](const FStatModifier& Mod)
+		{
+			return Mod.IsExpired(CurrentTime);
+		});
+	}
+
+	void ClearModifiers()
+	{
+		FlatModifiers.Reset();
+		PercentModifiers.Reset();
+		OverrideModifiers.Reset();
+		NumTimedModifiers = 0;
+		FlatSum = 0.0f;
+		PercentProduct = 1.0f;
+		bAggregatesDirty = false;
+	}
+
+	int32 GetNumModifiers() const
+	{
+		return FlatModifiers.Num() + PercentModifiers.Num() + OverrideModifiers.Num();
+	}
+
+	bool HasTimedModifiers() const { return NumTimedModifiers > 0; }
+
+	/** 전체 Modifier를 Priority 순으로 (UI/디버그용, 매번 할당) */
+	TArray<FStatModifier> GetAllModifiers() const
+	{
+		TArray<FStatModifier> Result;
+		Result.Reserve(GetNumModifiers());
+		Result.Append(FlatModifiers);
+		Result.Append(PercentModifiers);
+		Result.Append(OverrideModifiers);
+		Algo::StableSortBy(Result, &FStatModifier::Priority);
+		return Result;
+	}
+
+	/** 캐시된 합계로 계산, 제거로 합계가 무효화된 경우에만 버킷을 다시 순회 */
+	void RecalculateValue()
+	{
+		// Override는 다른 Modifier 무시 (Priority가 가장 낮은 것 적용)
+		if (OverrideModifiers.Num() > 0)
+		{
+			CurrentValue = FMath::Max(0.0f, OverrideModifiers[0].ModifierValue);
+			return;
+		}
+
+		if (bAggregatesDirty)
+		{
+			RebuildAggregates();
+		}
 
 		// 최종 계산: (Base + Flat) * Percentage
-		FinalValue = (FinalValue + FlatBonus) * PercentBonus;
+		const float FinalValue = (BaseValue + FlatSum) * PercentProduct;
 		CurrentValue = FMath::Max(0.0f, FinalValue);
 	}
+
+	/** 복제로 버킷이 통째로 바뀐 뒤 호출, 캐시는 다음 재계산에서 다시 만듦 */
+	void InvalidateModifierCache()
+	{
+		NumTimedModifiers = 0;
+		for (const TArray<FStatModifier>* Bucket : { &FlatModifiers, &PercentModifiers, &OverrideModifiers })
+		{
+			for (const FStatModifier& Mod : *Bucket)
+			{
+				NumTimedModifiers += Mod.Duration > 0.0f ? 1 : 0;
+			}
+		}
+		bAggregatesDirty = true;
+	}
+
+	/** 값은 즉시 재계산, UStatsComponent가 복제/OnStatModified만 프레임당 한 번 처리하기 위한 표시 */
+	bool bChangeNotifyPending = false;
+	float ValueBeforeChange = 0.0f;
+
+private:
+	float FlatSum = 0.0f;
+	float PercentProduct = 1.0f;
+	int32 NumTimedModifiers = 0;
+	// 새로 만들어지거나 역직렬화된 엔트리는 첫 재계산에서 합계를 구함
+	bool bAggregatesDirty = true;
+
+	TArray<FStatModifier>& GetBucket(EModifierSourceType Type)
+	{
+		switch (Type)
+		{
+		case EModifierSourceType::Percentage:
+			return PercentModifiers;
+		case EModifierSourceType::Override:
+			return OverrideModifiers;
+		default:
+			return FlatModifiers;
+		}
+	}
+
+	template<typename PredicateType>
+	int32 RemoveModifiersIf(PredicateType Predicate)
+	{
+		int32 RemovedCount = 0;
+		const auto RemoveFromBucket = [this, &Predicate, &RemovedCount](TArray<FStatModifier>& Bucket, EModifierSourceType Type)
+		{
+			for (int32 i = Bucket.Num() - 1; i >= 0; --i)
+			{
+				const FStatModifier& Mod = Bucket[i];
+				if (!Predicate(Mod)) continue;
+
+				if (Mod.Duration > 0.0f)
+				{
+					--NumTimedModifiers;
+				}
+
+				// Flat은 빼기로 갱신, Percent는 나누기 오차/0 나누기를 피하려고 다시 곱함
+				if (Type == EModifierSourceType::Flat && !bAggregatesDirty)
+				{
+					FlatSum -= Mod.ModifierValue;
+				}
+				else if (Type == EModifierSourceType::Percentage)
+				{
+					bAggregatesDirty = true;
+				}
+
+				// 정렬 유지
+				Bucket.RemoveAt(i, 1, EAllowShrinking::No);
+				++RemovedCount;
+			}
+		};
+
+		RemoveFromBucket(FlatModifiers, EModifierSourceType::Flat);
+		RemoveFromBucket(PercentModifiers, EModifierSourceType::Percentage);
+		RemoveFromBucket(OverrideModifiers, EModifierSourceType::Override);
+
+		// 비면 누적 오차 없이 초기화
+		if (bAggregatesDirty && PercentModifiers.Num() == 0)
+		{
+			RebuildAggregates();
+		}
+		else if (FlatModifiers.Num() == 0 && !bAggregatesDirty)
+		{
+			FlatSum = 0.0f;
+		}
+		return RemovedCount;
+	}
+
+	void RebuildAggregates()
+	{
+		FlatSum = 0.0f;
+		for (const FStatModifier& Mod : FlatModifiers)
+		{
+			FlatSum += Mod.ModifierValue;
+		}
+
+		PercentProduct = 1.0f;
+		for (const FStatModifier& Mod : PercentModifiers)
+		{
+			PercentProduct *= (1.0f + Mod.ModifierValue);
+		}
+		bAggregatesDirty = false;
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -157,7 +333,10 @@ protected:
 private:
 	FTimerHandle StatRecalculationTimer;
 	FTimerHandle ModifierCleanupTimer;
-	bool bNeedsStatRecalculation = false;
+	bool bHasPendingStatChanges = false;
+
+	/** 이번 프레임에 Modifier로 값이 바뀐 스탯 (복제/알림은 프레임당 스탯별 한 번) */
+	TArray<int32> PendingChangedStatIndices;
 
 public:
 
@@ -178,6 +357,9 @@ public:
 	void RemoveStatModifier(const FGameplayTag& StatTag, const FGameplayTag& ModifierTag);
 	void RemoveAllModifiers(const FGameplayTag& StatTag);
 	TArray<FStatModifier> GetStatModifiers(const FGameplayTag& StatTag) const;
+
+	/** Modifier 변경으로 미뤄둔 복제/OnStatModified를 즉시 처리 (보통은 다음 Tick에서 자동 처리) */
+	void FlushPendingStatChanges();
 	
 	void AddItemStatBonus(const FGameplayTag& StatTag, const FGameplayTag& ItemID,float BonusValue, EModifierSourceType ModifierType = EModifierSourceType::Flat);
 	void RemoveItemStatBonus(const FGameplayTag& StatTag, const FGameplayTag& ItemID);
@@ -205,6 +387,7 @@ private:
 	float ClampStatValue(const FGameplayTag& StatTag, float Value) const;
 	void OnStatValueChanged(const FGameplayTag& StatTag, float OldValue, float NewValue);
 	void RebuildStatCache();
+	void RecalculateStat(int32 StatIndex);
 	// void RecalculateStat(const FGameplayTag& StatTag);
 	void CleanupExpiredModifiers();
 	void EnsureModifierCleanupTimerRunning();
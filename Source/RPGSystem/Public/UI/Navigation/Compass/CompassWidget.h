@@ -11,6 +11,7 @@
 
 class USizeBox;
 class UCompassMarkerWidget;
+class UNavigationMarkerLayerWidget;
 class UOverlay;
 class URetainerBox;
 class UImage;
@@ -38,6 +39,16 @@ public:
 	// 이미 있는 마커라면 위치를 갱신하고, 없다면 새로 만듭니다.
 	void AddOrUpdateCompassMarker(UObject* MarkerObject, UObject* PingIcon1, UObject* PingIcon2);
 
+	// 아이콘/색상/크기 마커 추가, Layer_CompassMarkers가 있으면 마커 위젯 대신 UNavigationMarkerSubsystem에 등록
+	// ScreenPersistance면 시야 밖 마커를 나침반 양 끝에 고정
+	void AddOrUpdateCompassMarker(UObject* MarkerObject, const FCompassMarkerInfo& MarkerInfo);
+
+	// 마커 제거
+	void RemoveCompassMarker(UObject* MarkerObject);
+
+	// 모든 마커 제거
+	void RemoveAllCompassMarkers();
+
 protected:
 	bool IsActive;      // 나침반이 현재 활성화되어 화면에 보이는지 여부
 	float Orientation;  // 나침반의 기준 방향 (플레이어의 정면)
@@ -48,6 +59,13 @@ protected:
 	UPROPERTY()
 	TMap<UObject*,UCompassMarkerWidget*> MarkerMap;
 
+	// Layer_CompassMarkers로 그리도록 서브시스템에 등록한 마커 대상
+	TSet<TWeakObjectPtr<UObject>> LayerMarkers;
+
+	// 배치 레이어가 없을 때 마커마다 생성하는 위젯 클래스
+	UPROPERTY(EditDefaultsOnly)
+	TSubclassOf<UCompassMarkerWidget> CompassMarkerClass;
+
 private:
 	// 실제 방위(N, S, E, W)가 그려진 이미지. 머티리얼을 통해 UV를 이동시킵니다.
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, meta=(AllowPrivateAccess))
@@ -88,6 +106,10 @@ private:
 	// 마커 위젯들이 실제로 생성되어 자식으로 들어가는 부모 패널 (Overlay)
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, meta=(AllowPrivateAccess))
 	UOverlay* Overlay_MarkerParent;
+
+	// 배치 마커 레이어 (Overlay_MarkerParent 위에 채우기로 배치, View는 Compass)
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, meta=(BindWidgetOptional, AllowPrivateAccess))
+	UNavigationMarkerLayerWidget* Layer_CompassMarkers;
 	
 public:
 	FORCEINLINE UMaterialInstanceDynamic* GetCompassMaterial() const { return Image_DirectionLines->GetDynamicMaterial(); }
@@ -4,6 +4,8 @@
 #include "Slate/WidgetTransform.h"
 #include "MinimapData.generated.h"
 
+class UMinimapTileSet;
+
 /**
  * 미니맵 초기 설정 정보를 담는 구조체입니다.
  * 월드 크기와 미니맵 텍스처를 매핑하기 위한 좌표 정보가 핵심입니다.
@@ -25,6 +27,9 @@ struct FMiniMapInfo
 	
 	UPROPERTY(EditDefaultsOnly,BlueprintReadOnly)
 	UObject* MinimapTexture{};             // 미니맵 배경으로 쓸 텍스처 이미지
+
+	UPROPERTY(EditDefaultsOnly,BlueprintReadOnly)
+	UMinimapTileSet* MinimapTileSet{};     // 타일 피라미드 (지정하면 MinimapTexture 대신 보이는 타일만 스트리밍, 텍스처는 비워둘 것)
 };
 
 /**
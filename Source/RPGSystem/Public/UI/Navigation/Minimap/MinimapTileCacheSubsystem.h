@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MinimapTileCacheSubsystem.generated.h"
+
+class UMinimapTileSet;
+struct FStreamableHandle;
+
+/**
+ * 미니맵 타일 LRU 캐시
+ *
+ * 보이는 타일만 요청받아 비동기로 로드하고, 로드된 타일은 스트리머블 핸들로 붙잡아 둠
+ * 메모리 예산을 넘으면 가장 오래 쓰이지 않은 타일부터 핸들을 놓아 GC가 정리하게 함
+ * 이번 프레임에 요청된 타일은 예산을 넘어도 내리지 않음 (다음 프레임에 다시 로드하는 반복 방지)
+ * 로드에 실패한 타일은 엔트리와 예산에서 빼고 경로만 기록해 다시 요청하지 않음 (Flush하면 다시 시도)
+ *
+ * Console:
+ *	RPGMinimap.TileCacheBudgetMB 64
+ *	RPGMinimap.TileCacheStats
+ */
+UCLASS()
+class RPGSYSTEM_API UMinimapTileCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** 월드 컨텍스트의 타일 캐시, 게임/PIE 월드가 아니면 nullptr */
+	static UMinimapTileCacheSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * 타일 브러시, 아직 로드되지 않았으면 비동기 로드를 시작하고 nullptr
+	 * 반환된 브러시는 다음 요청 전까지만 유효
+	 */
+	const FSlateBrush* RequestTile(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY);
+
+	/** 로드돼 있으면 브러시, 로드를 시작하지는 않음 (상위 단계 대체 타일 찾기용) */
+	const FSlateBrush* FindResidentTile(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY);
+
+	/** 모든 타일 해제, 실패 기록도 비움 */
+	void Flush();
+
+	int32 GetNumTiles() const { return Tiles.Num(); }
+	int64 GetResidentBytes() const { return ResidentBytes; }
+
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 해제 순서 자동화 테스트 (RPGSystem.Minimap.TileCache.Eviction)
+	friend class FMinimapTileCacheEvictionTest;
+
+	struct FTileEntry
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+
+		// 로드 완료 후 채워짐
+		FSlateBrush Brush;
+		bool bLoaded = false;
+
+		// 로드 전에는 추정치
+		int64 SizeBytes = 0;
+
+		uint64 LastUsedFrame = 0;
+	};
+
+	FTileEntry* FindEntry(const UMinimapTileSet* TileSet, int32 Level, int32 TileX, int32 TileY, FSoftObjectPath& OutPath);
+
+	void HandleTileLoaded(FSoftObjectPath TilePath);
+
+	static void ReleaseEntry(FTileEntry& Entry);
+
+	/** 예산을 넘으면 이번 프레임에 쓰이지 않은 타일을 오래된 순으로 해제 */
+	void EvictOverBudget();
+
+	TMap<FSoftObjectPath, FTileEntry> Tiles;
+
+	// 로드에 실패한 타일 경로
+	TSet<FSoftObjectPath> MissingTiles;
+
+	int64 ResidentBytes = 0;
+};
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "MinimapTileLayerWidget.generated.h"
+
+class SMinimapTileLayer;
+class UMinimapTileSet;
+
+/**
+ * 타일 피라미드(UMinimapTileSet)로 미니맵 배경을 그리는 레이어
+ *
+ * 맵 텍스처 한 장을 브러시로 쓰는 Img_Map 대신, 보이는 타일만 현재 줌에 맞는 단계에서
+ * UMinimapTileCacheSubsystem을 통해 비동기로 로드해서 그림
+ * UMinimapWidget의 Img_Map과 같은 캔버스 슬롯 위치/크기로 움직이도록 Tile_Map으로 배치
+ */
+UCLASS()
+class RPGSYSTEM_API UMinimapTileLayerWidget : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	UMinimapTileLayerWidget();
+
+	UFUNCTION(BlueprintCallable, Category = "Minimap")
+	void SetTileSet(UMinimapTileSet* InTileSet);
+
+	UFUNCTION(BlueprintCallable, Category = "Minimap")
+	void SetTint(FLinearColor InTint);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Minimap")
+	TObjectPtr<UMinimapTileSet> TileSet;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	FLinearColor Tint = FLinearColor::White;
+
+	// 양수면 더 거친 단계를 사용 (메모리/로드 감소), 음수면 더 세밀한 단계
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance", meta = (ClampMin = "-2", ClampMax = "4"))
+	float LevelBias = 0.0f;
+
+	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	TSharedPtr<SMinimapTileLayer> MyTileLayer;
+};
@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MinimapTileSet.generated.h"
+
+class UTexture2D;
+
+/** 피라미드 한 단계의 타일 (행 우선, 0,0이 이미지 좌상단) */
+USTRUCT(BlueprintType)
+struct FMinimapTileLevel
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumTilesX = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumTilesY = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<TSoftObjectPtr<UTexture2D>> Tiles;
+};
+
+/**
+ * 미니맵 타일 피라미드 인덱스
+ *
+ * 고해상도 미니맵 캡처 한 장을 에디터 도구(RPGSystemEditor, 텍스처 우클릭 > Build Minimap Tile Pyramid)로
+ * 고정 크기 타일로 잘라 만든 에셋. 0단계가 원본 해상도, 한 단계 올라갈 때마다 절반으로 줄고 마지막 단계는 타일 하나
+ * 타일은 소프트 참조라 이 에셋을 로드해도 텍스처는 로드되지 않음,
+ * UMinimapTileLayerWidget이 보이는 타일만 UMinimapTileCacheSubsystem을 통해 비동기로 로드
+ */
+UCLASS(BlueprintType)
+class RPGSYSTEM_API UMinimapTileSet : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// 타일 한 변의 픽셀 수 (가장자리 타일도 이 크기, 남는 부분은 투명)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tiles")
+	int32 TileSize = 256;
+
+	// 원본 캡처의 해상도
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tiles")
+	FIntPoint SourceSize = FIntPoint::ZeroValue;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tiles")
+	TArray<FMinimapTileLevel> Levels;
+
+#if WITH_EDITORONLY_DATA
+	// 잘라낸 원본 (다시 자를 때 사용)
+	UPROPERTY(VisibleAnywhere, Category = "Tiles")
+	TSoftObjectPtr<UTexture2D> SourceTexture;
+#endif
+
+	int32 GetNumLevels() const { return Levels.Num(); }
+
+	bool IsValidTileSet() const { return TileSize > 0 && SourceSize.X > 0 && SourceSize.Y > 0 && Levels.Num() > 0; }
+
+	/** 범위 밖이면 빈 참조 */
+	const TSoftObjectPtr<UTexture2D>& GetTile(int32 Level, int32 TileX, int32 TileY) const;
+
+	/**
+	 * 화면 픽셀 하나에 원본 픽셀이 SourcePixelsPerScreenPixel개 들어갈 때 쓸 단계
+	 * 타일 해상도가 화면 해상도 이상인 가장 거친 단계 (Bias가 양수면 더 거칠게)
+	 */
+	int32 SelectLevel(float SourcePixelsPerScreenPixel, float Bias = 0.0f) const;
+};
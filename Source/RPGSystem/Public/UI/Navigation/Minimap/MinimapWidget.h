@@ -9,6 +9,8 @@
 
 class UMinimapDistantMarkerWidget;
 class UMinimapMarkerWidget;
+class UMinimapTileLayerWidget;
+class UNavigationMarkerLayerWidget;
 class URetainerBox;
 class UOverlay;
 class UImage;
@@ -33,6 +35,9 @@ public:
 	void HideMinimap();
 	void UpdateMiniMap(float NewZoomValue);
 	void AddOrUpdateMarker(UObject* Marker,bool ScaleWithZoom, FMiniMapInfo Info);
+
+	// 아이콘/색상/크기 마커 추가, Layer_MapMarkers가 있으면 마커 위젯 대신 UNavigationMarkerSubsystem에 등록 (맵 밖이면 가장자리에 고정)
+	void AddOrUpdateMarker(UObject* Marker, const FMinimapMarkerInfo& MarkerInfo);
 	
 	// 마커 제거
 	void RemoveMarker(UObject* Marker);
@@ -103,12 +108,20 @@ protected:
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	UImage* Img_Map;
 
+	// 타일 피라미드용 배경 레이어 (Img_Map과 같은 캔버스 슬롯 설정으로 배치)
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	UMinimapTileLayerWidget* Tile_Map;
+
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	UImage* Img_Frame;
 
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	UOverlay* OV_MapMarkers;
 
+	// 배치 마커 레이어 (B_MapMarkers 안에 채우기로 배치, View는 Minimap)
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	UNavigationMarkerLayerWidget* Layer_MapMarkers;
+
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	UOverlay* OV_DistantMarker;
 
@@ -147,6 +160,9 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UUserWidget> CurrentDistantMarker; // 현재 처리 중인 원거리 마커
 
+	// Layer_MapMarkers로 그리도록 서브시스템에 등록한 마커 대상
+	TSet<TWeakObjectPtr<UObject>> LayerMarkers;
+
 	// 마커 생성을 위한 위젯 클래스 참조
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UMinimapMarkerWidget> MinimapMarkerClass;
@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "UI/Navigation/NavigationMarkerSubsystem.h"
+#include "NavigationMarkerLayerWidget.generated.h"
+
+class SNavigationMarkerLayer;
+
+/**
+ * UNavigationMarkerSubsystem의 마커를 한 뷰(미니맵/나침반/월드)에 그리는 레이어
+ *
+ * 마커마다 UMinimapMarkerWidget/UCompassMarkerWidget/UWorldMarkerWidget을 만들지 않고
+ * Slate 리프 위젯 하나가 OnPaint에서 전부 그림
+ * - Minimap: 맵 이미지와 같이 움직이는 패널(B_MapMarkers) 안에 채우기로 배치 (UMinimapWidget::Layer_MapMarkers)
+ * - Compass: 나침반 띠 위에 채우기로 배치 (UCompassWidget::Layer_CompassMarkers)
+ * - WorldMarker: 뷰포트 전체를 덮도록 배치 (URPGHUDWidget::Layer_WorldMarkers, 최상단 캔버스, 앵커 전체)
+ *
+ * 위젯을 소유한 플레이어를 서브시스템에 뷰로 등록하고, 그 플레이어의 카메라/뷰포트 기준 투영 결과를 그림
+ */
+UCLASS()
+class RPGSYSTEM_API UNavigationMarkerLayerWidget : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	UNavigationMarkerLayerWidget();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	ENavigationMarkerView View = ENavigationMarkerView::WorldMarker;
+
+	// 배율 1인 마커의 크기
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance")
+	FVector2D IconSize = FVector2D(32.0);
+
+	// WorldMarker: ClampToEdge 마커를 고정할 가장자리 여백
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance", meta = (ClampMin = "0"))
+	float EdgeMargin = 32.0f;
+
+	// Compass: 나침반 띠 가로 폭에 해당하는 각도
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Appearance", meta = (ClampMin = "1", ClampMax = "360"))
+	float CompassFieldOfView = 120.0f;
+
+	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	TSharedPtr<SNavigationMarkerLayer> MyMarkerLayer;
+
+private:
+	void RegisterView(UNavigationMarkerSubsystem* MarkerSubsystem, APlayerController* Player);
+	void UnregisterView();
+
+	TWeakObjectPtr<UNavigationMarkerSubsystem> RegisteredSubsystem;
+	TWeakObjectPtr<APlayerController> RegisteredPlayer;
+};
@@ -0,0 +1,230 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavigationMarkerSubsystem.generated.h"
+
+class APlayerController;
+class ULevel;
+class USceneComponent;
+
+/** 마커를 표시할 뷰와 표시 옵션 */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ENavigationMarkerFlags : uint8
+{
+	None		= 0 UMETA(Hidden),
+	Minimap		= 1 << 0,
+	Compass		= 1 << 1,
+	WorldMarker	= 1 << 2,
+	// 뷰 밖이면 숨기지 않고 가장자리에 고정 (FWorldMarkerInfo::ScreenPersistance)
+	ClampToEdge	= 1 << 3,
+};
+ENUM_CLASS_FLAGS(ENavigationMarkerFlags);
+
+/** UNavigationMarkerLayerWidget 하나가 그리는 뷰 */
+UENUM(BlueprintType)
+enum class ENavigationMarkerView : uint8
+{
+	Minimap,
+	Compass,
+	WorldMarker,
+};
+
+/** 프레임마다 계산되는 투영 결과 플래그 */
+enum class ENavigationMarkerProjectionFlags : uint8
+{
+	None				= 0,
+	// 미니맵 경계를 찾아 UV를 계산함
+	HasMinimapUV		= 1 << 0,
+	// 미니맵 경계 안 (UV가 0~1)
+	InMinimap			= 1 << 1,
+	HasCompassAngle		= 1 << 2,
+	HasScreenPosition	= 1 << 3,
+	// 카메라 앞, 뒤쪽이면 화면 좌표가 중심 기준으로 뒤집혀 있음
+	InFront				= 1 << 4,
+};
+ENUM_CLASS_FLAGS(ENavigationMarkerProjectionFlags);
+
+/** 플레이어 한 명의 뷰 기준 프레임별 투영 결과 (인덱스는 마커 배열과 같음) */
+struct FNavigationMarkerProjection
+{
+	TWeakObjectPtr<APlayerController> Player;
+
+	// 이 플레이어로 등록한 레이어 수, 0이 되면 제거
+	int32 NumViews = 0;
+
+	// ENavigationMarkerProjectionFlags
+	TArray<uint8> Flags;
+	TArray<FVector2f> MinimapUVs;
+	TArray<float> CompassAngles;
+	TArray<FVector2f> ScreenPositions;
+
+	// 월드 마커 투영에 쓴 뷰포트 크기 (픽셀)
+	FVector2D ViewportSize = FVector2D::ZeroVector;
+};
+
+/**
+ * 미니맵/나침반/월드 마커 공용 마커 저장소
+ *
+ * 마커마다 UUserWidget을 만들고 각자 Tick에서 위치를 계산하는 대신,
+ * 모든 마커를 인덱스가 같은 평면 배열(월드 위치, 아이콘, 색상, 플래그)에 보관하고
+ * 서브시스템 Tick에서 레이어를 등록한 플레이어마다 한 번만 세 뷰의 좌표로 투영 (등록한 레이어가 없으면 투영하지 않음)
+ * - 미니맵: 경계 액터 기준 정규화 UV (X/Y 성분별, 좌하단 0,0 / 우상단 1,1)
+ * - 나침반: 카메라 Yaw 기준 상대 방위각 (-180~180)
+ * - 월드 마커: 뷰포트 픽셀 좌표
+ * 그리기는 UNavigationMarkerLayerWidget 하나가 뷰별로 담당하고, 같은 아이콘은 브러시 하나를 공유
+ *
+ * 미니맵 경계 액터는 클래스별로 한 번만 찾아 캐시 (파괴되거나 해당 클래스가 새로 스폰되거나 레벨이 스트리밍되어 들어오면 다시 찾음)
+ *
+ * 마커는 대상마다 하나라 아이콘/색상/크기/ClampToEdge는 마지막으로 갱신한 위젯 기준으로 모든 뷰가 공유
+ *
+ * 사용
+ *	UNavigationMarkerSubsystem::Get(this)->AddOrUpdateMarker(QuestTarget, Icon, FLinearColor::Yellow, 1.f, Flags);
+ */
+UCLASS()
+class RPGSYSTEM_API UNavigationMarkerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 마커 서브시스템, 게임/PIE 월드가 아니면 nullptr */
+	static UNavigationMarkerSubsystem* Get(const UObject* WorldContextObject);
+
+	// --- 마커 ---
+
+	/**
+	 * Target(액터 또는 씬 컴포넌트)을 추적하는 마커 추가, 이미 있으면 아이콘/색상/플래그만 갱신
+	 * Flags는 ENavigationMarkerFlags 조합
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Navigation|Marker")
+	void AddOrUpdateMarker(UObject* Target, UObject* Icon, FLinearColor Color, float Scale,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/RPGSystem.ENavigationMarkerFlags")) int32 Flags);
+
+	UFUNCTION(BlueprintCallable, Category = "Navigation|Marker")
+	void RemoveMarker(UObject* Target);
+
+	UFUNCTION(BlueprintCallable, Category = "Navigation|Marker")
+	void RemoveAllMarkers();
+
+	/**
+	 * Target 마커에서 뷰 플래그(Minimap/Compass/WorldMarker)만 제거, 남은 뷰가 없으면 마커 제거
+	 * 미니맵/나침반/월드 마커 위젯이 같은 대상을 각자 등록하므로 위젯은 RemoveMarker 대신 이 함수를 씀
+	 */
+	void RemoveMarkerViews(UObject* Target, ENavigationMarkerFlags Views);
+
+	/** Target 마커를 표시 중인 뷰 플래그, 마커가 없으면 None (다른 위젯이 등록한 뷰를 유지하며 갱신할 때) */
+	ENavigationMarkerFlags GetMarkerViews(UObject* Target) const;
+
+	UFUNCTION(BlueprintPure, Category = "Navigation|Marker")
+	bool HasMarker(UObject* Target) const;
+
+	int32 GetNumMarkers() const { return MarkerKeys.Num(); }
+
+	// --- 뷰 ---
+
+	/** 레이어가 그릴 플레이어 등록/해제, 등록된 플레이어 뷰마다 매 프레임 투영 */
+	void RegisterView(APlayerController* Player);
+	void UnregisterView(APlayerController* Player);
+
+	/** 플레이어 뷰의 투영 결과, 등록하지 않은 플레이어면 nullptr */
+	const FNavigationMarkerProjection* FindProjection(const APlayerController* Player) const;
+
+	// --- 미니맵 경계 ---
+
+	/** 미니맵 좌하단/우상단 경계 액터 클래스 지정 (FMiniMapInfo::BottomLeftActor/TopRightActor) */
+	void SetMinimapBounds(TSubclassOf<AActor> BottomLeftClass, TSubclassOf<AActor> TopRightClass);
+
+	/** 두 경계 액터를 모두 찾았으면 true */
+	bool GetMinimapWorldBounds(FVector2D& OutBottomLeft, FVector2D& OutTopRight);
+
+	/** 클래스의 첫 액터, 클래스별로 캐시 (GetAllActorsOfClass 대체) */
+	AActor* FindBoundsActor(TSubclassOf<AActor> ActorClass);
+
+	// --- 마커 데이터 (SNavigationMarkerLayer가 읽음, 인덱스는 투영 결과와 같음) ---
+
+	TConstArrayView<uint8> GetMarkerFlags() const { return MarkerFlags; }
+	TConstArrayView<int32> GetMarkerBrushIndices() const { return MarkerBrushIndices; }
+	TConstArrayView<FLinearColor> GetMarkerColors() const { return MarkerColors; }
+	TConstArrayView<float> GetMarkerScales() const { return MarkerScales; }
+
+	const FSlateBrush* GetBrush(int32 BrushIndex) const { return Brushes.IsValidIndex(BrushIndex) ? &Brushes[BrushIndex] : nullptr; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 아이콘별 공유 브러시 인덱스, 아이콘이 없으면 INDEX_NONE */
+	int32 FindOrAddBrush(UObject* Icon);
+
+	/** 모든 배열에서 한 마커를 스왑 제거 */
+	void RemoveAtSwap(int32 Index);
+
+	/** 추적 대상 위치 갱신, 파괴된 대상의 마커는 제거 */
+	void UpdateWorldPositions();
+
+	/** 한 플레이어 뷰로 모든 마커 투영, 미니맵 경계는 플레이어와 무관하므로 호출 측에서 한 번 계산 */
+	void ProjectMarkers(FNavigationMarkerProjection& Projection, bool bHasMinimapBounds, const FVector2D& BoundsMin, const FVector2D& InvBoundsSize);
+
+	/** 못 찾았던 경계 액터 클래스를 다시 찾도록 캐시 항목 제거 (SpawnedActor가 nullptr이면 모든 클래스) */
+	void InvalidateMissingBoundsActors(const AActor* SpawnedActor);
+
+	void HandleActorSpawned(AActor* SpawnedActor);
+	void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	// --- 마커 (구조체 배열이 아닌 배열 구조체, 같은 인덱스가 같은 마커) ---
+
+	TArray<TObjectKey<UObject>> MarkerKeys;
+	TArray<TWeakObjectPtr<USceneComponent>> MarkerTargets;
+	TArray<FVector> WorldPositions;
+	TArray<int32> MarkerBrushIndices;
+	TArray<FLinearColor> MarkerColors;
+	TArray<float> MarkerScales;
+
+	// ENavigationMarkerFlags
+	TArray<uint8> MarkerFlags;
+
+	TMap<TObjectKey<UObject>, int32> KeyToIndex;
+
+	// --- 플레이어 뷰별 투영 결과 (분할 화면이 아니면 하나) ---
+
+	TArray<FNavigationMarkerProjection> Projections;
+
+	// --- 공유 브러시 ---
+
+	TArray<FSlateBrush> Brushes;
+
+	// 브러시가 참조하는 아이콘을 GC에서 보호
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> BrushResources;
+
+	TMap<TObjectKey<UObject>, int32> BrushIndexByIcon;
+
+	// --- 미니맵 경계 ---
+
+	UPROPERTY(Transient)
+	TSubclassOf<AActor> MinimapBottomLeftClass;
+
+	UPROPERTY(Transient)
+	TSubclassOf<AActor> MinimapTopRightClass;
+
+	struct FCachedBoundsActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		// 찾지 못한 클래스도 기록해서 매번 다시 찾지 않음 (해당 클래스가 스폰되거나 레벨이 추가되면 항목 제거)
+		bool bFound = false;
+	};
+
+	TMap<TObjectKey<UClass>, FCachedBoundsActor> BoundsActorCache;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+};
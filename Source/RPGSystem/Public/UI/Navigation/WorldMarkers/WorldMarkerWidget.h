@@ -250,6 +250,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config")
     FWorldMarkerInfo MarkerInfo;
 
+    // 추적 대상 오브젝트 (URPGHUDWidget::AddOrUpdateWorldMarker가 설정)
+    UPROPERTY(BlueprintReadOnly, Category = "Config")
+    TObjectPtr<UObject> MarkerObject;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config")
     float TextInterpSpeed;
 
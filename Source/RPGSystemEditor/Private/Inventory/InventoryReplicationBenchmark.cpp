@@ -0,0 +1,395 @@
+// Source/RPGSystemEditor/Private/Inventory/InventoryReplicationBenchmark.cpp
+
+#include "Inventory/InventoryReplicationBenchmark.h"
+
+bool UInventoryBenchmarkPackageMap::SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID)
+{
+    check(Ar.IsSaving());
+
+    // 0은 null, 실제 패키지 맵처럼 가변 길이 정수로 기록
+    uint32 NetGUID = Obj ? NetGUIDs.FindOrAdd(TObjectKey<UObject>(Obj), NetGUIDs.Num() + 1) : 0;
+    Ar.SerializeIntPacked(NetGUID);
+    return true;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Inventory/InventoryCoreComponent.h"
+#include "Item/Data/ItemDataStructure.h"
+#include "Item/Data/ItemDefinition.h"
+#include "Shared/RPGBenchmark.h"
+#include "Shared/RPGTestItems.h"
+#include "UObject/Package.h"
+
+namespace InventoryReplicationBenchmark
+{
+    constexpr int32 StashSlots = 200;
+    constexpr int32 NumContainers = 8;
+    constexpr int32 ContainerSlots = 40;
+
+    // 네트 업데이트 한 번 사이의 슬롯 변경 수
+    constexpr int32 ChangesPerUpdate = 32;
+    constexpr int32 NumUpdates = 300;
+    constexpr int32 Seed = 1337;
+
+    /**
+     * 항목 구조체를 프로퍼티 순서대로 기록 (RepLayout 대신 SerializeBin)
+     * 오브젝트 참조는 Writer의 패키지 맵을 거치므로 NetGUID 크기로 기록됨
+     * 인벤토리 엔트리는 슬롯 단위 복제 이전처럼 슬롯 배열 전체를 함께 기록
+     */
+    class FBenchmarkNetSerializeCB : public INetSerializeCB
+    {
+    public:
+        virtual void NetSerializeStruct(FNetDeltaSerializeInfo& Params) override
+        {
+            check(Params.Writer);
+            FArchive& Ar = *Params.Writer;
+
+            if (Params.Struct == FInventoryEntry::StaticStruct())
+            {
+                // Slots는 이제 NotReplicated이므로 직접 기록
+                FInventoryEntry& Entry = *static_cast<FInventoryEntry*>(Params.Data);
+                Ar << Entry.InventoryGuid;
+                FInventoryMetaData::StaticStruct()->SerializeBin(Ar, &Entry.MetaData);
+
+                int32 NumSlots = Entry.Slots.Num();
+                Ar << NumSlots;
+                for (FInventorySlot& Slot : Entry.Slots)
+                {
+                    FInventorySlot::StaticStruct()->SerializeBin(Ar, &Slot);
+                }
+                return;
+            }
+
+            Params.Struct->SerializeBin(Ar, Params.Data);
+        }
+
+        virtual void GatherGuidReferencesForFastArray(FFastArrayDeltaSerializeParams& Params) override {}
+        virtual bool MoveGuidToUnmappedForFastArray(FFastArrayDeltaSerializeParams& Params) override { return false; }
+        virtual void UpdateUnmappedGuidsForFastArray(FFastArrayDeltaSerializeParams& Params) override {}
+        virtual bool NetDeltaSerializeForFastArray(FFastArrayDeltaSerializeParams& Params) override { return false; }
+    };
+
+    /** 한 연결의 기준 상태를 유지하며 네트 업데이트마다 복제 목록(FInventorySlotList 또는 FInventoryList)을 델타 직렬화 */
+    template<typename TListType>
+    class TListDeltaWriter
+    {
+    public:
+        TListDeltaWriter()
+            : PackageMap(NewObject<UInventoryBenchmarkPackageMap>(GetTransientPackage()))
+        {
+        }
+
+        /** @return 이번 업데이트에 전송될 바이트 수 (바뀐 항목이 없으면 0) */
+        int64 Serialize(const TListType& ServerList, double& InOutMilliseconds)
+        {
+            // 서버 목록은 그대로 두고 사본을 직렬화 (델타 직렬화가 항목 맵 캐시를 갱신함)
+            TListType List = ServerList;
+
+            FNetBitWriter Writer(PackageMap.Get(), 8 * 1024);
+            TSharedPtr<INetDeltaBaseState> NewState;
+
+            FNetDeltaSerializeInfo Parms;
+            Parms.Writer = &Writer;
+            Parms.Map = PackageMap.Get();
+            Parms.NetSerializeCB = &NetSerializeCB;
+            Parms.OldState = OldState.Get();
+            Parms.NewState = &NewState;
+
+            const double Start = FPlatformTime::Seconds();
+            const bool bWroteSomething = List.NetDeltaSerialize(Parms);
+            InOutMilliseconds += (FPlatformTime::Seconds() - Start) * 1000.0;
+
+            if (NewState.IsValid())
+            {
+                OldState = NewState;
+            }
+
+            return bWroteSomething ? Writer.GetNumBytes() : 0;
+        }
+
+    private:
+        TStrongObjectPtr<UInventoryBenchmarkPackageMap> PackageMap;
+        FBenchmarkNetSerializeCB NetSerializeCB;
+        TSharedPtr<INetDeltaBaseState> OldState;
+    };
+
+    /** 서버 권한이 있는 액터에 등록된 인벤토리 컴포넌트 */
+    UInventoryCoreComponent* CreateInventoryComponent(UWorld* World)
+    {
+        AActor* Owner = World ? World->SpawnActor<AActor>() : nullptr;
+        if (!Owner)
+        {
+            return nullptr;
+        }
+
+        UInventoryCoreComponent* InventoryComp = NewObject<UInventoryCoreComponent>(Owner);
+        InventoryComp->RegisterComponent();
+        return InventoryComp;
+    }
+
+    FGuid CreateInventory(UInventoryCoreComponent* InventoryComp, const FString& Name, int32 NumSlots)
+    {
+        FInventoryCreateConfig Config;
+        Config.InventoryName = *Name;
+        Config.SlotCount = NumSlots;
+        Config.MaxSlots = NumSlots;
+        return InventoryComp->CreateInventory(Config);
+    }
+
+    int32 GetNumSlots(const UInventoryCoreComponent* InventoryComp, const FGuid& Guid)
+    {
+        const TArray<FInventorySlot>* Slots = InventoryComp->GetInventory(Guid);
+        return Slots ? Slots->Num() : 0;
+    }
+
+    /** 슬롯 단위 복제 이전의 엔트리 단위 복제: 서버 슬롯이 바뀐 인벤토리는 엔트리 전체를 dirty 마킹 */
+    void SyncWholeEntries(FInventoryList& WholeList, const UInventoryCoreComponent* InventoryComp, const TSet<FGuid>& TouchedGuids)
+    {
+        for (const FGuid& Guid : TouchedGuids)
+        {
+            FInventoryEntry* Entry = WholeList.FindInventoryByGuid(Guid);
+            const TArray<FInventorySlot>* Slots = InventoryComp->GetInventory(Guid);
+            if (Entry && Slots && Entry->Slots != *Slots)
+            {
+                Entry->Slots = *Slots;
+                Entry->NumSlots = Slots->Num();
+                WholeList.MarkItemDirty(*Entry);
+            }
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventoryReplicationBenchmark, "RPGSystem.Benchmark.Inventory.Replication",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FInventoryReplicationBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace InventoryReplicationBenchmark;
+
+    FRPGBenchmarkWorld World;
+    UInventoryCoreComponent* InventoryComp = CreateInventoryComponent(World.GetWorld());
+    if (!TestNotNull(TEXT("Inventory component"), InventoryComp))
+    {
+        return false;
+    }
+
+    const TArray<TStrongObjectPtr<UItemDefinition>> ItemDefs = RPGTestItems::CreateItemDefinitions();
+
+    TArray<FGuid> Guids;
+    Guids.Add(CreateInventory(InventoryComp, TEXT("Stash"), StashSlots));
+    for (int32 i = 0; i < NumContainers; ++i)
+    {
+        Guids.Add(CreateInventory(InventoryComp, FString::Printf(TEXT("Container_%d"), i), ContainerSlots));
+    }
+
+    // 가중치: 슬롯 수가 많은 인벤토리일수록 자주 변경
+    const auto PickSlot = [InventoryComp, &Guids](FRandomStream& Random, FGuid& OutGuid) -> int32
+    {
+        int32 Pick = Random.RandHelper(StashSlots + NumContainers * ContainerSlots);
+        for (const FGuid& Guid : Guids)
+        {
+            const int32 NumSlots = GetNumSlots(InventoryComp, Guid);
+            if (Pick < NumSlots)
+            {
+                OutGuid = Guid;
+                return Pick;
+            }
+            Pick -= NumSlots;
+        }
+        OutGuid = Guids[0];
+        return 0;
+    };
+
+    // 비교 기준: 같은 변경을 엔트리 단위로 복제하는 목록
+    FInventoryList WholeList;
+    for (const FGuid& Guid : Guids)
+    {
+        WholeList.AddInventory(Guid, *InventoryComp->GetMetaData(Guid), *InventoryComp->GetInventory(Guid));
+    }
+
+    TListDeltaWriter<FInventorySlotList> DeltaWriter;
+    TListDeltaWriter<FInventoryList> WholeWriter;
+    FRPGBenchmarkReport Report(TEXT("InventoryReplication"));
+    FRandomStream Random(Seed);
+    TSet<FGuid> TouchedGuids;
+
+    // 초기 상태는 이미 전송되었다고 가정
+    double InitialMs = 0.0;
+    DeltaWriter.Serialize(InventoryComp->GetReplicatedSlots(), InitialMs);
+    WholeWriter.Serialize(WholeList, InitialMs);
+
+    // 루트 스톰: 슬롯에 아이템 추가/제거
+    double LootMs = 0.0;
+    int64 LootBytes = 0;
+    double LootWholeMs = 0.0;
+    int64 LootWholeBytes = 0;
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        TouchedGuids.Reset();
+        for (int32 Change = 0; Change < ChangesPerUpdate; ++Change)
+        {
+            FGuid Guid;
+            const int32 SlotIndex = PickSlot(Random, Guid);
+            TouchedGuids.Add(Guid);
+
+            if (Random.FRand() < 0.6f)
+            {
+                InventoryComp->AddItemToInventory(Guid, ItemDefs[Random.RandHelper(ItemDefs.Num())].Get(), Random.RandRange(1, 20));
+            }
+            else
+            {
+                InventoryComp->RemoveItem(Guid, SlotIndex, Random.RandRange(1, 5));
+            }
+        }
+
+        LootBytes += DeltaWriter.Serialize(InventoryComp->GetReplicatedSlots(), LootMs);
+
+        SyncWholeEntries(WholeList, InventoryComp, TouchedGuids);
+        LootWholeBytes += WholeWriter.Serialize(WholeList, LootWholeMs);
+    }
+    Report.AddStage(TEXT("LootStorm"), LootMs, LootBytes);
+    Report.AddStage(TEXT("LootStormWholeEntry"), LootWholeMs, LootWholeBytes);
+
+    // 정리: 인벤토리 안/사이의 이동과 교환
+    double MoveSwapMs = 0.0;
+    int64 MoveSwapBytes = 0;
+    double MoveSwapWholeMs = 0.0;
+    int64 MoveSwapWholeBytes = 0;
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        TouchedGuids.Reset();
+        for (int32 Change = 0; Change < ChangesPerUpdate; ++Change)
+        {
+            FGuid FromGuid;
+            FGuid ToGuid;
+            const int32 FromSlot = PickSlot(Random, FromGuid);
+            const int32 ToSlot = PickSlot(Random, ToGuid);
+            TouchedGuids.Add(FromGuid);
+            TouchedGuids.Add(ToGuid);
+
+            if (Random.FRand() < 0.5f)
+            {
+                InventoryComp->MoveItem(FromGuid, FromSlot, ToGuid, ToSlot);
+            }
+            else
+            {
+                InventoryComp->SwapItems(FromGuid, FromSlot, ToGuid, ToSlot);
+            }
+        }
+
+        MoveSwapBytes += DeltaWriter.Serialize(InventoryComp->GetReplicatedSlots(), MoveSwapMs);
+
+        SyncWholeEntries(WholeList, InventoryComp, TouchedGuids);
+        MoveSwapWholeBytes += WholeWriter.Serialize(WholeList, MoveSwapWholeMs);
+    }
+    Report.AddStage(TEXT("MoveSwap"), MoveSwapMs, MoveSwapBytes);
+    Report.AddStage(TEXT("MoveSwapWholeEntry"), MoveSwapWholeMs, MoveSwapWholeBytes);
+
+    TestTrue(TEXT("Loot storm replicated slot changes"), LootBytes > 0);
+    TestTrue(TEXT("Moves and swaps replicated slot changes"), MoveSwapBytes > 0);
+    TestTrue(TEXT("Per-slot replication sends less than whole entries"),
+        LootBytes < LootWholeBytes && MoveSwapBytes < MoveSwapWholeBytes);
+
+    const auto PerUpdate = [](int64 Bytes) { return static_cast<double>(Bytes) / NumUpdates; };
+    const auto Ratio = [](int64 Bytes, int64 WholeBytes) { return WholeBytes > 0 ? 100.0 * Bytes / WholeBytes : 0.0; };
+
+    AddInfo(FString::Printf(TEXT("Loot storm: %.1f bytes per update per slot, %.1f whole entry (%.1f%%)"),
+        PerUpdate(LootBytes), PerUpdate(LootWholeBytes), Ratio(LootBytes, LootWholeBytes)));
+    AddInfo(FString::Printf(TEXT("Move/swap: %.1f bytes per update per slot, %.1f whole entry (%.1f%%)"),
+        PerUpdate(MoveSwapBytes), PerUpdate(MoveSwapWholeBytes), Ratio(MoveSwapBytes, MoveSwapWholeBytes)));
+
+    return Report.Submit(*this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventorySlotReplicationTest, "RPGSystem.Inventory.SlotReplication",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInventorySlotReplicationTest::RunTest(const FString& Parameters)
+{
+    using namespace InventoryReplicationBenchmark;
+
+    constexpr int32 NumSlots = 16;
+    constexpr int32 NumOps = 2000;
+
+    FRPGBenchmarkWorld World;
+    UInventoryCoreComponent* InventoryComp = CreateInventoryComponent(World.GetWorld());
+    if (!TestNotNull(TEXT("Inventory component"), InventoryComp))
+    {
+        return false;
+    }
+
+    const TArray<TStrongObjectPtr<UItemDefinition>> ItemDefs = RPGTestItems::CreateItemDefinitions();
+    const TArray<FGuid> Guids = { CreateInventory(InventoryComp, TEXT("Main"), NumSlots), CreateInventory(InventoryComp, TEXT("Storage"), NumSlots) };
+
+    // 복제 항목만으로 만든 클라이언트 슬롯이 서버 슬롯과 같은지 검사
+    const auto CheckReplicatedSlots = [this, InventoryComp, &Guids](int32 Op) -> bool
+    {
+        for (const FGuid& Guid : Guids)
+        {
+            const TArray<FInventorySlot>& ServerSlots = *InventoryComp->GetInventory(Guid);
+
+            TArray<FInventorySlot> EmptySlots;
+            EmptySlots.SetNum(ServerSlots.Num());
+            FInventoryEntry ClientEntry(Guid, *InventoryComp->GetMetaData(Guid), EmptySlots);
+            InventoryComp->GetReplicatedSlots().ApplyToEntry(ClientEntry);
+
+            for (int32 i = 0; i < ServerSlots.Num(); ++i)
+            {
+                const FInventorySlot& ServerSlot = ServerSlots[i];
+                const FInventorySlot& ClientSlot = ClientEntry.Slots[i];
+                const bool bSameContent = ServerSlot.IsEmpty() ? ClientSlot.IsEmpty()
+                    : ClientSlot.ItemInstance == ServerSlot.ItemInstance && ClientSlot.Quantity == ServerSlot.Quantity;
+
+                if (ServerSlot.SlotIndex != i || !bSameContent)
+                {
+                    AddError(FString::Printf(TEXT("Op %d: slot %d differs (server index %d qty %d, client qty %d)"),
+                        Op, i, ServerSlot.SlotIndex, ServerSlot.Quantity, ClientSlot.Quantity));
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    FRandomStream Random(Seed);
+    for (int32 i = 0; i < NumSlots; ++i)
+    {
+        InventoryComp->AddItemToInventory(Guids[0], ItemDefs[Random.RandHelper(ItemDefs.Num())].Get(), Random.RandRange(1, 10));
+    }
+
+    for (int32 Op = 0; Op < NumOps; ++Op)
+    {
+        const FGuid FromGuid = Guids[Random.RandHelper(Guids.Num())];
+        const FGuid ToGuid = Guids[Random.RandHelper(Guids.Num())];
+        const int32 FromSlot = Random.RandHelper(NumSlots);
+        const int32 ToSlot = Random.RandHelper(NumSlots);
+
+        switch (Random.RandHelper(4))
+        {
+        case 0:
+            InventoryComp->MoveItem(FromGuid, FromSlot, ToGuid, ToSlot);
+            break;
+        case 1:
+            InventoryComp->SwapItems(FromGuid, FromSlot, ToGuid, ToSlot);
+            break;
+        case 2:
+            InventoryComp->RemoveItem(FromGuid, FromSlot, Random.RandRange(1, 3));
+            break;
+        default:
+            InventoryComp->AddItemToInventory(FromGuid, ItemDefs[Random.RandHelper(ItemDefs.Num())].Get(), Random.RandRange(1, 5));
+            break;
+        }
+
+        if (!CheckReplicatedSlots(Op))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,36 @@
+// Source/RPGSystemEditor/Private/Inventory/InventoryReplicationBenchmark.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/CoreNet.h"
+#include "UObject/ObjectKey.h"
+#include "InventoryReplicationBenchmark.generated.h"
+
+/**
+ * 인벤토리 복제 자동화 테스트
+ *
+ * - RPGSystem.Benchmark.Inventory.Replication
+ *	서버 인벤토리 컴포넌트에 루트 스톰(추가/제거)과 이동/교환을 적용하고,
+ *	네트 업데이트마다 FInventorySlotList::NetDeltaSerialize가 실제로 쓴 바이트를 기록 (기준 비교는 Shared/RPGBenchmark.h)
+ *	같은 변경을 엔트리 단위 복제(FInventoryList, 바뀐 인벤토리의 슬롯 전체 전송)로도 직렬화해 두 값을 함께 보고
+ * - RPGSystem.Inventory.SlotReplication
+ *	이동/교환 후 복제 항목을 빈 클라이언트 엔트리에 적용한 결과가 서버 슬롯과 같은지 검사
+ *
+ * 에디터 모듈에 있으므로 아래 패키지 맵은 게임과 함께 배포되지 않음
+ */
+
+/**
+ * 벤치마크 전용 패키지 맵 (쓰기 전용)
+ * 오브젝트 참조를 처음 본 순서로 매긴 NetGUID로 기록, 처음 보내는 오브젝트의 경로 export는 제외
+ */
+UCLASS(Transient)
+class UInventoryBenchmarkPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override;
+
+private:
+	TMap<TObjectKey<UObject>, uint32> NetGUIDs;
+};
@@ -0,0 +1,329 @@
+﻿// Source/RPGSystemEditor/Private/Minimap/MinimapTileSlicer.cpp
+#include "Minimap/MinimapTileSlicer.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "ContentBrowserMenuContexts.h"
+#include "Engine/Texture2D.h"
+#include "HAL/IConsoleManager.h"
+#include "ImageCore.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ToolMenus.h"
+#include "UI/Navigation/Minimap/MinimapTileSet.h"
+
+#define LOCTEXT_NAMESPACE "MinimapTileSlicer"
+
+static TAutoConsoleVariable<int32> CVarMinimapSliceTileSize(
+	TEXT("RPGMinimap.SliceTileSize"),
+	256,
+	TEXT("Tile size (pixels) used by Build Minimap Tile Pyramid."));
+
+namespace MinimapTileSlicer
+{
+	// 2x2 평균으로 절반 크기 (홀수 크기의 마지막 행/열은 그대로 한 번 더 사용)
+	void Downsample(const TArray64<FColor>& Src, int32 SrcX, int32 SrcY, TArray64<FColor>& Dst, int32& DstX, int32& DstY)
+	{
+		DstX = FMath::Max(1, (SrcX + 1) / 2);
+		DstY = FMath::Max(1, (SrcY + 1) / 2);
+		Dst.SetNumUninitialized(static_cast<int64>(DstX) * DstY);
+
+		for (int32 Y = 0; Y < DstY; ++Y)
+		{
+			const int32 Y0 = FMath::Min(Y * 2, SrcY - 1);
+			const int32 Y1 = FMath::Min(Y * 2 + 1, SrcY - 1);
+
+			for (int32 X = 0; X < DstX; ++X)
+			{
+				const int32 X0 = FMath::Min(X * 2, SrcX - 1);
+				const int32 X1 = FMath::Min(X * 2 + 1, SrcX - 1);
+
+				const FColor& A = Src[static_cast<int64>(Y0) * SrcX + X0];
+				const FColor& B = Src[static_cast<int64>(Y0) * SrcX + X1];
+				const FColor& C = Src[static_cast<int64>(Y1) * SrcX + X0];
+				const FColor& D = Src[static_cast<int64>(Y1) * SrcX + X1];
+
+				Dst[static_cast<int64>(Y) * DstX + X] = FColor(
+					static_cast<uint8>((A.R + B.R + C.R + D.R + 2) / 4),
+					static_cast<uint8>((A.G + B.G + C.G + D.G + 2) / 4),
+					static_cast<uint8>((A.B + B.B + C.B + D.B + 2) / 4),
+					static_cast<uint8>((A.A + B.A + C.A + D.A + 2) / 4));
+			}
+		}
+	}
+
+	// 이미지 밖은 투명으로 채움
+	void CopyTile(const TArray64<FColor>& LevelPixels, int32 SizeX, int32 SizeY, int32 TileX, int32 TileY, int32 TileSize, TArray<FColor>& OutTile)
+	{
+		OutTile.Init(FColor(0, 0, 0, 0), TileSize * TileSize);
+
+		const int32 StartX = TileX * TileSize;
+		const int32 StartY = TileY * TileSize;
+		const int32 CopyX = FMath::Min(TileSize, SizeX - StartX);
+		const int32 CopyY = FMath::Min(TileSize, SizeY - StartY);
+
+		for (int32 Row = 0; Row < CopyY; ++Row)
+		{
+			FMemory::Memcpy(
+				&OutTile[Row * TileSize],
+				&LevelPixels[static_cast<int64>(StartY + Row) * SizeX + StartX],
+				CopyX * sizeof(FColor));
+		}
+	}
+
+	UTexture2D* CreateOrUpdateTileTexture(const FString& PackageName, const FString& AssetName, int32 TileSize, const TArray<FColor>& Pixels)
+	{
+		UPackage* Package = CreatePackage(*PackageName);
+		if (!Package)
+		{
+			return nullptr;
+		}
+		Package->FullyLoad();
+
+		UTexture2D* Texture = FindObject<UTexture2D>(Package, *AssetName);
+		const bool bCreated = Texture == nullptr;
+		if (bCreated)
+		{
+			Texture = NewObject<UTexture2D>(Package, *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+		}
+		else
+		{
+			Texture->PreEditChange(nullptr);
+		}
+
+		Texture->Source.Init(TileSize, TileSize, 1, 1, TSF_BGRA8, reinterpret_cast<const uint8*>(Pixels.GetData()));
+
+		// 타일 캐시가 상주 여부를 관리하므로 밉/스트리밍 없이, 예산을 아끼도록 기본 압축
+		Texture->CompressionSettings = TextureCompressionSettings::TC_Default;
+		Texture->LODGroup = TextureGroup::TEXTUREGROUP_UI;
+		Texture->MipGenSettings = TextureMipGenSettings::TMGS_NoMipmaps;
+		Texture->NeverStream = true;
+		Texture->SRGB = true;
+		Texture->AddressX = TextureAddress::TA_Clamp;
+		Texture->AddressY = TextureAddress::TA_Clamp;
+
+		Texture->PostEditChange();
+
+		if (bCreated)
+		{
+			FAssetRegistryModule::AssetCreated(Texture);
+		}
+		Package->MarkPackageDirty();
+
+		return Texture;
+	}
+
+	void ExecuteBuildFromContext(const FToolMenuContext& InContext)
+	{
+		const UContentBrowserAssetContextMenuContext* Context = InContext.FindContext<UContentBrowserAssetContextMenuContext>();
+		if (!Context)
+		{
+			return;
+		}
+
+		const int32 TileSize = CVarMinimapSliceTileSize.GetValueOnGameThread();
+		for (UTexture2D* SourceTexture : Context->LoadSelectedObjects<UTexture2D>())
+		{
+			FMinimapTileSlicer::BuildTilePyramid(SourceTexture, TileSize);
+		}
+	}
+}
+
+UMinimapTileSet* FMinimapTileSlicer::BuildTilePyramid(UTexture2D* SourceTexture, int32 TileSize)
+{
+	if (!SourceTexture || TileSize < 16)
+	{
+		UE_LOG(LogTemp, Error, TEXT(">> [MinimapTileSlicer] 원본 텍스처가 없거나 TileSize(%d)가 너무 작습니다."), TileSize);
+		return nullptr;
+	}
+
+	// 원본 소스 데이터를 BGRA8 sRGB로
+	FImage SourceImage;
+	if (!SourceTexture->Source.IsValid() || !SourceTexture->Source.GetMipImage(SourceImage, 0, 0, 0))
+	{
+		UE_LOG(LogTemp, Error, TEXT(">> [MinimapTileSlicer] %s 의 소스 데이터를 읽을 수 없습니다."), *SourceTexture->GetName());
+		return nullptr;
+	}
+	SourceImage.ChangeFormat(ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+
+	int32 LevelX = SourceImage.SizeX;
+	int32 LevelY = SourceImage.SizeY;
+	const TArrayView64<FColor> SourcePixels = SourceImage.AsBGRA8();
+	TArray64<FColor> LevelPixels(SourcePixels.GetData(), SourcePixels.Num());
+	SourceImage = FImage();
+
+	// 진행 표시용 전체 타일 수
+	int32 NumLevels = 0;
+	int32 TotalTiles = 0;
+	for (int32 X = LevelX, Y = LevelY; ; X = FMath::Max(1, (X + 1) / 2), Y = FMath::Max(1, (Y + 1) / 2))
+	{
+		++NumLevels;
+		TotalTiles += FMath::DivideAndRoundUp(X, TileSize) * FMath::DivideAndRoundUp(Y, TileSize);
+		if (X <= TileSize && Y <= TileSize)
+		{
+			break;
+		}
+	}
+
+	const FIntPoint SourceSize(LevelX, LevelY);
+	const FString SourceName = SourceTexture->GetName();
+	const FString FolderPath = FPackageName::GetLongPackagePath(SourceTexture->GetOutermost()->GetName());
+	const FString TileFolderPath = FolderPath / (SourceName + TEXT("_Tiles"));
+
+	// 취소하면 인덱스 에셋을 건드리지 않도록 단계 목록은 따로 만들고 마지막에 반영
+	TArray<FMinimapTileLevel> Levels;
+	Levels.Reserve(NumLevels);
+
+	FScopedSlowTask SlowTask(TotalTiles, FText::Format(LOCTEXT("Slicing", "Building minimap tile pyramid for {0}"), FText::FromString(SourceName)));
+	SlowTask.MakeDialog(true);
+
+	TArray<FColor> TilePixels;
+	TArray64<FColor> NextLevelPixels;
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		FMinimapTileLevel& TileLevel = Levels.AddDefaulted_GetRef();
+		TileLevel.NumTilesX = FMath::DivideAndRoundUp(LevelX, TileSize);
+		TileLevel.NumTilesY = FMath::DivideAndRoundUp(LevelY, TileSize);
+		TileLevel.Tiles.Reserve(TileLevel.NumTilesX * TileLevel.NumTilesY);
+
+		for (int32 TileY = 0; TileY < TileLevel.NumTilesY; ++TileY)
+		{
+			for (int32 TileX = 0; TileX < TileLevel.NumTilesX; ++TileX)
+			{
+				if (SlowTask.ShouldCancel())
+				{
+					UE_LOG(LogTemp, Warning, TEXT(">> [MinimapTileSlicer] %s 취소됨, 인덱스는 갱신하지 않습니다."), *SourceName);
+					return nullptr;
+				}
+				SlowTask.EnterProgressFrame(1.0f);
+
+				MinimapTileSlicer::CopyTile(LevelPixels, LevelX, LevelY, TileX, TileY, TileSize, TilePixels);
+
+				const FString TileName = FString::Printf(TEXT("%s_L%d_%d_%d"), *SourceName, Level, TileX, TileY);
+				UTexture2D* TileTexture = MinimapTileSlicer::CreateOrUpdateTileTexture(TileFolderPath / TileName, TileName, TileSize, TilePixels);
+				TileLevel.Tiles.Add(TileTexture);
+			}
+		}
+
+		if (Level + 1 < NumLevels)
+		{
+			MinimapTileSlicer::Downsample(LevelPixels, LevelX, LevelY, NextLevelPixels, LevelX, LevelY);
+			Swap(LevelPixels, NextLevelPixels);
+		}
+	}
+
+	// 인덱스 에셋
+	const FString TileSetName = SourceName + TEXT("_TileSet");
+	UPackage* TileSetPackage = CreatePackage(*(FolderPath / TileSetName));
+	TileSetPackage->FullyLoad();
+
+	UMinimapTileSet* TileSet = FindObject<UMinimapTileSet>(TileSetPackage, *TileSetName);
+	const bool bCreatedTileSet = TileSet == nullptr;
+	if (bCreatedTileSet)
+	{
+		TileSet = NewObject<UMinimapTileSet>(TileSetPackage, *TileSetName, RF_Public | RF_Standalone | RF_Transactional);
+	}
+	TileSet->Modify();
+	TileSet->TileSize = TileSize;
+	TileSet->SourceSize = SourceSize;
+	TileSet->SourceTexture = SourceTexture;
+	TileSet->Levels = MoveTemp(Levels);
+
+	TileSet->PostEditChange();
+	if (bCreatedTileSet)
+	{
+		FAssetRegistryModule::AssetCreated(TileSet);
+	}
+	TileSetPackage->MarkPackageDirty();
+
+	UE_LOG(LogTemp, Log, TEXT(">> [MinimapTileSlicer] %s: %d단계, 타일 %d개 (%dpx) -> %s"),
+		*SourceName, NumLevels, TotalTiles, TileSize, *TileSet->GetPathName());
+
+	return TileSet;
+}
+
+void FMinimapTileSlicer::RegisterMenus()
+{
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("ContentBrowser.AssetContextMenu.Texture2D");
+	if (!Menu)
+	{
+		return;
+	}
+
+	FToolMenuSection& Section = Menu->FindOrAddSection("GetAssetActions");
+	Section.AddMenuEntry(
+		"BuildMinimapTilePyramid",
+		LOCTEXT("BuildMinimapTilePyramid", "Build Minimap Tile Pyramid"),
+		LOCTEXT("BuildMinimapTilePyramidTooltip", "Slice this minimap capture into fixed-size tiles at every zoom level and write a UMinimapTileSet index next to it."),
+		FSlateIcon(),
+		FToolMenuExecuteAction::CreateStatic(&MinimapTileSlicer::ExecuteBuildFromContext));
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+/**
+ * 홀수 크기에서 마지막 행/열을 한 번 더 써서 평균하는지 검사
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinimapTileSlicerDownsampleTest, "RPGSystem.Minimap.TileSlicer.Downsample",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinimapTileSlicerDownsampleTest::RunTest(const FString& Parameters)
+{
+	// R은 열, G는 행을 40 단위로 인코딩
+	const auto MakeImage = [](int32 SizeX, int32 SizeY)
+	{
+		TArray64<FColor> Pixels;
+		Pixels.SetNumUninitialized(static_cast<int64>(SizeX) * SizeY);
+		for (int32 Y = 0; Y < SizeY; ++Y)
+		{
+			for (int32 X = 0; X < SizeX; ++X)
+			{
+				Pixels[static_cast<int64>(Y) * SizeX + X] = FColor(static_cast<uint8>(X * 40), static_cast<uint8>(Y * 40), 128, 255);
+			}
+		}
+		return Pixels;
+	};
+
+	const auto TestPixel = [this](const TCHAR* What, const TArray64<FColor>& Pixels, int32 SizeX, int32 X, int32 Y, const FColor& Expected)
+	{
+		const FColor& Actual = Pixels[static_cast<int64>(Y) * SizeX + X];
+		TestEqual(FString::Printf(TEXT("%s pixel (%d, %d)"), What, X, Y), Actual, Expected);
+	};
+
+	TArray64<FColor> Dst;
+	int32 DstX = 0;
+	int32 DstY = 0;
+
+	// 3x3 -> 2x2, 마지막 열/행은 자기 자신과 평균
+	MinimapTileSlicer::Downsample(MakeImage(3, 3), 3, 3, Dst, DstX, DstY);
+	if (TestEqual(TEXT("3x3 width"), DstX, 2) && TestEqual(TEXT("3x3 height"), DstY, 2) && TestEqual(TEXT("3x3 pixels"), Dst.Num(), static_cast<int64>(4)))
+	{
+		TestPixel(TEXT("3x3"), Dst, DstX, 0, 0, FColor(20, 20, 128, 255));
+		TestPixel(TEXT("3x3"), Dst, DstX, 1, 0, FColor(80, 20, 128, 255));
+		TestPixel(TEXT("3x3"), Dst, DstX, 0, 1, FColor(20, 80, 128, 255));
+		TestPixel(TEXT("3x3"), Dst, DstX, 1, 1, FColor(80, 80, 128, 255));
+	}
+
+	// 5x1 -> 3x1, 높이는 1 유지
+	MinimapTileSlicer::Downsample(MakeImage(5, 1), 5, 1, Dst, DstX, DstY);
+	if (TestEqual(TEXT("5x1 width"), DstX, 3) && TestEqual(TEXT("5x1 height"), DstY, 1))
+	{
+		TestPixel(TEXT("5x1"), Dst, DstX, 0, 0, FColor(20, 0, 128, 255));
+		TestPixel(TEXT("5x1"), Dst, DstX, 1, 0, FColor(100, 0, 128, 255));
+		TestPixel(TEXT("5x1"), Dst, DstX, 2, 0, FColor(160, 0, 128, 255));
+	}
+
+	// 1x1은 그대로
+	MinimapTileSlicer::Downsample(MakeImage(1, 1), 1, 1, Dst, DstX, DstY);
+	if (TestEqual(TEXT("1x1 width"), DstX, 1) && TestEqual(TEXT("1x1 height"), DstY, 1))
+	{
+		TestPixel(TEXT("1x1"), Dst, DstX, 0, 0, FColor(0, 0, 128, 255));
+	}
+
+	return true;
+}
+
+#endif
@@ -14,6 +14,8 @@
 #include "Debugger/SInventoryDebugger.h"
 #include "Debugger/SQuestDebugger.h"
 #include "Debugger/SStatsDebugger.h"
+#include "Minimap/MinimapTileSlicer.h"
+#include "ToolMenus.h"
 
 static const FName LocomotionDebuggerTabName("LocomotionDebugger");
 static const FName ItemDebuggerTabName("ItemDebugger");
@@ -39,14 +41,27 @@ void FRPGSystemEditorModule::StartupModule()
 	LevelEditorModule.GetGlobalLevelEditorActions()->Append(PluginCommands.ToSharedRef());
 	
 	RegisterTabSpawners();
+
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FRPGSystemEditorModule::RegisterMenus));
 }
 
 void FRPGSystemEditorModule::ShutdownModule()
 {
+	UToolMenus::UnRegisterStartupCallback(this);
+	UToolMenus::UnregisterOwner(this);
+
 	UnregisterTabSpawners();
 	FRPGEditorCommands::Unregister();
 }
 
+void FRPGSystemEditorModule::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(this);
+
+	// 텍스처 우클릭 > Build Minimap Tile Pyramid
+	FMinimapTileSlicer::RegisterMenus();
+}
+
 void FRPGSystemEditorModule::RegisterTabSpawners()
 {
 	auto& TabManager = FGlobalTabmanager::Get();
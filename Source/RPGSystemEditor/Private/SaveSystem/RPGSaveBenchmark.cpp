@@ -0,0 +1,404 @@
+// Source/RPGSystemEditor/Private/SaveSystem/RPGSaveBenchmark.cpp
+
+#include "SaveSystem/RPGSaveBenchmark.h"
+#include "Components/SceneComponent.h"
+#include "Math/RandomStream.h"
+
+/**
+FRPGSaveBenchmarkPayload
+**/
+
+void FRPGSaveBenchmarkPayload::Fill(const int32 InSeed, const int32 Size)
+{
+	Seed = InSeed;
+
+	FRandomStream Stream(InSeed);
+	Bytes.SetNumUninitialized(Size);
+
+	for (uint8& Byte : Bytes)
+	{
+		Byte = uint8(Stream.RandRange(0, 15));
+	}
+}
+
+bool FRPGSaveBenchmarkPayload::Matches(const int32 InSeed, const int32 Size) const
+{
+	if (Seed != InSeed || Bytes.Num() != Size)
+	{
+		return false;
+	}
+
+	FRandomStream Stream(InSeed);
+	for (const uint8 Byte : Bytes)
+	{
+		if (Byte != uint8(Stream.RandRange(0, 15)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FRPGSaveBenchmarkPayload::Clear()
+{
+	Bytes.Reset();
+	Seed = INDEX_NONE;
+}
+
+/**
+Benchmark Classes
+**/
+
+ARPGSaveBenchmarkActor::ARPGSaveBenchmarkActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void URPGSaveBenchmarkComponent::FillPayload(const int32 InSeed, const int32 Size)
+{
+	Payload.Fill(InSeed, Size);
+	bSaveDirty = true;
+}
+
+ARPGSaveBenchmarkPawn::ARPGSaveBenchmarkPawn()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+/**
+Automation Test
+**/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "SaveSystem/Async/RPGAsyncLoadGame.h"
+#include "SaveSystem/Data/RPGSaveMisc.h"
+#include "SaveSystem/Subsystem/RPGSaveSubsystem.h"
+#include "Shared/RPGBenchmark.h"
+
+namespace SaveBenchmark
+{
+	//Every n-th actor changes before the delta save (5%), half of them through the actor, half through a component
+	constexpr int32 ChangedStep = 20;
+
+	//Upper bound for the async load, the test fails when it is reached
+	constexpr int32 MaxLoadFrames = 600;
+
+	static const TCHAR* SlotName = TEXT("RPGSaveBenchmark");
+
+	static int64 GetSaveFileSize(const FString& SaveFile)
+	{
+		return IFileManager::Get().FileSize(*FString::Printf(RPGSave::NativeDesktopSavePath, *FPaths::ProjectSavedDir(), *SaveFile));
+	}
+
+	static FName GetComponentName(const int32 ComponentIndex)
+	{
+		return FName(TEXT("RPGSaveBenchmarkComponent"), ComponentIndex + 1);
+	}
+
+	static URPGSaveBenchmarkComponent* FindComponent(const AActor* Actor, const int32 ComponentIndex)
+	{
+		return FindObjectFast<URPGSaveBenchmarkComponent>(const_cast<AActor*>(Actor), GetComponentName(ComponentIndex));
+	}
+
+	//Seeds of changed payloads, never equal to an initial seed
+	static int32 ChangedSeed(const int32 Seed)
+	{
+		return ~Seed;
+	}
+
+	struct FState
+	{
+		FRPGBenchmarkWorld World;
+		FRPGBenchmarkReport Report = FRPGBenchmarkReport(TEXT("SaveRoundTrip"));
+
+		int32 NumActors = 0;
+		int32 NumComponents = 0;
+		int32 PayloadSize = 0;
+
+		TArray<TWeakObjectPtr<ARPGSaveBenchmarkActor>> Actors;
+		TWeakObjectPtr<URPGSaveSubsystem> Subsystem;
+		TWeakObjectPtr<URPGAsyncLoadGame> LoadTask;
+
+		FString PreviousSlot;
+		bool bPreviousDeltaSaving = false;
+		double LoadMs = 0.0;
+		int32 LoadFrames = 0;
+
+		int32 GetActorSeed(const int32 Index) const
+		{
+			return Index % ChangedStep == 0 ? ChangedSeed(Index) : Index;
+		}
+
+		int32 GetComponentSeed(const int32 Index, const int32 ComponentIndex) const
+		{
+			const int32 Seed = NumActors + Index * NumComponents + ComponentIndex;
+			return Index % ChangedStep == ChangedStep / 2 && ComponentIndex == 0 ? ChangedSeed(Seed) : Seed;
+		}
+
+		~FState()
+		{
+			URPGSaveProjectSetting::Get()->bDeltaLevelSaving = bPreviousDeltaSaving;
+
+			if (URPGSaveSubsystem* SaveSubsystem = Subsystem.Get())
+			{
+				SaveSubsystem->DeleteAllSaveDataForSlot(SlotName);
+				SaveSubsystem->SetCurrentSaveGameName(PreviousSlot);
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRPGSaveRoundTripBenchmark, "RPGSystem.Benchmark.Save.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FRPGSaveRoundTripBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SaveBenchmark;
+
+	const TSharedRef<FState> State = MakeShared<FState>();
+	State->NumActors = State->Report.GetParameter(TEXT("RPGSaveBenchmarkActors"), 2000);
+	State->NumComponents = State->Report.GetParameter(TEXT("RPGSaveBenchmarkComponents"), 2);
+	State->PayloadSize = State->Report.GetParameter(TEXT("RPGSaveBenchmarkPayload"), 512);
+
+	const int32 NumActors = State->NumActors;
+	const int32 NumComponents = State->NumComponents;
+	const int32 PayloadSize = State->PayloadSize;
+
+	UWorld* World = State->World.GetWorld();
+	URPGSaveSubsystem* Subsystem = State->World.GetGameInstance()->GetSubsystem<URPGSaveSubsystem>();
+	if (!TestNotNull(TEXT("Save Subsystem"), Subsystem))
+	{
+		return false;
+	}
+
+	//Own slot, so the test neither reads nor overwrites real save data
+	State->Subsystem = Subsystem;
+	State->PreviousSlot = Subsystem->GetCurrentSaveGameName();
+	Subsystem->SetCurrentSaveGameName(SlotName);
+	Subsystem->DeleteAllSaveDataForSlot(SlotName);
+
+	//Delta saving is off by default, the delta stage needs it from the first save on, so the full save becomes the base
+	State->bPreviousDeltaSaving = URPGSaveProjectSetting::Get()->bDeltaLevelSaving;
+	URPGSaveProjectSetting::Get()->bDeltaLevelSaving = true;
+
+	APlayerController* PlayerController = State->World.SpawnPlayer(ARPGSaveBenchmarkPawn::StaticClass(), FTransform(FVector(0.f, 0.f, 100.f)));
+	ARPGSaveBenchmarkPawn* Pawn = PlayerController ? Cast<ARPGSaveBenchmarkPawn>(PlayerController->GetPawn()) : nullptr;
+	if (!TestNotNull(TEXT("Possessed player pawn"), Pawn))
+	{
+		return false;
+	}
+
+	const int32 PawnSeed = NumActors * (NumComponents + 1);
+	Pawn->Payload.Fill(PawnSeed, PayloadSize);
+
+	State->Actors.Reserve(NumActors);
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = FName(TEXT("RPGSaveBenchmarkActor"), Index + 1);
+
+		ARPGSaveBenchmarkActor* Actor = World->SpawnActor<ARPGSaveBenchmarkActor>(FVector(Index, 0.f, 0.f), FRotator::ZeroRotator, SpawnParams);
+		if (!TestNotNull(TEXT("Spawned save actor"), Actor))
+		{
+			return false;
+		}
+
+		Actor->Payload.Fill(Index, PayloadSize);
+
+		for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+		{
+			URPGSaveBenchmarkComponent* Component = NewObject<URPGSaveBenchmarkComponent>(Actor, GetComponentName(ComponentIndex));
+			Component->RegisterComponent();
+			Component->FillPayload(NumActors + Index * NumComponents + ComponentIndex, PayloadSize);
+		}
+
+		State->Actors.Add(Actor);
+	}
+
+	const uint32 LevelFlags = ENUM_TO_FLAG(ESaveTypeFlags::SF_Level);
+
+	//Same calls as the save task, without its frame delays
+	bool bFullSaved = false;
+	const double FullMs = State->Report.Measure(TEXT("LevelSaveFull"), [&]()
+	{
+		Subsystem->PrepareLoadAndSaveActors(LevelFlags, EAsyncCheckType::CT_Save, EPrepareType::PT_Default);
+		bFullSaved = Subsystem->SaveLevelActors(false);
+		return GetSaveFileSize(Subsystem->ActorSaveFile());
+	});
+
+	if (!TestTrue(TEXT("Full level save"), bFullSaved))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		ARPGSaveBenchmarkActor* Actor = State->Actors[Index].Get();
+
+		if (Index % ChangedStep == 0)
+		{
+			Actor->Payload.Fill(State->GetActorSeed(Index), PayloadSize);
+			Subsystem->MarkActorSaveDirty(Actor);
+		}
+		else if (Index % ChangedStep == ChangedStep / 2 && NumComponents > 0)
+		{
+			//Not marked, the component reports itself dirty
+			FindComponent(Actor, 0)->FillPayload(State->GetComponentSeed(Index, 0), PayloadSize);
+		}
+	}
+
+	bool bDeltaSaved = false;
+	State->Report.Measure(TEXT("LevelSaveDelta"), [&]()
+	{
+		Subsystem->PrepareLoadAndSaveActors(LevelFlags, EAsyncCheckType::CT_Save, EPrepareType::PT_Default);
+		bDeltaSaved = Subsystem->SaveLevelActors(false);
+		return GetSaveFileSize(Subsystem->ActorDeltaSaveFile());
+	});
+
+	if (!TestTrue(TEXT("Delta level save"), bDeltaSaved))
+	{
+		return false;
+	}
+
+	const FRPGBenchmarkStage* FullStage = State->Report.FindStage(TEXT("LevelSaveFull"));
+	const FRPGBenchmarkStage* DeltaStage = State->Report.FindStage(TEXT("LevelSaveDelta"));
+	TestTrue(TEXT("Delta file is smaller than the full file"), DeltaStage->Bytes > 0 && DeltaStage->Bytes < FullStage->Bytes);
+	AddInfo(FString::Printf(TEXT("Delta save %.1f%% of the full save time"), FullMs > 0.0 ? DeltaStage->Milliseconds / FullMs * 100.0 : 0.0));
+
+	//Reused records still fire the save events
+	int32 NumMissedSaveEvents = 0;
+	for (const TWeakObjectPtr<ARPGSaveBenchmarkActor>& Actor : State->Actors)
+	{
+		NumMissedSaveEvents += Actor->NumSaved != 2;
+	}
+	TestEqual(TEXT("Actors without two 'Actor Saved' events"), NumMissedSaveEvents, 0);
+
+	//Player file, same calls as the save and load tasks
+	bool bPlayerSaved = false;
+	State->Report.Measure(TEXT("PlayerSave"), [&]()
+	{
+		bPlayerSaved = Subsystem->SavePlayerActors(PlayerController, Subsystem->PlayerSaveFile());
+		return GetSaveFileSize(Subsystem->PlayerSaveFile());
+	});
+
+	if (!TestTrue(TEXT("Player save"), bPlayerSaved))
+	{
+		return false;
+	}
+
+	Pawn->Payload.Clear();
+
+	bool bPlayerFileLoaded = false;
+	State->Report.Measure(TEXT("PlayerLoad"), [&]()
+	{
+		bPlayerFileLoaded = Subsystem->TryLoadPlayerFile();
+		if (bPlayerFileLoaded)
+		{
+			Subsystem->LoadPlayerActors(PlayerController);
+		}
+		return int64(0);
+	});
+
+	TestTrue(TEXT("Player file loaded"), bPlayerFileLoaded);
+	TestTrue(TEXT("Player pawn payload after load"), Pawn->Payload.Matches(PawnSeed, PayloadSize));
+
+	//Clear the payloads, the load has to restore them from disk
+	for (const TWeakObjectPtr<ARPGSaveBenchmarkActor>& Actor : State->Actors)
+	{
+		Actor->Payload.Clear();
+
+		TArray<URPGSaveBenchmarkComponent*> Components;
+		Actor->GetComponents(Components);
+		for (URPGSaveBenchmarkComponent* Component : Components)
+		{
+			Component->Payload.Clear();
+		}
+	}
+
+	//Full reload skips the memory copy of the last save
+	URPGAsyncLoadGame* LoadTask = URPGAsyncLoadGame::AsyncLoadActors(World, ENUM_TO_FLAG(ELoadTypeFlags::LF_Level), true);
+	if (!TestNotNull(TEXT("Load task"), LoadTask))
+	{
+		return false;
+	}
+
+	LoadTask->RegisterWithGameInstance(World);
+	LoadTask->Activate();
+	State->LoadTask = LoadTask;
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		URPGAsyncLoadGame* Task = State->LoadTask.Get();
+		if (Task && Task->IsActive() && State->LoadFrames < MaxLoadFrames)
+		{
+			//Only the time spent in the world tick counts, not the rest of the engine frame
+			const double Start = FPlatformTime::Seconds();
+			State->World.Tick();
+			State->LoadMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+			State->Report.SampleMemory();
+			++State->LoadFrames;
+			return false;
+		}
+
+		if (!TestFalse(TEXT("Level load finished"), Task && Task->IsActive()))
+		{
+			Task->ForceDestroy();
+			return true;
+		}
+
+		State->Report.AddStage(TEXT("LevelLoad"), State->LoadMs);
+		AddInfo(FString::Printf(TEXT("Level load took %d frames"), State->LoadFrames));
+
+		int32 NumWrongPayloads = 0;
+		int32 NumWrongComponentPayloads = 0;
+		int32 NumNotLoaded = 0;
+		for (int32 Index = 0; Index < State->Actors.Num(); ++Index)
+		{
+			const ARPGSaveBenchmarkActor* Actor = State->Actors[Index].Get();
+			if (!Actor || Actor->NumLoaded == 0)
+			{
+				++NumNotLoaded;
+				continue;
+			}
+
+			NumWrongPayloads += !Actor->Payload.Matches(State->GetActorSeed(Index), State->PayloadSize);
+
+			for (int32 ComponentIndex = 0; ComponentIndex < State->NumComponents; ++ComponentIndex)
+			{
+				const URPGSaveBenchmarkComponent* Component = FindComponent(Actor, ComponentIndex);
+				NumWrongComponentPayloads += !Component || !Component->Payload.Matches(State->GetComponentSeed(Index, ComponentIndex), State->PayloadSize);
+			}
+		}
+
+		TestEqual(TEXT("Actors not loaded"), NumNotLoaded, 0);
+		TestEqual(TEXT("Actors with wrong payload after load"), NumWrongPayloads, 0);
+		TestEqual(TEXT("Components with wrong payload after load"), NumWrongComponentPayloads, 0);
+
+		//What the subsystem does for a World Partition cell that streams out. The cell load needs placed actors of a streamed level, which the generated world does not have.
+		if (URPGSaveSubsystem* Subsystem = State->Subsystem.Get())
+		{
+			bool bMemorySaved = false;
+			State->Report.Measure(TEXT("LevelSaveMemory"), [&]()
+			{
+				Subsystem->PrepareLoadAndSaveActors(ENUM_TO_FLAG(ESaveTypeFlags::SF_Level), EAsyncCheckType::CT_Save, EPrepareType::PT_Default);
+				bMemorySaved = Subsystem->SaveLevelActors(true);
+				return int64(0);
+			});
+			TestTrue(TEXT("Memory only level save"), bMemorySaved);
+		}
+
+		State->Report.Submit(*this);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,97 @@
+// Source/RPGSystemEditor/Private/SaveSystem/RPGSaveBenchmark.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "SaveSystem/Interface/RPGActorSaveInterface.h"
+#include "SaveSystem/Interface/RPGCompSaveInterface.h"
+#include "RPGSaveBenchmark.generated.h"
+
+/**
+Save Benchmark
+
+Automation test (RPGSystem.Benchmark.Save.RoundTrip) that spawns save actors with save components into a game world,
+saves them through the subsystem (full, delta and memory only) and loads them back with the same async load task the game uses.
+The player pawn is saved and loaded through the player file.
+Fails if a record is not restored, or if a stage got slower or larger than the baseline (see Shared/RPGBenchmark.h).
+
+Lives in the editor module, so the benchmark classes below never ship with the game.
+
+Command line:
+	-RPGSaveBenchmarkActors=2000		Level actors
+	-RPGSaveBenchmarkComponents=2		Save components per actor
+	-RPGSaveBenchmarkPayload=512		Payload bytes per actor, component and the player pawn
+**/
+
+//Seeded SaveGame bytes, so a loaded object can be checked against its seed
+USTRUCT()
+struct FRPGSaveBenchmarkPayload
+{
+	GENERATED_BODY()
+
+	//Low entropy, so compression behaves roughly like real property data
+	void Fill(const int32 InSeed, const int32 Size);
+	bool Matches(const int32 InSeed, const int32 Size) const;
+	void Clear();
+
+	UPROPERTY(SaveGame)
+	TArray<uint8> Bytes;
+
+	UPROPERTY(SaveGame)
+	int32 Seed = 0;
+};
+
+//Only spawned by the save benchmark
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class ARPGSaveBenchmarkActor : public AActor, public IRPGActorSaveInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	ARPGSaveBenchmarkActor();
+
+	virtual void ActorSaved_Implementation() override { ++NumSaved; }
+	virtual void ActorLoaded_Implementation() override { ++NumLoaded; }
+
+	UPROPERTY(SaveGame)
+	FRPGSaveBenchmarkPayload Payload;
+
+	int32 NumSaved = 0;
+	int32 NumLoaded = 0;
+};
+
+//Only added by the save benchmark, reports itself dirty for delta saving after a payload change
+UCLASS(NotBlueprintable, HideDropdown)
+class URPGSaveBenchmarkComponent : public UActorComponent, public IRPGCompSaveInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	void FillPayload(const int32 InSeed, const int32 Size);
+
+	virtual void ComponentSaved_Implementation() override { bSaveDirty = false; }
+	virtual bool ComponentSaveDirty_Implementation() override { return bSaveDirty; }
+
+	UPROPERTY(SaveGame)
+	FRPGSaveBenchmarkPayload Payload;
+
+	bool bSaveDirty = false;
+};
+
+//Only possessed by the save benchmark player
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class ARPGSaveBenchmarkPawn : public APawn, public IRPGActorSaveInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	ARPGSaveBenchmarkPawn();
+
+	UPROPERTY(SaveGame)
+	FRPGSaveBenchmarkPayload Payload;
+};
@@ -0,0 +1,29 @@
+﻿// Source/RPGSystemEditor/Public/Minimap/MinimapTileSlicer.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMinimapTileSet;
+class UTexture2D;
+
+/**
+ * 고해상도 미니맵 캡처(AMinimapCaptureActor 결과 등)를 타일 피라미드로 자르는 에디터 도구
+ * - 0단계는 원본 해상도, 다음 단계는 2x2 평균으로 절반, 타일 하나에 들어갈 때까지 반복
+ * - 타일: <원본 폴더>/<원본 이름>_Tiles/<원본 이름>_L<단계>_<X>_<Y> (TileSize x TileSize, 가장자리는 투명으로 채움)
+ * - 인덱스: <원본 폴더>/<원본 이름>_TileSet (UMinimapTileSet)
+ * 같은 원본을 다시 자르면 기존 에셋을 덮어씀, 저장은 직접 (Save All)
+ *
+ * 콘텐츠 브라우저에서 텍스처 우클릭 > Build Minimap Tile Pyramid
+ *
+ * Console:
+ *	RPGMinimap.SliceTileSize 256
+ */
+class RPGSYSTEMEDITOR_API FMinimapTileSlicer
+{
+public:
+	/** 실패하면 nullptr (원본 소스 데이터가 없거나 TileSize가 16 미만) */
+	static UMinimapTileSet* BuildTilePyramid(UTexture2D* SourceTexture, int32 TileSize);
+
+	/** 텍스처 에셋 컨텍스트 메뉴 등록 (UToolMenus 시작 콜백에서 호출) */
+	static void RegisterMenus();
+};
@@ -26,6 +26,9 @@ private:
 	TSharedRef<class SDockTab> SpawnQuestDebuggerTab(const class FSpawnTabArgs& SpawnTabArgs);     
 	TSharedRef<class SDockTab> SpawnInventoryDebuggerTab(const class FSpawnTabArgs& SpawnTabArgs); 
 private:
+	/** 콘텐츠 브라우저 메뉴 확장 (UToolMenus 시작 콜백) */
+	void RegisterMenus();
+
 	void SelectActorAtViewportCenter();
 	TSharedPtr<FUICommandList> PluginCommands;
 };
\ No newline at end of file
@@ -31,6 +31,8 @@ public class RPGSystemEditor : ModuleRules
 			"WorkspaceMenuStructure",// 메뉴 구조
 			"ToolMenus",             // 툴바/메뉴
 			"DataValidation",
+			"ImageCore",             // 미니맵 타일 슬라이서
+			"NetCore",               // 인벤토리 복제 벤치마크
 		});
 		
 		PublicIncludePaths.Add(ModuleDirectory + "/Public");